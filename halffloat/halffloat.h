@@ -0,0 +1,41 @@
+/**
+ * @file halffloat.h
+ * @brief En-tête public de la bibliothèque Half-Float (libhalffloat.a / libhalffloat.so)
+ *
+ * Regroupe les en-têtes des modules publics: inclure ce seul fichier et lier
+ * avec -lhalffloat -lm (voir 'make lib'). Seules les fonctions déclarées
+ * HF_API sont exportées par libhalffloat.so; les helpers HF_INTERNAL
+ * (decompose_half, normalize_and_round, table_interpolate...) restent cachés.
+ *
+ * Sous Windows, définir HF_SHARED avant l'inclusion pour utiliser la DLL.
+ * Une bibliothèque compilée avec HF_THREADS se lie en plus avec -lpthread.
+ *
+ * Pour la version en-tête seul, inclure halffloat_all.h à la place.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HALFFLOAT_H
+#define HALFFLOAT_H
+
+#include "hf_common.h"
+#include "hf_precalc.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_round.h"
+#include "hf_lib_misc.h"
+#include "hf_lib_conv.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_trig.h"
+#include "hf_lib_lut.h"
+#include "hf_lib_blas.h"
+#include "hf_lib_swar.h"
+#include "hf_lib_sort.h"
+#include "hf_lib_fmt.h"
+#include "hf_lib_fast.h"
+#include "hf_lib_act.h"
+#include "hf_lib_complex.h"
+#include "hf_lib_par.h"
+
+#endif //HALFFLOAT_H
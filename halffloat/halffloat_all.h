@@ -0,0 +1,58 @@
+/**
+ * @file halffloat_all.h
+ * @brief Version en-tête seul (amalgame) de la bibliothèque Half-Float
+ *
+ * Inclut toutes les sources de la bibliothèque dans l'unité de traduction
+ * courante avec HF_INLINE: chaque fonction publique est static inline et
+ * les tables constantes sont locales. Le compilateur peut alors intégrer
+ * hf_neg, decompose_half, hf_add... et propager les constantes sans -flto
+ * ni édition de liens avec la bibliothèque.
+ *
+ * Utilisation: inclure ce fichier à la place des en-têtes hf_*.h, avant tout
+ * autre en-tête de la bibliothèque, et ne compiler aucun fichier hf_*.c.
+ *
+ * Remarques :
+ *  - L'état de la bibliothèque (mode d'arrondi du thread, niveau SIMD
+ *    choisi, moteur des fonctions transcendantes, LUT activées) et les
+ *    tables sont propres à chaque unité de traduction qui inclut ce fichier:
+ *    régler le mode d'arrondi dans l'unité qui effectue les calculs.
+ *  - Les tables doivent être constantes (HF_PRECALC_RUNTIME non supporté).
+ *  - Les helpers internes des sources (static) partagent l'espace de noms de
+ *    l'unité de traduction.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HALFFLOAT_ALL_H
+#define HALFFLOAT_ALL_H
+
+#if defined(HF_COMMON_H) && !defined(HF_INLINE)
+#error "halffloat_all.h doit être inclus avant tout autre en-tête de la bibliothèque"
+#endif
+
+#ifndef HF_INLINE
+#define HF_INLINE
+#endif
+
+#include "hf_common.c"
+#include "hf_precalc.c"
+#include "hf_lib_common.c"
+#include "hf_lib_par.c"
+#include "hf_lib_arith.c"
+#include "hf_lib_round.c"
+#include "hf_lib_misc.c"
+#include "hf_lib_conv.c"
+#include "hf_lib_exp.c"
+#include "hf_lib_trig.c"
+#include "hf_lib_lut.c"
+#include "hf_lib_blas.c"
+#include "hf_lib_swar.c"
+#include "hf_lib_sort.c"
+#include "hf_lib_fmt.c"
+#include "hf_lib_fast.c"
+#include "hf_lib_act.c"
+#include "hf_lib_complex.c"
+
+#endif //HALFFLOAT_ALL_H
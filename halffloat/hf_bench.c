@@ -0,0 +1,779 @@
+/**
+ * @file hf_bench.c
+ * @brief Banc de mesure des performances de la bibliothèque Half-Float
+ *
+ * Programme autonome (cible `make bench`) qui chronomètre chaque fonction
+ * publique sur quatre jeux d'entrées de 65536 éléments: tous les motifs, un
+ * échantillon aléatoire uniforme, des nombres finis normalisés uniquement et
+ * des subnormaux non nuls uniquement.
+ * Chaque mesure est faite cache chaud (meilleure de N passes après une passe
+ * d'échauffement) et cache froid (caches évincés avant chaque passe), et
+ * rapportée en ns/op et cycles/op (compteur d'horodatage du processeur).
+ *
+ * Avec -t, les fonctions scalaires sont chronométrées appel par appel
+ * (compteur encadré de barrières lfence, coût du chronométrage retranché):
+ * pour chaque entrée la meilleure de N passes est retenue, puis le minimum,
+ * la médiane, le 99e centile et le maximum sur le jeu sont rapportés en
+ * cycles. Un écart min/max réduit indique une latence indépendante des
+ * données (voir HF_CONSTANT_TIME).
+ *
+ * Usage: hf_bench [-f fonction] [-s all|random|normal|subnormal] [-c warm|cold|both]
+ *                 [-r repetitions] [-p] [-t] [--csv|--json] [-l]
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(HF_BENCH_INLINE)
+#include "halffloat_all.h"  //Mode en-tête seul: toute la bibliothèque dans cette unité
+#endif
+#include "hf_common.h"
+#include "hf_precalc.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_blas.h"
+#include "hf_lib_conv.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_fast.h"
+#include "hf_lib_act.h"
+#include "hf_lib_complex.h"
+#include "hf_lib_misc.h"
+#include "hf_lib_round.h"
+#include "hf_lib_trig.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+//Compteur de cycles (TSC) quand il est disponible
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <x86intrin.h>
+#define HF_BENCH_HAS_CYCLES 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define HF_BENCH_HAS_CYCLES 1
+#endif
+
+//Lecture du compteur de cycles encadrée de barrières autour d'une instruction mesurée
+#ifdef HF_BENCH_HAS_CYCLES
+#define BENCH_TIMED(t0, t1, stmt) do { \
+    _mm_lfence(); (t0) = __rdtsc(); _mm_lfence(); \
+    stmt; \
+    _mm_lfence(); (t1) = __rdtsc(); \
+} while(0)
+#endif
+
+#define BENCH_N 65536                       //Nombre d'éléments par jeu d'entrées
+#define BENCH_EVICT_BYTES (64u << 20)       //Taille du tampon d'éviction des caches (64 Mio)
+#define BENCH_DEFAULT_REPS 7                //Nombre de passes chronométrées par défaut
+#define BENCH_SET_COUNT 4                   //Nombre de jeux d'entrées
+
+//Forme d'appel d'une fonction mesurée
+typedef enum {
+    KIND_UNARY,
+    KIND_BINARY,
+    KIND_TERNARY,
+    KIND_BATCH1,
+    KIND_BATCH2,
+    KIND_BATCH3,
+    KIND_DUAL,
+    KIND_DUAL_N,
+    KIND_REDUCE1,
+    KIND_REDUCE2,
+    KIND_TO_FLOAT,
+    KIND_FROM_FLOAT,
+    KIND_TO_FLOAT_N,
+    KIND_FROM_FLOAT_N
+} bench_kind;
+
+//Description d'une fonction mesurée (seul le pointeur correspondant à kind est renseigné)
+typedef struct {
+    const char *name;
+    bench_kind kind;
+    uint16_t (*unary)(uint16_t);
+    uint16_t (*binary)(uint16_t, uint16_t);
+    uint16_t (*ternary)(uint16_t, uint16_t, uint16_t);
+    void (*batch1)(const uint16_t *, uint16_t *, size_t);
+    void (*batch2)(const uint16_t *, const uint16_t *, uint16_t *, size_t);
+    void (*batch3)(const uint16_t *, const uint16_t *, const uint16_t *, uint16_t *, size_t);
+    void (*dual)(uint16_t, uint16_t *, uint16_t *);
+    void (*dual_n)(const uint16_t *, uint16_t *, uint16_t *, size_t);
+    uint16_t (*reduce1)(const uint16_t *, size_t);
+    uint16_t (*reduce2)(const uint16_t *, const uint16_t *, size_t);
+    float (*to_float)(uint16_t);
+    uint16_t (*from_float)(float);
+    void (*to_float_n)(const uint16_t *, float *, size_t);
+    void (*from_float_n)(const float *, uint16_t *, size_t);
+} bench_entry;
+
+//Jeu d'entrées (trois opérandes et leur équivalent float pour les conversions)
+typedef struct {
+    const char *name;
+    uint16_t a[BENCH_N];
+    uint16_t b[BENCH_N];
+    uint16_t c[BENCH_N];
+    float f[BENCH_N];
+} bench_set;
+
+//Format de sortie
+typedef enum {
+    OUTPUT_TEXT,
+    OUTPUT_CSV,
+    OUTPUT_JSON
+} bench_output;
+
+//Déclaration des helpers statiques
+static uint16_t bench_cmp(uint16_t hf1, uint16_t hf2);
+static uint16_t bench_ldexp(uint16_t hf1, uint16_t hf2);
+static uint16_t bench_scalbn(uint16_t hf1, uint16_t hf2);
+static uint16_t bench_remquo(uint16_t hf1, uint16_t hf2);
+static uint16_t bench_pow2(uint16_t hf);
+static uint16_t bench_pow_real(uint16_t hf);
+static uint16_t bench_powi3(uint16_t hf);
+static void bench_pow2_n(const uint16_t *a, uint16_t *out, size_t n);
+static void bench_fft_n(const uint16_t *a, uint16_t *out, size_t n);
+static uint16_t bench_modf(uint16_t hf);
+static uint16_t bench_frexp(uint16_t hf);
+static uint16_t bench_ilogb(uint16_t hf);
+static uint16_t bench_sigmoid_composed(uint16_t hf);
+static uint16_t bench_gelu_composed(uint16_t hf);
+static void fill_sets(void);
+static void run_pass(const bench_entry *entry, const bench_set *set);
+static int measure_latency(const bench_entry *entry, const bench_set *set, int reps, unsigned long long stats[4]);
+static int compare_cycles(const void *a, const void *b);
+static void evict_caches(void);
+static double now_ns(void);
+static unsigned long long now_cycles(void);
+static int name_matches(const char *name, const char *filter);
+static void print_usage(const char *prog);
+
+#define UNARY(fn)    {#fn, KIND_UNARY, .unary = fn}
+#define BINARY(fn)   {#fn, KIND_BINARY, .binary = fn}
+#define WRAP1(n, fn) {n, KIND_UNARY, .unary = fn}
+#define WRAP2(n, fn) {n, KIND_BINARY, .binary = fn}
+
+//Fonctions mesurées
+static const bench_entry bench_entries[] = {
+    //Arithmétique
+    UNARY(hf_neg), UNARY(hf_abs), BINARY(hf_add), BINARY(hf_sub), BINARY(hf_mul), BINARY(hf_div),
+    UNARY(hf_inv), UNARY(hf_sqrt), UNARY(hf_rsqrt), UNARY(hf_cbrt),
+    {"hf_fma", KIND_TERNARY, .ternary = hf_fma},
+    BINARY(hf_hypot), BINARY(hf_fmod), BINARY(hf_remainder), WRAP2("hf_remquo", bench_remquo),
+    //Opérations par lots
+    {"hf_add_n", KIND_BATCH2, .batch2 = hf_add_n},
+    {"hf_sub_n", KIND_BATCH2, .batch2 = hf_sub_n},
+    {"hf_mul_n", KIND_BATCH2, .batch2 = hf_mul_n},
+    {"hf_div_n", KIND_BATCH2, .batch2 = hf_div_n},
+    {"hf_fma_n", KIND_BATCH3, .batch3 = hf_fma_n},
+    {"hf_sqrt_n", KIND_BATCH1, .batch1 = hf_sqrt_n},
+    //Réductions (accumulateur exact)
+    {"hf_sum", KIND_REDUCE1, .reduce1 = hf_sum},
+    {"hf_dot", KIND_REDUCE2, .reduce2 = hf_dot},
+    //Conversions
+    {"float_to_half", KIND_FROM_FLOAT, .from_float = float_to_half},
+    {"half_to_float", KIND_TO_FLOAT, .to_float = half_to_float},
+    {"hf_from_float_n", KIND_FROM_FLOAT_N, .from_float_n = hf_from_float_n},
+    {"hf_to_float_n", KIND_TO_FLOAT_N, .to_float_n = hf_to_float_n},
+    //Exponentielles et logarithmes
+    BINARY(hf_pow), WRAP1("hf_pow_int", bench_pow2), WRAP1("hf_pow_real", bench_pow_real),
+    WRAP1("hf_powi", bench_powi3), {"hf_pow_n", KIND_BATCH1, .batch1 = bench_pow2_n}, UNARY(hf_exp), UNARY(hf_exp2), UNARY(hf_exp10), UNARY(hf_expm1),
+    UNARY(hf_ln), UNARY(hf_log2), UNARY(hf_log10), UNARY(hf_log1p),
+    //Trigonométrie
+    UNARY(hf_sin), UNARY(hf_cos), UNARY(hf_tan), UNARY(hf_asin), UNARY(hf_acos), UNARY(hf_atan),
+    BINARY(hf_atan2), UNARY(hf_sinh), UNARY(hf_cosh), UNARY(hf_tanh),
+    UNARY(hf_asinh), UNARY(hf_acosh), UNARY(hf_atanh),
+    //Fonctions approchées rapides
+    UNARY(hf_fast_exp), UNARY(hf_fast_ln), UNARY(hf_fast_rsqrt), UNARY(hf_fast_tanh),
+    UNARY(hf_fast_sigmoid), UNARY(hf_fast_sin), UNARY(hf_fast_cos), BINARY(hf_fast_div),
+    //Fonctions d'activation (fusionnées et composées d'opérations fp16)
+    UNARY(hf_sigmoid), UNARY(hf_silu), UNARY(hf_gelu), {"hf_softmax_n", KIND_BATCH1, .batch1 = hf_softmax_n},
+    WRAP1("sigmoid_composee", bench_sigmoid_composed), WRAP1("gelu_composee", bench_gelu_composed),
+    //Complexes (n/2 points entrelacés)
+    {"hf_fft", KIND_BATCH1, .batch1 = bench_fft_n},
+    {"hf_sincos", KIND_DUAL, .dual = hf_sincos},
+    {"hf_sinhcosh", KIND_DUAL, .dual = hf_sinhcosh},
+    {"hf_sincos_n", KIND_DUAL_N, .dual_n = hf_sincos_n},
+    {"hf_sinhcosh_n", KIND_DUAL_N, .dual_n = hf_sinhcosh_n},
+    //Arrondis
+    UNARY(hf_ceil), UNARY(hf_floor), UNARY(hf_round), UNARY(hf_trunc), UNARY(hf_int),
+    //Divers
+    WRAP2("hf_cmp", bench_cmp), BINARY(hf_min), BINARY(hf_max), BINARY(hf_copysign), BINARY(hf_nextafter),
+    WRAP1("hf_modf", bench_modf), WRAP1("hf_frexp", bench_frexp), WRAP2("hf_ldexp", bench_ldexp),
+    WRAP2("hf_scalbn", bench_scalbn), UNARY(hf_logb), WRAP1("hf_ilogb", bench_ilogb)
+};
+
+#define BENCH_ENTRY_COUNT ((int)(sizeof(bench_entries) / sizeof(bench_entries[0])))
+
+//Jeux d'entrées et tampons de sortie
+static bench_set bench_sets[BENCH_SET_COUNT];
+static uint16_t out_half[BENCH_N];
+static uint16_t out_half2[BENCH_N];
+static float out_float[BENCH_N];
+static unsigned char *evict_buffer = NULL;
+static unsigned long long latency_cycles[BENCH_N];
+static volatile unsigned int bench_sink = 0;
+
+/**
+ * @brief Point d'entrée du banc de mesure
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Tableau des arguments
+ * @return 0 en cas de succès, 1 si une option est invalide ou si le filtre ne retient aucune fonction
+ */
+int main(int argc, char *argv[]) {
+    const char *filter = NULL;
+    const char *set_filter = NULL;
+    int warm = 1, cold = 1, reps = BENCH_DEFAULT_REPS, latency = 0;
+    bench_output output = OUTPUT_TEXT;
+    int measured = 0, first = 1, i, e, s;
+
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-f") == 0 && i + 1 < argc) filter = argv[++i];
+        else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc) set_filter = argv[++i];
+        else if(strcmp(argv[i], "-r") == 0 && i + 1 < argc) reps = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            const char *cache = argv[++i];
+            warm = strcmp(cache, "cold") != 0;
+            cold = strcmp(cache, "warm") != 0;
+        }
+        else if(strcmp(argv[i], "-p") == 0) hf_engine_select(HF_ENGINE_POLY);
+        else if(strcmp(argv[i], "-t") == 0) latency = 1;
+        else if(strcmp(argv[i], "--csv") == 0) output = OUTPUT_CSV;
+        else if(strcmp(argv[i], "--json") == 0) output = OUTPUT_JSON;
+        else if(strcmp(argv[i], "-l") == 0) {
+            for(e = 0; e < BENCH_ENTRY_COUNT; e++) printf("%s\n", bench_entries[e].name);
+            return 0;
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if(reps < 1) reps = 1;
+#ifndef HF_BENCH_HAS_CYCLES
+    if(latency) {
+        fprintf(stderr, "hf_bench: -t nécessite un compteur de cycles (x86)\n");
+        return 1;
+    }
+#endif
+
+    for(e = 0; e < BENCH_ENTRY_COUNT; e++) {
+        if(filter == NULL || name_matches(bench_entries[e].name, filter)) measured++;
+    }
+    if(measured == 0) {
+        fprintf(stderr, "hf_bench: aucune fonction ne correspond à '%s' (voir -l)\n", filter);
+        return 1;
+    }
+
+    hf_precalc_init();
+    fill_sets();
+    if(latency) {
+        //Latences par appel, cache chaud, fonctions scalaires uniquement
+        unsigned long long stats[4];
+
+        if(output == OUTPUT_CSV) printf("function,set,min_cycles,p50_cycles,p99_cycles,max_cycles\n");
+        else if(output == OUTPUT_JSON) printf("[\n");
+        else printf("%-16s %-9s %8s %8s %8s %8s\n", "fonction", "entrees", "min", "p50", "p99", "max");
+
+        for(e = 0; e < BENCH_ENTRY_COUNT; e++) {
+            const bench_entry *entry = &bench_entries[e];
+
+            if(filter != NULL && !name_matches(entry->name, filter)) continue;
+
+            for(s = 0; s < BENCH_SET_COUNT; s++) {
+                const bench_set *set = &bench_sets[s];
+
+                if(set_filter != NULL && strcmp(set->name, set_filter) != 0) continue;
+                if(!measure_latency(entry, set, reps, stats)) continue;
+
+                if(output == OUTPUT_CSV) {
+                    printf("%s,%s,%llu,%llu,%llu,%llu\n", entry->name, set->name, stats[0], stats[1], stats[2], stats[3]);
+                } else if(output == OUTPUT_JSON) {
+                    printf("%s  {\"function\": \"%s\", \"set\": \"%s\", \"min_cycles\": %llu, \"p50_cycles\": %llu, \"p99_cycles\": %llu, \"max_cycles\": %llu}",
+                           first ? "" : ",\n", entry->name, set->name, stats[0], stats[1], stats[2], stats[3]);
+                } else {
+                    printf("%-16s %-9s %8llu %8llu %8llu %8llu\n", entry->name, set->name, stats[0], stats[1], stats[2], stats[3]);
+                }
+                first = 0;
+                fflush(stdout);
+            }
+        }
+
+        if(output == OUTPUT_JSON) printf("%s]\n", first ? "" : "\n");
+        return 0;
+    }
+    if(cold) {
+        evict_buffer = (unsigned char *)malloc(BENCH_EVICT_BYTES);
+        if(evict_buffer == NULL) {
+            fprintf(stderr, "hf_bench: allocation du tampon d'éviction impossible, mesures à froid ignorées\n");
+            cold = 0;
+        } else {
+            memset(evict_buffer, 1, BENCH_EVICT_BYTES);
+        }
+    }
+
+    if(output == OUTPUT_CSV) printf("function,set,cache,ns_per_op,cycles_per_op\n");
+    else if(output == OUTPUT_JSON) printf("[\n");
+    else printf("%-16s %-9s %-5s %12s %12s\n", "fonction", "entrees", "cache", "ns/op", "cycles/op");
+
+    for(e = 0; e < BENCH_ENTRY_COUNT; e++) {
+        const bench_entry *entry = &bench_entries[e];
+
+        if(filter != NULL && !name_matches(entry->name, filter)) continue;
+
+        for(s = 0; s < BENCH_SET_COUNT; s++) {
+            const bench_set *set = &bench_sets[s];
+            int pass;
+
+            if(set_filter != NULL && strcmp(set->name, set_filter) != 0) continue;
+
+            for(pass = 0; pass < 2; pass++) {
+                double best_ns = 0.0;
+                unsigned long long best_cycles = 0;
+                int r;
+
+                if((pass == 0 && !warm) || (pass == 1 && !cold)) continue;
+
+                //Passe d'échauffement (code, tables et entrées en cache)
+                if(pass == 0) run_pass(entry, set);
+
+                for(r = 0; r < reps; r++) {
+                    double t0;
+                    unsigned long long c0, cycles;
+                    double ns;
+
+                    if(pass == 1) evict_caches();
+                    t0 = now_ns();
+                    c0 = now_cycles();
+                    run_pass(entry, set);
+                    cycles = now_cycles() - c0;
+                    ns = now_ns() - t0;
+                    if(r == 0 || ns < best_ns) best_ns = ns;
+                    if(r == 0 || cycles < best_cycles) best_cycles = cycles;
+                }
+
+#ifdef HF_BENCH_HAS_CYCLES
+                if(output == OUTPUT_CSV) {
+                    printf("%s,%s,%s,%.4f,%.3f\n", entry->name, set->name, pass ? "cold" : "warm",
+                           best_ns / BENCH_N, (double)best_cycles / BENCH_N);
+                } else if(output == OUTPUT_JSON) {
+                    printf("%s  {\"function\": \"%s\", \"set\": \"%s\", \"cache\": \"%s\", \"ns_per_op\": %.4f, \"cycles_per_op\": %.3f}",
+                           first ? "" : ",\n", entry->name, set->name, pass ? "cold" : "warm",
+                           best_ns / BENCH_N, (double)best_cycles / BENCH_N);
+                } else {
+                    printf("%-16s %-9s %-5s %12.3f %12.2f\n", entry->name, set->name, pass ? "cold" : "warm",
+                           best_ns / BENCH_N, (double)best_cycles / BENCH_N);
+                }
+#else
+                if(output == OUTPUT_CSV) {
+                    printf("%s,%s,%s,%.4f,\n", entry->name, set->name, pass ? "cold" : "warm", best_ns / BENCH_N);
+                } else if(output == OUTPUT_JSON) {
+                    printf("%s  {\"function\": \"%s\", \"set\": \"%s\", \"cache\": \"%s\", \"ns_per_op\": %.4f, \"cycles_per_op\": null}",
+                           first ? "" : ",\n", entry->name, set->name, pass ? "cold" : "warm", best_ns / BENCH_N);
+                } else {
+                    printf("%-16s %-9s %-5s %12.3f %12s\n", entry->name, set->name, pass ? "cold" : "warm",
+                           best_ns / BENCH_N, "n/a");
+                }
+                (void)best_cycles;
+#endif
+                first = 0;
+                fflush(stdout);
+            }
+        }
+    }
+
+    if(output == OUTPUT_JSON) printf("%s]\n", first ? "" : "\n");
+    free(evict_buffer);
+
+    return 0;
+}
+
+/**
+ * @brief Adaptateur hf_cmp (résultat entier ramené sur 16 bits)
+ */
+static uint16_t bench_cmp(uint16_t hf1, uint16_t hf2) {
+    return (uint16_t)hf_cmp(hf1, hf2);
+}
+
+/**
+ * @brief Adaptateur hf_ldexp (exposant entier dans [-32, 31] tiré du second opérande)
+ */
+static uint16_t bench_ldexp(uint16_t hf1, uint16_t hf2) {
+    return hf_ldexp(hf1, (int)(hf2 & 63) - 32);
+}
+
+/**
+ * @brief Adaptateur hf_scalbn (exposant entier dans [-32, 31] tiré du second opérande)
+ */
+static uint16_t bench_scalbn(uint16_t hf1, uint16_t hf2) {
+    return hf_scalbn(hf1, (int)(hf2 & 63) - 32);
+}
+
+/**
+ * @brief Adaptateur hf_remquo (quotient partiel combiné au résultat)
+ */
+static uint16_t bench_remquo(uint16_t hf1, uint16_t hf2) {
+    int quo = 0;
+    uint16_t result = hf_remquo(hf1, hf2, &quo);
+    return (uint16_t)(result ^ quo);
+}
+
+/**
+ * @brief Adaptateur hf_pow à exposant entier constant (x^2)
+ */
+static uint16_t bench_pow2(uint16_t hf) {
+    return hf_pow(hf, 0x4000U);
+}
+
+/**
+ * @brief Adaptateur hf_pow à exposant quelconque constant (x^0.3, chemin ln/exp)
+ */
+static uint16_t bench_pow_real(uint16_t hf) {
+    return hf_pow(hf, 0x34CDU);
+}
+
+/**
+ * @brief Adaptateur hf_powi (x^3)
+ */
+static uint16_t bench_powi3(uint16_t hf) {
+    return hf_powi(hf, 3);
+}
+
+/**
+ * @brief Adaptateur hf_pow_n à exposant commun 2
+ */
+static void bench_pow2_n(const uint16_t *a, uint16_t *out, size_t n) {
+    hf_pow_n(a, 0x4000U, out, n);
+}
+
+/**
+ * @brief FFT directe des n/2 points entrelacés de a (copiés dans out)
+ */
+static void bench_fft_n(const uint16_t *a, uint16_t *out, size_t n) {
+    memcpy(out, a, n * sizeof(uint16_t));
+    hf_fft(out, n / 2);
+}
+
+/**
+ * @brief Sigmoïde composée d'opérations fp16 (référence de hf_sigmoid)
+ */
+static uint16_t bench_sigmoid_composed(uint16_t hf) {
+    return hf_div(HF_ONE_POS, hf_add(HF_ONE_POS, hf_exp(hf_neg(hf))));
+}
+
+/**
+ * @brief GELU (forme tanh) composée d'opérations fp16 (référence de hf_gelu)
+ */
+static uint16_t bench_gelu_composed(uint16_t hf) {
+    uint16_t cube = hf_mul(hf_mul(hf, hf), hf);
+    uint16_t inner = hf_mul(0x3A62U, hf_fma(0x29B9U, cube, hf));        //sqrt(2/pi), 0.044715
+    return hf_mul(hf_mul(0x3800U, hf), hf_add(HF_ONE_POS, hf_tanh(inner)));
+}
+
+/**
+ * @brief Adaptateur hf_modf (partie entière combinée au résultat)
+ */
+static uint16_t bench_modf(uint16_t hf) {
+    uint16_t intpart = 0;
+    uint16_t result = hf_modf(hf, &intpart);
+    return (uint16_t)(result ^ intpart);
+}
+
+/**
+ * @brief Adaptateur hf_frexp (exposant combiné au résultat)
+ */
+static uint16_t bench_frexp(uint16_t hf) {
+    int exp = 0;
+    uint16_t result = hf_frexp(hf, &exp);
+    return (uint16_t)(result ^ exp);
+}
+
+/**
+ * @brief Adaptateur hf_ilogb (résultat entier ramené sur 16 bits)
+ */
+static uint16_t bench_ilogb(uint16_t hf) {
+    return (uint16_t)hf_ilogb(hf);
+}
+
+/**
+ * @brief Prépare les jeux d'entrées (tous les motifs, aléatoire, normalisés, subnormaux)
+ */
+static void fill_sets(void) {
+    uint32_t state = 0x12345678U;
+    int s, i;
+
+    bench_sets[0].name = "all";
+    bench_sets[1].name = "random";
+    bench_sets[2].name = "normal";
+    bench_sets[3].name = "subnormal";
+
+    for(i = 0; i < BENCH_N; i++) {
+        //Tous les motifs, le second opérande étant une permutation du premier
+        bench_sets[0].a[i] = (uint16_t)i;
+        bench_sets[0].b[i] = (uint16_t)(i * 40503U + 12345U);
+        bench_sets[0].c[i] = (uint16_t)((i * 2654435761U) >> 16);
+
+        for(s = 1; s < 3; s++) {
+            uint16_t values[3];
+            int k;
+
+            for(k = 0; k < 3; k++) {
+                //Générateur xorshift32: motifs uniformes sur 16 bits
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                values[k] = (uint16_t)(state >> 16);
+
+                //Jeu normalisé: exposant biaisé ramené dans [1, 30]
+                if(s == 2) {
+                    uint32_t exp = 1 + ((values[k] >> HF_MANT_BITS) & HF_MASK_EXP) % (HF_MASK_EXP - 1);
+                    values[k] = (uint16_t)((values[k] & (HF_MASK_SIGN | HF_MASK_MANT)) | (exp << HF_MANT_BITS));
+                }
+            }
+            bench_sets[s].a[i] = values[0];
+            bench_sets[s].b[i] = values[1];
+            bench_sets[s].c[i] = values[2];
+        }
+    }
+
+    //Subnormaux: signe et mantisse non nulle aléatoires, générateur séparé
+    state = 0x9E3779B9U;
+    for(i = 0; i < BENCH_N; i++) {
+        uint16_t *slots[3];
+        int k;
+
+        slots[0] = &bench_sets[3].a[i];
+        slots[1] = &bench_sets[3].b[i];
+        slots[2] = &bench_sets[3].c[i];
+        for(k = 0; k < 3; k++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            *slots[k] = (uint16_t)(((state >> 16) & HF_MASK_SIGN) | (1U + (state >> 8) % HF_MASK_MANT));
+        }
+    }
+
+    for(s = 0; s < BENCH_SET_COUNT; s++) {
+        for(i = 0; i < BENCH_N; i++) bench_sets[s].f[i] = half_to_float(bench_sets[s].a[i]);
+    }
+}
+
+/**
+ * @brief Exécute une passe complète d'une fonction sur un jeu d'entrées
+ *
+ * @param entry Fonction mesurée
+ * @param set Jeu d'entrées
+ */
+static void run_pass(const bench_entry *entry, const bench_set *set) {
+    int i;
+
+    switch(entry->kind) {
+        case KIND_UNARY:
+            for(i = 0; i < BENCH_N; i++) out_half[i] = entry->unary(set->a[i]);
+            break;
+        case KIND_BINARY:
+            for(i = 0; i < BENCH_N; i++) out_half[i] = entry->binary(set->a[i], set->b[i]);
+            break;
+        case KIND_TERNARY:
+            for(i = 0; i < BENCH_N; i++) out_half[i] = entry->ternary(set->a[i], set->b[i], set->c[i]);
+            break;
+        case KIND_BATCH1:
+            entry->batch1(set->a, out_half, BENCH_N);
+            break;
+        case KIND_BATCH2:
+            entry->batch2(set->a, set->b, out_half, BENCH_N);
+            break;
+        case KIND_BATCH3:
+            entry->batch3(set->a, set->b, set->c, out_half, BENCH_N);
+            break;
+        case KIND_DUAL:
+            for(i = 0; i < BENCH_N; i++) entry->dual(set->a[i], &out_half[i], &out_half2[i]);
+            break;
+        case KIND_DUAL_N:
+            entry->dual_n(set->a, out_half, out_half2, BENCH_N);
+            break;
+        case KIND_REDUCE1:
+            out_half[BENCH_N / 2] = entry->reduce1(set->a, BENCH_N);
+            break;
+        case KIND_REDUCE2:
+            out_half[BENCH_N / 2] = entry->reduce2(set->a, set->b, BENCH_N);
+            break;
+        case KIND_TO_FLOAT:
+            for(i = 0; i < BENCH_N; i++) out_float[i] = entry->to_float(set->a[i]);
+            break;
+        case KIND_FROM_FLOAT:
+            for(i = 0; i < BENCH_N; i++) out_half[i] = entry->from_float(set->f[i]);
+            break;
+        case KIND_TO_FLOAT_N:
+            entry->to_float_n(set->a, out_float, BENCH_N);
+            break;
+        case KIND_FROM_FLOAT_N:
+            entry->from_float_n(set->f, out_half, BENCH_N);
+            break;
+        default:
+            break;
+    }
+
+    bench_sink += out_half[BENCH_N / 2] + out_half2[BENCH_N / 2] + (unsigned int)out_float[BENCH_N / 3];
+}
+
+/**
+ * @brief Mesure la latence par appel d'une fonction scalaire sur un jeu d'entrées
+ *
+ * Chaque appel est chronométré séparément; le coût du chronométrage seul
+ * (minimum sur le jeu) est retranché. Pour chaque entrée, la meilleure des
+ * reps passes est retenue afin d'écarter interruptions et migrations.
+ *
+ * @param entry Fonction mesurée
+ * @param set Jeu d'entrées
+ * @param reps Nombre de passes
+ * @param stats Minimum, médiane, 99e centile et maximum en cycles
+ * @return 1 si la fonction a été mesurée, 0 si elle n'est pas scalaire
+ */
+static int measure_latency(const bench_entry *entry, const bench_set *set, int reps, unsigned long long stats[4]) {
+    int result = 0;
+
+#ifdef HF_BENCH_HAS_CYCLES
+    switch(entry->kind) {
+        case KIND_UNARY:
+        case KIND_BINARY:
+        case KIND_TERNARY:
+        case KIND_DUAL:
+        case KIND_TO_FLOAT:
+        case KIND_FROM_FLOAT:
+            result = 1;
+            break;
+        default:
+            break;
+    }
+
+    if(result) {
+        unsigned long long overhead = ~0ULL, t0 = 0, t1 = 0;
+        int r, i;
+
+        //Coût du chronométrage seul
+        for(i = 0; i < BENCH_N; i++) {
+            BENCH_TIMED(t0, t1, (void)0);
+            if(t1 - t0 < overhead) overhead = t1 - t0;
+        }
+
+        //Passe d'échauffement, puis meilleure latence par entrée
+        run_pass(entry, set);
+        for(i = 0; i < BENCH_N; i++) latency_cycles[i] = ~0ULL;
+        for(r = 0; r < reps; r++) {
+            for(i = 0; i < BENCH_N; i++) {
+                uint16_t a = set->a[i], b = set->b[i], c = set->c[i];
+                float f = set->f[i];
+
+                switch(entry->kind) {
+                    case KIND_UNARY:      BENCH_TIMED(t0, t1, out_half[i] = entry->unary(a)); break;
+                    case KIND_BINARY:     BENCH_TIMED(t0, t1, out_half[i] = entry->binary(a, b)); break;
+                    case KIND_TERNARY:    BENCH_TIMED(t0, t1, out_half[i] = entry->ternary(a, b, c)); break;
+                    case KIND_DUAL:       BENCH_TIMED(t0, t1, entry->dual(a, &out_half[i], &out_half2[i])); break;
+                    case KIND_TO_FLOAT:   BENCH_TIMED(t0, t1, out_float[i] = entry->to_float(a)); break;
+                    case KIND_FROM_FLOAT: BENCH_TIMED(t0, t1, out_half[i] = entry->from_float(f)); break;
+                    default: break;
+                }
+                t1 -= t0;
+                t1 = (t1 > overhead) ? t1 - overhead : 0;
+                if(t1 < latency_cycles[i]) latency_cycles[i] = t1;
+            }
+        }
+
+        qsort(latency_cycles, BENCH_N, sizeof(latency_cycles[0]), compare_cycles);
+        stats[0] = latency_cycles[0];
+        stats[1] = latency_cycles[BENCH_N / 2];
+        stats[2] = latency_cycles[(BENCH_N / 100) * 99];
+        stats[3] = latency_cycles[BENCH_N - 1];
+        bench_sink += out_half[BENCH_N / 2] + out_half2[BENCH_N / 2] + (unsigned int)out_float[BENCH_N / 3];
+    }
+#else
+    (void)entry;
+    (void)set;
+    (void)reps;
+    (void)stats;
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Comparaison de deux durées en cycles pour qsort()
+ */
+static int compare_cycles(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *)a, y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Évince les caches de données en parcourant un grand tampon
+ */
+static void evict_caches(void) {
+    unsigned int sum = 0;
+    size_t i;
+
+    for(i = 0; i < BENCH_EVICT_BYTES; i += 64) {
+        evict_buffer[i]++;
+        sum += evict_buffer[i];
+    }
+
+    bench_sink += sum;
+}
+
+/**
+ * @brief Horloge monotone en nanosecondes
+ */
+static double now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Compteur de cycles du processeur (0 s'il n'est pas disponible)
+ */
+static unsigned long long now_cycles(void) {
+#ifdef HF_BENCH_HAS_CYCLES
+    return (unsigned long long)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Vrai si le nom correspond au filtre (avec ou sans le préfixe "hf_")
+ */
+static int name_matches(const char *name, const char *filter) {
+    return strcmp(name, filter) == 0 || (strncmp(name, "hf_", 3) == 0 && strcmp(name + 3, filter) == 0);
+}
+
+/**
+ * @brief Affiche l'aide de la ligne de commande
+ */
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [-f fonction] [-s all|random|normal|subnormal] [-c warm|cold|both]\n"
+        "          [-r repetitions] [-p] [-t] [--csv|--json] [-l]\n"
+        "  -f  ne mesure que la fonction indiquee (ex: hf_sin ou sin)\n"
+        "  -s  ne mesure que le jeu d'entrees indique\n"
+        "  -c  cache chaud, froid ou les deux (defaut: both)\n"
+        "  -r  nombre de passes chronometrees, la meilleure est retenue (defaut: %d)\n"
+        "  -p  moteur polynomial des fonctions transcendantes (defaut: HF_ENGINE_DEFAULT)\n"
+        "  -t  latence par appel des fonctions scalaires: min, p50, p99, max en cycles\n"
+        "  -l  liste les fonctions mesurables\n",
+        prog, BENCH_DEFAULT_REPS);
+}
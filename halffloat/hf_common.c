@@ -13,55 +13,92 @@
 
 #include "hf_common.h"
 #include <stddef.h>
+#include <stdio.h>
 
 //Variable globale pour le mode d'arrondi
-static hf_rounding_mode current_rounding_mode = HF_ROUND_NEAREST_EVEN;
+static HF_THREAD_LOCAL hf_rounding_mode current_rounding_mode = HF_ROUND_NEAREST_EVEN;
 
-//Fonction interne pour décider de l'arrondi
-static int should_round_up(uint32_t round_bits, uint32_t lsb, uint16_t sign);
+//Indicateurs d'exception cumulés du thread (HF_FE_*)
+#if !defined(HF_NO_FENV)
+HF_DATA HF_THREAD_LOCAL unsigned int hf_fe_status = 0;
+#endif
+
+//Compteurs de profilage du thread (HF_PROFILE)
+#if defined(HF_PROFILE)
+HF_DATA HF_THREAD_LOCAL hf_profile_counters hf_profile_state;
+#endif
+
+//Déclaration des helpers statiques
+static void profile_print_rule(int width);
+
+//Moteur des fonctions transcendantes (lu en ligne par les noyaux de hf_lib_common.h, HF_ATOMIC_LOAD)
+HF_DATA hf_engine hf_engine_current = HF_ENGINE_DEFAULT;
+
+//Zéros de tête de chaque octet (hf_clz32 sans intrinsèque)
+#if !defined(HF_CLZ_INTRINSIC)
+HF_DATA const uint8_t hf_clz_table[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+#endif
 
 /**
- * @brief Convertit un float en demi-flottant (16 bits)
+ * @brief Convertit un float en demi-flottant (16 bits) selon le mode d'arrondi du thread
+ *
+ * Arrondi IEEE 754 dans les cinq modes, identique bit à bit à vcvtps2ph (F16C)
+ * dans les quatre modes qu'il connaît (voir float_bits_to_half_inline).
  *
  * @param f Le float à convertir
  * @return La valeur uint16_t correspondante au demi-flottant
  */
 uint16_t float_to_half(float f) {
     union { float f; uint32_t u; } conv = {f};
-    uint32_t bits = conv.u;
-    uint32_t sign = (bits >> 31) & 0x1;
-    int32_t exp = ((bits >> 23) & 0xFF) - 127; //exposant débiaisé float32
-    uint32_t mant = bits & 0x7FFFFF; //mantisse float32 (23 bits)
-    uint16_t result = (uint16_t)(sign << HF_SIGN_BITS);
-    
-    if(exp > HF_EXP_BIAS) {
-        //Overflow -> inf ou NaN
-        result |= mant != 0 ? HF_NAN : HF_INFINITY_POS;
-    }
-    else if(exp > HF_EXP_MIN) {
-        //Valeur normalisée
-        unsigned int exp_biased = exp + HF_EXP_BIAS;
-        mant = mant + 0x1000; //Arrondi (bit à la position 12 du float)
-
-        //Gestion débordement mantisse
-        if(mant & 0x800000) {
-            mant = 0;
-            exp_biased++;
-        }
-        
-        //Vérifier overflow après arrondi
-        result |= (exp_biased > HF_MASK_EXP) ? HF_INFINITY_POS : (exp_biased << HF_MANT_BITS) | (mant >> 13);
-    }
-    else if(exp >= (HF_EXP_MIN - HF_MANT_BITS - 1)) {
-        //Valeur subnormale: exposants très petits nécessitant un décalage
-        //pour récupérer la mantisse significative (bornes dépendant de HF_MANT_BITS)
-        uint32_t shift = (uint32_t)(HF_EXP_MIN - exp);
-        mant = (mant | 0x800000) >> shift; //Ajouter bit implicite et décaler
-        mant = (mant + 0x1000) >> 13; //Arrondi puis extraction des 10 bits
-        result |= mant;
+    hf_rounding_mode mode = current_rounding_mode;
+    unsigned int flags = 0;
+    uint16_t result;
+
+    //Mode par défaut traité en ligne, sans passer par la table de dispatch
+    if(mode == HF_ROUND_NEAREST_EVEN) {
+        result = float_bits_to_half_inline(conv.u, &flags, HF_ROUND_NEAREST_EVEN);
+        HF_FE_RAISE(flags);
+        HF_PROFILE_FN(HF_PROF_FLOAT_TO_HALF, result);
+    } else {
+        result = float_to_half_r(f, mode);
     }
-    //else: Trop petit -> 0 (déjà initialisé avec juste le signe)
-    
+
+    return result;
+}
+
+/**
+ * @brief Convertit un float en demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param f Le float à convertir
+ * @param mode Mode d'arrondi à appliquer
+ * @return La valeur uint16_t correspondante au demi-flottant
+ */
+uint16_t float_to_half_r(float f, hf_rounding_mode mode) {
+    union { float f; uint32_t u; } conv = {f};
+    unsigned int flags = 0;
+    uint16_t result;
+
+    DISPATCH_ROUNDING_MODE_RET(result, mode, float_bits_to_half_inline, conv.u, &flags);
+    HF_FE_RAISE(flags);
+    HF_PROFILE_FN(HF_PROF_FLOAT_TO_HALF, result);
+
     return result;
 }
 
@@ -78,6 +115,19 @@ float half_to_float(uint16_t hf) {
     uint32_t mant = hf & HF_MASK_MANT;
     uint32_t f_bits = sign;
     
+    HF_PROFILE_FN(HF_PROF_HALF_TO_FLOAT, hf);
+
+#if defined(HF_CONSTANT_TIME)
+    {
+        //Les trois encodages sont calculés puis choisis par masque
+        int shift = hf_ct_clz32(mant | 1U) - (31 - HF_MANT_BITS);
+        uint32_t normal = ((exp + 112) << 23) | (mant << 13);
+        uint32_t subnormal = (((uint32_t)(113 - shift) << 23) | (((mant << shift) & HF_MASK_MANT) << 13)) & (0U - (mant != 0));
+        uint32_t special = 0x7F800000U | (mant << 13) | ((uint32_t)(mant != 0) << 22);
+
+        f_bits |= hf_ct_select(exp == HF_MASK_EXP, special, hf_ct_select(exp == 0, subnormal, normal));
+    }
+#else
     if(exp == HF_MASK_EXP) {
         //Infini ou NaN
         f_bits |= 0x7F800000U;
@@ -86,13 +136,9 @@ float half_to_float(uint16_t hf) {
         if(mant != 0) f_bits |= (mant << 13) | 0x400000U;
     } else if(exp == 0) {
         if(mant != 0) {
-            //Subnormal: normaliser pour float32
-            int32_t shift = 0;
-            while(!(mant & (1U << HF_MANT_BITS))) {
-                mant <<= 1;
-                shift++;
-            }
-            mant &= HF_MASK_MANT;
+            //Subnormal: normaliser pour float32 (bit de poids fort amené au bit implicite)
+            int32_t shift = hf_clz32(mant) - (31 - HF_MANT_BITS);
+            mant = (mant << shift) & HF_MASK_MANT;
             exp = 113 - shift;
             f_bits |= (exp << 23) | (mant << 13);
         }
@@ -102,6 +148,7 @@ float half_to_float(uint16_t hf) {
         //exp_float = exp_half + (127 - 15) = exp_half + 112
         f_bits |= ((exp + 112) << 23) | (mant << 13);
     }
+#endif
     
     conv.u = f_bits;
     return conv.f;
@@ -154,27 +201,7 @@ bool_t is_subnormal(const half_float *hf) {
  * @return La structure half_float correspondante
  */
 half_float decompose_half(uint16_t hf) {
-    half_float result;
-    int exp = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
-   
-    result.sign = hf & HF_MASK_SIGN;
-    result.mant = (hf & HF_MASK_MANT) << HF_PRECISION_SHIFT;
-   
-    if(exp == 0) {
-        //Subnormal: stocker l'exposant réel des subnormaux (HF_EXP_MIN == -14)
-        result.exp = HF_EXP_MIN;
-    }
-    else if(exp == HF_MASK_EXP) {
-        //Infini ou NaN
-        result.exp = HF_EXP_FULL;
-    }
-    else {
-        //Nombre normalisé: débiaiser l'exposant et ajouter bit implicite
-        result.exp = exp - HF_EXP_BIAS;
-        result.mant |= HF_MANT_NORM_MIN;
-    }
-   
-    return result;
+    return decompose_fmt(hf, HF_FORMAT_FP16);
 }
 
 /**
@@ -184,28 +211,7 @@ half_float decompose_half(uint16_t hf) {
  * @return La valeur uint16_t correspondante
  */
 uint16_t compose_half(const half_float *hf) {
-    //Initialisation avec le bit de signe (0x0000 ou 0x8000)
-    uint16_t result = hf->sign;
-
-    //Gestion des cas spéciaux
-    if(hf->exp == HF_EXP_FULL) {
-        //Cas infini ou NaN: si mantisse non nulle, c'est NaN, sinon infini
-        result |= (hf->mant != 0 ? HF_NAN : HF_INFINITY_POS);
-    } else if(hf->mant & HF_MANT_NORM_MIN) {
-        //Cas normalisé: bit implicite présent dans la mantisse
-        //Encoder l'exposant avec le biais et écrire la mantisse sans le bit implicite
-        uint16_t exp_bits = (hf->exp + HF_EXP_BIAS) & HF_MASK_EXP;
-        uint16_t mant_bits = (hf->mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT;
-        result |= (exp_bits << HF_MANT_BITS) | mant_bits;
-    } else {
-        //Cas subnormal: pas de bit implicite, extraire les bits bruts de la mantisse
-        //Utilise le même décalage de précision que dans decompose_half pour symétrie
-        uint16_t mant_bits = (hf->mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT;
-        result |= mant_bits;
-    }
-
-    //Cas zéro par défaut: seul le signe est préservé
-    return result;
+    return compose_fmt(hf, HF_FORMAT_FP16);
 }
 
 /**
@@ -250,67 +256,29 @@ void align_mantissas(half_float *hf1, half_float *hf2) {
  * 
  * Cette fonction normalise la mantisse d'un demi-flottant pour s'assurer
  * qu'elle est dans la plage correcte et ajuste l'exposant en conséquence.
- * Elle effectue également un arrondi selon la méthode round-to-nearest, ties to even.
+ * Elle effectue également un arrondi selon le mode d'arrondi global.
  *
  * @param result Pointeur vers le demi-flottant à normaliser et arrondir
  */
 void normalize_and_round(half_float *result) {
-    //NORMALISATION
-    if(result->mant != 0) {
-        //Positionner rapidement le bit le plus significatif 
-        int shift = 24, margin;
-        uint32_t temp = result->mant;
-       
-        //Trouver rapidement la position du MSB (dichotomie + affinage)
-        if(temp > 0x00FFFFFFU) shift = 0;
-        else if(temp > 0x0000FFFFU) shift = 8;
-        else if(temp > 0x000000FFU) shift = 16;
-        temp <<= shift;
-        while((int32_t)temp > 0) {temp <<= 1; shift++;}
-       
-        //Calculer décalage pour placer MSB au bit 15
-        shift -= HF_MANT_SHIFT + 1; //16 = 10 (mantisse) + 5 (précision)
-
-        //Limiter le décalage pour ne pas passer sous HF_EXP_MIN
-        margin = result->exp - HF_EXP_MIN;
-        if(shift > margin) shift = margin;
-       
-        //Application de la normalisation
-        if(shift > 0) result->mant <<= shift;
-        else if(shift < 0) result->mant >>= -shift;
-        result->exp -= shift;
-
-        //ARRONDI selon le mode configuré
-        if(result->mant & HF_GUARD_BIT) {
-            uint32_t round_bits = result->mant & HF_ROUND_BIT_MASK;
-            uint32_t lsb = result->mant & (1U << HF_PRECISION_SHIFT);
-            
-            if(should_round_up(round_bits, lsb, result->sign)) {
-                result->mant += (1U << HF_PRECISION_SHIFT);
-                if(result->mant >= HF_MANT_NORM_MAX) {
-                    result->mant >>= 1;
-                    result->exp++;
-                }
-            }
-        }
-    }
+    normalize_and_round_mode(result, current_rounding_mode);
+}
 
-    //GESTION DES CAS LIMITES
-    if(result->exp > HF_EXP_BIAS) {
-        //Overflow -> Infini
-        result->exp = HF_EXP_FULL;
-        result->mant = 0;
-    }
-    else if(result->exp < HF_EXP_MIN) {
-        //Underflow: créer subnormal ou zéro
-        int shift = HF_EXP_MIN - result->exp;
-        result->mant = (shift < HF_MANT_SHIFT + 1) ? (result->mant + (1U << (shift - 1))) >> shift : 0;
-        result->exp = HF_EXP_MIN;
-    }
-    //Sinon exp == HF_EXP_MIN: subnormal déjà bien positionné, rien à faire
+/**
+ * @brief Normalise et arrondit avec un mode d'arrondi explicite
+ * 
+ * Variante de normalize_and_round() qui reçoit le mode d'arrondi en paramètre
+ * au lieu de lire le mode global. Les noyaux par lots lisent ainsi le mode
+ * une seule fois pour tout le tableau.
+ *
+ * @param result Pointeur vers le demi-flottant à normaliser et arrondir
+ * @param mode Mode d'arrondi à appliquer
+ */
+void normalize_and_round_mode(half_float *result, hf_rounding_mode mode) {
+    unsigned int flags = 0;
 
-    //NETTOYAGE
-    result->mant &= ~HF_ROUND_BIT_MASK;
+    DISPATCH_ROUNDING_MODE(mode, normalize_and_round_inline, result, &flags);
+    HF_FE_RAISE(flags);
 }
 
 /**
@@ -318,22 +286,21 @@ void normalize_and_round(half_float *result) {
  * 
  * Cette fonction normalise une mantisse dénormalisée en décalant la mantisse
  * vers la gauche et en décrémentant l'exposant jusqu'à ce que la mantisse
- * soit normalisée (bit implicite défini).
+ * soit normalisée (bit implicite défini), en un seul décalage compté par
+ * hf_clz32().
  *
  * @param hf Pointeur vers la structure half_float à normaliser
  */
 void normalize_denormalized_mantissa(half_float *hf) {
-    if(hf->mant != 0) {
-        while(hf->mant <= (HF_MANT_NORM_MIN >> 1)) {
-            hf->mant <<= 1;
-            hf->exp--;
-        }
-    }
+    normalize_mantissa_inline(hf);
 }
 
 /**
- * @brief Définit le mode d'arrondi global
+ * @brief Définit le mode d'arrondi du thread appelant
  * 
+ * Chaque thread possède son propre mode (HF_ROUND_NEAREST_EVEN au démarrage),
+ * sauf si la bibliothèque est compilée avec HF_NO_THREAD_LOCAL.
+ *
  * @param mode Le nouveau mode d'arrondi à utiliser
  */
 void hf_set_rounding_mode(hf_rounding_mode mode) {
@@ -341,7 +308,7 @@ void hf_set_rounding_mode(hf_rounding_mode mode) {
 }
 
 /**
- * @brief Récupère le mode d'arrondi actuel
+ * @brief Récupère le mode d'arrondi du thread appelant
  * 
  * @return Le mode d'arrondi actuellement configuré
  */
@@ -350,37 +317,262 @@ hf_rounding_mode hf_get_rounding_mode(void) {
 }
 
 /**
- * @brief Détermine si un arrondi vers le haut est nécessaire
- * 
- * @param round_bits Bits de garde/arrondi (HF_ROUND_BIT_MASK)
- * @param lsb Least Significant Bit de la mantisse finale
- * @param sign Signe du nombre (0 = positif, HF_MASK_SIGN = négatif)
- * @return 1 si arrondi vers le haut, 0 sinon
+ * @brief Choisit le moteur des fonctions transcendantes
+ *
+ * HF_ENGINE_TABLE interpole les tables précalculées, HF_ENGINE_POLY évalue des
+ * polynômes minimax en virgule fixe (aucun accès mémoire, sans branchement,
+ * vectorisable). Le réglage est commun à tous les threads et lu ou écrit
+ * atomiquement (HF_ATOMIC_LOAD/HF_ATOMIC_STORE): le changer pendant qu'un
+ * autre thread calcule ne rend pas ses résultats faux, seulement issus de
+ * l'un ou l'autre moteur.
+ *
+ * @param engine Moteur souhaité
+ * @return 1 si le moteur a été retenu, 0 s'il est inconnu (sélection inchangée)
+ */
+int hf_engine_select(hf_engine engine) {
+    int result = engine == HF_ENGINE_TABLE || engine == HF_ENGINE_POLY;
+
+    if(result) HF_ATOMIC_STORE(hf_engine_current, engine);
+
+    return result;
+}
+
+/**
+ * @brief Renvoie le moteur des fonctions transcendantes en service
+ *
+ * @return Moteur actif (HF_ENGINE_DEFAULT au démarrage)
+ */
+hf_engine hf_engine_selected(void) {
+    return HF_ATOMIC_LOAD(hf_engine_current);
+}
+
+/**
+ * @brief Renvoie le nom d'un moteur des fonctions transcendantes
+ *
+ * @param engine Moteur
+ * @return Chaîne constante décrivant le moteur
+ */
+const char *hf_engine_name(hf_engine engine) {
+    const char *result = "inconnu";
+
+    switch(engine) {
+        case HF_ENGINE_TABLE: result = "tables"; break;
+        case HF_ENGINE_POLY:  result = "polynomes"; break;
+        default: break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Efface des indicateurs d'exception du thread appelant
+ *
+ * @param excepts Indicateurs à effacer (combinaison de HF_FE_*)
+ */
+void hf_feclearexcept(unsigned int excepts) {
+#if defined(HF_NO_FENV)
+    (void)excepts;
+#else
+    hf_fe_status &= ~excepts;
+#endif
+}
+
+/**
+ * @brief Lève des indicateurs d'exception du thread appelant
+ *
+ * Les indicateurs sont cumulatifs: ils restent levés jusqu'à hf_feclearexcept().
+ *
+ * @param excepts Indicateurs à lever (combinaison de HF_FE_*)
+ */
+void hf_feraiseexcept(unsigned int excepts) {
+    HF_FE_RAISE(excepts & HF_FE_ALL_EXCEPT);
+}
+
+/**
+ * @brief Teste des indicateurs d'exception du thread appelant
+ *
+ * @param excepts Indicateurs à tester (combinaison de HF_FE_*)
+ * @return Le sous-ensemble de excepts actuellement levé (0 avec HF_NO_FENV)
  */
-static int should_round_up(uint32_t round_bits, uint32_t lsb, uint16_t sign) {
+unsigned int hf_fetestexcept(unsigned int excepts) {
+    unsigned int result = 0;
+
+#if defined(HF_NO_FENV)
+    (void)excepts;
+#else
+    result = hf_fe_status & excepts;
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Indique si la bibliothèque a été compilée avec HF_PROFILE
+ *
+ * @return 1 si les compteurs de profilage sont actifs, 0 sinon
+ */
+int hf_profile_enabled(void) {
     int result = 0;
-    
-    switch(current_rounding_mode) {
-        case HF_ROUND_NEAREST_EVEN:
-            result = (round_bits > HF_GUARD_BIT) || (round_bits == HF_GUARD_BIT && lsb);
-            break;
-            
-        case HF_ROUND_NEAREST_UP:
-            result = (round_bits >= HF_GUARD_BIT);
-            break;
-
-        case HF_ROUND_TOWARD_POS_INF:
-            result = (!sign && round_bits);
-            break;
-            
-        case HF_ROUND_TOWARD_NEG_INF:
-            result = (sign && round_bits);
-            break;
-            
-        case HF_ROUND_TOWARD_ZERO:
-        default:
-            break;
+
+#if defined(HF_PROFILE)
+    result = 1;
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Copie les compteurs de profilage du thread appelant
+ *
+ * Sans HF_PROFILE, tous les compteurs copiés sont nuls.
+ *
+ * @param out Destination des compteurs
+ */
+void hf_profile_snapshot(hf_profile_counters *out) {
+    if(out) {
+#if defined(HF_PROFILE)
+        *out = hf_profile_state;
+#else
+        static const hf_profile_counters zero;
+        *out = zero;
+#endif
     }
-    
+}
+
+/**
+ * @brief Remet à zéro les compteurs de profilage du thread appelant
+ */
+void hf_profile_reset(void) {
+#if defined(HF_PROFILE)
+    static const hf_profile_counters zero;
+    hf_profile_state = zero;
+#endif
+}
+
+/**
+ * @brief Nom lisible d'une fonction profilée
+ *
+ * @param fn Identifiant de la fonction
+ * @return Nom de la fonction ("inconnu" hors bornes)
+ */
+const char *hf_profile_fn_name(hf_profile_fn fn) {
+    static const char *const names[HF_PROF_FN_COUNT] = {
+        "hf_add", "hf_mul", "hf_div", "hf_inv", "hf_sqrt", "hf_rsqrt", "hf_fma",
+        "hf_sin", "hf_cos", "hf_sincos", "hf_tan", "hf_asin", "hf_acos", "hf_atan", "hf_atan2",
+        "hf_sinh", "hf_cosh", "hf_tanh", "hf_exp", "hf_exp2",
+        "hf_ln", "hf_log2", "hf_log10", "hf_pow",
+        "float_to_half", "half_to_float", "arith_n", "conv_n",
+        "hf_cbrt", "hf_hypot", "hf_fmod", "hf_exp10", "hf_expm1", "hf_log1p", "hf_powi",
+        "hf_asinh", "hf_acosh", "hf_atanh", "hf_sinhcosh", "arrondis entiers", "divers",
+        "double_to_half", "half_to_double", "int_to_half", "half_to_int",
+        "hf_fast_*", "activations", "math_n", "blas", "swar", "tri_n",
+        "complexes", "fft", "bf16/fp8", "bf16/fp8_n", "lut_n"
+    };
+    const char *result = "inconnu";
+
+    if((unsigned int)fn < HF_PROF_FN_COUNT) result = names[fn];
+
+    return result;
+}
+
+/**
+ * @brief Nom lisible d'un chemin interne profilé
+ *
+ * @param path Identifiant du chemin
+ * @return Nom du chemin ("inconnu" hors bornes)
+ */
+const char *hf_profile_path_name(hf_profile_path path) {
+    static const char *const names[HF_PROF_PATH_COUNT] = {
+        "arrondi", "arrondi sous-normal", "arrondi vers zero", "arrondi debordement",
+        "noyau table", "noyau polynome"
+    };
+    const char *result = "inconnu";
+
+    if((unsigned int)path < HF_PROF_PATH_COUNT) result = names[path];
+
+    return result;
+}
+
+/**
+ * @brief Nom lisible d'une table interpolée
+ *
+ * @param table Identifiant de la table
+ * @return Nom de la table ("inconnu" hors bornes)
+ */
+const char *hf_profile_table_name(hf_profile_table table) {
+    static const char *const names[HF_PROF_TABLE_COUNT] = {
+        "sin", "asin", "atan", "ln", "exp", "tan", "autre"
+    };
+    const char *result = "inconnu";
+
+    if((unsigned int)table < HF_PROF_TABLE_COUNT) result = names[table];
+
     return result;
 }
+
+/**
+ * @brief Affiche une ligne de séparation de width tirets
+ *
+ * @param width Nombre de tirets
+ */
+static void profile_print_rule(int width) {
+    int i;
+
+    for(i = 0; i < width; i++) putchar('-');
+    putchar('\n');
+}
+
+/**
+ * @brief Affiche des compteurs de profilage sur la sortie standard
+ *
+ * Même présentation que print_formatted_table (hf_tests.c): titre, en-têtes,
+ * ligne de tirets puis une ligne par entrée; les lignes entièrement nulles
+ * sont omises.
+ *
+ * @param counters Compteurs à afficher (relevés par hf_profile_snapshot)
+ */
+void hf_profile_print(const hf_profile_counters *counters) {
+    static const char *const class_headers[HF_PROF_CLASS_COUNT] = {"Appels", "Speciaux", "Zeros", "Sous-norm"};
+    const int name_width = 20;
+    const int col_width = 12;
+    int i, j;
+
+    if(counters) {
+        printf("\n=== Profil: fonctions ===\n");
+        printf("%-*s", name_width + 2, "Fonction");
+        for(j = 0; j < HF_PROF_CLASS_COUNT; j++) printf("%-*s", col_width + 2, class_headers[j]);
+        printf("\n");
+        profile_print_rule(name_width + 2 + HF_PROF_CLASS_COUNT * (col_width + 2));
+        for(i = 0; i < HF_PROF_FN_COUNT; i++) {
+            if(counters->fn[i][HF_PROF_CALLS]) {
+                printf("%-*s", name_width + 2, hf_profile_fn_name((hf_profile_fn)i));
+                for(j = 0; j < HF_PROF_CLASS_COUNT; j++) printf("%-*llu", col_width + 2, (unsigned long long)counters->fn[i][j]);
+                printf("\n");
+            }
+        }
+
+        printf("\n=== Profil: chemins internes ===\n");
+        printf("%-*s%-*s\n", name_width + 2, "Chemin", col_width + 2, "Passages");
+        profile_print_rule(name_width + 2 + col_width + 2);
+        for(i = 0; i < HF_PROF_PATH_COUNT; i++) {
+            printf("%-*s%-*llu\n", name_width + 2, hf_profile_path_name((hf_profile_path)i),
+                   col_width + 2, (unsigned long long)counters->path[i]);
+        }
+
+        printf("\n=== Profil: lectures de tables (8 tranches d'indices) ===\n");
+        printf("%-*s", name_width + 2, "Table");
+        for(j = 0; j < HF_PROFILE_BUCKETS; j++) printf("%-*d", col_width + 2, j);
+        printf("\n");
+        profile_print_rule(name_width + 2 + HF_PROFILE_BUCKETS * (col_width + 2));
+        for(i = 0; i < HF_PROF_TABLE_COUNT; i++) {
+            uint64_t total = 0;
+
+            for(j = 0; j < HF_PROFILE_BUCKETS; j++) total += counters->table[i][j];
+            if(total) {
+                printf("%-*s", name_width + 2, hf_profile_table_name((hf_profile_table)i));
+                for(j = 0; j < HF_PROFILE_BUCKETS; j++) printf("%-*llu", col_width + 2, (unsigned long long)counters->table[i][j]);
+                printf("\n");
+            }
+        }
+    }
+}
@@ -20,6 +20,8 @@
 
 #include <math.h>
 
+typedef unsigned char uint8_t;
+typedef signed char int8_t;
 typedef unsigned short uint16_t;
 typedef signed short int16_t;
 typedef unsigned int uint32_t;
@@ -28,6 +30,78 @@ typedef unsigned int bool_t;
 typedef unsigned long long uint64_t;
 typedef signed long long int64_t;
 
+//Stockage local au thread (mode d'arrondi courant, un par thread)
+#if defined(HF_NO_THREAD_LOCAL)
+#define HF_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define HF_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define HF_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define HF_THREAD_LOCAL _Thread_local
+#else
+#define HF_THREAD_LOCAL
+#endif
+
+//Accès atomiques (ordre relâché) aux sélections globales lues par tous les threads:
+//chaque lecture voit l'ancienne ou la nouvelle valeur, jamais un mélange
+#if defined(__GNUC__)
+#define HF_ATOMIC_LOAD(var) __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#define HF_ATOMIC_STORE(var, value) __atomic_store_n(&(var), (value), __ATOMIC_RELAXED)
+#else
+//Pointeurs et entiers alignés: lus et écrits en une seule instruction
+#define HF_ATOMIC_LOAD(var) (var)
+#define HF_ATOMIC_STORE(var, value) ((var) = (value))
+#endif
+
+//Intégration forcée des noyaux génériques: format et mode y sont des constantes
+//à chaque appel, leurs tests disparaissent seulement si le corps est intégré
+#if defined(_MSC_VER)
+#define HF_ALWAYS_INLINE __forceinline
+#elif defined(__GNUC__)
+#define HF_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define HF_ALWAYS_INLINE inline
+#endif
+
+//Mode en-tête seul (HF_INLINE, défini par halffloat_all.h): fonctions et tables
+//sont internes à chaque unité de traduction, sans appel ni édition de liens
+//Bibliothèque (make lib, -fvisibility=hidden): HF_API marque l'API exportée,
+//HF_INTERNAL les helpers partagés entre sources qui restent cachés dans
+//libhalffloat.so. Sous Windows, HF_BUILD_SHARED construit la DLL et HF_SHARED
+//l'importe.
+#if defined(HF_INLINE)
+#define HF_API static inline
+#define HF_INTERNAL static inline
+#define HF_DATA static
+#define HF_DATA_DECL static
+#else
+#if defined(_WIN32) && defined(HF_BUILD_SHARED)
+#define HF_API __declspec(dllexport)
+#elif defined(_WIN32) && defined(HF_SHARED)
+#define HF_API __declspec(dllimport)
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define HF_API __attribute__((visibility("default")))
+#else
+#define HF_API
+#endif
+#if defined(__GNUC__) && __GNUC__ >= 4 && !defined(_WIN32)
+#define HF_INTERNAL __attribute__((visibility("hidden")))
+#else
+#define HF_INTERNAL
+#endif
+#define HF_DATA
+#define HF_DATA_DECL extern
+#endif
+
+//Indicateurs d'exception IEEE 754 (cumulatifs, propres à chaque thread)
+#define HF_FE_INVALID       0x01U                               //Opération invalide (résultat NaN, NaN signalant)
+#define HF_FE_DIVBYZERO     0x02U                               //Division d'un fini non nul par zéro
+#define HF_FE_OVERFLOW      0x04U                               //Résultat arrondi au-delà de 65504
+#define HF_FE_UNDERFLOW     0x08U                               //Résultat minuscule (< 2^-14 avant arrondi) et inexact
+#define HF_FE_INEXACT       0x10U                               //Résultat arrondi différent de la valeur exacte
+#define HF_FE_ALL_EXCEPT    0x1FU                               //Tous les indicateurs
+
 //Modes d'arrondi IEEE 754
 typedef enum {
     HF_ROUND_NEAREST_EVEN = 0,    //Round to nearest, ties to even (par défaut)
@@ -37,6 +111,17 @@ typedef enum {
     HF_ROUND_TOWARD_NEG_INF = 4   //Round toward -inf (plancher)
 } hf_rounding_mode;
 
+//Moteurs des fonctions transcendantes (sin/cos, atan, exp, ln et leurs dérivées)
+typedef enum {
+    HF_ENGINE_TABLE = 0,          //Tables précalculées interpolées (par défaut)
+    HF_ENGINE_POLY = 1            //Polynômes minimax en virgule fixe, sans table
+} hf_engine;
+
+//Moteur actif au démarrage (ex: -DHF_ENGINE_DEFAULT=HF_ENGINE_POLY)
+#ifndef HF_ENGINE_DEFAULT
+#define HF_ENGINE_DEFAULT HF_ENGINE_TABLE
+#endif
+
 //Définitions du format fp16
 #define HF_SIGN_BITS 15                                         //Position du bit de signe
 #define HF_EXP_BITS 5                                           //Nombre de bits pour l'exposant
@@ -55,6 +140,36 @@ typedef enum {
 #define HF_ONE_POS          (HF_EXP_BIAS << HF_MANT_BITS)       //Valeur demi-flottante pour +1.0
 #define HF_ONE_NEG          (HF_ONE_POS | HF_MASK_SIGN)         //Valeur demi-flottante pour -1.0
 
+//Formats flottants courts partageant le noyau decompose/normalize/compose.
+//Dans la représentation interne (half_float), le bit implicite occupe toujours
+//le bit HF_MANT_SHIFT: seuls le nombre de bits de précision sous le dernier bit
+//de mantisse et la plage d'exposant dépendent du format.
+typedef enum {
+    HF_FORMAT_FP16 = 0,     //IEEE 754 binary16: 5 bits d'exposant (biais 15), 10 bits de mantisse
+    HF_FORMAT_BF16 = 1,     //bfloat16: 8 bits d'exposant (biais 127), 7 bits de mantisse
+    HF_FORMAT_E4M3 = 2,     //FP8 E4M3 (OCP): 4 bits (biais 7), 3 bits, sans infini, NaN = S.1111.111
+    HF_FORMAT_E5M2 = 3      //FP8 E5M2: 5 bits (biais 15), 2 bits, infinis et NaN IEEE
+} hf_format;
+
+//Paramètres d'un format (expressions constantes quand fmt l'est)
+#define HF_FMT_EXP_BITS(fmt)    ((fmt) == HF_FORMAT_BF16 ? 8 : (fmt) == HF_FORMAT_E4M3 ? 4 : 5)
+#define HF_FMT_MANT_BITS(fmt)   ((fmt) == HF_FORMAT_BF16 ? 7 : (fmt) == HF_FORMAT_E4M3 ? 3 : (fmt) == HF_FORMAT_E5M2 ? 2 : 10)
+#define HF_FMT_BITS(fmt)        (1 + HF_FMT_EXP_BITS(fmt) + HF_FMT_MANT_BITS(fmt))     //16 ou 8
+#define HF_FMT_EXP_BIAS(fmt)    ((1 << (HF_FMT_EXP_BITS(fmt) - 1)) - 1)
+#define HF_FMT_FINITE_ONLY(fmt) ((fmt) == HF_FORMAT_E4M3)                               //Ni infini, ni NaN signalant
+#define HF_FMT_MASK_SIGN(fmt)   (1U << (HF_FMT_BITS(fmt) - 1))
+#define HF_FMT_MASK_EXP(fmt)    ((1U << HF_FMT_EXP_BITS(fmt)) - 1)
+#define HF_FMT_MASK_MANT(fmt)   ((1U << HF_FMT_MANT_BITS(fmt)) - 1)
+#define HF_FMT_INFINITY(fmt)    (HF_FMT_FINITE_ONLY(fmt) ? HF_FMT_NAN(fmt) : HF_FMT_MASK_EXP(fmt) << HF_FMT_MANT_BITS(fmt))
+#define HF_FMT_NAN(fmt)         ((HF_FMT_MASK_EXP(fmt) << HF_FMT_MANT_BITS(fmt)) | (HF_FMT_FINITE_ONLY(fmt) ? HF_FMT_MASK_MANT(fmt) : 1U << (HF_FMT_MANT_BITS(fmt) - 1)))
+#define HF_FMT_PRECISION_SHIFT(fmt) (HF_MANT_SHIFT - HF_FMT_MANT_BITS(fmt))            //5, 8, 12 ou 13
+#define HF_FMT_EXP_MIN(fmt)     (1 - HF_FMT_EXP_BIAS(fmt))                             //Exposant des subnormaux
+#define HF_FMT_EXP_MAX(fmt)     (HF_FMT_EXP_BIAS(fmt) + HF_FMT_FINITE_ONLY(fmt))       //Plus grand exposant fini
+#define HF_FMT_EXP_FULL(fmt)    (HF_FMT_EXP_MAX(fmt) + 1)                              //Marque infini/NaN interne
+//Sélection par masques dans float_bits_to_fmt_inline: boucles par lots vectorisées (bf16, E5M2);
+//comparaisons ailleurs, plus rapides en scalaire (fp16 a ses noyaux SIMD, E4M3 n'est pas vectorisé)
+#define HF_FMT_MASK_SELECT(fmt) ((fmt) == HF_FORMAT_BF16 || (fmt) == HF_FORMAT_E5M2)
+
 //Quelques définitions pour la gestion interne
 #define HF_PRECISION_SHIFT  5                                   //Décalage pour la précision
 #define HF_MANT_SHIFT       (HF_MANT_BITS + HF_PRECISION_SHIFT) //Décalage total mantisse (15)
@@ -81,26 +196,704 @@ typedef struct {
 } half_float;
 
 //Conversion entre float et demi-flottant
-uint16_t float_to_half(float f);
-float half_to_float(uint16_t hf);
+HF_API uint16_t float_to_half(float f);
+HF_API uint16_t float_to_half_r(float f, hf_rounding_mode mode);
+HF_API float half_to_float(uint16_t hf);
 
 //Statut du demi-flottant
-bool_t is_infinity(const half_float *hf);
-bool_t is_nan(const half_float *hf);
-bool_t is_zero(const half_float *hf);
-bool_t is_subnormal(const half_float *hf);
+HF_INTERNAL bool_t is_infinity(const half_float *hf);
+HF_INTERNAL bool_t is_nan(const half_float *hf);
+HF_INTERNAL bool_t is_zero(const half_float *hf);
+HF_INTERNAL bool_t is_subnormal(const half_float *hf);
 
 //Décomposition et composition de demi-flottants
-half_float decompose_half(uint16_t hf);
-uint16_t compose_half(const half_float *hf);
+HF_INTERNAL half_float decompose_half(uint16_t hf);
+HF_INTERNAL uint16_t compose_half(const half_float *hf);
 
 //Fonctions pour gérer les mantisses et exposants
-void align_mantissas(half_float *hf1, half_float *hf2);
-void normalize_and_round(half_float *result);
-void normalize_denormalized_mantissa(half_float *hf);
+HF_INTERNAL void align_mantissas(half_float *hf1, half_float *hf2);
+HF_INTERNAL void normalize_and_round(half_float *result);
+HF_INTERNAL void normalize_and_round_mode(half_float *result, hf_rounding_mode mode);
+HF_INTERNAL void normalize_denormalized_mantissa(half_float *hf);
+
+//Gestion du mode d'arrondi (propre à chaque thread, HF_ROUND_NEAREST_EVEN au démarrage)
+HF_API void hf_set_rounding_mode(hf_rounding_mode mode);
+HF_API hf_rounding_mode hf_get_rounding_mode(void);
+
+//Choix du moteur des fonctions transcendantes (commun à tous les threads, accès atomiques)
+HF_API int hf_engine_select(hf_engine engine);
+HF_API hf_engine hf_engine_selected(void);
+HF_API const char *hf_engine_name(hf_engine engine);
+HF_DATA_DECL hf_engine hf_engine_current;
+
+//Indicateurs d'exception du thread appelant (toujours nuls avec HF_NO_FENV)
+HF_API void hf_feclearexcept(unsigned int excepts);
+HF_API void hf_feraiseexcept(unsigned int excepts);
+HF_API unsigned int hf_fetestexcept(unsigned int excepts);
+
+//Les noyaux cumulent leurs exceptions dans un mot local (HF_FE_ACCUM) et le
+//publient d'un seul accès au mot du thread (HF_FE_RAISE), une fois par appel
+//ou par bloc. HF_NO_FENV supprime entièrement ce suivi à la compilation.
+#if defined(HF_NO_FENV)
+#define HF_FE_ACCUM(acc, excepts) ((void)(acc), (void)(excepts))
+#define HF_FE_RAISE(excepts) ((void)(excepts))
+#else
+HF_DATA_DECL HF_THREAD_LOCAL unsigned int hf_fe_status;
+#define HF_FE_ACCUM(acc, excepts) (*(acc) |= (excepts))
+#define HF_FE_RAISE(excepts) (hf_fe_status |= (excepts))
+#endif
+
+//Profilage (HF_PROFILE): compteurs propres à chaque thread, relevés par
+//hf_profile_snapshot(). Sans HF_PROFILE, les macros HF_PROFILE_* ne génèrent
+//aucun code et hf_profile_snapshot() renvoie des compteurs nuls.
+//Chaque point d'entrée public de calcul est compté dans une entrée de
+//hf_profile_fn, seul ou par famille (hf_fast_*, BLAS, SWAR, bf16/FP8...).
+//Les classes d'opérandes ne sont relevées que pour les opérandes fp16
+//scalaires; les familles par lots comptent des éléments, celles des
+//complexes et des formats bf16/FP8 des appels seuls.
+typedef enum {
+    HF_PROF_ADD = 0,                        //hf_add/hf_sub(_r)
+    HF_PROF_MUL,
+    HF_PROF_DIV,
+    HF_PROF_INV,
+    HF_PROF_SQRT,
+    HF_PROF_RSQRT,
+    HF_PROF_FMA,
+    HF_PROF_SIN,
+    HF_PROF_COS,
+    HF_PROF_SINCOS,
+    HF_PROF_TAN,
+    HF_PROF_ASIN,
+    HF_PROF_ACOS,
+    HF_PROF_ATAN,
+    HF_PROF_ATAN2,
+    HF_PROF_SINH,
+    HF_PROF_COSH,
+    HF_PROF_TANH,
+    HF_PROF_EXP,
+    HF_PROF_EXP2,
+    HF_PROF_LN,
+    HF_PROF_LOG2,
+    HF_PROF_LOG10,
+    HF_PROF_POW,
+    HF_PROF_FLOAT_TO_HALF,                  //Classe du résultat fp16
+    HF_PROF_HALF_TO_FLOAT,
+    HF_PROF_ARITH_N,                        //Éléments des noyaux par lots hf_*_n de hf_lib_arith
+    HF_PROF_CONV_N,                         //Éléments des conversions par lots
+    HF_PROF_CBRT,
+    HF_PROF_HYPOT,
+    HF_PROF_FMOD,                           //hf_fmod/hf_remainder/hf_remquo
+    HF_PROF_EXP10,
+    HF_PROF_EXPM1,
+    HF_PROF_LOG1P,
+    HF_PROF_POWI,
+    HF_PROF_ASINH,
+    HF_PROF_ACOSH,
+    HF_PROF_ATANH,
+    HF_PROF_SINHCOSH,
+    HF_PROF_ROUND_INT,                      //hf_ceil/floor/round/trunc/int/nearbyint/rint
+    HF_PROF_MISC,                           //Signe, comparaisons, min/max, décomposition, classification
+    HF_PROF_DOUBLE_TO_HALF,                 //Classe du résultat fp16
+    HF_PROF_HALF_TO_DOUBLE,
+    HF_PROF_INT_TO_HALF,                    //Classe du résultat fp16
+    HF_PROF_HALF_TO_INT,
+    HF_PROF_FAST,                           //hf_fast_*
+    HF_PROF_ACT,                            //hf_sigmoid/hf_silu/hf_gelu
+    HF_PROF_MATH_N,                         //Éléments de hf_pow_n, hf_sincos_n, hf_sinhcosh_n, hf_softmax_n
+    HF_PROF_BLAS,                           //Termes accumulés (m*n pour hf_gemv, m*n*k pour hf_gemm)
+    HF_PROF_SWAR,                           //Voies des opérations hf2_*/hf4_* (hors assemblage, accès et sélection)
+    HF_PROF_SORT_N,                         //Éléments de tri, recherche et classification par lots
+    HF_PROF_COMPLEX,                        //Appels hf_c*
+    HF_PROF_FFT,                            //Points de hf_fft/hf_ifft
+    HF_PROF_FMT,                            //Appels scalaires bf16/FP8
+    HF_PROF_FMT_N,                          //Éléments des conversions bf16/FP8 par lots
+    HF_PROF_LUT_N,                          //Éléments lus dans une table (hf_unary(_n), hf_lut_eval_n)
+    HF_PROF_FN_COUNT
+} hf_profile_fn;
+
+//Classes d'opérandes comptées pour chaque fonction (une seule par appel, la première qui s'applique)
+typedef enum {
+    HF_PROF_CALLS = 0,                      //Appels (éléments pour les noyaux par lots)
+    HF_PROF_SPECIAL,                        //Au moins un opérande NaN ou infini
+    HF_PROF_ZERO,                           //Sinon, au moins un opérande nul
+    HF_PROF_SUBNORMAL,                      //Sinon, au moins un opérande sous-normal
+    HF_PROF_CLASS_COUNT
+} hf_profile_class;
+
+//Chemins internes
+typedef enum {
+    HF_PROF_ROUND = 0,                      //Arrondis fp16 (normalize_and_round)
+    HF_PROF_ROUND_SUBNORMAL,                //... dont le résultat est sous-normal
+    HF_PROF_ROUND_ZERO,                     //... dont le résultat est un zéro par soupassement
+    HF_PROF_ROUND_OVERFLOW,                 //... dont le résultat dépasse le plus grand fini
+    HF_PROF_KERNEL_TABLE,                   //Noyaux Q15 servis par les tables (sin, atan, ln)
+    HF_PROF_KERNEL_POLY,                    //Noyaux Q15 servis par le moteur polynomial
+    HF_PROF_PATH_COUNT
+} hf_profile_path;
+
+//Tables interpolées (histogramme des indices lus par table_interpolate*)
+typedef enum {
+    HF_PROF_TABLE_SIN = 0,
+    HF_PROF_TABLE_ASIN,
+    HF_PROF_TABLE_ATAN,
+    HF_PROF_TABLE_LN,
+    HF_PROF_TABLE_EXP,
+    HF_PROF_TABLE_TAN,
+    HF_PROF_TABLE_OTHER,
+    HF_PROF_TABLE_COUNT
+} hf_profile_table;
+
+#define HF_PROFILE_BUCKETS 8                //Tranches d'indices égales par table
+
+typedef struct {
+    uint64_t fn[HF_PROF_FN_COUNT][HF_PROF_CLASS_COUNT];
+    uint64_t path[HF_PROF_PATH_COUNT];
+    uint64_t table[HF_PROF_TABLE_COUNT][HF_PROFILE_BUCKETS];
+} hf_profile_counters;
+
+HF_API int hf_profile_enabled(void);                            //1 si compilé avec HF_PROFILE
+HF_API void hf_profile_snapshot(hf_profile_counters *out);     //Copie des compteurs du thread appelant
+HF_API void hf_profile_reset(void);                             //Remise à zéro des compteurs du thread appelant
+HF_API const char *hf_profile_fn_name(hf_profile_fn fn);
+HF_API const char *hf_profile_path_name(hf_profile_path path);
+HF_API const char *hf_profile_table_name(hf_profile_table table);
+HF_API void hf_profile_print(const hf_profile_counters *counters);  //Tableaux sur la sortie standard
+
+#if defined(HF_PROFILE)
+HF_DATA_DECL HF_THREAD_LOCAL hf_profile_counters hf_profile_state;
+#define HF_PROFILE_FN(fn, hf) hf_profile_count((fn), (uint16_t)(hf), (uint16_t)(hf), (uint16_t)(hf))
+#define HF_PROFILE_FN2(fn, hf1, hf2) hf_profile_count((fn), (uint16_t)(hf1), (uint16_t)(hf2), (uint16_t)(hf2))
+#define HF_PROFILE_FN3(fn, hf1, hf2, hf3) hf_profile_count((fn), (uint16_t)(hf1), (uint16_t)(hf2), (uint16_t)(hf3))
+#define HF_PROFILE_CALLS(id, n) (hf_profile_state.fn[(id)][HF_PROF_CALLS] += (uint64_t)(n))
+#define HF_PROFILE_PATH(id) (hf_profile_state.path[(id)]++)
+#define HF_PROFILE_TABLE(id, index, size) \
+    (hf_profile_state.table[(id)][(uint64_t)(index) * HF_PROFILE_BUCKETS / (uint64_t)(size)]++)
+
+/**
+ * @brief Compte un appel et la classe de ses opérandes (voir hf_profile_class)
+ *
+ * @param fn Fonction comptée
+ * @param hf1 Premier opérande
+ * @param hf2 Deuxième opérande (hf1 répété pour une fonction unaire)
+ * @param hf3 Troisième opérande (hf2 répété pour une fonction binaire)
+ */
+static inline void hf_profile_count(hf_profile_fn fn, uint16_t hf1, uint16_t hf2, uint16_t hf3) {
+    uint64_t *counts = hf_profile_state.fn[fn];
+    uint32_t abs1 = hf1 & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t abs2 = hf2 & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t abs3 = hf3 & ~HF_MASK_SIGN & 0xFFFFU;
+
+    counts[HF_PROF_CALLS]++;
+    if(abs1 >= HF_INFINITY_POS || abs2 >= HF_INFINITY_POS || abs3 >= HF_INFINITY_POS) counts[HF_PROF_SPECIAL]++;
+    else if(!abs1 || !abs2 || !abs3) counts[HF_PROF_ZERO]++;
+    else if(abs1 <= HF_MASK_MANT || abs2 <= HF_MASK_MANT || abs3 <= HF_MASK_MANT) counts[HF_PROF_SUBNORMAL]++;
+}
+#else
+#define HF_PROFILE_FN(fn, hf) ((void)0)
+#define HF_PROFILE_FN2(fn, hf1, hf2) ((void)0)
+#define HF_PROFILE_FN3(fn, hf1, hf2, hf3) ((void)0)
+#define HF_PROFILE_CALLS(id, n) ((void)0)
+#define HF_PROFILE_PATH(id) ((void)0)
+#define HF_PROFILE_TABLE(id, index, size) ((void)0)
+#endif
+
+//Appelle fn(..., mode) avec le mode d'arrondi sous forme de constante,
+//ce qui permet au compilateur de spécialiser le code appelé pour chaque mode
+#define DISPATCH_ROUNDING_MODE(mode, fn, ...) do { \
+    switch(mode) { \
+        case HF_ROUND_NEAREST_EVEN:   fn(__VA_ARGS__, HF_ROUND_NEAREST_EVEN); break; \
+        case HF_ROUND_NEAREST_UP:     fn(__VA_ARGS__, HF_ROUND_NEAREST_UP); break; \
+        case HF_ROUND_TOWARD_ZERO:    fn(__VA_ARGS__, HF_ROUND_TOWARD_ZERO); break; \
+        case HF_ROUND_TOWARD_POS_INF: fn(__VA_ARGS__, HF_ROUND_TOWARD_POS_INF); break; \
+        case HF_ROUND_TOWARD_NEG_INF: fn(__VA_ARGS__, HF_ROUND_TOWARD_NEG_INF); break; \
+        default:                      fn(__VA_ARGS__, mode); break; \
+    } \
+} while(0)
+
+//Variante de DISPATCH_ROUNDING_MODE qui range la valeur renvoyée par fn dans result
+#define DISPATCH_ROUNDING_MODE_RET(result, mode, fn, ...) do { \
+    switch(mode) { \
+        case HF_ROUND_NEAREST_EVEN:   (result) = fn(__VA_ARGS__, HF_ROUND_NEAREST_EVEN); break; \
+        case HF_ROUND_NEAREST_UP:     (result) = fn(__VA_ARGS__, HF_ROUND_NEAREST_UP); break; \
+        case HF_ROUND_TOWARD_ZERO:    (result) = fn(__VA_ARGS__, HF_ROUND_TOWARD_ZERO); break; \
+        case HF_ROUND_TOWARD_POS_INF: (result) = fn(__VA_ARGS__, HF_ROUND_TOWARD_POS_INF); break; \
+        case HF_ROUND_TOWARD_NEG_INF: (result) = fn(__VA_ARGS__, HF_ROUND_TOWARD_NEG_INF); break; \
+        default:                      (result) = fn(__VA_ARGS__, mode); break; \
+    } \
+} while(0)
+
+/**
+ * @brief Détermine si un arrondi vers le haut est nécessaire (bit de garde explicite)
+ *
+ * Définie inline pour que les boucles qui reçoivent un mode constant
+ * puissent éliminer le switch à la compilation.
+ *
+ * @param round_bits Bits situés sous le dernier bit de mantisse (garde, arrondi, collant)
+ * @param guard_bit Poids du bit de garde (demi-ULP)
+ * @param lsb Least Significant Bit de la mantisse finale
+ * @param sign Signe du nombre (0 = positif, HF_MASK_SIGN = négatif)
+ * @param mode Mode d'arrondi à appliquer
+ * @return 1 si arrondi vers le haut, 0 sinon
+ */
+static HF_ALWAYS_INLINE int should_round_up_guard(uint32_t round_bits, uint32_t guard_bit, uint32_t lsb, uint16_t sign, hf_rounding_mode mode) {
+    int result = 0;
+    
+    switch(mode) {
+        case HF_ROUND_NEAREST_EVEN:
+            result = (round_bits > guard_bit) || (round_bits == guard_bit && lsb);
+            break;
+            
+        case HF_ROUND_NEAREST_UP:
+            result = (round_bits >= guard_bit);
+            break;
+
+        case HF_ROUND_TOWARD_POS_INF:
+            result = (!sign && round_bits);
+            break;
+            
+        case HF_ROUND_TOWARD_NEG_INF:
+            result = (sign && round_bits);
+            break;
+            
+        case HF_ROUND_TOWARD_ZERO:
+        default:
+            break;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Détermine si un arrondi vers le haut est nécessaire
+ * 
+ * @param round_bits Bits de garde/arrondi (HF_ROUND_BIT_MASK)
+ * @param lsb Least Significant Bit de la mantisse finale
+ * @param sign Signe du nombre (0 = positif, HF_MASK_SIGN = négatif)
+ * @param mode Mode d'arrondi à appliquer
+ * @return 1 si arrondi vers le haut, 0 sinon
+ */
+static inline int should_round_up(uint32_t round_bits, uint32_t lsb, uint16_t sign, hf_rounding_mode mode) {
+    return should_round_up_guard(round_bits, HF_GUARD_BIT, lsb, sign, mode);
+}
+
+//Comptage des zéros de tête (argument non nul), normalisation en un seul
+//décalage: instruction du processeur (__builtin_clz, _BitScanReverse)
+//ou, sans intrinsèque connue (68000, compilateurs C99 stricts) et avec
+//HF_CLZ_PORTABLE, deux tests et une table de 256 entrées indexée par octet
+#if !defined(HF_CLZ_PORTABLE) && defined(_MSC_VER)
+#include <intrin.h>
+#define HF_CLZ_INTRINSIC 1
+#elif !defined(HF_CLZ_PORTABLE) && defined(__GNUC__)
+#define HF_CLZ_INTRINSIC 1
+#else
+HF_DATA_DECL const uint8_t hf_clz_table[256];
+#endif
+
+/**
+ * @brief Nombre de zéros de tête d'un entier 32 bits non nul
+ *
+ * @param x Valeur non nulle
+ * @return Nombre de zéros de tête (0 à 31)
+ */
+static HF_ALWAYS_INLINE int hf_clz32(uint32_t x) {
+#if defined(HF_CLZ_INTRINSIC) && defined(_MSC_VER)
+    unsigned long index;
+
+    _BitScanReverse(&index, x);
+    return 31 - (int)index;
+#elif defined(HF_CLZ_INTRINSIC)
+    return __builtin_clz(x);
+#else
+    int n = 0;
+
+    //Octet de poids fort non nul amené en tête, puis table
+    if(x < (1U << 16)) {n = 16; x <<= 16;}
+    if(x < (1U << 24)) {n += 8; x <<= 8;}
+    return n + hf_clz_table[x >> 24];
+#endif
+}
+
+/**
+ * @brief Nombre de zéros de tête d'un entier 64 bits non nul
+ *
+ * @param x Valeur non nulle
+ * @return Nombre de zéros de tête (0 à 63)
+ */
+static HF_ALWAYS_INLINE int hf_clz64(uint64_t x) {
+#if defined(HF_CLZ_INTRINSIC) && defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+
+    _BitScanReverse64(&index, x);
+    return 63 - (int)index;
+#elif defined(HF_CLZ_INTRINSIC) && defined(__GNUC__)
+    return __builtin_clzll(x);
+#else
+    uint32_t high = (uint32_t)(x >> 32);
+
+    return high != 0 ? hf_clz32(high) : 32 + hf_clz32((uint32_t)x);
+#endif
+}
+
+/**
+ * @brief Normalise une mantisse non nulle (bit implicite au bit HF_MANT_SHIFT)
+ *
+ * Version inline de normalize_denormalized_mantissa(): un seul décalage,
+ * quelle que soit la profondeur du subnormal.
+ *
+ * @param hf Pointeur vers le nombre (mantisse inférieure à HF_MANT_NORM_MAX)
+ */
+static HF_ALWAYS_INLINE void normalize_mantissa_inline(half_float *hf) {
+    if(hf->mant != 0 && hf->mant < HF_MANT_NORM_MIN) {
+        int shift = hf_clz32((uint32_t)hf->mant) - (31 - HF_MANT_SHIFT);
+
+        hf->mant <<= shift;
+        hf->exp -= shift;
+    }
+}
+
+//HF_CONSTANT_TIME: hf_add/sub/mul/div/sqrt (et leurs versions par lots) et
+//half_to_float exécutent la même suite d'opérations pour tous les opérandes:
+//normalisation par comptage des zéros de tête, boucles de longueur fixe,
+//cas spéciaux calculés en parallèle et choisis par masque.
+#if defined(HF_CONSTANT_TIME)
+/**
+ * @brief Nombre de zéros de tête d'un entier 32 bits non nul, en temps constant
+ *
+ * @param x Valeur non nulle
+ * @return Nombre de zéros de tête (0 à 31)
+ */
+static HF_ALWAYS_INLINE int hf_ct_clz32(uint32_t x) {
+#if defined(HF_CLZ_INTRINSIC)
+    return hf_clz32(x);
+#else
+    int n = 0, step;
+
+    //Dichotomie sans branchement ni accès à la table (dont l'adresse dépend de x)
+    step = (x < (1U << 16)) << 4; n += step; x <<= step;
+    step = (x < (1U << 24)) << 3; n += step; x <<= step;
+    step = (x < (1U << 28)) << 2; n += step; x <<= step;
+    step = (x < (1U << 30)) << 1; n += step; x <<= step;
+    return n + (x < (1U << 31));
+#endif
+}
+
+/**
+ * @brief Sélection par masque: a si cond vaut 1, b si cond vaut 0
+ *
+ * @param cond Condition (0 ou 1)
+ * @param a Valeur retenue si cond vaut 1
+ * @param b Valeur retenue si cond vaut 0
+ * @return a ou b, sans branchement
+ */
+static HF_ALWAYS_INLINE uint32_t hf_ct_select(uint32_t cond, uint32_t a, uint32_t b) {
+    uint32_t mask = 0U - cond;
+    return (a & mask) | (b & ~mask);
+}
+#endif
+
+/**
+ * @brief Décompose le motif binaire d'un format court (version inline)
+ *
+ * Le bit implicite est placé au bit HF_MANT_SHIFT quel que soit le format,
+ * suivi de HF_FMT_PRECISION_SHIFT(fmt) bits de précision nuls. Avec un format
+ * constant, le code obtenu est celui d'un décodeur dédié.
+ *
+ * @param bits Motif binaire (16 bits, ou 8 bits pour FP8)
+ * @param fmt Format du motif
+ * @return La structure half_float correspondante
+ */
+static HF_ALWAYS_INLINE half_float decompose_fmt(uint16_t bits, hf_format fmt) {
+    half_float result;
+    uint32_t exp = ((uint32_t)bits >> HF_FMT_MANT_BITS(fmt)) & HF_FMT_MASK_EXP(fmt);
+    uint32_t mant = bits & HF_FMT_MASK_MANT(fmt);
+
+    result.sign = (uint16_t)(((uint32_t)bits << (16 - HF_FMT_BITS(fmt))) & HF_MASK_SIGN);
+    result.mant = (int32_t)(mant << HF_FMT_PRECISION_SHIFT(fmt));
+
+    if(exp == 0) {
+        //Subnormal: stocker l'exposant réel des subnormaux
+        result.exp = HF_FMT_EXP_MIN(fmt);
+    }
+    else if(exp == HF_FMT_MASK_EXP(fmt) && (!HF_FMT_FINITE_ONLY(fmt) || mant == HF_FMT_MASK_MANT(fmt))) {
+        //Infini ou NaN (E4M3: seul S.1111.111 est spécial)
+        result.exp = HF_FMT_EXP_FULL(fmt);
+    }
+    else {
+        //Nombre normalisé: débiaiser l'exposant et ajouter bit implicite
+        result.exp = (int)exp - HF_FMT_EXP_BIAS(fmt);
+        result.mant |= HF_MANT_NORM_MIN;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compose le motif binaire d'un format court (version inline)
+ *
+ * Les NaN sont rendus sous leur forme canonique silencieuse, l'infini
+ * d'un format sans infini (E4M3) devient NaN.
+ *
+ * @param hf La structure half_float à composer (normalisée et arrondie)
+ * @param fmt Format du résultat
+ * @return Le motif binaire (16 bits, ou 8 bits pour FP8)
+ */
+static HF_ALWAYS_INLINE uint16_t compose_fmt(const half_float *hf, hf_format fmt) {
+    uint32_t result = (uint32_t)hf->sign >> (16 - HF_FMT_BITS(fmt));
+    uint32_t mant_bits = ((uint32_t)hf->mant >> HF_FMT_PRECISION_SHIFT(fmt)) & HF_FMT_MASK_MANT(fmt);
+
+    if(hf->exp == HF_FMT_EXP_FULL(fmt)) {
+        //Cas infini ou NaN: si mantisse non nulle, c'est NaN, sinon infini
+        result |= (hf->mant != 0 ? HF_FMT_NAN(fmt) : HF_FMT_INFINITY(fmt));
+    } else if(hf->mant & HF_MANT_NORM_MIN) {
+        //Cas normalisé: exposant biaisé et mantisse sans le bit implicite
+        result |= ((uint32_t)(hf->exp + HF_FMT_EXP_BIAS(fmt)) & HF_FMT_MASK_EXP(fmt)) << HF_FMT_MANT_BITS(fmt) | mant_bits;
+    } else {
+        //Cas subnormal ou zéro: bits bruts de la mantisse
+        result |= mant_bits;
+    }
+
+    return (uint16_t)result;
+}
+
+/**
+ * @brief Normalise et arrondit dans un format court (version inline)
+ *
+ * Noyau commun à tous les formats: la mantisse est ramenée au bit
+ * HF_MANT_SHIFT, arrondie au dernier bit du format fmt, puis l'exposant est
+ * borné à la plage du format (subnormaux, dépassement vers l'infini ou le
+ * plus grand fini selon le mode; NaN pour E4M3 qui n'a pas d'infini).
+ * Appelée avec un mode et un format constants, elle est spécialisée par le
+ * compilateur: aucun test du mode ni du format ne subsiste.
+ * Les exceptions (inexact, dépassement, soupassement) sont cumulées dans
+ * *flags; la petitesse est évaluée avant l'arrondi.
+ *
+ * @param result Pointeur vers le nombre à normaliser et arrondir
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param fmt Format cible
+ * @param mode Mode d'arrondi à appliquer
+ */
+static HF_ALWAYS_INLINE void normalize_and_round_fmt(half_float *result, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    const int precision = HF_FMT_PRECISION_SHIFT(fmt);
+    const uint32_t round_mask = (1U << precision) - 1U;
+    const uint32_t max_mant = HF_MANT_NORM_MAX - ((1U + HF_FMT_FINITE_ONLY(fmt)) << precision);
+    const int32_t entry_mant = result->mant;
+
+    HF_PROFILE_PATH(HF_PROF_ROUND);
+
+    //NORMALISATION
+    if(result->mant != 0) {
+        //Décalage plaçant le MSB au bit 15 (16 = 10 (mantisse) + 5 (précision) + 1)
+        int shift = hf_clz32((uint32_t)result->mant) - (HF_MANT_SHIFT + 1), margin;
+        uint32_t lost = 0;
+
+        //Limiter le décalage pour ne pas passer sous l'exposant des subnormaux
+        margin = result->exp - HF_FMT_EXP_MIN(fmt);
+        if(shift > margin) shift = margin;
+       
+        //Application de la normalisation (bits sortis à droite repliés en bit collant)
+        if(shift > 0) result->mant <<= shift;
+        else if(shift < 0) {
+            lost = (uint32_t)result->mant & (shift > -32 ? (1U << -shift) - 1U : ~0U);
+            result->mant = (shift > -32 ? (int32_t)((uint32_t)result->mant >> -shift) : 0) | (lost != 0);
+        }
+        result->exp -= shift;
+
+        //Inexact si des bits sont perdus, soupassement si de plus le résultat est subnormal avant arrondi
+        if(lost | (result->mant & round_mask)) {
+            HF_FE_ACCUM(flags, result->mant < HF_MANT_NORM_MIN ? HF_FE_INEXACT | HF_FE_UNDERFLOW : HF_FE_INEXACT);
+        }
+
+        //ARRONDI selon le mode configuré (les modes dirigés arrondissent aussi sur le seul bit collant)
+        if(result->mant & round_mask) {
+            uint32_t round_bits = result->mant & round_mask;
+            uint32_t lsb = result->mant & (1U << precision);
+
+            if(should_round_up_guard(round_bits, 1U << (precision - 1), lsb, result->sign, mode)) {
+                result->mant += (1U << precision);
+                if(result->mant >= HF_MANT_NORM_MAX) {
+                    result->mant >>= 1;
+                    result->exp++;
+                }
+            }
+        }
+    }
+
+    //GESTION DES CAS LIMITES (E4M3: la mantisse 1.111 de l'exposant maximal code NaN)
+    if(result->exp > HF_FMT_EXP_MAX(fmt) ||
+       (HF_FMT_FINITE_ONLY(fmt) && result->exp == HF_FMT_EXP_MAX(fmt) && ((uint32_t)result->mant & ~round_mask) > max_mant)) {
+        //Overflow -> Infini, ou plus grand fini quand le mode arrondit vers zéro
+        HF_FE_ACCUM(flags, HF_FE_OVERFLOW | HF_FE_INEXACT);
+        HF_PROFILE_PATH(HF_PROF_ROUND_OVERFLOW);
+        if(should_round_up_guard(round_mask, 1U << (precision - 1), 1U, result->sign, mode)) {
+            result->exp = HF_FMT_EXP_FULL(fmt);
+            result->mant = 0;
+        } else {
+            result->exp = HF_FMT_EXP_MAX(fmt);
+            result->mant = (int32_t)max_mant;
+        }
+    }
+    else if(result->exp < HF_FMT_EXP_MIN(fmt)) {
+        //Underflow: créer subnormal ou zéro
+        int shift = HF_FMT_EXP_MIN(fmt) - result->exp;
+        result->mant = (shift < HF_MANT_SHIFT + 1) ? (result->mant + (1U << (shift - 1))) >> shift : 0;
+        result->exp = HF_FMT_EXP_MIN(fmt);
+    }
+    //Sinon exp == HF_FMT_EXP_MIN: subnormal déjà bien positionné, rien à faire
+
+    //NETTOYAGE
+    result->mant &= ~round_mask;
+    if(entry_mant != 0 && result->exp == HF_FMT_EXP_MIN(fmt) && result->mant < HF_MANT_NORM_MIN) {
+        HF_PROFILE_PATH(result->mant ? HF_PROF_ROUND_SUBNORMAL : HF_PROF_ROUND_ZERO);
+    }
+}
+
+/**
+ * @brief Normalise et arrondit avec un mode d'arrondi explicite (version inline)
+ *
+ * Corps de normalize_and_round_mode(): normalize_and_round_fmt() instancié
+ * pour le format fp16.
+ *
+ * @param result Pointeur vers le demi-flottant à normaliser et arrondir
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ */
+static inline void normalize_and_round_inline(half_float *result, unsigned int *flags, hf_rounding_mode mode) {
+    normalize_and_round_fmt(result, flags, HF_FORMAT_FP16, mode);
+}
+
+/**
+ * @brief Conversion sans branchement ni table float32 -> format court (version inline)
+ *
+ * Les bits perdus sont arrondis par un seul incrément entier dont la retenue
+ * se propage dans l'exposant: demi-ULP moins un plus le bit de poids faible
+ * (égalités au pair), demi-ULP (égalités loin de zéro), rien (vers zéro) ou
+ * ULP moins un dans le sens de l'arrondi dirigé. Le chemin normal perd
+ * 23 - HF_FMT_MANT_BITS(fmt) bits, le chemin subnormal autant de bits que
+ * l'écart d'exposant l'impose (limité à 25: il ne reste alors qu'un bit
+ * collant). Le dépassement donne l'infini ou le plus grand fini selon le mode
+ * (NaN au lieu de l'infini pour E4M3) et les NaN gardent les bits de poids
+ * fort de leur charge, rendus silencieux.
+ * Appelée avec un mode et un format constants, tous les tests disparaissent.
+ * Exceptions: bits perdus (inexact), valeur arrondie au-delà du plus grand
+ * fini avec un exposant non borné (dépassement), inexact sous le plus petit
+ * normal (soupassement), NaN signalant ou infini vers E4M3 (invalide).
+ *
+ * @param bits Motif binaire du float32
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ * @param fmt Format cible
+ * @return Motif binaire dans le format cible
+ */
+static HF_ALWAYS_INLINE uint16_t float_bits_to_fmt_inline(uint32_t bits, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    const int lost_bits = 23 - HF_FMT_MANT_BITS(fmt);
+    const uint32_t min_normal = (uint32_t)(128 - HF_FMT_EXP_BIAS(fmt)) << 23;     //Plus petit normal du format (bits float)
+    uint32_t sign = (bits >> (32 - HF_FMT_BITS(fmt))) & HF_FMT_MASK_SIGN(fmt);
+    uint32_t abs_bits = bits & 0x7FFFFFFFU;
+    uint32_t exp = abs_bits >> 23;
+    uint32_t mant = (abs_bits & 0x7FFFFFU) | ((uint32_t)(exp != 0) << 23);
+    uint32_t neg = 0U - (bits >> 31);                                   //Masque: négatif
+    //Bits perdus par un subnormal du format (les subnormaux float ont l'exposant 1, utile au seul bf16)
+    int shift = (151 - HF_FMT_EXP_BIAS(fmt) - HF_FMT_MANT_BITS(fmt)) - (int)(exp | (HF_FMT_EXP_BIAS(fmt) == 127 && exp == 0));
+    uint32_t normal, subnormal, special, max_finite, to_inf, dir_mask = 0, result;
+    uint32_t lost_normal = abs_bits & ((1U << lost_bits) - 1U), lost_subnormal, special_mask, normal_mask, excepts;
+
+    shift = shift < lost_bits ? lost_bits : (shift > 25 ? 25 : shift);
+    lost_subnormal = mant & ((1U << shift) - 1U);
+    if(mode == HF_ROUND_TOWARD_POS_INF) dir_mask = ~neg;
+    else if(mode == HF_ROUND_TOWARD_NEG_INF) dir_mask = neg;
+
+    //Valeur normalisée: exposant rebiaisé (127 -> biais du format) puis arrondi des bits perdus
+    normal = abs_bits - ((uint32_t)(127 - HF_FMT_EXP_BIAS(fmt)) << 23);
+    subnormal = mant;
+    if(mode == HF_ROUND_NEAREST_EVEN) {
+        normal += (1U << (lost_bits - 1)) - 1U + ((normal >> lost_bits) & 1U);
+        subnormal += (1U << (shift - 1)) - 1U + ((mant >> shift) & 1U);
+    } else if(mode == HF_ROUND_NEAREST_UP) {
+        normal += 1U << (lost_bits - 1);
+        subnormal += 1U << (shift - 1);
+    } else {
+        normal += ((1U << lost_bits) - 1U) & dir_mask;
+        subnormal += ((1U << shift) - 1U) & dir_mask;
+    }
+    normal >>= lost_bits;
+    subnormal >>= shift;
+
+    //Exceptions selon le chemin emprunté (masques de chemin ou comparaisons, voir HF_FMT_MASK_SELECT)
+    special_mask = 0U - (uint32_t)(abs_bits >= 0x7F800000U);
+    normal_mask = ~special_mask & (0U - (uint32_t)(abs_bits >= min_normal));
+    if(HF_FMT_MASK_SELECT(fmt)) {
+        excepts = (special_mask & (HF_FE_INVALID * ((uint32_t)(abs_bits > 0x7F800000U && !(abs_bits & 0x400000U)) |
+                                                    (uint32_t)(HF_FMT_FINITE_ONLY(fmt) && abs_bits == 0x7F800000U)))) |
+                  (normal_mask & ((HF_FE_OVERFLOW | HF_FE_INEXACT) * (uint32_t)(normal >= HF_FMT_INFINITY(fmt)) | HF_FE_INEXACT * (uint32_t)(lost_normal != 0))) |
+                  (~(special_mask | normal_mask) & ((HF_FE_UNDERFLOW | HF_FE_INEXACT) * (uint32_t)(lost_subnormal != 0)));
+    }
+    else if(abs_bits >= 0x7F800000U) excepts = ((abs_bits > 0x7F800000U && !(abs_bits & 0x400000U)) || (HF_FMT_FINITE_ONLY(fmt) && abs_bits == 0x7F800000U)) ? HF_FE_INVALID : 0;
+    else if(abs_bits >= min_normal) excepts = (normal >= HF_FMT_INFINITY(fmt) ? HF_FE_OVERFLOW | HF_FE_INEXACT : 0) | (lost_normal ? HF_FE_INEXACT : 0);
+    else excepts = lost_subnormal ? HF_FE_UNDERFLOW | HF_FE_INEXACT : 0;
+    HF_FE_ACCUM(flags, excepts);
+
+    //Dépassement: infini en arrondi au plus proche ou vers l'infini du même signe, plus grand fini sinon
+    to_inf = (mode == HF_ROUND_NEAREST_EVEN || mode == HF_ROUND_NEAREST_UP) ? ~0U : dir_mask;
+    max_finite = HF_FMT_INFINITY(fmt) - 1U + (to_inf & 1U);
+    normal = normal < max_finite ? normal : max_finite;
+    if(HF_FMT_FINITE_ONLY(fmt)) special = HF_FMT_NAN(fmt);
+    else special = HF_FMT_INFINITY(fmt) | (abs_bits > 0x7F800000U ? (HF_FMT_NAN(fmt) & ~HF_FMT_INFINITY(fmt)) | ((abs_bits >> lost_bits) & HF_FMT_MASK_MANT(fmt)) : 0);
+
+    if(HF_FMT_MASK_SELECT(fmt)) result = (special & special_mask) | (normal & normal_mask) | (subnormal & ~(special_mask | normal_mask));
+    else result = abs_bits >= 0x7F800000U ? special : (abs_bits >= min_normal ? normal : subnormal);
+
+    return (uint16_t)(sign | result);
+}
+
+/**
+ * @brief Conversion sans branchement ni table float32 -> fp16 (version inline)
+ *
+ * Corps de float_to_half(): float_bits_to_fmt_inline() instancié pour fp16.
+ * Le chemin normal perd 13 bits, le chemin subnormal 126 - exposant bits;
+ * le résultat est identique à vcvtps2ph (F16C).
+ *
+ * @param bits Motif binaire du float32
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ * @return Motif binaire du demi-flottant
+ */
+static inline uint16_t float_bits_to_half_inline(uint32_t bits, unsigned int *flags, hf_rounding_mode mode) {
+    return float_bits_to_fmt_inline(bits, flags, HF_FORMAT_FP16, mode);
+}
+
+/**
+ * @brief Conversion exacte sans branchement format court -> float32 (version inline)
+ *
+ * Les normaux sont rebiaisés, les subnormaux obtenus par mant * 2^(EXP_MIN -
+ * MANT_BITS), produit exact et normal en binary32 (les subnormaux bf16 sont
+ * directement des subnormaux binary32). Les NaN gardent leur charge, rendus
+ * silencieux; le NaN unique de E4M3 donne le NaN canonique.
+ *
+ * @param bits Motif binaire (16 bits, ou 8 bits pour FP8)
+ * @param fmt Format du motif
+ * @return Motif binaire du float32
+ */
+static HF_ALWAYS_INLINE uint32_t fmt_bits_to_float_bits_inline(uint32_t bits, hf_format fmt) {
+    union { float f; uint32_t u; } conv;
+    uint32_t sign = (bits & HF_FMT_MASK_SIGN(fmt)) << (32 - HF_FMT_BITS(fmt));
+    uint32_t abs_bits = bits & (HF_FMT_MASK_SIGN(fmt) - 1U);
+    uint32_t exp = abs_bits >> HF_FMT_MANT_BITS(fmt);
+    uint32_t mant = abs_bits & HF_FMT_MASK_MANT(fmt);
+    uint32_t normal = (abs_bits << (23 - HF_FMT_MANT_BITS(fmt))) + ((uint32_t)(127 - HF_FMT_EXP_BIAS(fmt)) << 23);
+    uint32_t subnormal, special, result;
+
+    //Échelle 2^(EXP_MIN - MANT_BITS) des subnormaux (inutilisée pour bf16)
+    conv.u = (uint32_t)(HF_FMT_EXP_BIAS(fmt) == 127 ? 127 : 127 + HF_FMT_EXP_MIN(fmt) - HF_FMT_MANT_BITS(fmt)) << 23;
+    conv.f = (float)mant * conv.f;
+    subnormal = HF_FMT_EXP_BIAS(fmt) == 127 ? normal : conv.u;
+
+    if(HF_FMT_FINITE_ONLY(fmt)) special = 0x7FC00000U;
+    else special = 0x7F800000U | (mant != 0 ? 0x400000U | (mant << (23 - HF_FMT_MANT_BITS(fmt))) : 0);
+
+    if(exp == HF_FMT_MASK_EXP(fmt) && (!HF_FMT_FINITE_ONLY(fmt) || mant == HF_FMT_MASK_MANT(fmt))) result = special;
+    else result = exp != 0 ? normal : subnormal;
 
-//Gestion du mode d'arrondi global
-void hf_set_rounding_mode(hf_rounding_mode mode);
-hf_rounding_mode hf_get_rounding_mode(void);
+    return sign | result;
+}
 
 #endif //HF_COMMON_H
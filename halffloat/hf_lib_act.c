@@ -0,0 +1,365 @@
+/**
+ * @file hf_lib_act.c
+ * @brief Implémentation des fonctions d'activation fusionnées pour Half-Float
+ *
+ * Une entrée finie m * 2^e est d'abord convertie sans perte en virgule fixe de
+ * LSB 2^-29 (plus petit sous-normal 2^-24, mantisse Q15). Pour |t| < 2^-6, la
+ * sigmoïde est la série 1/2 + t/4 - t^3/48 (reste sous 2^-38) calculée sur
+ * 64 bits depuis cette valeur exacte: le résultat reste juste près de 0, y
+ * compris dans les modes dirigés. Sinon l'argument de l'exponentielle est
+ * arrondi en Q15 et saturé à |t| <= 32 (e^-32 est sous l'ULP de tout
+ * résultat) et la sigmoïde est formée à partir de E = e^-|t| (exp_fixed_poly,
+ * polynôme quel que soit le moteur: l'erreur des tables interpolées atteint
+ * plusieurs ULP): 1 / (1 + E) pour t >= 0 et E / (1 + E) pour t < 0, par une
+ * division 64 bits dont le reste alimente le bit collant, ce qui garde la
+ * précision relative des très petits résultats.
+ * SiLU et GELU multiplient ensuite la mantisse exacte de x par ce quotient
+ * sur 64 bits. Seul normalize_and_round() arrondit, une seule fois.
+ *
+ * hf_softmax_n() fait trois passages: maximum (et détection des NaN et
+ * infinis), somme des e^(x_i - max) en Q30 sur 64 bits (exacte pour la
+ * précision de exp_fixed, jusqu'à 2^33 termes), puis multiplication de chaque
+ * terme recalculé par l'inverse de la somme sur 31 bits.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include "hf_lib_act.h"
+#include "hf_lib_common.h"
+
+#define IS_SNAN_BITS(hf) (((hf) & ~HF_MASK_SIGN & 0xFFFFU) > HF_INFINITY_POS && !((hf) & (1U << (HF_MANT_BITS - 1))))
+
+#define ACT_FIXED_SHIFT     (HF_MANT_SHIFT - HF_EXP_MIN)    //Virgule fixe exacte: LSB 2^-29
+#define ACT_EXP_LIMIT       (32 << 15)                      //|t| saturé à 32 (Q15)
+#define ACT_SERIES_LIMIT    (1LL << (ACT_FIXED_SHIFT - 6))  //|t| < 2^-6: série de Taylor (LSB 2^-29)
+
+//Forme tanh de GELU: u = GELU_C2 (x + GELU_C1 x^3), Q30
+#define ACT_GELU_C1         48012366LL                      //0.044715
+#define ACT_GELU_C2         1713444047LL                    //2 sqrt(2/pi)
+
+//Déclaration des helpers statiques
+static int64_t act_fixed(const half_float *input);
+static int32_t act_q15(int64_t x_fixed);
+static void act_sigmoid_fixed(int64_t t, half_float *s);
+static void act_narrow(uint64_t value, int exp, unsigned int sticky, half_float *result);
+static uint16_t act_special(uint16_t hf, uint16_t neg_inf, uint16_t pos_inf);
+static uint16_t act_scaled(uint16_t hf, int gelu);
+static void act_softmax_term(uint16_t hf, int64_t max_fixed, half_float *term);
+static inline void softmax_rounded(const uint16_t *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+
+/**
+ * @brief Calcule la sigmoïde 1 / (1 + e^-x) en demi-précision
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return sigmoid(hf): 0.5 pour +/-0, +1 pour +inf, +0 pour -inf, NaN propagé
+ */
+uint16_t hf_sigmoid(uint16_t hf) {
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_ACT, hf);
+
+    if((hf & ~HF_MASK_SIGN) >= HF_INFINITY_POS) {
+        result = act_special(hf, HF_ZERO_POS, HF_ONE_POS);
+    } else {
+        half_float input = decompose_half(hf);
+        half_float s;
+
+        act_sigmoid_fixed(act_fixed(&input), &s);
+        normalize_and_round(&s);
+        result = compose_half(&s);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule SiLU (swish) x * sigmoid(x) en demi-précision
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return silu(hf): +/-0 pour +/-0, +inf pour +inf, -0 pour -inf, NaN propagé
+ */
+uint16_t hf_silu(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_ACT, hf);
+    return act_scaled(hf, 0);
+}
+
+/**
+ * @brief Calcule GELU (forme tanh) en demi-précision
+ *
+ * 0.5 x (1 + tanh(v)) avec v = sqrt(2/pi) (x + 0.044715 x^3), comme
+ * l'approximation "tanh" des bibliothèques d'apprentissage; calculé sous la
+ * forme équivalente x * sigmoid(2v), sans tanh ni division supplémentaire.
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return gelu(hf): +/-0 pour +/-0, +inf pour +inf, -0 pour -inf, NaN propagé
+ */
+uint16_t hf_gelu(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_ACT, hf);
+    return act_scaled(hf, 1);
+}
+
+/**
+ * @brief Calcule le softmax d'un tableau de demi-flottants
+ *
+ * out[i] = e^(in[i] - max) / somme_j e^(in[j] - max). La soustraction du
+ * maximum rend le calcul stable quelle que soit la plage des entrées, la
+ * somme est tenue en virgule fixe 64 bits et chaque sortie n'est arrondie
+ * qu'une fois. Un NaN en entrée donne NaN partout; un maximum infini (+inf
+ * présent, ou toutes les entrées à -inf) donne NaN partout avec l'opération
+ * invalide, comme le calcul direct (inf - inf). Les entrées -inf donnent +0.
+ *
+ * @param in Tableau d'entrée
+ * @param out Tableau résultat (peut être confondu avec in)
+ * @param n Nombre d'éléments
+ */
+void hf_softmax_n(const uint16_t *in, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_CALLS(HF_PROF_MATH_N, n);
+    DISPATCH_ROUNDING_MODE(mode, softmax_rounded, in, out, n);
+}
+
+/**
+ * @brief Convertit un demi-flottant fini en virgule fixe exacte (LSB 2^-29)
+ *
+ * @param input Demi-flottant décomposé (ni NaN ni infini)
+ * @return Valeur signée de l'entrée multipliée par 2^29 (|valeur| < 2^45)
+ */
+static int64_t act_fixed(const half_float *input) {
+    int64_t result = (int64_t)input->mant << (input->exp - HF_EXP_MIN);
+
+    if(input->sign) result = -result;
+    return result;
+}
+
+/**
+ * @brief Arrondit une valeur de act_fixed() en Q15, saturée à +/-ACT_EXP_LIMIT
+ *
+ * @param x_fixed Valeur signée de LSB 2^-29
+ * @return Valeur Q15 arrondie au plus proche (symétrique)
+ */
+static int32_t act_q15(int64_t x_fixed) {
+    uint64_t magnitude = (uint64_t)(x_fixed < 0 ? -x_fixed : x_fixed);
+    int32_t result;
+
+    magnitude = (magnitude + (1ULL << (ACT_FIXED_SHIFT - 16))) >> (ACT_FIXED_SHIFT - 15);
+    if(magnitude > ACT_EXP_LIMIT) magnitude = ACT_EXP_LIMIT;
+    result = (int32_t)magnitude;
+
+    return x_fixed < 0 ? -result : result;
+}
+
+/**
+ * @brief Calcule sigmoid(t) non arrondie
+ *
+ * Pour |t| < 2^-6: 1/2 + t/4 - t^3/48 sur 64 bits (LSB 2^-62, bit collant
+ * pour t non nul). Sinon, avec E = e^-|t| = m 2^k (k <= 0) par
+ * exp_fixed_poly(): 1 / (1 + E) pour t >= 0, E / (1 + E) pour t < 0. Le
+ * quotient (sur 30 bits) garde un bit collant pour le reste.
+ *
+ * @param t Argument de LSB 2^-29 (|t| < 2^45)
+ * @param s Reçoit le résultat positif (mantisse < 2^31, à normaliser)
+ */
+static void act_sigmoid_fixed(int64_t t, half_float *s) {
+    s->sign = HF_ZERO_POS;
+
+    if(t > -ACT_SERIES_LIMIT && t < ACT_SERIES_LIMIT) {
+        //t^2 < 2^46 (LSB 2^-58), t^3 de LSB 2^-66 ramené en 2^-62 avec la division par 48
+        int64_t cube = ((t * t) >> 21) * t;
+        int64_t value = (1LL << 61) + t * (1LL << 31) - cube / (48 * 16);
+
+        act_narrow((uint64_t)value, -47, t != 0, s);
+    } else {
+        half_float e;
+        uint64_t numerator, denominator, quotient;
+        int32_t t15 = act_q15(t);
+        int shift, num_exp;
+
+        //E = e^-|t|, puis 1 + E en Q30 (E négligeable sous 2^-30)
+        exp_fixed_poly(t15 < 0 ? t15 : -t15, &e);
+        shift = e.exp + 15;
+        denominator = (1ULL << 30) + (shift >= 0 ? (uint64_t)e.mant << shift : (shift > -32 ? (uint64_t)e.mant >> -shift : 0));
+
+        //Numérateur 1 ou E, mantisse Q15
+        numerator = t15 < 0 ? (uint64_t)e.mant : HF_MANT_NORM_MIN;
+        num_exp = t15 < 0 ? e.exp : 0;
+
+        quotient = (numerator << 44) / denominator;
+        s->mant = (int32_t)(quotient | ((numerator << 44) % denominator != 0));
+        s->exp = num_exp - 14;
+    }
+}
+
+/**
+ * @brief Ramène une valeur 64 bits sous 2^31 avec bit collant
+ *
+ * @param value Mantisse de valeur value * 2^(exp - 15)
+ * @param exp Exposant associé
+ * @param sticky Non nul si des bits non nuls ont déjà été perdus
+ * @param result Reçoit mantisse et exposant (le signe n'est pas modifié)
+ */
+static void act_narrow(uint64_t value, int exp, unsigned int sticky, half_float *result) {
+    int shift = 0;
+
+    if(value != 0) {
+        shift = 33 - hf_clz64(value);
+        if(shift < 0) shift = 0;
+        sticky |= (value & ((1ULL << shift) - 1)) != 0;
+        value = (value >> shift) | (sticky != 0);
+    }
+
+    result->mant = (int32_t)value;
+    result->exp = exp + shift;
+}
+
+/**
+ * @brief Résultat d'une fonction d'activation pour NaN et infinis
+ *
+ * @param hf Entrée NaN ou infinie
+ * @param neg_inf Résultat pour -inf
+ * @param pos_inf Résultat pour +inf
+ * @return NaN silencieux propagé (invalide si signalant) ou résultat de l'infini
+ */
+static uint16_t act_special(uint16_t hf, uint16_t neg_inf, uint16_t pos_inf) {
+    uint16_t result = (hf & HF_MASK_SIGN) ? neg_inf : pos_inf;
+
+    if((hf & ~HF_MASK_SIGN) > HF_INFINITY_POS) {
+        if(IS_SNAN_BITS(hf)) HF_FE_RAISE(HF_FE_INVALID);
+        result = hf | (1U << (HF_MANT_BITS - 1));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule x * sigmoid(t) avec t = x (SiLU) ou t = 2 sqrt(2/pi) (x + 0.044715 x^3) (GELU)
+ *
+ * @param hf Demi-flottant d'entrée
+ * @param gelu Non nul pour l'argument de GELU
+ * @return Résultat arrondi une seule fois
+ */
+static uint16_t act_scaled(uint16_t hf, int gelu) {
+    uint16_t result;
+
+    if((hf & ~HF_MASK_SIGN) >= HF_INFINITY_POS) {
+        result = act_special(hf, HF_ZERO_NEG, HF_INFINITY_POS);
+    } else {
+        half_float input = decompose_half(hf);
+        half_float s, product;
+        int64_t t = act_fixed(&input);
+
+        if(gelu) {
+            //u = C2 (x + C1 x^3) sur |x| (fonction impaire): LSB 2^-29 près de 0, sinon Q15 avec |x| <= 32
+            int64_t x = t < 0 ? -t : t;
+            int small = x < ACT_SERIES_LIMIT;
+            int shift = small ? ACT_FIXED_SHIFT : 15;
+            int64_t cube, u;
+
+            if(!small) x = act_q15(x);
+            cube = ((x * x) >> shift) * x >> shift;
+            u = ((x + ((cube * ACT_GELU_C1) >> 30)) * ACT_GELU_C2) >> 30;
+            if(!small) {
+                if(u > ACT_EXP_LIMIT) u = ACT_EXP_LIMIT;
+                u *= 1 << (ACT_FIXED_SHIFT - 15);
+            }
+            t = t < 0 ? -u : u;
+        }
+
+        //x * sigmoid(t): produit exact des mantisses (< 2^47)
+        act_sigmoid_fixed(t, &s);
+        product.sign = input.sign;
+        act_narrow((uint64_t)input.mant * (uint64_t)s.mant, input.exp + s.exp - 15, 0, &product);
+        normalize_and_round(&product);
+        result = compose_half(&product);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule e^(x - max) non arrondi pour hf_softmax_n()
+ *
+ * @param hf Entrée (finie ou -inf, jamais supérieure au maximum)
+ * @param max_fixed Maximum converti par act_fixed()
+ * @param term Reçoit m 2^k (mantisse Q15, k <= 0), mantisse nulle pour -inf
+ */
+static void act_softmax_term(uint16_t hf, int64_t max_fixed, half_float *term) {
+    if((hf & ~HF_MASK_SIGN) == HF_INFINITY_POS) {
+        term->mant = 0;
+        term->exp = 0;
+    } else {
+        half_float input = decompose_half(hf);
+        exp_fixed(act_q15(act_fixed(&input) - max_fixed), term);
+    }
+}
+
+/**
+ * @brief Corps de hf_softmax_n(), instancié pour chaque mode d'arrondi constant
+ */
+static inline void softmax_rounded(const uint16_t *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t max_hf = HF_INFINITY_NEG, max_key = 0, nan = 0;
+    size_t i;
+
+    //Premier passage: maximum (ordre total sur les motifs) et premier NaN
+    for(i = 0; i < n; i++) {
+        uint16_t key = (in[i] & HF_MASK_SIGN) ? (uint16_t)~in[i] : (uint16_t)(in[i] | HF_MASK_SIGN);
+
+        if((in[i] & ~HF_MASK_SIGN) > HF_INFINITY_POS) {
+            if(!nan) nan = in[i] | (1U << (HF_MANT_BITS - 1));
+            if(IS_SNAN_BITS(in[i])) HF_FE_ACCUM(&flags, HF_FE_INVALID);
+        } else if(key >= max_key) {
+            max_key = key;
+            max_hf = in[i];
+        }
+    }
+
+    if(n != 0 && (nan || (max_hf & ~HF_MASK_SIGN) == HF_INFINITY_POS)) {
+        //NaN propagé, ou inf - inf (NaN négatif comme hf_sub)
+        if(!nan) HF_FE_ACCUM(&flags, HF_FE_INVALID);
+        for(i = 0; i < n; i++) out[i] = nan ? nan : (HF_NAN | HF_MASK_SIGN);
+    } else if(n != 0) {
+        half_float max_input = decompose_half(max_hf);
+        int64_t max_fixed = act_fixed(&max_input);
+        uint64_t sum = 0, sum_norm, inverse;
+        unsigned int sticky = 0;
+        int sum_shift;
+
+        //Deuxième passage: somme des e^(x_i - max) en Q30 (le maximum apporte 2^30)
+        for(i = 0; i < n; i++) {
+            half_float term;
+            int shift;
+
+            act_softmax_term(in[i], max_fixed, &term);
+            shift = term.exp + 15;
+            if(shift >= 0) {
+                sum += (uint64_t)term.mant << shift;
+            } else {
+                sum += shift > -32 ? (uint64_t)term.mant >> -shift : 0;
+                sticky |= (shift > -32 ? (uint64_t)term.mant & ((1ULL << -shift) - 1) : (uint64_t)term.mant) != 0;
+            }
+        }
+
+        //Inverse de la somme ramenée dans [2^31, 2^32): 1 / somme = inverse 2^-62 2^(30 - sum_shift)
+        sum_shift = 32 - hf_clz64(sum);
+        sum_norm = sum_shift >= 0 ? sum >> sum_shift : sum << -sum_shift;
+        sticky |= (sum_shift > 0 && (sum & ((1ULL << sum_shift) - 1)) != 0);
+        inverse = (1ULL << 62) / sum_norm;
+        sticky |= (1ULL << 62) % sum_norm != 0;
+
+        //Troisième passage: normalisation, un seul arrondi par sortie
+        for(i = 0; i < n; i++) {
+            half_float term, result;
+
+            act_softmax_term(in[i], max_fixed, &term);
+            result.sign = HF_ZERO_POS;
+            act_narrow((uint64_t)term.mant * inverse, term.exp - sum_shift - 32, term.mant != 0 && sticky, &result);
+            normalize_and_round_inline(&result, &flags, mode);
+            out[i] = compose_half(&result);
+        }
+    }
+
+    HF_FE_RAISE(flags);
+}
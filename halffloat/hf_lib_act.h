@@ -0,0 +1,42 @@
+/**
+ * @file hf_lib_act.h
+ * @brief Fonctions d'activation fusionnées (sigmoïde, GELU, SiLU, softmax) pour Half-Float
+ *
+ * Chaque fonction est calculée d'un bloc en virgule fixe, sans repasser par
+ * des demi-flottants intermédiaires, puis arrondie une seule fois
+ * dans le mode du thread avec les indicateurs HF_FE_* habituels. Elles
+ * remplacent les compositions hf_exp/hf_add/hf_div/hf_tanh, qui arrondissent
+ * et testent les cas spéciaux à chaque étape.
+ *
+ *  - hf_sigmoid(x) = 1 / (1 + e^-x)
+ *  - hf_silu(x)    = x * sigmoid(x)
+ *  - hf_gelu(x)    = 0.5 x (1 + tanh(sqrt(2/pi) (x + 0.044715 x^3))), forme
+ *    tanh de GELU, évaluée comme x * sigmoid(2 sqrt(2/pi) (x + 0.044715 x^3))
+ *  - hf_softmax_n  = e^(x_i - max) / somme, stable pour toute plage d'entrées
+ *
+ * La sigmoïde (et donc SiLU et GELU) prend e^-|t| au polynôme quel que soit
+ * le moteur, et une série de Taylor pour |t| < 2^-6: erreur sous 1 ULP avec
+ * les deux moteurs. hf_softmax_n suit le moteur choisi (exp_fixed(), table ou
+ * polynôme).
+ *
+ * Voir hf_lib_fast.h pour des variantes sans mode d'arrondi ni indicateurs.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_ACT_H
+#define HF_LIB_ACT_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+HF_API uint16_t hf_sigmoid(uint16_t hf);                       //+1 pour +inf, +0 pour -inf
+HF_API uint16_t hf_silu(uint16_t hf);                          //+inf pour +inf, -0 pour -inf
+HF_API uint16_t hf_gelu(uint16_t hf);                          //+inf pour +inf, -0 pour -inf
+
+//Softmax de in[0..n) dans out (peut être confondu avec in), mode d'arrondi lu une fois
+HF_API void hf_softmax_n(const uint16_t *in, uint16_t *out, size_t n);
+
+#endif //HF_LIB_ACT_H
@@ -11,12 +11,86 @@
  */
 
 #include "hf_lib_arith.h"
+#include "hf_lib_par.h"
 
 //Definition de la macro ROL32
 #define ROL32(x, n) ((x<<n) | (x>>(32-n)))
 
+//Vrai si le motif 16 bits est un nombre fini normalisé (champ exposant dans [1, 30])
+#define IS_NORMAL_BITS(hf) ((unsigned int)((((hf) >> HF_MANT_BITS) & HF_MASK_EXP) - 1U) < (HF_MASK_EXP - 1U))
+
+//Vrai si les deux motifs sont des finis normalisés (test combiné, sans court-circuit)
+#define BOTH_NORMAL_BITS(hf1, hf2) (IS_NORMAL_BITS(hf1) & IS_NORMAL_BITS(hf2))
+
+//Vrai si le motif 16 bits est un NaN signalant (bit de poids fort de la mantisse à 0)
+#define IS_SNAN_BITS(hf) (((hf) & ~HF_MASK_SIGN & 0xFFFFU) > HF_INFINITY_POS && !((hf) & (1U << (HF_MANT_BITS - 1))))
+
+//Taille des blocs traités par les variantes par lots (un seul test de cas spéciaux par bloc)
+#define HF_BATCH_BLOCK 256
+
+//Noyaux par lots confiés au groupe de threads (HF_THREADS, voir hf_lib_par.h)
+#if defined(HF_THREADS)
+typedef enum {
+    ARITH_PAR_ADD = 0,
+    ARITH_PAR_SUB,
+    ARITH_PAR_MUL,
+    ARITH_PAR_DIV,
+    ARITH_PAR_FMA,
+    ARITH_PAR_SQRT,
+    ARITH_PAR_FMOD,
+    ARITH_PAR_REMAINDER,
+    ARITH_PAR_REMQUO
+} arith_par_op;
+
+//Opération et tableaux d'un lot réparti (indices relatifs au début du lot)
+typedef struct {
+    arith_par_op op;
+    const uint16_t *a, *b, *c;
+    uint16_t *out;
+    int *quo;
+} arith_par_task;
+
+#define ARITH_PARALLEL(op, a, b, c, out, quo, n) arith_parallel((op), (a), (b), (c), (out), (quo), (n))
+#else
+#define ARITH_PARALLEL(op, a, b, c, out, quo, n) 0
+#endif
+
 //Déclaration des helpers statiques
+static inline uint16_t add_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t mul_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t div_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t inv_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t sqrt_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t rsqrt_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
 static uint32_t square_root(uint32_t value);
+static uint32_t square_root_wide(uint64_t value);
+static inline uint16_t hypot_rounded(uint16_t hfx, uint16_t hfy, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t round_pack_fast(uint16_t sign, int exp, uint32_t mant, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t add_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t mul_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+#if !defined(HF_CONSTANT_TIME)
+static uint16_t div_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t sqrt_normal_fast(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
+#endif
+static void add_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, uint16_t flip, hf_rounding_mode mode);
+static void mul_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void div_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void fma_blocks(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void sqrt_blocks(const uint16_t *a, uint16_t *out, size_t n, hf_rounding_mode mode);
+static uint16_t remainder_exact(uint16_t hfx, uint16_t hfy, int nearest, int *quo, unsigned int *flags);
+static void remainder_batch(const uint16_t *a, const uint16_t *b, uint16_t *out, int *quo, size_t n, int nearest);
+#if defined(HF_THREADS)
+static int arith_parallel(arith_par_op op, const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, int *quo, size_t n);
+static void arith_par_body(void *ctx, size_t begin, size_t end);
+#endif
+#if defined(HF_CONSTANT_TIME)
+static uint32_t decode_ct(uint16_t hf, int *exp);
+static uint16_t round_pack_ct(uint16_t sign, int exp, uint32_t mant, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t add_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t mul_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t div_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode);
+static uint16_t sqrt_ct(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
+#endif
 
 
 /**
@@ -29,6 +103,7 @@ static uint32_t square_root(uint32_t value);
  * @return L'opposé de hf sous forme de demi-flottant
  */
 uint16_t hf_neg(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     //L'opposé est obtenu en inversant le bit de signe
     //On utilise l'opération XOR avec HF_MASK_SIGN pour inverser uniquement le bit de signe
     return hf ^ HF_MASK_SIGN;
@@ -44,6 +119,7 @@ uint16_t hf_neg(uint16_t hf) {
  * @return La valeur absolue de hf sous forme de demi-flottant
  */
 uint16_t hf_abs(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     //La valeur absolue est obtenue en mettant le bit de signe à 0
     //On utilise un masque pour conserver tous les bits sauf le bit de signe
     return hf & ~HF_MASK_SIGN;
@@ -57,6 +133,45 @@ uint16_t hf_abs(uint16_t hf) {
  * @return Le résultat de l'addition sous forme de demi-flottant
  */
 uint16_t hf_add(uint16_t hf1, uint16_t hf2) {
+    return hf_add_r(hf1, hf2, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Additionne deux demi-flottants avec un mode d'arrondi explicite
+ *
+ * Le mode n'est examiné qu'une fois: chaque mode dispose de sa propre copie
+ * du calcul, où l'arrondi est résolu à la compilation.
+ *
+ * @param hf1 Premier demi-flottant
+ * @param hf2 Second demi-flottant
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_add_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN2(HF_PROF_ADD, hf1, hf2);
+
+#if defined(HF_CONSTANT_TIME)
+    DISPATCH_ROUNDING_MODE_RET(result, mode, add_ct, hf1, hf2, &flags);
+#else
+    if(BOTH_NORMAL_BITS(hf1, hf2)) {
+        //Chemin rapide: deux nombres finis normalisés, calcul direct sur les bits
+        DISPATCH_ROUNDING_MODE_RET(result, mode, add_normal_fast, hf1, hf2, &flags);
+    } else {
+        DISPATCH_ROUNDING_MODE_RET(result, mode, add_rounded, hf1, hf2, &flags);
+    }
+#endif
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_add_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t add_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
@@ -68,6 +183,7 @@ uint16_t hf_add(uint16_t hf1, uint16_t hf2) {
     //Gestion unifiée des NaN - propager le premier NaN rencontré
     if(is_nan(&input1) || is_nan(&input2)) {
         result.sign = is_nan(&input1) ? input1.sign : input2.sign;
+        if(IS_SNAN_BITS(hf1) || IS_SNAN_BITS(hf2)) HF_FE_ACCUM(flags, HF_FE_INVALID);
     } else if(is_infinity(&input1) || is_infinity(&input2)) {
         //Gestion des cas infinis
         if(is_infinity(&input1) && is_infinity(&input2)) {
@@ -75,6 +191,7 @@ uint16_t hf_add(uint16_t hf1, uint16_t hf2) {
             if(input1.sign != input2.sign) {
                 //Infini positif + Infini négatif = NaN négatif
                 result.sign = HF_ZERO_NEG;
+                HF_FE_ACCUM(flags, HF_FE_INVALID);
             } else {
                 //Infini + Infini de même signe = Infini
                 result = input1;
@@ -84,8 +201,8 @@ uint16_t hf_add(uint16_t hf1, uint16_t hf2) {
             result = is_infinity(&input1) ? input1 : input2;
         }
     } else if(is_zero(&input1) && is_zero(&input2)) {
-        //Cas spécial -0 + -0 = -0
-        result.sign = (input1.sign && input2.sign) ? HF_ZERO_NEG : HF_ZERO_POS;
+        //Cas spécial -0 + -0 = -0, et -0 vers -inf pour deux zéros de signes opposés
+        result.sign = (input1.sign & input2.sign || (input1.sign != input2.sign && mode == HF_ROUND_TOWARD_NEG_INF)) ? HF_ZERO_NEG : HF_ZERO_POS;
         result.exp = 0;
         result.mant = 0;
     } else {
@@ -105,9 +222,12 @@ uint16_t hf_add(uint16_t hf1, uint16_t hf2) {
         if(sum < 0) {
             result.mant = -sum;
             result.sign = HF_ZERO_NEG;
+        } else if(sum == 0 && mode == HF_ROUND_TOWARD_NEG_INF) {
+            //Somme exacte nulle de signes opposés: -0 vers -inf, +0 sinon
+            result.sign = HF_ZERO_NEG;
         }
 
-        normalize_and_round(&result);
+        normalize_and_round_inline(&result, flags, mode);
     }
 
     return compose_half(&result);
@@ -125,6 +245,18 @@ uint16_t hf_sub(uint16_t hf1, uint16_t hf2) {
     return hf_add(hf1, hf2 ^ HF_ZERO_NEG);
 }
 
+/**
+ * @brief Soustrait deux demi-flottants avec un mode d'arrondi explicite
+ *
+ * @param hf1 Premier demi-flottant
+ * @param hf2 Second demi-flottant (sera soustrait)
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat de la soustraction sous forme de demi-flottant
+ */
+uint16_t hf_sub_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode) {
+    return hf_add_r(hf1, hf2 ^ HF_ZERO_NEG, mode);
+}
+
 /**
  * @brief Multiplie deux demi-flottants
  * 
@@ -133,6 +265,42 @@ uint16_t hf_sub(uint16_t hf1, uint16_t hf2) {
  * @return Le résultat de la multiplication sous forme de demi-flottant
  */
 uint16_t hf_mul(uint16_t hf1, uint16_t hf2) {
+    return hf_mul_r(hf1, hf2, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Multiplie deux demi-flottants avec un mode d'arrondi explicite
+ *
+ * @param hf1 Premier demi-flottant
+ * @param hf2 Second demi-flottant
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_mul_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN2(HF_PROF_MUL, hf1, hf2);
+
+#if defined(HF_CONSTANT_TIME)
+    DISPATCH_ROUNDING_MODE_RET(result, mode, mul_ct, hf1, hf2, &flags);
+#else
+    if(BOTH_NORMAL_BITS(hf1, hf2)) {
+        //Chemin rapide: deux nombres finis normalisés, calcul direct sur les bits
+        DISPATCH_ROUNDING_MODE_RET(result, mode, mul_normal_fast, hf1, hf2, &flags);
+    } else {
+        DISPATCH_ROUNDING_MODE_RET(result, mode, mul_rounded, hf1, hf2, &flags);
+    }
+#endif
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_mul_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t mul_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
@@ -145,10 +313,12 @@ uint16_t hf_mul(uint16_t hf1, uint16_t hf2) {
     //Gestion unifiée des NaN - propager le premier NaN rencontré
     if(is_nan(&input1) || is_nan(&input2)) {
         result.sign = is_nan(&input1) ? input1.sign : input2.sign;
+        if(IS_SNAN_BITS(hf1) || IS_SNAN_BITS(hf2)) HF_FE_ACCUM(flags, HF_FE_INVALID);
     } else if((is_infinity(&input1) && is_zero(&input2)) ||
               (is_infinity(&input2) && is_zero(&input1))) {
         //Inf * 0 = NaN négatif selon la convention de la référence
         result.sign = HF_ZERO_NEG;
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
     } else {
         //Signe du résultat
         result.sign = input1.sign ^ input2.sign;
@@ -159,12 +329,18 @@ uint16_t hf_mul(uint16_t hf1, uint16_t hf2) {
             result.exp = -HF_EXP_BIAS;
         } else if(!is_infinity(&input1) && !is_infinity(&input2)) {
             //Multiplication normale
-            uint32_t mult_result = (uint32_t)(input1.mant * input2.mant);
-            
+            uint32_t mult_result;
+
+            //Subnormaux normalisés: le produit garde ses 22 bits significatifs
+            normalize_mantissa_inline(&input1);
+            normalize_mantissa_inline(&input2);
+            mult_result = (uint32_t)input1.mant * (uint32_t)input2.mant;
+
+            //Les bits de poids faible du produit deviennent un bit collant
             result.exp = input1.exp + input2.exp;
-            result.mant = (int32_t)(mult_result >> HF_MANT_SHIFT);
+            result.mant = (int32_t)(mult_result >> HF_MANT_SHIFT) | ((mult_result & (HF_MANT_NORM_MIN - 1)) != 0);
             
-            normalize_and_round(&result);
+            normalize_and_round_inline(&result, flags, mode);
         }
         //Par défaut: Résultat = infini
     }
@@ -180,6 +356,37 @@ uint16_t hf_mul(uint16_t hf1, uint16_t hf2) {
  * @return Le résultat de la division sous forme de demi-flottant
  */
 uint16_t hf_div(uint16_t hf1, uint16_t hf2) {
+    return hf_div_r(hf1, hf2, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Divise deux demi-flottants avec un mode d'arrondi explicite
+ *
+ * @param hf1 Premier demi-flottant (dividende)
+ * @param hf2 Second demi-flottant (diviseur)
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_div_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN2(HF_PROF_DIV, hf1, hf2);
+
+#if defined(HF_CONSTANT_TIME)
+    DISPATCH_ROUNDING_MODE_RET(result, mode, div_ct, hf1, hf2, &flags);
+#else
+    DISPATCH_ROUNDING_MODE_RET(result, mode, div_rounded, hf1, hf2, &flags);
+#endif
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_div_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t div_rounded(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
@@ -192,25 +399,33 @@ uint16_t hf_div(uint16_t hf1, uint16_t hf2) {
     //Gestion unifiée des NaN - propager le premier NaN rencontré
     if(is_nan(&input1) || is_nan(&input2)) {
         result.sign = is_nan(&input1) ? input1.sign : input2.sign;
-    } else if(is_infinity(&input1) && is_infinity(&input2)) {
-        //Inf / Inf = NaN négatif
+        if(IS_SNAN_BITS(hf1) || IS_SNAN_BITS(hf2)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if((is_infinity(&input1) && is_infinity(&input2)) || (is_zero(&input1) && is_zero(&input2))) {
+        //Inf / Inf et 0 / 0 = NaN négatif
         result.sign = HF_ZERO_NEG;
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
     } else if(is_infinity(&input1) || is_zero(&input2)) {
         //Inf / valeur finie = Inf ou Fini / 0 = Inf
+        if(is_zero(&input2) && !is_infinity(&input1)) HF_FE_ACCUM(flags, HF_FE_DIVBYZERO);
         result.mant = 0;
     } else if(is_infinity(&input2) || is_zero(&input1)) {
         //Fini / Inf = 0 ou 0 / Fini = 0
         result.exp = -HF_EXP_BIAS;
         result.mant = 0;
-    } else if(!(is_zero(&input1) && is_zero(&input2))) {
+    } else {
         //Division arithmétique normale
-        uint32_t dividend = input1.mant << HF_MANT_SHIFT;
-        
+        uint32_t dividend;
+
+        //Subnormaux normalisés: le quotient garde au moins 15 bits significatifs
+        normalize_mantissa_inline(&input1);
+        normalize_mantissa_inline(&input2);
+        dividend = (uint32_t)input1.mant << HF_MANT_SHIFT;
+
         result.exp = input1.exp - input2.exp;
         result.mant = dividend / input2.mant;
         if(dividend % input2.mant) result.mant |= 1;
 
-        normalize_and_round(&result);
+        normalize_and_round_inline(&result, flags, mode);
     }
     //Gestion du NaN: valeurs déjà bonnes par défaut
 
@@ -224,6 +439,32 @@ uint16_t hf_div(uint16_t hf1, uint16_t hf2) {
  * @return L'inverse du demi-flottant (1/x)
  */
 uint16_t hf_inv(uint16_t hf) {
+    return hf_inv_r(hf, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Inverse un demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param hf Argument demi-flottant
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_inv_r(uint16_t hf, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_INV, hf);
+
+    DISPATCH_ROUNDING_MODE_RET(result, mode, inv_rounded, hf, &flags);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_inv_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t inv_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input = decompose_half(hf);
     
@@ -239,6 +480,7 @@ uint16_t hf_inv(uint16_t hf) {
         result.mant = 0;
     } else if(is_zero(&input)) {
         //1/0 = Inf (avec le signe)
+        HF_FE_ACCUM(flags, HF_FE_DIVBYZERO);
         result.mant = 0;
     } else if(!is_nan(&input)) {
         //Créer 1.0 avec bit implicite: mantisse = 1.0 en format étendu
@@ -248,10 +490,13 @@ uint16_t hf_inv(uint16_t hf) {
         //Pour 1/x avec exposant débiaisé: exp_result = -exp_input
         result.exp = -input.exp;
 
-        //Division arithmétique: 1.0 / input
+        //Division arithmétique: 1.0 / input (bit collant si le reste est non nul)
         result.mant = dividend / input.mant;
+        if(dividend % input.mant) result.mant |= 1;
         
-        normalize_and_round(&result);
+        normalize_and_round_inline(&result, flags, mode);
+    } else if(IS_SNAN_BITS(hf)) {
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
     }
     //Gestion du NaN: valeurs déjà bonnes par défaut
 
@@ -270,6 +515,36 @@ uint16_t hf_inv(uint16_t hf) {
  * @return Le résultat de la racine carrée sous forme de demi-flottant
  */
 uint16_t hf_sqrt(uint16_t hf) {
+    return hf_sqrt_r(hf, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Calcule la racine carrée d'un demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param hf Argument demi-flottant
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_sqrt_r(uint16_t hf, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_SQRT, hf);
+
+#if defined(HF_CONSTANT_TIME)
+    DISPATCH_ROUNDING_MODE_RET(result, mode, sqrt_ct, hf, &flags);
+#else
+    DISPATCH_ROUNDING_MODE_RET(result, mode, sqrt_rounded, hf, &flags);
+#endif
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_sqrt_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t sqrt_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input  = decompose_half(hf);
     
@@ -305,14 +580,18 @@ uint16_t hf_sqrt(uint16_t hf) {
             input.exp--;
         }
         
-        //Calcul de la racine carrée
+        //Calcul de la racine carrée (bit collant si la racine entière n'est pas exacte)
         root = square_root(value);
+        root |= root * root != value;
 
         if(root > 0) {
             result.exp  = input.exp / 2;
             result.mant = (int32_t)root;
-            normalize_and_round(&result);
+            normalize_and_round_inline(&result, flags, mode);
         }
+    } else if(!is_nan(&input) || IS_SNAN_BITS(hf)) {
+        //Racine d'un négatif (ou NaN signalant): opération invalide
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
     }
     //NaN et -x (incluant -inf) -> NaN: déjà correct par l'initialisation
 
@@ -330,10 +609,36 @@ uint16_t hf_sqrt(uint16_t hf) {
  * @return Le résultat de 1/sqrt(x) sous forme de demi-flottant
  */
 uint16_t hf_rsqrt(uint16_t hf) {
+    return hf_rsqrt_r(hf, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Calcule la racine carrée inverse d'un demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param hf Argument demi-flottant
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat sous forme de demi-flottant
+ */
+uint16_t hf_rsqrt_r(uint16_t hf, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_RSQRT, hf);
+
+    DISPATCH_ROUNDING_MODE_RET(result, mode, rsqrt_rounded, hf, &flags);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Corps de hf_rsqrt_r(), instancié pour chaque mode d'arrondi constant
+ */
+static inline uint16_t rsqrt_rounded(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
     half_float result;
     half_float input  = decompose_half(hf);
 
-    //Initialisation par défaut: +inf (gère automatiquement +/-0)
+    //Initialisation par défaut: +inf (gère automatiquement +0)
     result.sign = HF_ZERO_POS;
     result.exp  = HF_EXP_FULL;
     result.mant = 0;
@@ -341,6 +646,7 @@ uint16_t hf_rsqrt(uint16_t hf) {
     //Cas spéciaux IEEE 754
     if(is_nan(&input) || (input.sign && !is_zero(&input))) {
         //NaN ou x<0 (hors -0, incluant -inf) -> NaN
+        if(!is_nan(&input) || IS_SNAN_BITS(hf)) HF_FE_ACCUM(flags, HF_FE_INVALID);
         result.mant = 1;
     }
     else if(is_infinity(&input)) {
@@ -368,12 +674,15 @@ uint16_t hf_rsqrt(uint16_t hf) {
               
         if(root > 0) {
             uint32_t one = 1U << 31;
-            result.mant = (int32_t)(one / root);
+            result.mant = (int32_t)(one / root) | (one % root != 0 || root * root != value);
             result.exp  = -(input.exp / 2) - 1;
-            normalize_and_round(&result);
+            normalize_and_round_inline(&result, flags, mode);
         }
+    } else {
+        //rsqrt(+/-0) -> +/-inf (IEEE 754: 1/sqrt(-0) = 1/-0), division par zéro
+        result.sign = input.sign;
+        HF_FE_ACCUM(flags, HF_FE_DIVBYZERO);
     }
-    //rsqrt(+/-0) -> +inf: déjà correct par l'initialisation
 
     return compose_half(&result);
 }
@@ -385,6 +694,7 @@ uint16_t hf_rsqrt(uint16_t hf) {
  * @return La racine cubique de hf
  */
 uint16_t hf_cbrt(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_CBRT, hf);
     (void)hf;
     return HF_NAN;
 }
@@ -400,11 +710,27 @@ uint16_t hf_cbrt(uint16_t hf) {
  * @return Le résultat de (hfa * hfb) + hfc
  */
 uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc) {
+    return hf_fma_r(hfa, hfb, hfc, hf_get_rounding_mode());
+}
+
+/**
+ * @brief Multiplication-addition fusionnée (FMA) avec un mode d'arrondi explicite
+ *
+ * @param hfa Premier facteur
+ * @param hfb Second facteur
+ * @param hfc Valeur à ajouter
+ * @param mode Mode d'arrondi à appliquer au résultat
+ * @return Le résultat de (hfa * hfb) + hfc
+ */
+uint16_t hf_fma_r(uint16_t hfa, uint16_t hfb, uint16_t hfc, hf_rounding_mode mode) {
+    unsigned int flags = 0;
     half_float result;
     half_float inputa = decompose_half(hfa);
     half_float inputb = decompose_half(hfb);
     half_float inputc = decompose_half(hfc);
 
+    HF_PROFILE_FN3(HF_PROF_FMA, hfa, hfb, hfc);
+
     //Initialisation par défaut: NaN positif (sécurité)
     result.sign = HF_ZERO_POS;
     result.exp = HF_EXP_FULL;
@@ -415,10 +741,12 @@ uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc) {
         if(is_nan(&inputa)) result.sign = inputa.sign;
         else if(is_nan(&inputb)) result.sign = inputb.sign;
         else result.sign = inputc.sign;
+        if(IS_SNAN_BITS(hfa) || IS_SNAN_BITS(hfb) || IS_SNAN_BITS(hfc)) flags = HF_FE_INVALID;
     }
     //inf * 0 -> NaN (convention)
     else if((is_infinity(&inputa) && is_zero(&inputb)) || (is_infinity(&inputb) && is_zero(&inputa))) {
         result.sign = HF_ZERO_NEG;
+        flags = HF_FE_INVALID;
     }
     //Produit inf (+/-)
     else if(is_infinity(&inputa) || is_infinity(&inputb)) {
@@ -428,6 +756,7 @@ uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc) {
             //inf + inf : si signes opposés -> NaN, sinon inf
             if(prod_sign != inputc.sign) {
                 result.sign = HF_ZERO_NEG;
+                flags = HF_FE_INVALID;
             } else {
                 result = inputc; //inf avec signe
             }
@@ -444,11 +773,12 @@ uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc) {
     }
     else {
         //TODO: implémenter le calcul FMA exact a*b + c
-        //Implémentation temporaire via fonctions existantes
-        uint16_t prod = hf_mul(hfa, hfb);
-        uint16_t sum = hf_add(prod, hfc);
+        //Implémentation temporaire via fonctions existantes (qui lèvent leurs propres exceptions)
+        uint16_t prod = hf_mul_r(hfa, hfb, mode);
+        uint16_t sum = hf_add_r(prod, hfc, mode);
         result = decompose_half(sum);
     }
+    HF_FE_RAISE(flags);
 
     return compose_half(&result);
 }
@@ -456,50 +786,268 @@ uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc) {
 /**
  * @brief Calcule l'hypoténuse (sqrt(x^2 + y^2))
  *
+ * Correctement arrondie dans le mode du thread, sans dépassement ni
+ * soupassement intermédiaire: la somme des carrés des mantisses est exacte
+ * sur 64 bits (voir hypot_rounded()).
+ *
+ * Cas particuliers (IEEE 754):
+ *  - hypot(+/-Inf, y) = hypot(x, +/-Inf) = +Inf, même si l'autre est NaN
+ *  - hypot(NaN, y) = NaN sinon (invalide si signalant)
+ *  - hypot(x, +/-0) = |x|, exact
+ *
  * @param hfx Coordonnée X
  * @param hfy Coordonnée Y
  * @return La longueur de l'hypoténuse
  */
 uint16_t hf_hypot(uint16_t hfx, uint16_t hfy) {
-    (void)hfx; (void)hfy;
-    return HF_NAN;
+    unsigned int flags = 0;
+    uint16_t result;
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_FN2(HF_PROF_HYPOT, hfx, hfy);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, hypot_rounded, hfx, hfy, &flags);
+    HF_FE_RAISE(flags);
+
+    return result;
 }
 
 /**
  * @brief Calcule le reste de la division flottante
  *
+ * Résultat x - trunc(x / y) * y, toujours exact (aucun arrondi) et du signe
+ * de x. Calculé par division longue entière sur les mantisses, sans passer
+ * par la bibliothèque mathématique flottante.
+ *
+ * Cas particuliers (IEEE 754):
+ *  - fmod(+/-Inf, y) et fmod(x, +/-0) = NaN (invalide)
+ *  - fmod(x, +/-Inf) = x pour x fini
+ *  - fmod(+/-0, y) = +/-0
+ *
  * @param hfx Dividende
  * @param hfy Diviseur
  * @return Le reste de hfx / hfy
  */
 uint16_t hf_fmod(uint16_t hfx, uint16_t hfy) {
-    (void)hfx; (void)hfy;
-    return HF_NAN;
+    unsigned int flags = 0;
+    uint16_t result = remainder_exact(hfx, hfy, 0, NULL, &flags);
+
+    HF_PROFILE_FN2(HF_PROF_FMOD, hfx, hfy);
+    HF_FE_RAISE(flags);
+    return result;
 }
 
 /**
- * @brief Calcule le reste de la division avec arrondi
+ * @brief Calcule le reste IEEE de la division (quotient arrondi au plus proche)
+ *
+ * Résultat x - n * y où n est l'entier le plus proche de x / y (au pair en
+ * cas d'égalité), toujours exact et de valeur absolue au plus |y| / 2.
+ * Un résultat nul garde le signe de x. Mêmes cas particuliers que hf_fmod().
  *
  * @param hfx Dividende
  * @param hfy Diviseur
  * @return Le reste arrondi de hfx / hfy
  */
 uint16_t hf_remainder(uint16_t hfx, uint16_t hfy) {
-    (void)hfx; (void)hfy;
-    return HF_NAN;
+    unsigned int flags = 0;
+    uint16_t result = remainder_exact(hfx, hfy, 1, NULL, &flags);
+
+    HF_PROFILE_FN2(HF_PROF_FMOD, hfx, hfy);
+    HF_FE_RAISE(flags);
+    return result;
 }
 
 /**
  * @brief Calcule le reste et le quotient de la division
  *
+ * Même reste que hf_remainder(). *quo reçoit le signe de x / y et les 30 bits
+ * de poids faible du quotient entier n (suffisant pour un numéro de quadrant
+ * en réduction d'argument), 0 pour les cas NaN.
+ *
  * @param hfx Dividende
  * @param hfy Diviseur
  * @param quo Pointeur vers le quotient (optionnel)
  * @return Le reste de hfx / hfy
  */
 uint16_t hf_remquo(uint16_t hfx, uint16_t hfy, int *quo) {
-    (void)hfx; (void)hfy; (void)quo;
-    return HF_NAN;
+    unsigned int flags = 0;
+    uint16_t result = remainder_exact(hfx, hfy, 1, quo, &flags);
+
+    HF_PROFILE_FN2(HF_PROF_FMOD, hfx, hfy);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Additionne deux tableaux de demi-flottants élément par élément
+ *
+ * Calcule out[i] = a[i] + b[i] pour i dans [0, n). Le mode d'arrondi global
+ * est lu une seule fois pour tout le tableau. Les éléments sont traités par
+ * blocs : si tous les opérandes d'un bloc sont finis et normalisés, le bloc
+ * passe par un chemin rapide sans appel ni test de cas spéciaux, sinon chaque
+ * élément spécial est confié à hf_add_r(). Le résultat est identique bit à bit
+ * à celui de hf_add().
+ *
+ * @param a Premier tableau d'opérandes
+ * @param b Second tableau d'opérandes
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_add_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_ADD, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, add_blocks, a, b, out, n, HF_ZERO_POS);
+    }
+}
+
+/**
+ * @brief Soustrait deux tableaux de demi-flottants élément par élément
+ *
+ * Calcule out[i] = a[i] - b[i], identique bit à bit à hf_sub().
+ *
+ * @param a Tableau des premiers opérandes
+ * @param b Tableau des opérandes soustraits
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_sub_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_SUB, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, add_blocks, a, b, out, n, HF_ZERO_NEG);
+    }
+}
+
+/**
+ * @brief Multiplie deux tableaux de demi-flottants élément par élément
+ *
+ * Calcule out[i] = a[i] * b[i], identique bit à bit à hf_mul().
+ *
+ * @param a Premier tableau d'opérandes
+ * @param b Second tableau d'opérandes
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_mul_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_MUL, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, mul_blocks, a, b, out, n);
+    }
+}
+
+/**
+ * @brief Divise deux tableaux de demi-flottants élément par élément
+ *
+ * Calcule out[i] = a[i] / b[i], identique bit à bit à hf_div().
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_div_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_DIV, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, div_blocks, a, b, out, n);
+    }
+}
+
+/**
+ * @brief Multiplication-addition sur trois tableaux de demi-flottants
+ *
+ * Calcule out[i] = a[i] * b[i] + c[i], identique bit à bit à hf_fma().
+ *
+ * @param a Tableau des premiers facteurs
+ * @param b Tableau des seconds facteurs
+ * @param c Tableau des valeurs ajoutées
+ * @param out Tableau résultat (peut être confondu avec a, b ou c)
+ * @param n Nombre d'éléments
+ */
+void hf_fma_n(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_FMA, a, b, c, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, fma_blocks, a, b, c, out, n);
+    }
+}
+
+/**
+ * @brief Calcule la racine carrée d'un tableau de demi-flottants
+ *
+ * Calcule out[i] = sqrt(a[i]), identique bit à bit à hf_sqrt().
+ *
+ * @param a Tableau d'entrée
+ * @param out Tableau résultat (peut être confondu avec a)
+ * @param n Nombre d'éléments
+ */
+void hf_sqrt_n(const uint16_t *a, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    if(!ARITH_PARALLEL(ARITH_PAR_SQRT, a, NULL, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        DISPATCH_ROUNDING_MODE(mode, sqrt_blocks, a, out, n);
+    }
+}
+
+/**
+ * @brief Calcule le reste flottant d'un tableau de demi-flottants
+ *
+ * Calcule out[i] = fmod(a[i], b[i]), identique bit à bit à hf_fmod().
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_fmod_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    if(!ARITH_PARALLEL(ARITH_PAR_FMOD, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        remainder_batch(a, b, out, NULL, n, 0);
+    }
+}
+
+/**
+ * @brief Calcule le reste IEEE d'un tableau de demi-flottants
+ *
+ * Calcule out[i] = remainder(a[i], b[i]), identique bit à bit à hf_remainder().
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau résultat (peut être confondu avec a ou b)
+ * @param n Nombre d'éléments
+ */
+void hf_remainder_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n) {
+    if(!ARITH_PARALLEL(ARITH_PAR_REMAINDER, a, b, NULL, out, NULL, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        remainder_batch(a, b, out, NULL, n, 1);
+    }
+}
+
+/**
+ * @brief Calcule le reste IEEE et le quotient d'un tableau de demi-flottants
+ *
+ * Calcule out[i] = remquo(a[i], b[i], &quo[i]), identique bit à bit à
+ * hf_remquo(). Usage type: réduction d'argument trigonométrique d'un tableau
+ * par une constante (b rempli de pi/2 en demi), quo[i] & 3 donnant le quadrant.
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau des restes (peut être confondu avec a ou b)
+ * @param quo Tableau des quotients partiels (optionnel)
+ * @param n Nombre d'éléments
+ */
+void hf_remquo_n(const uint16_t *a, const uint16_t *b, uint16_t *out, int *quo, size_t n) {
+    if(!ARITH_PARALLEL(ARITH_PAR_REMQUO, a, b, NULL, out, quo, n)) {
+        HF_PROFILE_CALLS(HF_PROF_ARITH_N, n);
+        remainder_batch(a, b, out, quo, n, 1);
+    }
 }
 
 /**
@@ -529,3 +1077,875 @@ static uint32_t square_root(uint32_t value) {
 
     return root;
 }
+
+/**
+ * @brief Calcule la racine carrée entière d'un entier non signé 64 bits
+ *
+ * Même algorithme par décalage que square_root(), sur 32 itérations.
+ *
+ * @param value L'entier non signé dont on veut calculer la racine carrée
+ * @return La racine carrée entière de value (tronquée)
+ */
+static uint32_t square_root_wide(uint64_t value) {
+    uint64_t root = 0;
+    uint64_t rest = 0;
+    int loop = 32;
+
+    while(--loop >= 0) {
+        uint64_t cond;
+        rest  = (rest << 2) | (value >> 62); //Ajoute les 2 bits de poids fort au reste
+        value <<= 2;
+        root  = (root << 2) + 1;             //Diviseur d'essai
+        cond  = (rest >= root);
+        rest -= root & (0 - cond);
+        root  = (root >> 1) + cond;
+    }
+
+    return (uint32_t)root;
+}
+
+/**
+ * @brief Calcule l'hypoténuse arrondie une seule fois
+ *
+ * Avec |x| >= |y| et les mantisses entières mx, my (11 bits, subnormaux
+ * normalisés) d'exposants ex >= ey: S = mx^2 4^d + my^2 (d = ex - ey) est
+ * exacte sur 64 bits pour d <= 20. Au-delà, y^2 < 2^-40 x^2 ne change que le
+ * bit collant: S = mx^2 4^20 + 1. S est recadrée d'un nombre pair de bits
+ * dans [2^58, 2^62), sa racine entière r (31 bits) reçoit un bit collant si
+ * r^2 != S puis normalize_and_round_inline() arrondit une seule fois
+ * (inexact, dépassement et soupassement selon le résultat).
+ *
+ * @param hfx Coordonnée X
+ * @param hfy Coordonnée Y
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ * @return sqrt(x^2 + y^2)
+ */
+static inline uint16_t hypot_rounded(uint16_t hfx, uint16_t hfy, unsigned int *flags, hf_rounding_mode mode) {
+    uint16_t ax = hfx & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t ay = hfy & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t result;
+
+    if(IS_SNAN_BITS(hfx) || IS_SNAN_BITS(hfy)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+
+    if(ax == HF_INFINITY_POS || ay == HF_INFINITY_POS) {
+        //Un infini l'emporte sur NaN
+        result = HF_INFINITY_POS;
+    } else if(ax > HF_INFINITY_POS || ay > HF_INFINITY_POS) {
+        //NaN propagé (le premier rencontré), rendu silencieux
+        result = (uint16_t)((ax > HF_INFINITY_POS ? hfx : hfy) | (1U << (HF_MANT_BITS - 1)));
+    } else if(ax == 0 || ay == 0) {
+        //hypot(x, 0) = |x|: exact
+        result = ax | ay;
+    } else {
+        half_float root;
+        int ex, ey, d, shift;
+        uint32_t mx, my, r;
+        uint64_t sum;
+
+        if(ax < ay) {
+            uint16_t t = ax;
+            ax = ay;
+            ay = t;
+        }
+        ex = ax >> HF_MANT_BITS;
+        ey = ay >> HF_MANT_BITS;
+        mx = (ax & HF_MASK_MANT) | (ex ? 1U << HF_MANT_BITS : 0U);
+        my = (ay & HF_MASK_MANT) | (ey ? 1U << HF_MANT_BITS : 0U);
+
+        //Subnormaux: exposant 1 puis mantisse recadrée sur le bit implicite
+        shift = hf_clz32(mx) - (31 - HF_MANT_BITS);
+        ex += !ex - shift;
+        mx <<= shift;
+        shift = hf_clz32(my) - (31 - HF_MANT_BITS);
+        ey += !ey - shift;
+        my <<= shift;
+
+        //Somme exacte des carrés à l'échelle de y (ou de x / 2^20 si y est négligeable)
+        d = ex - ey;
+        if(d > 20) {
+            sum = ((uint64_t)mx * mx << 40) | 1U;
+            ey = ex - 20;
+        } else {
+            sum = ((uint64_t)mx * mx << (2 * d)) + (uint64_t)my * my;
+        }
+
+        //Recadrage pair dans [2^58, 2^62): racine entière sur 31 bits
+        shift = (hf_clz64(sum) - 2) & ~1;
+        sum <<= shift;
+        r = square_root_wide(sum);
+
+        //x = mx 2^(ex - 25): racine de valeur r 2^(ey - 25 - shift / 2)
+        root.sign = HF_ZERO_POS;
+        root.mant = (int32_t)(r | ((uint64_t)r * r != sum));
+        root.exp = ey - HF_EXP_BIAS - HF_MANT_BITS + HF_MANT_SHIFT - shift / 2;
+        normalize_and_round_inline(&root, flags, mode);
+        result = compose_half(&root);
+    }
+
+    return result;
+}
+
+
+/**
+ * @brief Normalise, arrondit et compose un résultat issu d'un chemin rapide
+ *
+ * Reproduit exactement l'enchaînement normalize_and_round_mode() puis
+ * compose_half() pour une mantisse non signée issue d'opérandes normalisés,
+ * sans passer par la structure half_float. Le décalage de normalisation est
+ * limité par HF_EXP_MIN comme dans la version générale, ce qui produit
+ * directement les subnormaux.
+ *
+ * @param sign Signe du résultat (HF_ZERO_POS ou HF_ZERO_NEG)
+ * @param exp Exposant débiaisé avant normalisation
+ * @param mant Mantisse avec HF_PRECISION_SHIFT bits de précision
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ * @return Le demi-flottant composé
+ */
+static uint16_t round_pack_fast(uint16_t sign, int exp, uint32_t mant, unsigned int *flags, hf_rounding_mode mode) {
+    uint16_t result = sign;
+
+    if(mant != 0) {
+        int shift, margin;
+        uint32_t lost;
+
+        //Position du MSB: décalage pour le placer au bit HF_MANT_SHIFT
+        shift = hf_clz32(mant) - (31 - HF_MANT_SHIFT);
+
+        //Limiter le décalage pour ne pas passer sous HF_EXP_MIN
+        margin = exp - HF_EXP_MIN;
+        if(shift > margin) shift = margin;
+        lost = (shift >= 0) ? 0 : mant & ((1U << -shift) - 1U);
+        mant = (shift >= 0) ? (mant << shift) : ((mant >> -shift) | (lost != 0));
+        exp -= shift;
+
+        //Exceptions comme normalize_and_round_inline(): inexact, soupassement avant arrondi
+        if(lost | (mant & HF_ROUND_BIT_MASK)) {
+            HF_FE_ACCUM(flags, mant < HF_MANT_NORM_MIN ? HF_FE_INEXACT | HF_FE_UNDERFLOW : HF_FE_INEXACT);
+        }
+
+        //Arrondi selon le mode (constant dans les boucles spécialisées)
+        if((mant & HF_ROUND_BIT_MASK) && should_round_up(mant & HF_ROUND_BIT_MASK, mant & (1U << HF_PRECISION_SHIFT), sign, mode)) {
+            mant += 1U << HF_PRECISION_SHIFT;
+            if(mant >= HF_MANT_NORM_MAX) {
+                mant >>= 1;
+                exp++;
+            }
+        }
+
+        //Composition: infini, normalisé ou subnormal
+        if(exp > HF_EXP_BIAS) {
+            //Infini, ou 65504 quand le mode arrondit vers zéro
+            HF_FE_ACCUM(flags, HF_FE_OVERFLOW | HF_FE_INEXACT);
+            result |= should_round_up(HF_ROUND_BIT_MASK, 1U, sign, mode) ? HF_INFINITY_POS : HF_INFINITY_POS - 1;
+        } else if(mant & HF_MANT_NORM_MIN) {
+            result |= (uint16_t)((((exp + HF_EXP_BIAS) & HF_MASK_EXP) << HF_MANT_BITS) | ((mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT));
+        } else {
+            result |= (uint16_t)((mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Addition rapide de deux demi-flottants finis normalisés
+ *
+ * @param hf1 Premier opérande (fini, normalisé)
+ * @param hf2 Second opérande (fini, normalisé)
+ * @param mode Mode d'arrondi
+ * @return hf1 + hf2, identique à hf_add_r()
+ */
+static uint16_t add_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    int exp1 = ((hf1 >> HF_MANT_BITS) & HF_MASK_EXP) - HF_EXP_BIAS;
+    int exp2 = ((hf2 >> HF_MANT_BITS) & HF_MASK_EXP) - HF_EXP_BIAS;
+    int32_t mant1 = ((hf1 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN;
+    int32_t mant2 = ((hf2 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN;
+    int shift = exp1 - exp2;
+    uint16_t sign = HF_ZERO_POS;
+    int32_t sum;
+
+    //Alignement avec bit collant (|shift| <= 29 pour deux normalisés)
+    if(shift > 0) {
+        mant2 = (mant2 >> shift) | ((mant2 & ((1 << shift) - 1)) != 0);
+    } else if(shift < 0) {
+        mant1 = (mant1 >> -shift) | ((mant1 & ((1 << -shift) - 1)) != 0);
+        exp1 = exp2;
+    }
+
+    sum = ((hf1 & HF_MASK_SIGN) ? -mant1 : mant1) + ((hf2 & HF_MASK_SIGN) ? -mant2 : mant2);
+    if(sum < 0) {
+        sign = HF_ZERO_NEG;
+        sum = -sum;
+    } else if(sum == 0 && mode == HF_ROUND_TOWARD_NEG_INF) {
+        sign = HF_ZERO_NEG;
+    }
+
+    return round_pack_fast(sign, exp1, (uint32_t)sum, flags, mode);
+}
+
+/**
+ * @brief Multiplication rapide de deux demi-flottants finis normalisés
+ *
+ * @param hf1 Premier opérande (fini, normalisé)
+ * @param hf2 Second opérande (fini, normalisé)
+ * @param mode Mode d'arrondi
+ * @return hf1 * hf2, identique à hf_mul_r()
+ */
+static uint16_t mul_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    int exp = ((hf1 >> HF_MANT_BITS) & HF_MASK_EXP) + ((hf2 >> HF_MANT_BITS) & HF_MASK_EXP) - 2 * HF_EXP_BIAS;
+    uint32_t mant1 = ((hf1 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN;
+    uint32_t mant2 = ((hf2 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN;
+    uint32_t product = mant1 * mant2;
+
+    //Bits de poids faible du produit repliés en bit collant, comme mul_rounded()
+    return round_pack_fast((hf1 ^ hf2) & HF_MASK_SIGN, exp, (product >> HF_MANT_SHIFT) | ((product & (HF_MANT_NORM_MIN - 1)) != 0), flags, mode);
+}
+
+#if !defined(HF_CONSTANT_TIME)
+/**
+ * @brief Division rapide de deux demi-flottants finis normalisés
+ *
+ * @param hf1 Dividende (fini, normalisé)
+ * @param hf2 Diviseur (fini, normalisé)
+ * @param mode Mode d'arrondi
+ * @return hf1 / hf2, identique à hf_div_r()
+ */
+static uint16_t div_normal_fast(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    int exp = ((hf1 >> HF_MANT_BITS) & HF_MASK_EXP) - ((hf2 >> HF_MANT_BITS) & HF_MASK_EXP);
+    uint32_t dividend = (((hf1 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN) << HF_MANT_SHIFT;
+    uint32_t divisor = ((hf2 & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN;
+    uint32_t quotient = dividend / divisor;
+
+    //Bit collant si la division n'est pas exacte
+    quotient |= (dividend % divisor) != 0;
+
+    return round_pack_fast((hf1 ^ hf2) & HF_MASK_SIGN, exp, quotient, flags, mode);
+}
+
+/**
+ * @brief Racine carrée rapide d'un demi-flottant positif normalisé
+ *
+ * @param hf Opérande (fini, normalisé, positif)
+ * @param mode Mode d'arrondi
+ * @return sqrt(hf), identique à hf_sqrt_r()
+ */
+static uint16_t sqrt_normal_fast(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
+    int exp = ((hf >> HF_MANT_BITS) & HF_MASK_EXP) - HF_EXP_BIAS;
+    uint32_t value = (((hf & HF_MASK_MANT) << HF_PRECISION_SHIFT) | HF_MANT_NORM_MIN) << 15;
+    uint32_t root;
+
+    //Exposant impair: ajustement de l'exposant à pair + mantisse
+    if(exp & 1) {
+        value <<= 1;
+        exp--;
+    }
+
+    //Bit collant si la racine entière n'est pas exacte, comme sqrt_rounded()
+    root = square_root(value);
+    return round_pack_fast(HF_ZERO_POS, exp / 2, root | (root * root != value), flags, mode);
+}
+#endif
+
+/**
+ * @brief Noyau par blocs de hf_add_n() / hf_sub_n()
+ *
+ * @param a Premier tableau d'opérandes
+ * @param b Second tableau d'opérandes
+ * @param out Tableau résultat
+ * @param n Nombre d'éléments
+ * @param flip Masque XOR appliqué au signe de b (HF_ZERO_NEG pour la soustraction)
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ */
+static void add_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, uint16_t flip, hf_rounding_mode mode) {
+    size_t base, i;
+
+#if defined(HF_CONSTANT_TIME)
+    unsigned int flags = 0;
+
+    (void)base;
+    for(i = 0; i < n; i++) out[i] = add_ct(a[i], b[i] ^ flip, &flags, mode);
+    HF_FE_RAISE(flags);
+#else
+    for(base = 0; base < n; base += HF_BATCH_BLOCK) {
+        size_t len = (n - base < HF_BATCH_BLOCK) ? n - base : HF_BATCH_BLOCK;
+        unsigned int special = 0, flags = 0;
+
+        //Test combiné des champs exposants de tout le bloc
+        for(i = base; i < base + len; i++) special |= !IS_NORMAL_BITS(a[i]) | !IS_NORMAL_BITS(b[i]);
+
+        if(!special) {
+            for(i = base; i < base + len; i++) out[i] = add_normal_fast(a[i], b[i] ^ flip, &flags, mode);
+        } else {
+            for(i = base; i < base + len; i++) {
+                uint16_t x = a[i], y = b[i] ^ flip;
+                out[i] = (IS_NORMAL_BITS(x) && IS_NORMAL_BITS(y)) ? add_normal_fast(x, y, &flags, mode) : hf_add_r(x, y, mode);
+            }
+        }
+        HF_FE_RAISE(flags);
+    }
+#endif
+}
+
+/**
+ * @brief Noyau par blocs de hf_mul_n()
+ *
+ * @param a Premier tableau d'opérandes
+ * @param b Second tableau d'opérandes
+ * @param out Tableau résultat
+ * @param n Nombre d'éléments
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ */
+static void mul_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    size_t base, i;
+
+#if defined(HF_CONSTANT_TIME)
+    unsigned int flags = 0;
+
+    (void)base;
+    for(i = 0; i < n; i++) out[i] = mul_ct(a[i], b[i], &flags, mode);
+    HF_FE_RAISE(flags);
+#else
+    for(base = 0; base < n; base += HF_BATCH_BLOCK) {
+        size_t len = (n - base < HF_BATCH_BLOCK) ? n - base : HF_BATCH_BLOCK;
+        unsigned int special = 0, flags = 0;
+
+        for(i = base; i < base + len; i++) special |= !IS_NORMAL_BITS(a[i]) | !IS_NORMAL_BITS(b[i]);
+
+        if(!special) {
+            for(i = base; i < base + len; i++) out[i] = mul_normal_fast(a[i], b[i], &flags, mode);
+        } else {
+            for(i = base; i < base + len; i++) {
+                uint16_t x = a[i], y = b[i];
+                out[i] = (IS_NORMAL_BITS(x) && IS_NORMAL_BITS(y)) ? mul_normal_fast(x, y, &flags, mode) : hf_mul_r(x, y, mode);
+            }
+        }
+        HF_FE_RAISE(flags);
+    }
+#endif
+}
+
+/**
+ * @brief Noyau par blocs de hf_div_n()
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau résultat
+ * @param n Nombre d'éléments
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ */
+static void div_blocks(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    size_t base, i;
+
+#if defined(HF_CONSTANT_TIME)
+    unsigned int flags = 0;
+
+    (void)base;
+    for(i = 0; i < n; i++) out[i] = div_ct(a[i], b[i], &flags, mode);
+    HF_FE_RAISE(flags);
+#else
+    for(base = 0; base < n; base += HF_BATCH_BLOCK) {
+        size_t len = (n - base < HF_BATCH_BLOCK) ? n - base : HF_BATCH_BLOCK;
+        unsigned int special = 0, flags = 0;
+
+        for(i = base; i < base + len; i++) special |= !IS_NORMAL_BITS(a[i]) | !IS_NORMAL_BITS(b[i]);
+
+        if(!special) {
+            for(i = base; i < base + len; i++) out[i] = div_normal_fast(a[i], b[i], &flags, mode);
+        } else {
+            for(i = base; i < base + len; i++) {
+                uint16_t x = a[i], y = b[i];
+                out[i] = (IS_NORMAL_BITS(x) && IS_NORMAL_BITS(y)) ? div_normal_fast(x, y, &flags, mode) : hf_div_r(x, y, mode);
+            }
+        }
+        HF_FE_RAISE(flags);
+    }
+#endif
+}
+
+/**
+ * @brief Noyau par blocs de hf_fma_n()
+ *
+ * Le chemin rapide enchaîne le produit et la somme rapides tant que le
+ * produit intermédiaire reste normalisé, comme hf_fma_r().
+ *
+ * @param a Tableau des premiers facteurs
+ * @param b Tableau des seconds facteurs
+ * @param c Tableau des valeurs ajoutées
+ * @param out Tableau résultat
+ * @param n Nombre d'éléments
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ */
+static void fma_blocks(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint16_t x = a[i], y = b[i], z = c[i];
+
+        if(IS_NORMAL_BITS(x) && IS_NORMAL_BITS(y) && IS_NORMAL_BITS(z)) {
+            uint16_t prod = mul_normal_fast(x, y, &flags, mode);
+            out[i] = IS_NORMAL_BITS(prod) ? add_normal_fast(prod, z, &flags, mode) : hf_add_r(prod, z, mode);
+        } else {
+            out[i] = hf_fma_r(x, y, z, mode);
+        }
+    }
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Noyau par blocs de hf_sqrt_n()
+ *
+ * @param a Tableau d'entrée
+ * @param out Tableau résultat
+ * @param n Nombre d'éléments
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ */
+static void sqrt_blocks(const uint16_t *a, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    size_t base, i;
+
+#if defined(HF_CONSTANT_TIME)
+    unsigned int flags = 0;
+
+    (void)base;
+    for(i = 0; i < n; i++) out[i] = sqrt_ct(a[i], &flags, mode);
+    HF_FE_RAISE(flags);
+#else
+    for(base = 0; base < n; base += HF_BATCH_BLOCK) {
+        size_t len = (n - base < HF_BATCH_BLOCK) ? n - base : HF_BATCH_BLOCK;
+        unsigned int special = 0, flags = 0;
+
+        //Chemin rapide: normalisés positifs uniquement
+        for(i = base; i < base + len; i++) special |= !IS_NORMAL_BITS(a[i]) | ((a[i] & HF_MASK_SIGN) != 0);
+
+        if(!special) {
+            for(i = base; i < base + len; i++) out[i] = sqrt_normal_fast(a[i], &flags, mode);
+        } else {
+            for(i = base; i < base + len; i++) {
+                uint16_t x = a[i];
+                out[i] = (IS_NORMAL_BITS(x) && !(x & HF_MASK_SIGN)) ? sqrt_normal_fast(x, &flags, mode) : hf_sqrt_r(x, mode);
+            }
+        }
+        HF_FE_RAISE(flags);
+    }
+#endif
+}
+
+/**
+ * @brief Reste exact de hfx / hfy (fmod ou remainder IEEE)
+ *
+ * Les mantisses entières (bit implicite compris, subnormaux normalisés) sont
+ * divisées bit à bit: une soustraction conditionnelle sans branchement par
+ * bit de quotient, au plus 40 itérations (écart maximal des exposants). Le
+ * reste r < |y| est exact et se range directement dans le format. Avec
+ * nearest, r est remplacé par |y| - r si r > |y| / 2 (ou égal et quotient
+ * impair), ce qui incrémente le quotient et inverse le signe du reste.
+ *
+ * @param hfx Dividende
+ * @param hfy Diviseur
+ * @param nearest 0 pour fmod (quotient tronqué), 1 pour remainder
+ * @param quo Quotient partiel signé (optionnel, 30 bits de poids faible)
+ * @param flags Mot d'exceptions local (invalide uniquement: le reste est exact)
+ * @return Le reste
+ */
+static uint16_t remainder_exact(uint16_t hfx, uint16_t hfy, int nearest, int *quo, unsigned int *flags) {
+    uint16_t ax = hfx & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t ay = hfy & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t sign = hfx & HF_MASK_SIGN;
+    uint32_t q = 0;
+    uint16_t result;
+
+    if(ax > HF_INFINITY_POS || ay > HF_INFINITY_POS) {
+        //NaN propagé (le premier rencontré), invalide si signalant
+        result = (uint16_t)(HF_NAN | ((ax > HF_INFINITY_POS ? hfx : hfy) & HF_MASK_SIGN));
+        if(IS_SNAN_BITS(hfx) || IS_SNAN_BITS(hfy)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if(ax == HF_INFINITY_POS || ay == 0) {
+        //Inf mod y et x mod 0: NaN négatif, comme 0 / 0
+        result = (uint16_t)(HF_NAN | HF_MASK_SIGN);
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if(ax == 0 || ay == HF_INFINITY_POS) {
+        //0 mod y et x mod Inf: x inchangé, quotient nul
+        result = hfx;
+    } else {
+        int ex = ax >> HF_MANT_BITS;
+        int ey = ay >> HF_MANT_BITS;
+        uint32_t mx = (ax & HF_MASK_MANT) | (ex ? 1U << HF_MANT_BITS : 0U);
+        uint32_t my = (ay & HF_MASK_MANT) | (ey ? 1U << HF_MANT_BITS : 0U);
+        int diff, far;
+
+        //Subnormaux: exposant 1 puis mantisse recadrée sur le bit implicite
+        int shift_x = hf_clz32(mx) - (31 - HF_MANT_BITS);
+        int shift_y = hf_clz32(my) - (31 - HF_MANT_BITS);
+
+        ex += !ex - shift_x;
+        ey += !ey - shift_y;
+        mx <<= shift_x;
+        my <<= shift_y;
+        diff = ex - ey;
+        far = diff < -1;
+
+        if(diff < 0) {
+            //|x| < |y|: quotient nul, reste x; y ramené à l'échelle de x
+            //quand |x| peut encore dépasser |y| / 2 (sinon |x| < |y| / 4)
+            my <<= !far;
+            ey = ex;
+        } else {
+            //Division longue: un bit de quotient par itération
+            int k;
+
+            for(k = 0; k <= diff; k++) {
+                uint32_t ge = (uint32_t)(mx >= my);
+
+                mx -= my & (0U - ge);
+                q = (q << 1) | ge;
+                if(k < diff) mx <<= 1;
+            }
+        }
+
+        //Quotient au plus proche: reste ramené dans [-|y|/2, |y|/2]
+        if(nearest && !far && (2U * mx > my || (2U * mx == my && (q & 1U)))) {
+            mx = my - mx;
+            sign ^= HF_MASK_SIGN;
+            q++;
+        }
+
+        //Rangement exact: r * 2^(ey - 25), renormalisé puis dénormalisé si besoin
+        if(mx != 0 && mx < (1U << HF_MANT_BITS)) {
+            int shift = hf_clz32(mx) - (31 - HF_MANT_BITS);
+
+            if(shift > ey - 1) shift = ey - 1;
+            if(shift > 0) {mx <<= shift; ey -= shift;}
+        }
+        if(ey < 1) {
+            mx = (1 - ey) < 32 ? mx >> (1 - ey) : 0U;
+            ey = 1;
+        }
+        result = mx == 0 ? (hfx & HF_MASK_SIGN) : (uint16_t)(sign | ((mx >= (1U << HF_MANT_BITS)) ? ((uint32_t)(ey - 1) << HF_MANT_BITS) + mx : mx));
+    }
+
+    if(quo) *quo = ((hfx ^ hfy) & HF_MASK_SIGN) ? -(int)(q & 0x3FFFFFFFU) : (int)(q & 0x3FFFFFFFU);
+    return result;
+}
+
+/**
+ * @brief Noyau commun de hf_fmod_n(), hf_remainder_n() et hf_remquo_n()
+ *
+ * @param a Tableau des dividendes
+ * @param b Tableau des diviseurs
+ * @param out Tableau des restes
+ * @param quo Tableau des quotients partiels (optionnel)
+ * @param n Nombre d'éléments
+ * @param nearest 0 pour fmod, 1 pour remainder
+ */
+static void remainder_batch(const uint16_t *a, const uint16_t *b, uint16_t *out, int *quo, size_t n, int nearest) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = remainder_exact(a[i], b[i], nearest, quo ? &quo[i] : NULL, &flags);
+    HF_FE_RAISE(flags);
+}
+
+#if defined(HF_CONSTANT_TIME)
+/**
+ * @brief Décode un demi-flottant en mantisse normalisée, en temps constant
+ *
+ * Les subnormaux sont normalisés par comptage des zéros de tête (aucune
+ * boucle). Le résultat n'a de sens que pour les motifs finis.
+ *
+ * @param hf Motif à décoder
+ * @param exp Exposant débiaisé de la mantisse renvoyée
+ * @return Mantisse avec HF_PRECISION_SHIFT bits de précision (bit HF_MANT_SHIFT à 1), 0 pour un zéro
+ */
+static uint32_t decode_ct(uint16_t hf, int *exp) {
+    uint32_t field = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
+    uint32_t sub = (field == 0);
+    uint32_t mant = ((hf & HF_MASK_MANT) | ((sub ^ 1U) << HF_MANT_BITS)) << HF_PRECISION_SHIFT;
+    int shift = hf_ct_clz32(mant | 1U) - (31 - HF_MANT_SHIFT);
+
+    *exp = (int)field - HF_EXP_BIAS + (int)sub - shift;
+    return mant << shift;
+}
+
+/**
+ * @brief Normalise, arrondit et compose un résultat, en temps constant
+ *
+ * Même résultat et mêmes exceptions que round_pack_fast(): décalage de
+ * normalisation obtenu par comptage des zéros de tête et borné par
+ * HF_EXP_MIN, décalages à droite bornés à 31 avec bit collant, dépassement
+ * et mantisse nulle choisis par masque.
+ *
+ * @param sign Signe du résultat (HF_ZERO_POS ou HF_ZERO_NEG)
+ * @param exp Exposant débiaisé avant normalisation
+ * @param mant Mantisse avec HF_PRECISION_SHIFT bits de précision (< 2^31)
+ * @param flags Exceptions du calcul (écrit, non cumulé)
+ * @param mode Mode d'arrondi à appliquer
+ * @return Le demi-flottant composé
+ */
+static uint16_t round_pack_ct(uint16_t sign, int exp, uint32_t mant, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t nonzero = (mant != 0);
+    int shift = hf_ct_clz32(mant | 1U) - (31 - HF_MANT_SHIFT);
+    int margin = exp - HF_EXP_MIN;
+    int left, right;
+    uint32_t lost, up, carry, tiny, inexact, overflow, bits, saturated;
+
+    //Décalage borné par HF_EXP_MIN, puis séparé en décalages gauche et droite
+    shift = (int)hf_ct_select(shift > margin, (uint32_t)margin, (uint32_t)shift);
+    left = (int)hf_ct_select(shift > 0, (uint32_t)shift, 0U);
+    right = (int)hf_ct_select(-shift > 31, 31U, hf_ct_select(shift < 0, (uint32_t)-shift, 0U));
+    mant <<= left;
+    lost = mant & ((1U << right) - 1U);
+    mant = (mant >> right) | (lost != 0);
+    exp -= shift;
+
+    //Exceptions avant arrondi: inexact, soupassement
+    inexact = (lost | (mant & HF_ROUND_BIT_MASK)) != 0;
+    tiny = mant < HF_MANT_NORM_MIN;
+
+    //Arrondi, report éventuel sur l'exposant
+    up = (uint32_t)should_round_up(mant & HF_ROUND_BIT_MASK, mant & (1U << HF_PRECISION_SHIFT), sign, mode);
+    mant += up << HF_PRECISION_SHIFT;
+    carry = mant >= HF_MANT_NORM_MAX;
+    mant >>= carry;
+    exp += (int)carry;
+
+    //Normalisé et subnormal ont la même formule (exp vaut HF_EXP_MIN sans bit implicite)
+    overflow = nonzero & (exp > HF_EXP_BIAS);
+    bits = ((uint32_t)(exp - HF_EXP_MIN) << HF_MANT_BITS) + (mant >> HF_PRECISION_SHIFT);
+    saturated = hf_ct_select((uint32_t)should_round_up(HF_ROUND_BIT_MASK, 1U, sign, mode), HF_INFINITY_POS, HF_INFINITY_POS - 1);
+    bits = hf_ct_select(overflow, saturated, bits) & (0U - nonzero);
+
+    *flags = (HF_FE_INEXACT & (0U - inexact)) | (HF_FE_UNDERFLOW & (0U - (inexact & tiny))) | ((HF_FE_OVERFLOW | HF_FE_INEXACT) & (0U - overflow));
+    return (uint16_t)(sign | bits);
+}
+
+/**
+ * @brief Addition en temps constant (HF_CONSTANT_TIME)
+ *
+ * Les deux mantisses sont alignées sur le plus grand exposant (décalage
+ * borné à 31 avec bit collant); les résultats spéciaux (NaN, infinis,
+ * zéros) sont calculés en parallèle et choisis par masque.
+ *
+ * @param hf1 Premier opérande
+ * @param hf2 Second opérande
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return hf1 + hf2, identique à hf_add_r()
+ */
+static uint16_t add_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t abs1 = hf1 & ~HF_MASK_SIGN & 0xFFFFU, abs2 = hf2 & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t nan1 = abs1 > HF_INFINITY_POS, nan2 = abs2 > HF_INFINITY_POS;
+    uint32_t inf1 = abs1 == HF_INFINITY_POS, inf2 = abs2 == HF_INFINITY_POS;
+    uint32_t snan = (nan1 & !(hf1 & (1U << (HF_MANT_BITS - 1)))) | (nan2 & !(hf2 & (1U << (HF_MANT_BITS - 1))));
+    uint32_t neg1 = hf1 >> 15, neg2 = hf2 >> 15;
+    uint32_t any_nan = nan1 | nan2, invalid = (inf1 & inf2 & (neg1 ^ neg2)) & (any_nan ^ 1U);
+    int exp1, exp2, emax, d1, d2;
+    uint32_t mant1 = decode_ct(hf1, &exp1), mant2 = decode_ct(hf2, &exp2);
+    uint32_t negative, magnitude, special, result;
+    unsigned int exc;
+    int32_t sum;
+
+    //Alignement sur le plus grand exposant, bit collant
+    emax = (int)hf_ct_select(exp1 > exp2, (uint32_t)exp1, (uint32_t)exp2);
+    d1 = (int)hf_ct_select(emax - exp1 > 31, 31U, (uint32_t)(emax - exp1));
+    d2 = (int)hf_ct_select(emax - exp2 > 31, 31U, (uint32_t)(emax - exp2));
+    mant1 = (mant1 >> d1) | ((mant1 & ((1U << d1) - 1U)) != 0);
+    mant2 = (mant2 >> d2) | ((mant2 & ((1U << d2) - 1U)) != 0);
+
+    //Somme signée (négation par masque), puis valeur absolue (somme nulle: -0 vers -inf)
+    sum = (int32_t)((mant1 ^ (0U - neg1)) + neg1) + (int32_t)((mant2 ^ (0U - neg2)) + neg2);
+    negative = ((uint32_t)sum >> 31) | ((sum == 0) & (mode == HF_ROUND_TOWARD_NEG_INF));
+    magnitude = ((uint32_t)sum ^ (0U - negative)) + negative;
+    result = round_pack_ct((uint16_t)(negative << 15), emax, magnitude, &exc, mode);
+
+    //-0 + -0 = -0 (et -0 + +0 vers -inf), infinis, premier NaN rencontré
+    result = hf_ct_select((abs1 | abs2) == 0, mode == HF_ROUND_TOWARD_NEG_INF ? hf1 | hf2 : hf1 & hf2, result);
+    special = hf_ct_select(invalid, (HF_NAN | HF_MASK_SIGN), hf_ct_select(inf1, hf1, hf2));
+    special = hf_ct_select(any_nan, (hf_ct_select(nan1, hf1, hf2) & HF_MASK_SIGN) | HF_NAN, special);
+    result = hf_ct_select(inf1 | inf2 | any_nan, special, result);
+
+    exc &= 0U - ((inf1 | inf2 | any_nan) ^ 1U);
+    HF_FE_ACCUM(flags, exc | (HF_FE_INVALID & (0U - (snan | invalid))));
+    return (uint16_t)result;
+}
+
+/**
+ * @brief Multiplication en temps constant (HF_CONSTANT_TIME)
+ *
+ * @param hf1 Premier opérande
+ * @param hf2 Second opérande
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return hf1 * hf2, identique à hf_mul_r()
+ */
+static uint16_t mul_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t abs1 = hf1 & ~HF_MASK_SIGN & 0xFFFFU, abs2 = hf2 & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t nan1 = abs1 > HF_INFINITY_POS, nan2 = abs2 > HF_INFINITY_POS;
+    uint32_t inf1 = abs1 == HF_INFINITY_POS, inf2 = abs2 == HF_INFINITY_POS;
+    uint32_t snan = (nan1 & !(hf1 & (1U << (HF_MANT_BITS - 1)))) | (nan2 & !(hf2 & (1U << (HF_MANT_BITS - 1))));
+    uint32_t any_nan = nan1 | nan2, any_inf = inf1 | inf2;
+    uint32_t invalid = ((inf1 & (abs2 == 0)) | (inf2 & (abs1 == 0))) & (any_nan ^ 1U);
+    uint16_t sign = (hf1 ^ hf2) & HF_MASK_SIGN;
+    int exp1, exp2;
+    uint32_t mant1 = decode_ct(hf1, &exp1), mant2 = decode_ct(hf2, &exp2);
+    uint32_t product = mant1 * mant2;
+    uint32_t special, result;
+    unsigned int exc;
+
+    //Bits de poids faible du produit repliés en bit collant, comme mul_rounded()
+    result = round_pack_ct(sign, exp1 + exp2, (product >> HF_MANT_SHIFT) | ((product & (HF_MANT_NORM_MIN - 1)) != 0), &exc, mode);
+
+    special = hf_ct_select(invalid, (HF_NAN | HF_MASK_SIGN), sign | HF_INFINITY_POS);
+    special = hf_ct_select(any_nan, (hf_ct_select(nan1, hf1, hf2) & HF_MASK_SIGN) | HF_NAN, special);
+    result = hf_ct_select(any_inf | any_nan, special, result);
+
+    exc &= 0U - ((any_inf | any_nan) ^ 1U);
+    HF_FE_ACCUM(flags, exc | (HF_FE_INVALID & (0U - (snan | invalid))));
+    return (uint16_t)result;
+}
+
+/**
+ * @brief Division en temps constant (HF_CONSTANT_TIME)
+ *
+ * Le quotient est obtenu par 16 étapes de division restaurante sans
+ * branchement (une soustraction conditionnelle par masque et par bit),
+ * le reste final donnant le bit collant.
+ *
+ * @param hf1 Dividende
+ * @param hf2 Diviseur
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return hf1 / hf2, identique à hf_div_r()
+ */
+static uint16_t div_ct(uint16_t hf1, uint16_t hf2, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t abs1 = hf1 & ~HF_MASK_SIGN & 0xFFFFU, abs2 = hf2 & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t nan1 = abs1 > HF_INFINITY_POS, nan2 = abs2 > HF_INFINITY_POS;
+    uint32_t inf1 = abs1 == HF_INFINITY_POS, inf2 = abs2 == HF_INFINITY_POS;
+    uint32_t zero1 = abs1 == 0, zero2 = abs2 == 0;
+    uint32_t snan = (nan1 & !(hf1 & (1U << (HF_MANT_BITS - 1)))) | (nan2 & !(hf2 & (1U << (HF_MANT_BITS - 1))));
+    uint32_t any_nan = nan1 | nan2;
+    uint32_t invalid = ((inf1 & inf2) | (zero1 & zero2)) & (any_nan ^ 1U);
+    uint32_t infinite = (inf1 | zero2) & ((any_nan | invalid) ^ 1U);
+    uint32_t vanish = (inf2 | zero1) & ((any_nan | invalid | infinite) ^ 1U);
+    uint32_t divbyzero = zero2 & ((any_nan | inf1 | zero1) ^ 1U);
+    uint16_t sign = (hf1 ^ hf2) & HF_MASK_SIGN;
+    int exp1, exp2, i;
+    uint32_t mant1 = decode_ct(hf1, &exp1), mant2 = decode_ct(hf2, &exp2);
+    uint32_t rest = mant1, quotient = 0, special, result;
+    unsigned int exc;
+
+    //Division restaurante: un bit de quotient par étape, de 2^0 à 2^-15
+    for(i = 0; i <= HF_MANT_SHIFT; i++) {
+        uint32_t ge = rest >= mant2;
+        quotient = (quotient << 1) | ge;
+        rest = (rest - (mant2 & (0U - ge))) << 1;
+    }
+    result = round_pack_ct(sign, exp1 - exp2, quotient | (rest != 0), &exc, mode);
+
+    special = hf_ct_select(infinite, sign | HF_INFINITY_POS, sign);
+    special = hf_ct_select(invalid, (HF_NAN | HF_MASK_SIGN), special);
+    special = hf_ct_select(any_nan, (hf_ct_select(nan1, hf1, hf2) & HF_MASK_SIGN) | HF_NAN, special);
+    result = hf_ct_select(any_nan | invalid | infinite | vanish, special, result);
+
+    exc &= 0U - ((any_nan | invalid | infinite | vanish) ^ 1U);
+    HF_FE_ACCUM(flags, exc | (HF_FE_INVALID & (0U - (snan | invalid))) | (HF_FE_DIVBYZERO & (0U - divbyzero)));
+    return (uint16_t)result;
+}
+
+/**
+ * @brief Racine carrée en temps constant (HF_CONSTANT_TIME)
+ *
+ * square_root() effectue toujours 16 itérations sans branchement; la parité
+ * de l'exposant est corrigée par décalage conditionnel.
+ *
+ * @param hf Opérande
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return sqrt(hf), identique à hf_sqrt_r()
+ */
+static uint16_t sqrt_ct(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t abs = hf & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t nan = abs > HF_INFINITY_POS, zero = abs == 0;
+    uint32_t negative = (uint32_t)(hf >> 15) & (zero ^ 1U) & (nan ^ 1U);
+    uint32_t invalid = negative | (nan & !(hf & (1U << (HF_MANT_BITS - 1))));
+    int exp, odd;
+    uint32_t value = decode_ct(hf, &exp) << 15;
+    uint32_t root, special, result;
+    unsigned int exc;
+
+    //Exposant impair: ajustement de l'exposant à pair + mantisse
+    odd = exp & 1;
+    value <<= odd;
+    exp -= odd;
+
+    //Bit collant si la racine entière n'est pas exacte, comme sqrt_rounded()
+    root = square_root(value);
+    result = round_pack_ct(HF_ZERO_POS, exp / 2, root | (root * root != value), &exc, mode);
+
+    //sqrt(+/-0) = +/-0, sqrt(+inf) = +inf, NaN pour un NaN ou un négatif
+    special = hf_ct_select(zero, hf, hf_ct_select(nan | negative, HF_NAN, HF_INFINITY_POS));
+    result = hf_ct_select(zero | nan | negative | (abs == HF_INFINITY_POS), special, result);
+
+    exc &= 0U - ((zero | nan | negative | (abs == HF_INFINITY_POS)) ^ 1U);
+    HF_FE_ACCUM(flags, exc | (HF_FE_INVALID & (0U - invalid)));
+    return (uint16_t)result;
+}
+#endif
+
+#if defined(HF_THREADS)
+/**
+ * @brief Confie un lot au groupe de threads
+ *
+ * @param op Opération du lot
+ * @param a Premier tableau d'opérandes
+ * @param b Second tableau d'opérandes (NULL pour sqrt)
+ * @param c Troisième tableau d'opérandes (fma seulement)
+ * @param out Tableau résultat
+ * @param quo Tableau des quotients (remquo seulement, optionnel)
+ * @param n Nombre d'éléments
+ * @return 1 si le lot a été traité en parallèle, 0 sinon
+ */
+static int arith_parallel(arith_par_op op, const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, int *quo, size_t n) {
+    arith_par_task task;
+
+    task.op = op;
+    task.a = a;
+    task.b = b;
+    task.c = c;
+    task.out = out;
+    task.quo = quo;
+
+    return hf_par_run(arith_par_body, &task, n);
+}
+
+/**
+ * @brief Traite la tranche [begin, end) d'un lot réparti
+ *
+ * Rappelle le noyau public sur la tranche: depuis une tranche, hf_par_run()
+ * renvoie 0 et le noyau s'exécute séquentiellement.
+ *
+ * @param ctx Lot (arith_par_task)
+ * @param begin Premier élément de la tranche
+ * @param end Fin (exclue) de la tranche
+ */
+static void arith_par_body(void *ctx, size_t begin, size_t end) {
+    const arith_par_task *task = (const arith_par_task *)ctx;
+    const uint16_t *a = task->a + begin;
+    const uint16_t *b = task->b ? task->b + begin : NULL;
+    uint16_t *out = task->out + begin;
+    size_t n = end - begin;
+
+    switch(task->op) {
+        case ARITH_PAR_ADD:       hf_add_n(a, b, out, n); break;
+        case ARITH_PAR_SUB:       hf_sub_n(a, b, out, n); break;
+        case ARITH_PAR_MUL:       hf_mul_n(a, b, out, n); break;
+        case ARITH_PAR_DIV:       hf_div_n(a, b, out, n); break;
+        case ARITH_PAR_FMA:       hf_fma_n(a, b, task->c + begin, out, n); break;
+        case ARITH_PAR_SQRT:      hf_sqrt_n(a, out, n); break;
+        case ARITH_PAR_FMOD:      hf_fmod_n(a, b, out, n); break;
+        case ARITH_PAR_REMAINDER: hf_remainder_n(a, b, out, n); break;
+        case ARITH_PAR_REMQUO:    hf_remquo_n(a, b, out, task->quo ? task->quo + begin : NULL, n); break;
+        default: break;
+    }
+}
+#endif
@@ -13,31 +13,53 @@
 #ifndef HF_LIB_ARITH_H
 #define HF_LIB_ARITH_H
 
+#include <stddef.h>
 #include "hf_lib_common.h"
 
 //Opérations unaires
-uint16_t hf_neg(uint16_t hf);
-uint16_t hf_abs(uint16_t hf);
+HF_API uint16_t hf_neg(uint16_t hf);
+HF_API uint16_t hf_abs(uint16_t hf);
 
 //Opérations arithmétiques de base
-uint16_t hf_add(uint16_t hf1, uint16_t hf2);
-uint16_t hf_sub(uint16_t hf1, uint16_t hf2);
-uint16_t hf_mul(uint16_t hf1, uint16_t hf2);
-uint16_t hf_div(uint16_t hf1, uint16_t hf2);
-uint16_t hf_inv(uint16_t hf);
+HF_API uint16_t hf_add(uint16_t hf1, uint16_t hf2);
+HF_API uint16_t hf_sub(uint16_t hf1, uint16_t hf2);
+HF_API uint16_t hf_mul(uint16_t hf1, uint16_t hf2);
+HF_API uint16_t hf_div(uint16_t hf1, uint16_t hf2);
+HF_API uint16_t hf_inv(uint16_t hf);
 
 //Fonctions de racines
-uint16_t hf_sqrt(uint16_t hf);
-uint16_t hf_rsqrt(uint16_t hf);
-uint16_t hf_cbrt(uint16_t hf);
+HF_API uint16_t hf_sqrt(uint16_t hf);
+HF_API uint16_t hf_rsqrt(uint16_t hf);
+HF_API uint16_t hf_cbrt(uint16_t hf);
 
 //Opérations avancées
-uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc);  //a*b+c
-uint16_t hf_hypot(uint16_t hfx, uint16_t hfy);              //sqrt(x^2+y^2)
+HF_API uint16_t hf_fma(uint16_t hfa, uint16_t hfb, uint16_t hfc);  //a*b+c
+HF_API uint16_t hf_hypot(uint16_t hfx, uint16_t hfy);              //sqrt(x^2+y^2)
+
+//Variantes avec mode d'arrondi explicite (sans lecture du mode du thread)
+HF_API uint16_t hf_add_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode);
+HF_API uint16_t hf_sub_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode);
+HF_API uint16_t hf_mul_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode);
+HF_API uint16_t hf_div_r(uint16_t hf1, uint16_t hf2, hf_rounding_mode mode);
+HF_API uint16_t hf_inv_r(uint16_t hf, hf_rounding_mode mode);
+HF_API uint16_t hf_sqrt_r(uint16_t hf, hf_rounding_mode mode);
+HF_API uint16_t hf_rsqrt_r(uint16_t hf, hf_rounding_mode mode);
+HF_API uint16_t hf_fma_r(uint16_t hfa, uint16_t hfb, uint16_t hfc, hf_rounding_mode mode);
 
 //Opérations modulo
-uint16_t hf_fmod(uint16_t hfx, uint16_t hfy);              //x mod y
-uint16_t hf_remainder(uint16_t hfx, uint16_t hfy);         //IEEE remainder
-uint16_t hf_remquo(uint16_t hfx, uint16_t hfy, int *quo);  //remainder + quotient
+HF_API uint16_t hf_fmod(uint16_t hfx, uint16_t hfy);              //x mod y
+HF_API uint16_t hf_remainder(uint16_t hfx, uint16_t hfy);         //IEEE remainder
+HF_API uint16_t hf_remquo(uint16_t hfx, uint16_t hfy, int *quo);  //remainder + quotient
+
+//Opérations par lots sur tableaux (identiques bit à bit aux versions scalaires)
+HF_API void hf_add_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_sub_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_mul_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_div_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_fma_n(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *out, size_t n);
+HF_API void hf_sqrt_n(const uint16_t *a, uint16_t *out, size_t n);
+HF_API void hf_fmod_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_remainder_n(const uint16_t *a, const uint16_t *b, uint16_t *out, size_t n);
+HF_API void hf_remquo_n(const uint16_t *a, const uint16_t *b, uint16_t *out, int *quo, size_t n);
 
 #endif //HF_LIB_ARITH_H
@@ -0,0 +1,547 @@
+/**
+ * @file hf_lib_blas.c
+ * @brief Implémentation des réductions et noyaux d'algèbre linéaire pour Half-Float
+ *
+ * Tous les noyaux reposent sur un accumulateur exact: un produit de deux
+ * demi-flottants finis vaut m1*m2 * 2^(e1+e2-50) avec m1*m2 < 2^22 et
+ * e1+e2-50 >= -48, il est donc représenté sans perte en virgule fixe de
+ * LSB 2^-48 (au plus 2^80 en valeur absolue). La somme est tenue sur 128 bits
+ * en complément à deux et n'est arrondie qu'une fois, ce qui rend le résultat
+ * indépendant de l'ordre des termes et du découpage en blocs.
+ *
+ * La boucle interne (acc_add_dot/acc_add_sum) est sans branchement: chaque
+ * terme décalé est ajouté à l'un de deux accumulateurs 64 bits selon son
+ * exposant, repliés dans l'accumulateur 128 bits tous les ACC_CHUNK termes,
+ * ce qui permet au compilateur de la vectoriser. Les NaN et infinis sont
+ * masqués dans cette boucle puis traités par un second passage sur le bloc.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include "hf_lib_blas.h"
+
+#define ACC_FRAC_BITS 48                    //LSB de l'accumulateur: 2^-48 (produit de deux plus petits subnormaux)
+#define ACC_SUBNORMAL_SHIFT 24              //Position du LSB des subnormaux (2^-24) dans l'accumulateur
+#define ACC_CHUNK 512                       //Termes par repli (|accumulateur 64 bits| < 2^62)
+
+//Indicateurs de l'accumulateur
+#define ACC_HAS_TERMS     0x01U             //Au moins un terme ajouté
+#define ACC_NOT_NEG_ZERO  0x02U             //Au moins un terme différent de -0
+#define ACC_NOT_POS_ZERO  0x04U             //Au moins un terme différent de +0
+#define ACC_NAN           0x08U             //NaN en entrée (premier NaN conservé)
+#define ACC_INVALID       0x10U             //Opération invalide (inf*0, NaN signalant)
+#define ACC_POS_INF       0x20U             //Terme +inf
+#define ACC_NEG_INF       0x40U             //Terme -inf
+#define ACC_SPECIAL_MASK  (ACC_NAN | ACC_INVALID | ACC_POS_INF | ACC_NEG_INF)
+
+//Blocage du produit matrice-vecteur (lignes traitées ensemble, colonnes par bloc de x)
+#define GEMV_ROWS 4
+#define GEMV_COLS 2048
+
+//Blocage du produit matrice-matrice (tuile de C, bloc de k recopié de B)
+#define GEMM_MB 16
+#define GEMM_NB 16
+#define GEMM_KB 256
+
+//Accumulateur exact (somme en complément à deux sur 128 bits, LSB = 2^-48)
+typedef struct {
+    uint64_t lo;                            //64 bits de poids faible
+    uint64_t hi;                            //64 bits de poids fort (bit 63 = signe)
+    unsigned int flags;                     //Indicateurs ACC_*
+    uint16_t nan;                           //Premier NaN rencontré (si ACC_NAN)
+} hf_acc;
+
+//Déclaration des helpers statiques
+static void acc_reset(hf_acc *acc);
+static void acc_add_fixed(hf_acc *acc, int64_t value, int shift);
+static void acc_add_dot(hf_acc *acc, const uint16_t *a, const uint16_t *b, size_t n);
+static void acc_add_sum(hf_acc *acc, const uint16_t *a, size_t n);
+static void acc_scan_dot_specials(hf_acc *acc, const uint16_t *a, const uint16_t *b, size_t n);
+static void acc_scan_sum_specials(hf_acc *acc, const uint16_t *a, size_t n);
+static void acc_add_infinity(hf_acc *acc, uint16_t sign);
+static void acc_add_nan(hf_acc *acc, uint16_t hf);
+static uint16_t acc_round(const hf_acc *acc, unsigned int *flags, hf_rounding_mode mode);
+static int msb64(uint64_t value);
+static uint64_t shr128(uint64_t hi, uint64_t lo, int shift);
+static int low_bits_nonzero(uint64_t hi, uint64_t lo, int count);
+
+/**
+ * @brief Produit scalaire de deux tableaux de demi-flottants
+ *
+ * Calcule la somme exacte des a[i]*b[i] puis l'arrondit une seule fois selon
+ * le mode d'arrondi du thread (arrondi correct). Les NaN se propagent,
+ * inf*0 et +inf + -inf donnent NaN, et un tableau vide donne +0.
+ *
+ * @param a Premier tableau
+ * @param b Second tableau
+ * @param n Nombre d'éléments
+ * @return Le produit scalaire arrondi en demi-précision
+ */
+uint16_t hf_dot(const uint16_t *a, const uint16_t *b, size_t n) {
+    unsigned int flags = 0;
+    uint16_t result;
+    hf_acc acc;
+
+    HF_PROFILE_CALLS(HF_PROF_BLAS, n);
+    acc_reset(&acc);
+    acc_add_dot(&acc, a, b, n);
+    result = acc_round(&acc, &flags, hf_get_rounding_mode());
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Somme d'un tableau de demi-flottants
+ *
+ * Calcule la somme exacte des a[i] puis l'arrondit une seule fois selon
+ * le mode d'arrondi du thread.
+ *
+ * @param a Tableau d'entrée
+ * @param n Nombre d'éléments
+ * @return La somme arrondie en demi-précision
+ */
+uint16_t hf_sum(const uint16_t *a, size_t n) {
+    unsigned int flags = 0;
+    uint16_t result;
+    hf_acc acc;
+
+    HF_PROFILE_CALLS(HF_PROF_BLAS, n);
+    acc_reset(&acc);
+    acc_add_sum(&acc, a, n);
+    result = acc_round(&acc, &flags, hf_get_rounding_mode());
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Calcule y = alpha*x + y élément par élément
+ *
+ * Chaque y[i] est la valeur exacte alpha*x[i] + y[i] arrondie une seule fois
+ * selon le mode d'arrondi du thread.
+ *
+ * @param alpha Facteur appliqué à x
+ * @param x Tableau d'entrée
+ * @param y Tableau mis à jour (ne doit pas chevaucher x, sauf s'il lui est identique)
+ * @param n Nombre d'éléments
+ */
+void hf_axpy(uint16_t alpha, const uint16_t *x, uint16_t *y, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_BLAS, n);
+    for(i = 0; i < n; i++) {
+        hf_acc acc;
+
+        acc_reset(&acc);
+        acc_add_dot(&acc, &alpha, &x[i], 1);
+        acc_add_sum(&acc, &y[i], 1);
+        y[i] = acc_round(&acc, &flags, mode);
+    }
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Produit matrice-vecteur y = A.x
+ *
+ * Chaque y[i] est le produit scalaire exact de la ligne i par x, arrondi une
+ * fois: le résultat est identique à hf_dot(&a[i*lda], x, n). Les lignes sont
+ * traitées par groupes de GEMV_ROWS sur des blocs de GEMV_COLS colonnes pour
+ * que le bloc courant de x reste en cache.
+ *
+ * @param a Matrice m x n rangée par lignes
+ * @param lda Pas entre deux lignes de a (>= n)
+ * @param x Vecteur de n éléments
+ * @param y Vecteur résultat de m éléments (ne doit chevaucher ni a ni x)
+ * @param m Nombre de lignes
+ * @param n Nombre de colonnes
+ */
+void hf_gemv(const uint16_t *a, size_t lda, const uint16_t *x, uint16_t *y, size_t m, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    hf_acc acc[GEMV_ROWS];
+    unsigned int flags = 0;
+    size_t i0, j0;
+
+    HF_PROFILE_CALLS(HF_PROF_BLAS, m * n);
+    for(i0 = 0; i0 < m; i0 += GEMV_ROWS) {
+        size_t rows = (m - i0 < GEMV_ROWS) ? m - i0 : GEMV_ROWS;
+        size_t r;
+
+        for(r = 0; r < rows; r++) acc_reset(&acc[r]);
+
+        for(j0 = 0; j0 < n; j0 += GEMV_COLS) {
+            size_t cols = (n - j0 < GEMV_COLS) ? n - j0 : GEMV_COLS;
+            for(r = 0; r < rows; r++) acc_add_dot(&acc[r], &a[(i0 + r) * lda + j0], &x[j0], cols);
+        }
+
+        for(r = 0; r < rows; r++) y[i0 + r] = acc_round(&acc[r], &flags, mode);
+    }
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Produit matrice-matrice C = A.B
+ *
+ * Chaque élément de C est le produit scalaire exact d'une ligne de A par une
+ * colonne de B, arrondi une fois. C est calculée par tuiles GEMM_MB x GEMM_NB;
+ * pour chaque bloc de GEMM_KB valeurs de k, les colonnes de la tuile de B sont
+ * recopiées de façon contiguë pour que la boucle interne soit un produit
+ * scalaire sur deux tableaux contigus.
+ *
+ * @param a Matrice m x k rangée par lignes
+ * @param lda Pas entre deux lignes de a (>= k)
+ * @param b Matrice k x n rangée par lignes
+ * @param ldb Pas entre deux lignes de b (>= n)
+ * @param c Matrice résultat m x n (ne doit chevaucher ni a ni b)
+ * @param ldc Pas entre deux lignes de c (>= n)
+ * @param m Nombre de lignes de A et C
+ * @param n Nombre de colonnes de B et C
+ * @param k Nombre de colonnes de A et de lignes de B
+ */
+void hf_gemm(const uint16_t *a, size_t lda, const uint16_t *b, size_t ldb, uint16_t *c, size_t ldc,
+             size_t m, size_t n, size_t k) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    uint16_t packed[GEMM_NB][GEMM_KB];
+    hf_acc acc[GEMM_MB][GEMM_NB];
+    unsigned int flags = 0;
+    size_t i0, j0, k0;
+
+    HF_PROFILE_CALLS(HF_PROF_BLAS, m * n * k);
+    for(j0 = 0; j0 < n; j0 += GEMM_NB) {
+        size_t nb = (n - j0 < GEMM_NB) ? n - j0 : GEMM_NB;
+
+        for(i0 = 0; i0 < m; i0 += GEMM_MB) {
+            size_t mb = (m - i0 < GEMM_MB) ? m - i0 : GEMM_MB;
+            size_t ii, jj, kk;
+
+            for(ii = 0; ii < mb; ii++)
+                for(jj = 0; jj < nb; jj++) acc_reset(&acc[ii][jj]);
+
+            for(k0 = 0; k0 < k; k0 += GEMM_KB) {
+                size_t kb = (k - k0 < GEMM_KB) ? k - k0 : GEMM_KB;
+
+                //Recopie transposée du bloc de B (lecture des lignes de B dans l'ordre)
+                for(kk = 0; kk < kb; kk++) {
+                    const uint16_t *row = &b[(k0 + kk) * ldb + j0];
+                    for(jj = 0; jj < nb; jj++) packed[jj][kk] = row[jj];
+                }
+
+                for(ii = 0; ii < mb; ii++) {
+                    const uint16_t *row = &a[(i0 + ii) * lda + k0];
+                    for(jj = 0; jj < nb; jj++) acc_add_dot(&acc[ii][jj], row, packed[jj], kb);
+                }
+            }
+
+            for(ii = 0; ii < mb; ii++)
+                for(jj = 0; jj < nb; jj++) c[(i0 + ii) * ldc + j0 + jj] = acc_round(&acc[ii][jj], &flags, mode);
+        }
+    }
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Remet un accumulateur à zéro
+ *
+ * @param acc Accumulateur
+ */
+static void acc_reset(hf_acc *acc) {
+    acc->lo = 0;
+    acc->hi = 0;
+    acc->flags = 0;
+    acc->nan = HF_NAN;
+}
+
+/**
+ * @brief Ajoute value * 2^shift à l'accumulateur 128 bits
+ *
+ * @param acc Accumulateur
+ * @param value Valeur signée en unités de LSB
+ * @param shift Décalage à gauche (0 <= shift < 64)
+ */
+static void acc_add_fixed(hf_acc *acc, int64_t value, int shift) {
+    uint64_t lo = (uint64_t)value;
+    uint64_t hi = (value < 0) ? ~0ULL : 0ULL;
+
+    if(shift > 0) {
+        hi = (hi << shift) | (lo >> (64 - shift));
+        lo <<= shift;
+    }
+
+    acc->lo += lo;
+    acc->hi += hi + (acc->lo < lo);
+}
+
+/**
+ * @brief Ajoute exactement les produits a[i]*b[i] à l'accumulateur
+ *
+ * Terme i: |a[i]*b[i]| = ma*mb * 2^(ea+eb-2) en unités de 2^-48 (ea, eb: champs
+ * exposant, ramenés à 1 pour les subnormaux). Les termes d'exposant < 32 vont
+ * dans low, les autres dans high (décalés de 32 de moins): |terme| < 2^53.
+ *
+ * @param acc Accumulateur
+ * @param a Premier tableau
+ * @param b Second tableau
+ * @param n Nombre d'éléments
+ */
+static void acc_add_dot(hf_acc *acc, const uint16_t *a, const uint16_t *b, size_t n) {
+    size_t base, i;
+
+    for(base = 0; base < n; base += ACC_CHUNK) {
+        size_t len = (n - base < ACC_CHUNK) ? n - base : ACC_CHUNK;
+        int64_t low = 0, high = 0;
+        uint32_t special = 0, not_neg_zero = 0, not_pos_zero = 0;
+
+        for(i = 0; i < len; i++) {
+            uint32_t x = a[base + i], y = b[base + i];
+            uint32_t ex = (x >> HF_MANT_BITS) & HF_MASK_EXP;
+            uint32_t ey = (y >> HF_MANT_BITS) & HF_MASK_EXP;
+            uint32_t mx = (x & HF_MASK_MANT) | ((uint32_t)(ex != 0) << HF_MANT_BITS);
+            uint32_t my = (y & HF_MASK_MANT) | ((uint32_t)(ey != 0) << HF_MANT_BITS);
+            uint32_t shift = ex + ey + (ex == 0) + (ey == 0) - 2;
+            uint32_t neg = ((x ^ y) >> HF_SIGN_BITS) & 1U;
+            uint32_t spec = (ex == HF_MASK_EXP) | (ey == HF_MASK_EXP);
+            int64_t prod = spec ? 0 : (int64_t)(mx * my);
+            int64_t term = prod << (shift & 31U);
+
+            term = neg ? -term : term;
+            low += (shift < 32) ? term : 0;
+            high += (shift < 32) ? 0 : term;
+            special |= spec;
+            not_neg_zero |= (prod != 0) | (neg ^ 1U);
+            not_pos_zero |= (prod != 0) | neg;
+        }
+
+        acc_add_fixed(acc, low, 0);
+        acc_add_fixed(acc, high, 32);
+        if(len) acc->flags |= ACC_HAS_TERMS;
+        if(not_neg_zero) acc->flags |= ACC_NOT_NEG_ZERO;
+        if(not_pos_zero) acc->flags |= ACC_NOT_POS_ZERO;
+        if(special) acc_scan_dot_specials(acc, &a[base], &b[base], len);
+    }
+}
+
+/**
+ * @brief Ajoute exactement les valeurs a[i] à l'accumulateur
+ *
+ * Terme i: |a[i]| = m * 2^(e-1) en unités de 2^-24 (< 2^40), replié avec un
+ * décalage de ACC_FRAC_BITS - ACC_SUBNORMAL_SHIFT.
+ *
+ * @param acc Accumulateur
+ * @param a Tableau d'entrée
+ * @param n Nombre d'éléments
+ */
+static void acc_add_sum(hf_acc *acc, const uint16_t *a, size_t n) {
+    size_t base, i;
+
+    for(base = 0; base < n; base += ACC_CHUNK) {
+        size_t len = (n - base < ACC_CHUNK) ? n - base : ACC_CHUNK;
+        int64_t total = 0;
+        uint32_t special = 0, not_neg_zero = 0, not_pos_zero = 0;
+
+        for(i = 0; i < len; i++) {
+            uint32_t x = a[base + i];
+            uint32_t ex = (x >> HF_MANT_BITS) & HF_MASK_EXP;
+            uint32_t mx = (x & HF_MASK_MANT) | ((uint32_t)(ex != 0) << HF_MANT_BITS);
+            uint32_t shift = ex + (ex == 0) - 1;
+            uint32_t neg = (x >> HF_SIGN_BITS) & 1U;
+            uint32_t spec = (ex == HF_MASK_EXP);
+            int64_t mag = (int64_t)(mx & (spec - 1U));  //Masque nul pour NaN/inf
+            int64_t term = mag << (shift & 31U);
+
+            term = neg ? -term : term;
+            total += term;
+            special |= spec;
+            not_neg_zero |= (mx != 0) | (neg ^ 1U);
+            not_pos_zero |= (mx != 0) | neg;
+        }
+
+        acc_add_fixed(acc, total, ACC_FRAC_BITS - ACC_SUBNORMAL_SHIFT);
+        if(len) acc->flags |= ACC_HAS_TERMS;
+        if(not_neg_zero) acc->flags |= ACC_NOT_NEG_ZERO;
+        if(not_pos_zero) acc->flags |= ACC_NOT_POS_ZERO;
+        if(special) acc_scan_sum_specials(acc, &a[base], len);
+    }
+}
+
+/**
+ * @brief Traite les NaN et infinis d'un bloc de produits
+ *
+ * @param acc Accumulateur
+ * @param a Premier tableau (bloc)
+ * @param b Second tableau (bloc)
+ * @param n Nombre d'éléments du bloc
+ */
+static void acc_scan_dot_specials(hf_acc *acc, const uint16_t *a, const uint16_t *b, size_t n) {
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint16_t x = a[i], y = b[i];
+        uint16_t x_abs = x & ~HF_MASK_SIGN, y_abs = y & ~HF_MASK_SIGN;
+
+        if(x_abs > HF_INFINITY_POS || y_abs > HF_INFINITY_POS) {
+            //Les deux NaN sont enregistrés pour qu'un NaN signalant en second opérande lève invalide
+            if(x_abs > HF_INFINITY_POS) acc_add_nan(acc, x);
+            if(y_abs > HF_INFINITY_POS) acc_add_nan(acc, y);
+        } else if(x_abs == HF_INFINITY_POS || y_abs == HF_INFINITY_POS) {
+            //inf*0 invalide, sinon infini du signe du produit
+            if(x_abs == 0 || y_abs == 0) acc->flags |= ACC_INVALID;
+            else acc_add_infinity(acc, (x ^ y) & HF_MASK_SIGN);
+        }
+    }
+}
+
+/**
+ * @brief Traite les NaN et infinis d'un bloc de valeurs
+ *
+ * @param acc Accumulateur
+ * @param a Tableau (bloc)
+ * @param n Nombre d'éléments du bloc
+ */
+static void acc_scan_sum_specials(hf_acc *acc, const uint16_t *a, size_t n) {
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint16_t x_abs = a[i] & ~HF_MASK_SIGN;
+
+        if(x_abs > HF_INFINITY_POS) acc_add_nan(acc, a[i]);
+        else if(x_abs == HF_INFINITY_POS) acc_add_infinity(acc, a[i] & HF_MASK_SIGN);
+    }
+}
+
+/**
+ * @brief Enregistre un terme infini
+ *
+ * @param acc Accumulateur
+ * @param sign Signe du terme (HF_ZERO_POS ou HF_ZERO_NEG)
+ */
+static void acc_add_infinity(hf_acc *acc, uint16_t sign) {
+    acc->flags |= sign ? ACC_NEG_INF : ACC_POS_INF;
+}
+
+/**
+ * @brief Enregistre un NaN d'entrée (seul le premier est conservé)
+ *
+ * @param acc Accumulateur
+ * @param hf NaN rencontré
+ */
+static void acc_add_nan(hf_acc *acc, uint16_t hf) {
+    if(!(acc->flags & ACC_NAN)) acc->nan = (hf & HF_MASK_SIGN) | HF_NAN;
+    acc->flags |= ACC_NAN;
+    if(!(hf & HF_NAN & HF_MASK_MANT)) acc->flags |= ACC_INVALID;
+}
+
+/**
+ * @brief Arrondit la valeur exacte de l'accumulateur en demi-précision
+ *
+ * Arrondi correct dans les cinq modes: les 11 bits conservés (10 pour les
+ * subnormaux) sont extraits de la valeur 128 bits, le bit de garde et le bit
+ * collant sont regroupés au format HF_ROUND_BIT_MASK de should_round_up().
+ * En cas de dépassement, le résultat est l'infini ou le plus grand fini selon
+ * le sens de l'arrondi. Une somme nulle exacte suit les règles IEEE 754 de
+ * l'addition: -0 si tous les termes sont -0 (ou, vers -inf, si l'un d'eux
+ * n'est pas +0), +0 sinon.
+ * Les exceptions du seul arrondi final sont cumulées dans *flags (la somme
+ * intermédiaire étant exacte, aucune autre n'est possible).
+ *
+ * @param acc Accumulateur
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return Le demi-flottant arrondi
+ */
+static uint16_t acc_round(const hf_acc *acc, unsigned int *flags, hf_rounding_mode mode) {
+    uint64_t lo = acc->lo, hi = acc->hi;
+    uint16_t sign = HF_ZERO_POS;
+    uint16_t result;
+
+    if(acc->flags & ACC_SPECIAL_MASK) {
+        //NaN d'entrée prioritaire, puis opérations invalides, puis infini
+        int invalid = (acc->flags & ACC_INVALID) || ((acc->flags & ACC_POS_INF) && (acc->flags & ACC_NEG_INF));
+
+        if(acc->flags & ACC_NAN) result = acc->nan;
+        else if(invalid) result = HF_ZERO_NEG | HF_NAN;
+        else result = (acc->flags & ACC_NEG_INF) ? HF_INFINITY_NEG : HF_INFINITY_POS;
+        if(invalid) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else {
+        //Valeur absolue et signe de la somme
+        if(hi >> 63) {
+            sign = HF_ZERO_NEG;
+            lo = ~lo + 1;
+            hi = ~hi + (lo == 0);
+        }
+
+        if((hi | lo) == 0) {
+            //Somme nulle exacte
+            if(!(acc->flags & ACC_HAS_TERMS)) result = HF_ZERO_POS;
+            else if(mode == HF_ROUND_TOWARD_NEG_INF) result = (acc->flags & ACC_NOT_POS_ZERO) ? HF_ZERO_NEG : HF_ZERO_POS;
+            else result = (acc->flags & ACC_NOT_NEG_ZERO) ? HF_ZERO_POS : HF_ZERO_NEG;
+        } else {
+            int lead = hi ? 64 + msb64(hi) : msb64(lo);
+            int shift = (lead - HF_MANT_BITS > ACC_SUBNORMAL_SHIFT) ? lead - HF_MANT_BITS : ACC_SUBNORMAL_SHIFT;
+            uint32_t kept = (uint32_t)shr128(hi, lo, shift);
+            uint32_t guard = (uint32_t)shr128(hi, lo, shift - 1) & 1U;
+            uint32_t round_bits = (guard << (HF_PRECISION_SHIFT - 1)) | (uint32_t)low_bits_nonzero(hi, lo, shift - 1);
+            uint32_t bits;
+
+            if(should_round_up(round_bits, kept & 1U, sign, mode)) kept++;
+
+            //Inexact si des bits sont perdus, soupassement si de plus la valeur exacte est sous 2^-14
+            if(round_bits) HF_FE_ACCUM(flags, lead < ACC_SUBNORMAL_SHIFT + HF_MANT_BITS ? HF_FE_INEXACT | HF_FE_UNDERFLOW : HF_FE_INEXACT);
+
+            //kept >= 2^10 apporte le bit implicite (et la retenue éventuelle) dans le champ exposant
+            bits = ((uint32_t)(shift - ACC_SUBNORMAL_SHIFT) << HF_MANT_BITS) + kept;
+            if(bits >= HF_INFINITY_POS) {
+                int to_max = mode == HF_ROUND_TOWARD_ZERO ||
+                             (mode == HF_ROUND_TOWARD_POS_INF && sign) ||
+                             (mode == HF_ROUND_TOWARD_NEG_INF && !sign);
+                bits = to_max ? HF_INFINITY_POS - 1 : HF_INFINITY_POS;
+                HF_FE_ACCUM(flags, HF_FE_OVERFLOW | HF_FE_INEXACT);
+            }
+            result = sign | (uint16_t)bits;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Position du bit de poids fort d'un entier 64 bits non nul
+ *
+ * @param value Valeur non nulle
+ * @return Indice du bit de poids fort (0 à 63)
+ */
+static int msb64(uint64_t value) {
+    return 63 - hf_clz64(value);
+}
+
+/**
+ * @brief Décalage à droite d'une valeur 128 bits non signée
+ *
+ * @param hi 64 bits de poids fort
+ * @param lo 64 bits de poids faible
+ * @param shift Décalage (1 à 127)
+ * @return Les 64 bits de poids faible du résultat
+ */
+static uint64_t shr128(uint64_t hi, uint64_t lo, int shift) {
+    return (shift >= 64) ? hi >> (shift - 64) : (lo >> shift) | (hi << (64 - shift));
+}
+
+/**
+ * @brief Teste si l'un des count bits de poids faible d'une valeur 128 bits est non nul
+ *
+ * @param hi 64 bits de poids fort
+ * @param lo 64 bits de poids faible
+ * @param count Nombre de bits testés (0 à 127)
+ * @return 1 si au moins un bit est non nul, 0 sinon
+ */
+static int low_bits_nonzero(uint64_t hi, uint64_t lo, int count) {
+    int result;
+
+    if(count >= 64) result = lo != 0 || (count > 64 && (hi & ((1ULL << (count - 64)) - 1)) != 0);
+    else result = (lo & ((1ULL << count) - 1)) != 0;
+
+    return result;
+}
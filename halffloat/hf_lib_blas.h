@@ -0,0 +1,37 @@
+/**
+ * @file hf_lib_blas.h
+ * @brief Réductions et noyaux d'algèbre linéaire pour Half-Float
+ *
+ * Produits scalaires, sommes, axpy et produits matrice-vecteur/matrice-matrice
+ * sur des tableaux de demi-flottants. Chaque résultat est accumulé exactement
+ * (virgule fixe 128 bits) puis arrondi une seule fois selon le mode d'arrondi
+ * du thread: il ne dépend ni de l'ordre des termes ni du découpage en blocs.
+ *
+ * Les matrices sont rangées par lignes (row-major) avec un pas de ligne explicite.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_BLAS_H
+#define HF_LIB_BLAS_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+//Réductions (arrondi unique du résultat exact)
+HF_API uint16_t hf_dot(const uint16_t *a, const uint16_t *b, size_t n);  //somme des a[i]*b[i]
+HF_API uint16_t hf_sum(const uint16_t *a, size_t n);                     //somme des a[i]
+
+//y[i] = alpha*x[i] + y[i], arrondi une fois par élément
+HF_API void hf_axpy(uint16_t alpha, const uint16_t *x, uint16_t *y, size_t n);
+
+//y = A.x avec A de taille m x n (pas de ligne lda)
+HF_API void hf_gemv(const uint16_t *a, size_t lda, const uint16_t *x, uint16_t *y, size_t m, size_t n);
+
+//C = A.B avec A de taille m x k, B de taille k x n et C de taille m x n
+HF_API void hf_gemm(const uint16_t *a, size_t lda, const uint16_t *b, size_t ldb, uint16_t *c, size_t ldc,
+                    size_t m, size_t n, size_t k);
+
+#endif //HF_LIB_BLAS_H
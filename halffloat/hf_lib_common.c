@@ -13,6 +13,11 @@
 #include <math.h>
 #include "hf_lib_common.h"
 
+//Déclaration des helpers statiques
+#if defined(HF_PROFILE)
+static hf_profile_table profile_table_id(const uint16_t *table);
+#endif
+
 /**
  * @brief Réduit un angle exprimé en radians (format fixe) dans [0, 2*pi)
  *
@@ -68,21 +73,26 @@ uint16_t reduce_radian_uword(uint32_t angle_rad_fixed, int fact) {
  * Remarques :
  *  - L'ordre respecté tient compte du signe (valeurs négatives ordonnées
  *    inversement) pour obtenir un ordre numérique cohérent.
+ *  - +0 et -0 sont égaux (0), comme en IEEE 754.
  */
 int compare_half(const half_float *input1, const half_float *input2) {
     int cmp = 0;
+    int negative = input1->sign != HF_ZERO_POS;     //sign vaut 0 ou HF_MASK_SIGN
 
     if(is_nan(input1) || is_nan(input2)) {
         cmp = -2;
     }
+    else if(is_zero(input1) && is_zero(input2)) {
+        cmp = 0;    //+0 == -0
+    }
     else if(input1->sign != input2->sign) {
         cmp = input1->sign ? -1 : 1;
     }
     else if(input1->exp != input2->exp) {
-        cmp = ((input1->exp < input2->exp) ^ input1->sign) ? -1 : 1;
+        cmp = ((input1->exp < input2->exp) ^ negative) ? -1 : 1;
     }
     else if(input1->mant != input2->mant) {
-        cmp = ((input1->mant < input2->mant) ^ input1->sign) ? -1 : 1;
+        cmp = ((input1->mant < input2->mant) ^ negative) ? -1 : 1;
     }
 
     return cmp;
@@ -155,6 +165,7 @@ uint16_t table_interpolate(const uint16_t *table, int size, uint32_t index, int
     
     if(idx0 >= size) idx0 = size - 1;
     if(idx1 >= size) idx1 = size - 1;
+    HF_PROFILE_TABLE(profile_table_id(table), idx0, size);
     
     frac = index & ((1 << frac_bits) - 1);
     val0 = table[idx0];
@@ -163,13 +174,99 @@ uint16_t table_interpolate(const uint16_t *table, int size, uint32_t index, int
     return val0 + (((val1 - val0) * frac + (1 << (frac_bits-1))) >> frac_bits);
 }
 
+/**
+ * @brief Interpolation quadratique (3 points) dans une table de valeurs entières
+ *
+ * Même convention d'indice que table_interpolate. La parabole passe par
+ * l'entrée courante et les deux suivantes (fenêtre recalée sur les trois
+ * dernières entrées en fin de table), sans mémoire supplémentaire.
+ *
+ * Paramètres :
+ *  - table     : pointeur vers la table (éléments uint16_t, size >= 3)
+ *  - size      : nombre d'éléments dans la table
+ *  - index     : indice en format fixe (valeur << frac_bits)
+ *  - frac_bits : nombre de bits réservés à la fraction
+ *
+ * Retour : valeur interpolée (uint16_t, saturée à [0, 65535])
+ */
+uint16_t table_interpolate_quadratic(const uint16_t *table, int size, uint32_t index, int frac_bits) {
+    int idx0 = (int)(index >> frac_bits);
+    int64_t one = (int64_t)1 << frac_bits;
+    int64_t pos, d1, d2, value;
+    uint16_t result;
+
+    HF_PROFILE_TABLE(profile_table_id(table), idx0 < size ? idx0 : size - 1, size);
+    if(idx0 >= size - 1) {
+        result = table[size - 1];
+    } else {
+        if(idx0 > size - 3) idx0 = size - 3;
+
+        //Forme de Newton: y0 + s*d1 + s*(s-1)/2*d2, s = pos/one
+        pos = (int64_t)index - ((int64_t)idx0 << frac_bits);
+        d1 = (int64_t)table[idx0 + 1] - table[idx0];
+        d2 = (int64_t)table[idx0 + 2] - 2 * (int64_t)table[idx0 + 1] + table[idx0];
+        value = table[idx0] + ((2 * d1 * pos * one + d2 * pos * (pos - one) + one * one) >> (2 * frac_bits + 1));
+
+        if(value < 0) value = 0;
+        if(value > 0xFFFF) value = 0xFFFF;
+        result = (uint16_t)value;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Interpolation cubique d'Hermite avec pentes stockées
+ *
+ * Même convention d'indice que table_interpolate. Chaque intervalle est
+ * interpolé par le polynôme de degré 3 qui respecte les valeurs et les pentes
+ * (dérivée par pas de table) de ses deux extrémités.
+ *
+ * Paramètres :
+ *  - table     : pointeur vers la table (éléments uint16_t)
+ *  - slopes    : pentes associées à chaque entrée (même taille que table)
+ *  - size      : nombre d'éléments dans la table
+ *  - index     : indice en format fixe (valeur << frac_bits)
+ *  - frac_bits : nombre de bits réservés à la fraction
+ *
+ * Retour : valeur interpolée (uint16_t, saturée à [0, 65535])
+ */
+uint16_t table_interpolate_cubic(const uint16_t *table, const uint16_t *slopes, int size, uint32_t index, int frac_bits) {
+    int idx0 = (int)(index >> frac_bits);
+    int64_t one = (int64_t)1 << frac_bits;
+    int64_t t, d, m0, m1, c2, c3, value;
+    uint16_t result;
+
+    HF_PROFILE_TABLE(profile_table_id(table), idx0 < size ? idx0 : size - 1, size);
+    if(idx0 >= size - 1) {
+        result = table[size - 1];
+    } else {
+        //p(t) = y0 + m0*t + c2*t^2 + c3*t^3, t = frac/one
+        t = (int64_t)(index & (uint32_t)(one - 1));
+        d = (int64_t)table[idx0 + 1] - table[idx0];
+        m0 = slopes[idx0];
+        m1 = slopes[idx0 + 1];
+        c2 = 3 * d - 2 * m0 - m1;
+        c3 = m0 + m1 - 2 * d;
+        value = ((c3 * t + c2 * one) * t + m0 * one * one) * t;
+        value = table[idx0] + ((value + ((one * one * one) >> 1)) >> (3 * frac_bits));
+
+        if(value < 0) value = 0;
+        if(value > 0xFFFF) value = 0xFFFF;
+        result = (uint16_t)value;
+    }
+
+    return result;
+}
+
 /**
  * @brief Calcule e^x approximé en virgule fixe (Q15) avec interpolation
  *
  * Cette routine calcule une approximation de e^x pour une entrée en
  * virgule fixe Q15. Elle réduit l'argument par rapport à ln(2), utilise
  * une table pré-calculée `exp_table` pour la mantisse et complète par une
- * interpolation linéaire entre entrées consécutives.
+ * interpolation linéaire entre entrées consécutives, ou évalue e^r par
+ * polynôme avec le moteur HF_ENGINE_POLY.
  *
  * Le résultat est renvoyé sous forme décomposée dans `result` : champs
  * `mant` (mantisse) et `exp` (exposant entier) représentant
@@ -189,9 +286,54 @@ uint16_t table_interpolate(const uint16_t *table, int size, uint32_t index, int
  *    internes (ex. calcul de sinh) où la précision double n'est pas requise.
  */
 void exp_fixed(int32_t x_fixed, half_float *result) {
+    if(HF_ATOMIC_LOAD(hf_engine_current) == HF_ENGINE_POLY) {
+        exp_fixed_poly(x_fixed, result);
+    } else {
+        int32_t k_exp = x_fixed / LNI_2;
+        int32_t r_fixed = x_fixed - k_exp * LNI_2;
+        int index;
+
+        //Réduction à [0, ln(2)]: ajuster si r négatif
+        if(r_fixed < 0) {
+            k_exp--;
+            r_fixed += LNI_2;
+        }
+
+        //Index dans la table avec protection
+        index = (r_fixed * EXP_TABLE_SIZE) / LNI_2;
+        if(index >= EXP_TABLE_SIZE) index = EXP_TABLE_SIZE - 1;
+
+        //Interpolation (ordre EXP_INTERP) pour remplir result->mant
+#if EXP_INTERP == HF_INTERP_LINEAR
+        result->mant = exp_table[index];
+        if(index < EXP_TABLE_SIZE - 1) {
+            int32_t frac = ((r_fixed * EXP_TABLE_SIZE) % LNI_2) << 8;
+            result->mant += ((exp_table[index + 1] - result->mant) * frac / LNI_2) >> 8;
+        }
+#else
+        {
+            //Fraction de l'intervalle ramenée sur 8 bits pour l'interpolation d'ordre supérieur
+            uint32_t frac = (uint32_t)((((r_fixed * EXP_TABLE_SIZE) % LNI_2) << 8) / LNI_2);
+            result->mant = TABLE_INTERPOLATE(EXP_INTERP, exp_table, EXP_SLOPES, EXP_TABLE_SIZE + 1, ((uint32_t)index << 8) | frac, 8);
+        }
+#endif
+        result->exp = k_exp;
+    }
+}
+
+/**
+ * @brief Calcule e^x en virgule fixe (Q15) par polynôme, quel que soit le moteur
+ *
+ * Même réduction et même format de sortie que exp_fixed() avec le moteur
+ * HF_ENGINE_POLY (mantisse Q15). Sert aux fonctions
+ * dont l'erreur visée est inférieure à celle des tables interpolées.
+ *
+ * @param x_fixed Argument x en format fixe Q15
+ * @param result Reçoit la mantisse (Q15) et l'exposant de e^x
+ */
+void exp_fixed_poly(int32_t x_fixed, half_float *result) {
     int32_t k_exp = x_fixed / LNI_2;
     int32_t r_fixed = x_fixed - k_exp * LNI_2;
-    int index;
 
     //Réduction à [0, ln(2)]: ajuster si r négatif
     if(r_fixed < 0) {
@@ -199,16 +341,28 @@ void exp_fixed(int32_t x_fixed, half_float *result) {
         r_fixed += LNI_2;
     }
 
-    //Index dans la table avec protection
-    index = (r_fixed * EXP_TABLE_SIZE) / LNI_2;
-    if(index >= EXP_TABLE_SIZE) index = EXP_TABLE_SIZE - 1;
+    //Polynôme sur [0, ln(2)], sans table
+    result->mant = poly_exp_q15(r_fixed);
+    result->exp = k_exp;
+}
+
+#if defined(HF_PROFILE)
+/**
+ * @brief Identifie une table précalculée pour l'histogramme de profilage
+ *
+ * @param table Table passée à table_interpolate*
+ * @return Identifiant de la table (HF_PROF_TABLE_OTHER si inconnue)
+ */
+static hf_profile_table profile_table_id(const uint16_t *table) {
+    hf_profile_table result = HF_PROF_TABLE_OTHER;
 
-    //Interpolation linéaire pour remplir result->mant
-    result->mant = exp_table[index];
-    if(index < EXP_TABLE_SIZE - 1) {
-        int32_t frac = ((r_fixed * EXP_TABLE_SIZE) % LNI_2) << 8;
-        result->mant += ((exp_table[index + 1] - result->mant) * frac / LNI_2) >> 8;
-    }
+    if(table == sin_table) result = HF_PROF_TABLE_SIN;
+    else if(table == asin_table) result = HF_PROF_TABLE_ASIN;
+    else if(table == atan_table) result = HF_PROF_TABLE_ATAN;
+    else if(table == ln_table) result = HF_PROF_TABLE_LN;
+    else if(table == exp_table) result = HF_PROF_TABLE_EXP;
+    else if(table == tan_table_low || table == tan_table_high) result = HF_PROF_TABLE_TAN;
 
-    result->exp = k_exp;
+    return result;
 }
+#endif
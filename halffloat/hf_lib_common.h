@@ -17,12 +17,164 @@
 #include "hf_precalc.h"
 
 /* Utilitaires internes partagés */
-uint16_t reduce_radian_uword(uint32_t angle_rad_fixed, int fact);
-int compare_half(const half_float *input1, const half_float *input2);
-int check_int_half(const half_float *hf);
+HF_INTERNAL uint16_t reduce_radian_uword(uint32_t angle_rad_fixed, int fact);
+HF_INTERNAL int compare_half(const half_float *input1, const half_float *input2);
+HF_INTERNAL int check_int_half(const half_float *hf);
 
 //Prototypes des fonctions utilitaires spécialisées
-uint16_t table_interpolate(const uint16_t *table, int size, uint32_t index, int frac_bits);
-void exp_fixed(int32_t x_fixed, half_float *result);
+HF_INTERNAL uint16_t table_interpolate(const uint16_t *table, int size, uint32_t index, int frac_bits);
+HF_INTERNAL uint16_t table_interpolate_quadratic(const uint16_t *table, int size, uint32_t index, int frac_bits);
+HF_INTERNAL uint16_t table_interpolate_cubic(const uint16_t *table, const uint16_t *slopes, int size, uint32_t index, int frac_bits);
+HF_INTERNAL void exp_fixed(int32_t x_fixed, half_float *result);
+HF_INTERNAL void exp_fixed_poly(int32_t x_fixed, half_float *result);   //Polynôme quel que soit le moteur
+
+//Interpolation à l'ordre d'une famille (*_INTERP constant: le choix est résolu à la compilation)
+#define TABLE_INTERPOLATE(order, table, slopes, size, index, frac_bits) \
+    ((order) == HF_INTERP_CUBIC ? table_interpolate_cubic((table), (slopes), (size), (index), (frac_bits)) : \
+     (order) == HF_INTERP_QUADRATIC ? table_interpolate_quadratic((table), (size), (index), (frac_bits)) : \
+     table_interpolate((table), (size), (index), (frac_bits)))
+
+/*
+ * Moteur polynomial (HF_ENGINE_POLY): approximations minimax (noeuds de
+ * Tchebychev) évaluées par schéma de Horner en Q30, produits 32x32 -> 64 bits.
+ * Aucune table ni branchement: une boucle sur ces noyaux se vectorise sans
+ * gather. Erreur d'approximation < 3e-7, résultat Q15 arrondi au plus proche
+ * (écart à la valeur exacte <= 0.504 LSB, contre ~0.5 à 1 LSB pour les tables).
+ */
+#define HF_POLY_SIN_C0      1686629706          //sin(pi/2 t) = t * P(t^2), t dans [0, 1]
+#define HF_POLY_SIN_C1      (-693598305)
+#define HF_POLY_SIN_C2      85566398
+#define HF_POLY_SIN_C3      (-5018824)
+#define HF_POLY_SIN_C4      162856
+#define HF_POLY_ATAN_C0     1073741697          //atan(t) = t * P(t^2), t dans [0, 1]
+#define HF_POLY_ATAN_C1     (-357897613)
+#define HF_POLY_ATAN_C2     214393620
+#define HF_POLY_ATAN_C3     (-150359183)
+#define HF_POLY_ATAN_C4     105966136
+#define HF_POLY_ATAN_C5     (-63167966)
+#define HF_POLY_ATAN_C6     25534137
+#define HF_POLY_ATAN_C7     (-4896039)
+#define HF_POLY_EXP_C0      1073741715          //e^r = P(r), r dans [0, ln(2)]
+#define HF_POLY_EXP_C1      1073753146
+#define HF_POLY_EXP_C2      536681645
+#define HF_POLY_EXP_C3      180105526
+#define HF_POLY_EXP_C4      41629499
+#define HF_POLY_EXP_C5      12708554
+#define HF_POLY_LN_C0       1073741589          //ln(1 + f) = f * P(f), f dans [0, 1]
+#define HF_POLY_LN_C1       (-536840574)
+#define HF_POLY_LN_C2       357254611
+#define HF_POLY_LN_C3       (-262795887)
+#define HF_POLY_LN_C4       189917835
+#define HF_POLY_LN_C5       (-114729345)
+#define HF_POLY_LN_C6       46701219
+#define HF_POLY_LN_C7       (-8988457)
+
+//Produit de deux valeurs Q30 (ou d'une valeur Q30 par un coefficient Q30)
+static HF_ALWAYS_INLINE int32_t poly_mul_q30(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> 30);
+}
+
+//Produit Q30 x Q30 ramené en Q15 avec arrondi au plus proche
+static HF_ALWAYS_INLINE int32_t poly_round_q15(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b + (1LL << 44)) >> 45);
+}
+
+/**
+ * @brief sin(pi/2 * idx/16384) en Q15 par polynôme (quart d'onde)
+ *
+ * @param idx Angle du premier quadrant sur 14 bits
+ * @return Sinus en Q15 dans [0, 32768]
+ */
+static HF_ALWAYS_INLINE int32_t poly_sin_q15(uint32_t idx) {
+    int32_t t = (int32_t)(idx << 16);
+    int32_t u = poly_mul_q30(t, t);
+    int32_t p = HF_POLY_SIN_C4;
+
+    p = HF_POLY_SIN_C3 + poly_mul_q30(p, u);
+    p = HF_POLY_SIN_C2 + poly_mul_q30(p, u);
+    p = HF_POLY_SIN_C1 + poly_mul_q30(p, u);
+    p = HF_POLY_SIN_C0 + poly_mul_q30(p, u);
+
+    return poly_round_q15(p, t);
+}
+
+/**
+ * @brief atan(ratio) en Q15 par polynôme
+ *
+ * @param ratio Rapport Q15 dans [0, 32768]
+ * @return Arc tangente en Q15 dans [0, pi/4]
+ */
+static HF_ALWAYS_INLINE int32_t poly_atan_q15(int32_t ratio) {
+    int32_t t = ratio << 15;
+    int32_t u = poly_mul_q30(t, t);
+    int32_t p = HF_POLY_ATAN_C7;
+
+    p = HF_POLY_ATAN_C6 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C5 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C4 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C3 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C2 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C1 + poly_mul_q30(p, u);
+    p = HF_POLY_ATAN_C0 + poly_mul_q30(p, u);
+
+    return poly_round_q15(p, t);
+}
+
+/**
+ * @brief e^r en Q15 par polynôme
+ *
+ * Le dernier pas de Horner est fait sur 64 bits: e^r approche 2 (2^31 en Q30).
+ *
+ * @param r Argument réduit en Q15 dans [0, LNI_2)
+ * @return e^r en Q15 dans [32768, 65536)
+ */
+static HF_ALWAYS_INLINE int32_t poly_exp_q15(int32_t r) {
+    int32_t v = r << 15;
+    int32_t p = HF_POLY_EXP_C5;
+
+    p = HF_POLY_EXP_C4 + poly_mul_q30(p, v);
+    p = HF_POLY_EXP_C3 + poly_mul_q30(p, v);
+    p = HF_POLY_EXP_C2 + poly_mul_q30(p, v);
+    p = HF_POLY_EXP_C1 + poly_mul_q30(p, v);
+
+    return (int32_t)(((int64_t)HF_POLY_EXP_C0 + (((int64_t)p * v) >> 30) + (1 << 14)) >> 15);
+}
+
+/**
+ * @brief ln(1 + f) en Q15 par polynôme
+ *
+ * @param frac Partie fractionnaire f de la mantisse en Q15 dans [0, 32768)
+ * @return Logarithme en Q15 dans [0, LNI_2]
+ */
+static HF_ALWAYS_INLINE int32_t poly_ln_q15(uint32_t frac) {
+    int32_t f = (int32_t)(frac << 15);
+    int32_t p = HF_POLY_LN_C7;
+
+    p = HF_POLY_LN_C6 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C5 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C4 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C3 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C2 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C1 + poly_mul_q30(p, f);
+    p = HF_POLY_LN_C0 + poly_mul_q30(p, f);
+
+    return poly_round_q15(p, f);
+}
+
+//Noyaux Q15 des fonctions transcendantes, servis par le moteur actif (hf_engine_select)
+static HF_ALWAYS_INLINE int32_t sin_quarter_q15(uint32_t idx) {
+    return HF_ATOMIC_LOAD(hf_engine_current) == HF_ENGINE_POLY ? (HF_PROFILE_PATH(HF_PROF_KERNEL_POLY), poly_sin_q15(idx))
+         : (HF_PROFILE_PATH(HF_PROF_KERNEL_TABLE), (int32_t)TABLE_INTERPOLATE(SIN_INTERP, sin_table, SIN_SLOPES, SIN_TABLE_SIZE + 1, idx, SIN_INDEX_SHIFT));
+}
+
+static HF_ALWAYS_INLINE int32_t atan_unit_q15(int32_t ratio) {
+    return HF_ATOMIC_LOAD(hf_engine_current) == HF_ENGINE_POLY ? (HF_PROFILE_PATH(HF_PROF_KERNEL_POLY), poly_atan_q15(ratio))
+         : (HF_PROFILE_PATH(HF_PROF_KERNEL_TABLE), (int32_t)TABLE_INTERPOLATE(ATAN_INTERP, atan_table, ATAN_SLOPES, ATAN_TABLE_SIZE, ratio, ATAN_INDEX_SHIFT));
+}
+
+static HF_ALWAYS_INLINE int32_t ln_mant_q15(uint32_t frac) {
+    return HF_ATOMIC_LOAD(hf_engine_current) == HF_ENGINE_POLY ? (HF_PROFILE_PATH(HF_PROF_KERNEL_POLY), poly_ln_q15(frac))
+         : (HF_PROFILE_PATH(HF_PROF_KERNEL_TABLE), (int32_t)TABLE_INTERPOLATE(LN_INTERP, ln_table, LN_SLOPES, LN_TABLE_SIZE + 1, frac, LN_INDEX_SHIFT));
+}
 
 #endif //HF_LIB_COMMON_H
@@ -0,0 +1,534 @@
+/**
+ * @file hf_lib_complex.c
+ * @brief Implémentation de l'arithmétique complexe et de la FFT pour Half-Float
+ *
+ * hf_cmul évalue chaque partie comme un produit scalaire de deux termes
+ * (hf_dot): les produits sont exacts dans l'accumulateur de hf_lib_blas et
+ * la somme n'est arrondie qu'une fois, avec les règles IEEE habituelles
+ * (propagation des NaN, inf*0 et inf - inf invalides).
+ *
+ * La FFT est une décimation temporelle en place: permutation par inversion
+ * des bits, puis étapes radix-4 dont chaque papillon fusionne deux étapes
+ * radix-2 (l'ordre des données reste celui de l'inversion des bits), précédées
+ * d'une étape radix-2 si log2(n) est impair. Dans un papillon, les entrées
+ * finies sont converties sans perte en virgule fixe Q24 (LSB 2^-24, plus
+ * petit sous-normal), multipliées par les rotations Q15 et sommées exactement
+ * sur 64 bits (LSB 2^-39, |somme| < 2^58): chaque sortie n'est arrondie
+ * qu'une fois par étape radix-4, soit log4(n) arrondis au lieu de log2(n)
+ * pour une suite de hf_mul/hf_add. hf_ifft applique le facteur 1/n étape par
+ * étape sur l'exposant avant l'arrondi, sans perte ni dépassement
+ * intermédiaire.
+ *
+ * Les rotations e^(-2 pi i j/m) sont calculées une fois par indice j et par
+ * étape, par le quart d'onde sin_quarter_q15() (sin_table interpolée, exacte
+ * aux noeuds pour n <= 4 * SIN_TABLE_SIZE, ou moteur polynomial), puis
+ * réutilisées pour tous les blocs de l'étape. Les composantes de rotation
+ * nulles n'interviennent pas: un infini multiplié par une rotation exacte
+ * (1, -i...) reste infini. Un NaN dans un papillon se propage à toutes ses
+ * sorties, des infinis de signes opposés dans une même somme donnent NaN
+ * (invalide).
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include "hf_lib_complex.h"
+#include "hf_lib_common.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_blas.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_trig.h"
+
+#define IS_NAN_BITS(h) (((h) & (HF_INFINITY_POS | HF_MASK_MANT)) > HF_INFINITY_POS)
+#define IS_SNAN_BITS(hf) (((hf) & ~HF_MASK_SIGN & 0xFFFFU) > HF_INFINITY_POS && !((hf) & (1U << (HF_MANT_BITS - 1))))
+
+#define FFT_ONE             32768           //1.0 en Q15 (rotation triviale)
+#define FFT_QUARTER         16384           //Quart de tour (un tour = HF_FFT_MAX)
+#define FFT_FRAC_BITS       39              //LSB des sommes exactes: 2^-24 (Q24) fois rotation Q15
+#define FFT_SUBNORMAL_SHIFT (FFT_FRAC_BITS - 24)    //Position du LSB des sous-normaux (2^-24) dans les sommes
+
+//Déclaration des helpers statiques
+static int fft_size_valid(size_t n);
+static void fft_bit_reverse(uint16_t *data, size_t n);
+static void fft_twiddle(uint32_t phase, int inverse, int32_t *w);
+static int64_t fft_fixed(uint16_t hf);
+static uint16_t fft_round(int64_t sum, int scale, unsigned int *flags, hf_rounding_mode mode);
+static void fft_radix2_core(const int64_t *x, const int32_t *w, int64_t *y);
+static void fft_radix4_core(const int64_t *x, const int32_t *w, int inverse, int64_t *y);
+static void fft_specials(const uint16_t *in, int radix, const int32_t *w, int inverse, uint16_t *out, unsigned int *flags);
+static void fft_butterfly(uint16_t *data, size_t base, size_t h, int radix, const int32_t *w, int inverse, unsigned int *flags, hf_rounding_mode mode);
+static inline void fft_rounded(uint16_t *data, size_t n, int inverse, hf_rounding_mode mode);
+
+/**
+ * @brief Construit un complexe à partir de ses deux parties
+ *
+ * @param re Partie réelle
+ * @param im Partie imaginaire
+ * @return Le complexe re + i im
+ */
+hf_complex hf_cmake(uint16_t re, uint16_t im) {
+    hf_complex result;
+
+    result.re = re;
+    result.im = im;
+
+    return result;
+}
+
+/**
+ * @brief Somme de deux complexes (hf_add par partie)
+ *
+ * @param a Premier opérande
+ * @param b Second opérande
+ * @return a + b
+ */
+hf_complex hf_cadd(hf_complex a, hf_complex b) {
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+    return hf_cmake(hf_add(a.re, b.re), hf_add(a.im, b.im));
+}
+
+/**
+ * @brief Différence de deux complexes (hf_sub par partie)
+ *
+ * @param a Premier opérande
+ * @param b Second opérande
+ * @return a - b
+ */
+hf_complex hf_csub(hf_complex a, hf_complex b) {
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+    return hf_cmake(hf_sub(a.re, b.re), hf_sub(a.im, b.im));
+}
+
+/**
+ * @brief Conjugué d'un complexe (changement de signe de la partie imaginaire)
+ *
+ * @param a Complexe
+ * @return re - i im (NaN compris, sans indicateur)
+ */
+hf_complex hf_cconj(hf_complex a) {
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+    return hf_cmake(a.re, hf_neg(a.im));
+}
+
+/**
+ * @brief Produit de deux complexes, chaque partie arrondie une seule fois
+ *
+ * (a + ib)(c + id) = (ac - bd) + i(ad + bc): chaque partie est le produit
+ * scalaire exact de deux termes, arrondi dans le mode du thread. Le
+ * résultat est l'arrondi correct de la valeur exacte, sans les annulations
+ * catastrophiques de la forme composée (quatre hf_mul et deux hf_add).
+ *
+ * @param a Premier opérande
+ * @param b Second opérande
+ * @return a * b
+ */
+hf_complex hf_cmul(hf_complex a, hf_complex b) {
+    uint16_t lhs[2], rhs[2];
+    hf_complex result;
+
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+
+    lhs[0] = a.re;
+    lhs[1] = a.im;
+
+    //Partie réelle: re(a) re(b) + im(a) (-im(b))
+    rhs[0] = b.re;
+    rhs[1] = (uint16_t)(b.im ^ HF_MASK_SIGN);
+    result.re = hf_dot(lhs, rhs, 2);
+
+    //Partie imaginaire: re(a) im(b) + im(a) re(b)
+    rhs[0] = b.im;
+    rhs[1] = b.re;
+    result.im = hf_dot(lhs, rhs, 2);
+
+    return result;
+}
+
+/**
+ * @brief Module d'un complexe
+ *
+ * @param a Complexe
+ * @return |a| = hf_hypot(re, im), correctement arrondi (+inf si une partie est infinie, même NaN)
+ */
+uint16_t hf_cabs(hf_complex a) {
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+    return hf_hypot(a.re, a.im);
+}
+
+/**
+ * @brief Argument d'un complexe
+ *
+ * @param a Complexe
+ * @return hf_atan2(im, re) dans [-pi, pi], à 2 ULP près
+ */
+uint16_t hf_carg(hf_complex a) {
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+    return hf_atan2(a.im, a.re);
+}
+
+/**
+ * @brief Exponentielle complexe
+ *
+ * e^(x + iy) = e^x (cos y + i sin y), cosinus et sinus obtenus par une seule
+ * réduction d'angle (hf_sincos). Cas particuliers de la norme C (annexe G):
+ * y = ±0 donne e^x + iy exactement (même pour x infini ou NaN), x = -inf
+ * avec y infini ou NaN donne +0 + i0.
+ *
+ * @param a Complexe x + iy
+ * @return e^a
+ */
+hf_complex hf_cexp(hf_complex a) {
+    hf_complex result;
+
+    HF_PROFILE_CALLS(HF_PROF_COMPLEX, 1);
+
+    if((a.im & ~HF_MASK_SIGN & 0xFFFFU) == 0) {
+        //Argument réel: partie imaginaire nulle conservée avec son signe
+        result = hf_cmake(hf_exp(a.re), a.im);
+    } else if(a.re == HF_INFINITY_NEG && (a.im & HF_INFINITY_POS) == HF_INFINITY_POS) {
+        result = hf_cmake(HF_ZERO_POS, HF_ZERO_POS);
+    } else {
+        uint16_t magnitude = hf_exp(a.re), s, c;
+
+        hf_sincos(a.im, &s, &c);
+        result = hf_cmake(hf_mul(magnitude, c), hf_mul(magnitude, s));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Transformée de Fourier discrète directe, en place
+ *
+ * X_k = somme des x_j e^(-2 pi i jk/n), sans normalisation. Les résultats
+ * sont dans l'ordre naturel. Une somme qui dépasse le plus grand fini donne
+ * un infini (HF_FE_OVERFLOW), comme hf_add.
+ *
+ * @param data Tableau entrelacé re0, im0, re1, im1... de 2n demi-flottants
+ * @param n Nombre de points (puissance de 2, au plus HF_FFT_MAX)
+ * @return 1 en cas de succès, 0 si n n'est pas valide (data inchangé)
+ */
+int hf_fft(uint16_t *data, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    int result = fft_size_valid(n);
+
+    if(result) {
+        HF_PROFILE_CALLS(HF_PROF_FFT, n);
+        DISPATCH_ROUNDING_MODE(mode, fft_rounded, data, n, 0);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Transformée de Fourier discrète inverse, en place
+ *
+ * x_j = (1/n) somme des X_k e^(2 pi i jk/n): hf_ifft(hf_fft(x)) redonne x
+ * aux arrondis près.
+ *
+ * @param data Tableau entrelacé re0, im0, re1, im1... de 2n demi-flottants
+ * @param n Nombre de points (puissance de 2, au plus HF_FFT_MAX)
+ * @return 1 en cas de succès, 0 si n n'est pas valide (data inchangé)
+ */
+int hf_ifft(uint16_t *data, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    int result = fft_size_valid(n);
+
+    if(result) {
+        HF_PROFILE_CALLS(HF_PROF_FFT, n);
+        DISPATCH_ROUNDING_MODE(mode, fft_rounded, data, n, 1);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Vérifie qu'une taille de FFT est une puissance de 2 dans [1, HF_FFT_MAX]
+ *
+ * @param n Nombre de points
+ * @return 1 si n est valide, 0 sinon
+ */
+static int fft_size_valid(size_t n) {
+    return n != 0 && n <= HF_FFT_MAX && (n & (n - 1)) == 0;
+}
+
+/**
+ * @brief Permutation des points par inversion des bits de leur indice
+ *
+ * @param data Tableau entrelacé de n points
+ * @param n Nombre de points (puissance de 2)
+ */
+static void fft_bit_reverse(uint16_t *data, size_t n) {
+    size_t i, j = 0, bit;
+
+    for(i = 1; i < n; i++) {
+        for(bit = n >> 1; j & bit; bit >>= 1) j ^= bit;
+        j |= bit;
+        if(i < j) {
+            uint16_t re = data[2 * i], im = data[2 * i + 1];
+
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+/**
+ * @brief Facteur de rotation en Q15 pour une phase sur 16 bits
+ *
+ * Le quart d'onde est lu en rem et en FFT_QUARTER - rem (sinus et cosinus
+ * exacts aux angles multiples de pi/2), puis replacé dans son quadrant.
+ *
+ * @param phase Angle en unités de 2 pi / HF_FFT_MAX, dans [0, HF_FFT_MAX)
+ * @param inverse Non nul pour e^(+i angle), nul pour e^(-i angle)
+ * @param w Reçoit partie réelle et partie imaginaire en Q15
+ */
+static HF_ALWAYS_INLINE void fft_twiddle(uint32_t phase, int inverse, int32_t *w) {
+    uint32_t rem = phase & (FFT_QUARTER - 1);
+    int32_t s = sin_quarter_q15(rem), c = sin_quarter_q15(FFT_QUARTER - rem);
+    int32_t cosine, sine;
+
+    switch((phase / FFT_QUARTER) & 3U) {
+        case 0:  cosine = c;  sine = s;  break;
+        case 1:  cosine = -s; sine = c;  break;
+        case 2:  cosine = -c; sine = -s; break;
+        default: cosine = s;  sine = -c; break;
+    }
+
+    w[0] = cosine;
+    w[1] = inverse ? sine : -sine;
+}
+
+/**
+ * @brief Valeur exacte d'un demi-flottant fini en virgule fixe Q24
+ *
+ * @param hf Demi-flottant (NaN et infinis donnent 0, traités à part)
+ * @return Valeur signée en unités de 2^-24 (|valeur| < 2^40)
+ */
+static HF_ALWAYS_INLINE int64_t fft_fixed(uint16_t hf) {
+    uint32_t exp = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
+    uint32_t normal = exp != 0;
+    int64_t value = (int64_t)((hf & HF_MASK_MANT) | (normal << HF_MANT_BITS)) << (exp - normal);
+
+    if(exp == HF_MASK_EXP) value = 0;
+
+    return (hf & HF_MASK_SIGN) ? -value : value;
+}
+
+/**
+ * @brief Arrondit une somme exacte de la FFT en demi-flottant
+ *
+ * Les 11 bits de tête (ou les bits au-dessus du LSB des sous-normaux) sont
+ * extraits d'un seul décalage; l'incrément d'arrondi se propage dans
+ * l'exposant et un résultat au-delà de 65504 devient l'infini ou le plus grand
+ * fini selon le mode. Mêmes indicateurs que normalize_and_round (soupassement:
+ * minuscule avant arrondi et inexact). Une somme exactement nulle donne +0
+ * (-0 vers -inf), comme hf_add de deux termes opposés.
+ *
+ * @param sum Somme signée en unités de 2^-FFT_FRAC_BITS
+ * @param scale Division par 2^scale appliquée avant l'arrondi
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ * @return La somme arrondie
+ */
+static HF_ALWAYS_INLINE uint16_t fft_round(int64_t sum, int scale, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t neg = sum < 0, up = 0, to_inf, bits;
+    uint64_t mag = neg ? 0 - (uint64_t)sum : (uint64_t)sum, kept, rem, half;
+    int min_shift = FFT_SUBNORMAL_SHIFT + scale, shift = 63 - hf_clz64(mag | 1U) - HF_MANT_BITS;
+
+    if(shift < min_shift) shift = min_shift;
+    kept = mag >> shift;
+    rem = mag & ((1ULL << shift) - 1);
+    half = 1ULL << (shift - 1);
+
+    //Incrément sans branchement (les bits perdus sont imprévisibles)
+    if(mode == HF_ROUND_NEAREST_EVEN) up = (uint32_t)(rem > half) | ((uint32_t)(rem == half) & (uint32_t)kept);
+    else if(mode == HF_ROUND_NEAREST_UP) up = (uint32_t)(rem >= half);
+    else if(mode == HF_ROUND_TOWARD_POS_INF) up = (uint32_t)(rem != 0) & (neg ^ 1U);
+    else if(mode == HF_ROUND_TOWARD_NEG_INF) up = (uint32_t)(rem != 0) & neg;
+    up &= 1U;
+
+    //Exposant (shift - min_shift) augmenté du bit implicite de kept, puis retenue d'arrondi
+    bits = ((uint32_t)(shift - min_shift) << HF_MANT_BITS) + (uint32_t)kept + up;
+    HF_FE_ACCUM(flags, (uint32_t)(rem != 0) * (HF_FE_INEXACT | (uint32_t)(kept < (1U << HF_MANT_BITS)) * HF_FE_UNDERFLOW));
+    if(bits >= HF_INFINITY_POS) {
+        to_inf = mode == HF_ROUND_NEAREST_EVEN || mode == HF_ROUND_NEAREST_UP
+              || (mode == HF_ROUND_TOWARD_POS_INF && !neg) || (mode == HF_ROUND_TOWARD_NEG_INF && neg);
+        HF_FE_ACCUM(flags, HF_FE_OVERFLOW | HF_FE_INEXACT);
+        bits = to_inf ? HF_INFINITY_POS : HF_INFINITY_POS - 1U;
+    }
+    if(mag == 0 && mode == HF_ROUND_TOWARD_NEG_INF) neg = 1;
+
+    return (uint16_t)(bits | (neg ? HF_MASK_SIGN : 0U));
+}
+
+/**
+ * @brief Papillon radix-2 exact: y0 = x0 + w x1, y1 = x0 - w x1
+ *
+ * @param x Deux points en Q24 (re, im entrelacés)
+ * @param w Rotation Q15 de x1
+ * @param y Reçoit les deux points en Q39
+ */
+static HF_ALWAYS_INLINE void fft_radix2_core(const int64_t *x, const int32_t *w, int64_t *y) {
+    int64_t ar = x[0] * FFT_ONE, ai = x[1] * FFT_ONE;
+    int64_t tr = w[0] * x[2] - w[1] * x[3], ti = w[0] * x[3] + w[1] * x[2];
+
+    y[0] = ar + tr;
+    y[1] = ai + ti;
+    y[2] = ar - tr;
+    y[3] = ai - ti;
+}
+
+/**
+ * @brief Papillon radix-4 exact (deux étapes radix-2 fusionnées)
+ *
+ * Avec A = x0, B = w^2j x1, C = w^j x2, D = w^3j x3 et r = -i (+i pour la
+ * transformée inverse): y0 = A + B + C + D, y1 = A - B + r(C - D),
+ * y2 = A + B - C - D, y3 = A - B - r(C - D).
+ *
+ * @param x Quatre points en Q24 (re, im entrelacés)
+ * @param w Rotations Q15 w^2j, w^j et w^3j
+ * @param inverse Non nul pour la transformée inverse
+ * @param y Reçoit les quatre points en Q39
+ */
+static HF_ALWAYS_INLINE void fft_radix4_core(const int64_t *x, const int32_t *w, int inverse, int64_t *y) {
+    int64_t ar = x[0] * FFT_ONE, ai = x[1] * FFT_ONE;
+    int64_t br = w[0] * x[2] - w[1] * x[3], bi = w[0] * x[3] + w[1] * x[2];
+    int64_t cr = w[2] * x[4] - w[3] * x[5], ci = w[2] * x[5] + w[3] * x[4];
+    int64_t dr = w[4] * x[6] - w[5] * x[7], di = w[4] * x[7] + w[5] * x[6];
+    int64_t er = ci - di, ei = dr - cr;     //-i (C - D)
+
+    if(inverse) {
+        er = -er;
+        ei = -ei;
+    }
+
+    y[0] = ar + br + cr + dr;
+    y[1] = ai + bi + ci + di;
+    y[2] = ar - br + er;
+    y[3] = ai - bi + ei;
+    y[4] = ar + br - cr - dr;
+    y[5] = ai + bi - ci - di;
+    y[6] = ar - br - er;
+    y[7] = ai - bi - ei;
+}
+
+/**
+ * @brief Sorties d'un papillon dont une entrée est NaN ou infinie
+ *
+ * Un NaN (le premier rencontré, rendu silencieux) remplace toutes les
+ * sorties. Sinon, le signe de la contribution de chaque infini à chaque
+ * sortie est obtenu en appliquant le papillon à ce seul infini (±1): une
+ * sortie reçoit l'infini de ce signe, ou NaN (invalide) si des infinis de
+ * signes opposés s'y rencontrent. Les autres sorties gardent l'arrondi de
+ * la somme des entrées finies.
+ *
+ * @param in Entrées du papillon (2 * radix demi-flottants)
+ * @param radix 2 ou 4
+ * @param w Rotations Q15 du papillon
+ * @param inverse Non nul pour la transformée inverse
+ * @param out Sorties arrondies (modifiées pour les résultats spéciaux)
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ */
+static void fft_specials(const uint16_t *in, int radix, const int32_t *w, int inverse, uint16_t *out, unsigned int *flags) {
+    unsigned int infinities[8] = {0, 0, 0, 0, 0, 0, 0, 0};      //Bit 0: +inf, bit 1: -inf
+    int count = 2 * radix, k, o;
+    uint16_t nan = 0;
+
+    for(k = 0; k < count; k++) {
+        if(IS_NAN_BITS(in[k])) {
+            if(IS_SNAN_BITS(in[k])) HF_FE_ACCUM(flags, HF_FE_INVALID);
+            if(!nan) nan = (uint16_t)(in[k] | (1U << (HF_MANT_BITS - 1)));
+        } else if((in[k] & HF_INFINITY_POS) == HF_INFINITY_POS) {
+            int64_t unit[8] = {0, 0, 0, 0, 0, 0, 0, 0}, y[8];
+
+            unit[k] = (in[k] & HF_MASK_SIGN) ? -1 : 1;
+            if(radix == 4) fft_radix4_core(unit, w, inverse, y);
+            else fft_radix2_core(unit, w, y);
+            for(o = 0; o < count; o++) infinities[o] |= (y[o] > 0) | ((y[o] < 0) << 1);
+        }
+    }
+
+    for(o = 0; o < count; o++) {
+        if(nan) {
+            out[o] = nan;
+        } else if(infinities[o] == 3U) {
+            HF_FE_ACCUM(flags, HF_FE_INVALID);
+            out[o] = HF_NAN;
+        } else if(infinities[o] != 0) {
+            out[o] = infinities[o] == 1U ? HF_INFINITY_POS : HF_INFINITY_NEG;
+        }
+    }
+}
+
+/**
+ * @brief Papillon en place sur les points base, base + h, ... base + (radix-1) h
+ *
+ * @param data Tableau entrelacé
+ * @param base Indice du premier point
+ * @param h Écart entre les points
+ * @param radix 2 ou 4 (constant après intégration)
+ * @param w Rotations Q15 (une pour radix 2, trois pour radix 4)
+ * @param inverse Non nul pour la transformée inverse (division par radix)
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi à appliquer
+ */
+static HF_ALWAYS_INLINE void fft_butterfly(uint16_t *data, size_t base, size_t h, int radix, const int32_t *w, int inverse, unsigned int *flags, hf_rounding_mode mode) {
+    int count = 2 * radix, scale = inverse ? radix / 2 : 0, k;
+    uint16_t in[8], out[8], special = 0;
+    int64_t x[8], y[8];
+
+    for(k = 0; k < count; k++) {
+        in[k] = data[2 * (base + (size_t)(k >> 1) * h) + (size_t)(k & 1)];
+        x[k] = fft_fixed(in[k]);
+        special |= (in[k] & HF_INFINITY_POS) == HF_INFINITY_POS;
+    }
+
+    if(radix == 4) fft_radix4_core(x, w, inverse, y);
+    else fft_radix2_core(x, w, y);
+
+    for(k = 0; k < count; k++) out[k] = fft_round(y[k], scale, flags, mode);
+    if(special) fft_specials(in, radix, w, inverse, out, flags);
+
+    for(k = 0; k < count; k++) data[2 * (base + (size_t)(k >> 1) * h) + (size_t)(k & 1)] = out[k];
+}
+
+/**
+ * @brief Étapes de la FFT pour un mode d'arrondi donné
+ *
+ * Appelée avec un mode constant par DISPATCH_ROUNDING_MODE.
+ *
+ * @param data Tableau entrelacé de n points
+ * @param n Nombre de points (puissance de 2 valide)
+ * @param inverse Non nul pour la transformée inverse
+ * @param mode Mode d'arrondi à appliquer
+ */
+static inline void fft_rounded(uint16_t *data, size_t n, int inverse, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    int32_t w[6] = {FFT_ONE, 0, FFT_ONE, 0, FFT_ONE, 0};
+    size_t h = 1, j, base, step;
+
+    fft_bit_reverse(data, n);
+
+    //Étape radix-2 initiale (rotation triviale) si log2(n) est impair
+    if((63 - hf_clz64((uint64_t)n)) & 1) {
+        for(base = 0; base < n; base += 2) fft_butterfly(data, base, 1, 2, w, inverse, &flags, mode);
+        h = 2;
+    }
+
+    //Étapes radix-4: blocs de 4h points, rotations w = e^(-2 pi i j/4h)
+    for(; h < n; h *= 4) {
+        step = HF_FFT_MAX / (4 * h);
+        for(j = 0; j < h; j++) {
+            fft_twiddle((uint32_t)(2 * j * step), inverse, &w[0]);
+            fft_twiddle((uint32_t)(j * step), inverse, &w[2]);
+            fft_twiddle((uint32_t)(3 * j * step), inverse, &w[4]);
+            for(base = j; base < n; base += 4 * h) fft_butterfly(data, base, h, 4, w, inverse, &flags, mode);
+        }
+    }
+
+    HF_FE_RAISE(flags);
+}
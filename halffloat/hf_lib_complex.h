@@ -0,0 +1,53 @@
+/**
+ * @file hf_lib_complex.h
+ * @brief Arithmétique complexe et transformée de Fourier rapide pour Half-Float
+ *
+ * Un complexe est une paire (partie réelle, partie imaginaire) de
+ * demi-flottants; les tableaux sont entrelacés re0, im0, re1, im1... et
+ * peuvent être vus comme des tableaux de hf_complex.
+ *
+ *  - hf_cmul arrondit chaque partie une seule fois (a*c - b*d et a*d + b*c
+ *    sommés exactement), au lieu de quatre produits et deux additions arrondis
+ *  - hf_cabs et hf_carg reposent sur hf_hypot et hf_atan2
+ *  - hf_cexp combine hf_exp et hf_sincos (réduction d'angle commune)
+ *  - hf_fft / hf_ifft: FFT en place radix-4 (plus une étape radix-2 si log2(n)
+ *    est impair) sur n <= HF_FFT_MAX points, facteurs de rotation Q15 lus
+ *    dans sin_table (ou le moteur polynomial choisi) sans passer par float
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_COMPLEX_H
+#define HF_LIB_COMPLEX_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+#define HF_FFT_MAX 65536                    //Taille maximale d'une FFT (phase des rotations sur 16 bits)
+
+//Complexe en demi-précision (même disposition qu'une paire entrelacée)
+typedef struct {
+    uint16_t re;                            //Partie réelle
+    uint16_t im;                            //Partie imaginaire
+} hf_complex;
+
+//Construction et opérations élémentaires (par composante)
+HF_API hf_complex hf_cmake(uint16_t re, uint16_t im);
+HF_API hf_complex hf_cadd(hf_complex a, hf_complex b);
+HF_API hf_complex hf_csub(hf_complex a, hf_complex b);
+HF_API hf_complex hf_cconj(hf_complex a);
+
+//Produit (un seul arrondi par partie), module, argument et exponentielle
+HF_API hf_complex hf_cmul(hf_complex a, hf_complex b);
+HF_API uint16_t hf_cabs(hf_complex a);                         //sqrt(re^2 + im^2)
+HF_API uint16_t hf_carg(hf_complex a);                         //atan2(im, re) dans [-pi, pi]
+HF_API hf_complex hf_cexp(hf_complex a);                       //e^re (cos im + i sin im)
+
+//FFT en place de n points entrelacés (2n demi-flottants), n puissance de 2
+//Renvoient 1 en cas de succès, 0 si n n'est pas une puissance de 2 dans [1, HF_FFT_MAX]
+HF_API int hf_fft(uint16_t *data, size_t n);                   //X_k = somme x_j e^(-2 pi i jk/n)
+HF_API int hf_ifft(uint16_t *data, size_t n);                  //x_j = (1/n) somme X_k e^(2 pi i jk/n)
+
+#endif //HF_LIB_COMPLEX_H
@@ -0,0 +1,1411 @@
+/**
+ * @file hf_lib_conv.c
+ * @brief Implémentation des conversions par lots float <-> Half-Float
+ *
+ * Les noyaux vectoriels reproduisent exactement float_to_half() dans les cinq
+ * modes d'arrondi (mode du thread lu une fois par appel) et half_to_float().
+ * Les subnormaux sont traités sans branchement: chaque voie calcule les
+ * résultats normal, subnormal et spécial puis sélectionne le bon par masque.
+ * Le noyau F16C utilise vcvtps2ph pour les modes que l'instruction connaît. L'implémentation est choisie à l'exécution
+ * (premier appel) selon les extensions disponibles sur le processeur.
+ *
+ * Les conversions double et entières ramènent la valeur à une mantisse entière
+ * large, replient les bits perdus dans un bit collant puis arrondissent une
+ * seule fois avec normalize_and_round_inline() et compose_half().
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include <string.h>
+#include <limits.h>
+#include "hf_lib_conv.h"
+#include "hf_lib_par.h"
+
+//Noyaux x86 (SSE2/AVX2/F16C) compilés avec l'attribut target, sans option globale
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HF_CONV_X86 1
+#include <immintrin.h>
+#define HF_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+//Conversion matérielle fcvt via le type de stockage __fp16 (arm_neon.h redéfinirait uint64_t)
+#if defined(__aarch64__) && defined(__GNUC__)
+#define HF_CONV_NEON 1
+#endif
+
+//Constantes float32 utilisées pour la conversion
+#define F32_ABS_MASK        0x7FFFFFFFU                         //Masque valeur absolue float32
+#define F32_MANT_MASK       0x7FFFFFU                           //Masque mantisse float32 (23 bits)
+#define F32_IMPLICIT_BIT    0x800000U                           //Bit implicite float32
+#define F32_INF_BITS        0x7F800000U                         //Motif float32 de +Infini
+#define F32_QUIET_BIT       0x400000U                           //Bit de NaN silencieux float32
+#define F32_ROUND_HALF      0x1000U                             //Demi-ULP fp16 dans la mantisse float32
+#define F32_ROUND_DIR       0x1FFFU                             //ULP fp16 moins un (arrondi dirigé)
+#define F32_HALF_MIN_BITS   0x38800000U                         //Motif float32 de 2^-14 (plus petit normal fp16)
+#define F32_HALF_MIN        6.103515625e-5f                     //2^-14 (plus petit normal fp16)
+#define F32_HALF_MAX        65504.0f                            //Plus grand fini fp16
+#define F32_SUB_SHIFT_BASE  126                                 //Décalage subnormal = 126 - exposant biaisé float32
+#define F32_SUB_SHIFT_MAX   25                                  //Au-delà, seul subsiste un bit collant
+#define MXCSR_DAZ           0x0040U                             //Bit denormals-are-zero du registre MXCSR
+#define F32_EXP_REBIAS      (127 - HF_EXP_BIAS)                 //Différence de biais float32/fp16 (112)
+#define F32_TWO_M24         5.9604644775390625e-8f              //2^-24 (poids du bit de poids faible d'un subnormal fp16)
+#define F32_TWO_P24         16777216.0f                         //2^24
+#define F64_MANT_MASK       0xFFFFFFFFFFFFFULL                  //Masque mantisse double (52 bits)
+#define F64_IMPLICIT_BIT    (1ULL << 52)                        //Bit implicite double
+#define F64_INF_BITS        0x7FF0000000000000ULL               //Motif double de +Infini
+#define F64_QUIET_BIT       (1ULL << 51)                        //Bit de NaN silencieux double
+#define F64_EXP_REBIAS      (1023 - HF_EXP_BIAS)                //Différence de biais double/fp16 (1008)
+#define F64_EXP_SUB         (-1022 - 52 + HF_MANT_SHIFT)        //Exposant half_float d'une mantisse double subnormale
+
+//Signatures des noyaux de conversion
+typedef void (*from_float_fn)(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+typedef void (*to_float_fn)(const uint16_t *in, float *out, size_t n);
+
+//Implémentation retenue (résolue au premier appel ou par hf_simd_select)
+//Accès par HF_ATOMIC_LOAD/STORE: la résolution paresseuse est idempotente et
+//chaque noyau donne le même résultat, plusieurs threads peuvent donc résoudre
+//en même temps sans synchronisation supplémentaire
+static hf_simd_level selected_level = HF_SIMD_AUTO;
+static from_float_fn from_float_impl = NULL;
+static to_float_fn to_float_impl = NULL;
+
+//Déclaration des helpers statiques
+static void resolve_impl(void);
+static hf_simd_level best_level(void);
+static uint32_t to_float_bits(uint16_t hf);
+static void from_float_scalar(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void from_float_block(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void to_float_scalar(const uint16_t *in, float *out, size_t n);
+#ifdef HF_CONV_X86
+static void from_float_sse2(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void to_float_sse2(const uint16_t *in, float *out, size_t n);
+static void from_float_avx2(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void from_float_f16c(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void f16c_rare_flags(const float *in, int lanes, unsigned int *flags, hf_rounding_mode mode);
+static void to_float_avx2(const uint16_t *in, float *out, size_t n);
+static void to_float_f16c(const uint16_t *in, float *out, size_t n);
+#endif
+#ifdef HF_CONV_NEON
+static void to_float_neon(const uint16_t *in, float *out, size_t n);
+#endif
+static int msb_index64(uint64_t x);
+static uint16_t overflow_half(uint16_t sign, hf_rounding_mode mode);
+static inline uint16_t round_pack_wide(uint16_t sign, int exp, uint64_t mant, unsigned int *flags, hf_rounding_mode mode);
+static inline uint16_t from_double_mode(double d, unsigned int *flags, hf_rounding_mode mode);
+static uint64_t to_double_bits(uint16_t hf);
+static inline uint16_t from_int_mode(int32_t v, unsigned int *flags, hf_rounding_mode mode);
+static inline int32_t round_to_int(uint16_t hf, unsigned int *flags, hf_rounding_mode mode);
+static inline int32_t to_int_sat(uint16_t hf, int32_t lo, int32_t hi, unsigned int *flags, hf_rounding_mode mode);
+static void from_double_block(const double *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void from_int16_block(const int16_t *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void from_int32_block(const int32_t *in, uint16_t *out, size_t n, hf_rounding_mode mode);
+static void to_int8_block(const uint16_t *in, int8_t *out, size_t n, hf_rounding_mode mode);
+static void to_uint8_block(const uint16_t *in, uint8_t *out, size_t n, hf_rounding_mode mode);
+static void to_int16_block(const uint16_t *in, int16_t *out, size_t n, hf_rounding_mode mode);
+static void to_int32_block(const uint16_t *in, int32_t *out, size_t n, hf_rounding_mode mode);
+
+//Conversions par lots confiées au groupe de threads (HF_THREADS, voir hf_lib_par.h)
+#if defined(HF_THREADS)
+typedef enum {
+    CONV_PAR_FROM_FLOAT = 0,
+    CONV_PAR_TO_FLOAT,
+    CONV_PAR_FROM_DOUBLE,
+    CONV_PAR_TO_DOUBLE,
+    CONV_PAR_FROM_INT8,
+    CONV_PAR_FROM_UINT8,
+    CONV_PAR_FROM_INT16,
+    CONV_PAR_FROM_INT32,
+    CONV_PAR_TO_INT8,
+    CONV_PAR_TO_UINT8,
+    CONV_PAR_TO_INT16,
+    CONV_PAR_TO_INT32
+} conv_par_op;
+
+//Conversion et tableaux d'un lot réparti
+typedef struct {
+    conv_par_op op;
+    const void *in;
+    void *out;
+} conv_par_task;
+
+#define CONV_PARALLEL(op, in, out, n) conv_parallel((op), (in), (out), (n))
+static int conv_parallel(conv_par_op op, const void *in, void *out, size_t n);
+static void conv_par_body(void *ctx, size_t begin, size_t end);
+#else
+#define CONV_PARALLEL(op, in, out, n) 0
+#endif
+
+/**
+ * @brief Convertit un tableau de float en demi-flottants
+ *
+ * Résultat identique bit à bit à float_to_half() appliqué à chaque élément,
+ * dans le mode d'arrondi du thread (lu une seule fois).
+ *
+ * @param in Tableau source de n floats
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_float_n(const float *in, uint16_t *out, size_t n) {
+    from_float_fn impl = HF_ATOMIC_LOAD(from_float_impl);
+
+    if(impl == NULL) {
+        resolve_impl();
+        impl = HF_ATOMIC_LOAD(from_float_impl);
+    }
+    if(!CONV_PARALLEL(CONV_PAR_FROM_FLOAT, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        impl(in, out, n, hf_get_rounding_mode());
+    }
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en float
+ *
+ * Résultat identique bit à bit à half_to_float() appliqué à chaque élément.
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n floats
+ * @param n Nombre d'éléments
+ */
+void hf_to_float_n(const uint16_t *in, float *out, size_t n) {
+    to_float_fn impl = HF_ATOMIC_LOAD(to_float_impl);
+
+    if(impl == NULL) {
+        resolve_impl();
+        impl = HF_ATOMIC_LOAD(to_float_impl);
+    }
+    if(!CONV_PARALLEL(CONV_PAR_TO_FLOAT, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        impl(in, out, n);
+    }
+}
+
+/**
+ * @brief Indique si un niveau d'implémentation est utilisable sur ce processeur
+ *
+ * @param level Niveau d'implémentation
+ * @return 1 si le niveau est disponible (compilé et supporté), 0 sinon
+ */
+int hf_simd_supported(hf_simd_level level) {
+    int result = 0;
+
+    switch(level) {
+        case HF_SIMD_AUTO:
+        case HF_SIMD_SCALAR:
+            result = 1;
+            break;
+#ifdef HF_CONV_X86
+        case HF_SIMD_SSE2:
+#ifdef __x86_64__
+            result = 1;
+#else
+            __builtin_cpu_init();
+            result = __builtin_cpu_supports("sse2") != 0;
+#endif
+            break;
+        case HF_SIMD_AVX2:
+            __builtin_cpu_init();
+            result = __builtin_cpu_supports("avx2") != 0;
+            break;
+        case HF_SIMD_F16C:
+            //vcvtph2ps/vcvtps2ph (encodage VEX 256 bits), repli SSE2/AVX2 pour les égalités loin de zéro
+            __builtin_cpu_init();
+            result = __builtin_cpu_supports("f16c") != 0 && hf_simd_supported(HF_SIMD_SSE2);
+            break;
+#endif
+#ifdef HF_CONV_NEON
+        case HF_SIMD_NEON:
+            result = 1;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Force le niveau d'implémentation des conversions par lots
+ *
+ * @param level Niveau souhaité (HF_SIMD_AUTO pour le meilleur disponible)
+ * @return 1 si le niveau a été retenu, 0 s'il n'est pas disponible (sélection inchangée)
+ */
+int hf_simd_select(hf_simd_level level) {
+    int result = hf_simd_supported(level);
+
+    if(result) {
+        HF_ATOMIC_STORE(selected_level, level);
+        resolve_impl();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Renvoie le niveau d'implémentation effectivement utilisé
+ *
+ * @return Niveau résolu (jamais HF_SIMD_AUTO)
+ */
+hf_simd_level hf_simd_selected(void) {
+    hf_simd_level level = HF_ATOMIC_LOAD(selected_level);
+
+    return level == HF_SIMD_AUTO ? best_level() : level;
+}
+
+/**
+ * @brief Renvoie le nom d'un niveau d'implémentation
+ *
+ * @param level Niveau d'implémentation
+ * @return Chaîne constante décrivant le niveau
+ */
+const char *hf_simd_name(hf_simd_level level) {
+    const char *result = "inconnu";
+
+    switch(level) {
+        case HF_SIMD_AUTO:   result = "auto"; break;
+        case HF_SIMD_SCALAR: result = "scalaire"; break;
+        case HF_SIMD_SSE2:   result = "sse2"; break;
+        case HF_SIMD_AVX2:   result = "avx2"; break;
+        case HF_SIMD_F16C:   result = "f16c"; break;
+        case HF_SIMD_NEON:   result = "neon"; break;
+        default: break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Convertit un double en demi-flottant selon le mode d'arrondi du thread
+ *
+ * Arrondi unique depuis le double (pas de double arrondi via float). Les NaN
+ * conservent les 10 bits de poids fort de leur charge et sont rendus silencieux.
+ *
+ * @param d Le double à convertir
+ * @return Le demi-flottant correspondant
+ */
+uint16_t hf_from_double(double d) {
+    unsigned int flags = 0;
+    uint16_t result;
+    DISPATCH_ROUNDING_MODE_RET(result, hf_get_rounding_mode(), from_double_mode, d, &flags);
+    HF_PROFILE_FN(HF_PROF_DOUBLE_TO_HALF, result);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Convertit un double en demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param d Le double à convertir
+ * @param mode Mode d'arrondi à appliquer
+ * @return Le demi-flottant correspondant
+ */
+uint16_t hf_from_double_r(double d, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+    DISPATCH_ROUNDING_MODE_RET(result, mode, from_double_mode, d, &flags);
+    HF_PROFILE_FN(HF_PROF_DOUBLE_TO_HALF, result);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Convertit un demi-flottant en double (exacte)
+ *
+ * Construit directement le motif binaire du double. Les NaN conservent leur
+ * charge et sont rendus silencieux, comme half_to_float().
+ *
+ * @param hf Le demi-flottant à convertir
+ * @return Le double correspondant
+ */
+double hf_to_double(uint16_t hf) {
+    uint64_t bits = to_double_bits(hf);
+    double result;
+
+    HF_PROFILE_FN(HF_PROF_HALF_TO_DOUBLE, hf);
+    memcpy(&result, &bits, sizeof(result));
+
+    return result;
+}
+
+/**
+ * @brief Convertit un tableau de doubles en demi-flottants (mode du thread lu une fois)
+ *
+ * @param in Tableau source de n doubles
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_double_n(const double *in, uint16_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_FROM_DOUBLE, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), from_double_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en doubles
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n doubles
+ * @param n Nombre d'éléments
+ */
+void hf_to_double_n(const uint16_t *in, double *out, size_t n) {
+    size_t i;
+
+    if(!CONV_PARALLEL(CONV_PAR_TO_DOUBLE, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        for(i = 0; i < n; i++) {
+            uint64_t bits = to_double_bits(in[i]);
+            memcpy(&out[i], &bits, sizeof(bits));
+        }
+    }
+}
+
+/**
+ * @brief Convertit un entier 32 bits en demi-flottant selon le mode d'arrondi du thread
+ *
+ * Les entiers de valeur absolue au plus 2048 sont exacts; au-delà de 65504
+ * le résultat est l'infini ou 65504 selon le mode.
+ *
+ * @param v L'entier à convertir
+ * @return Le demi-flottant correspondant
+ */
+uint16_t hf_from_int32(int32_t v) {
+    unsigned int flags = 0;
+    uint16_t result;
+    DISPATCH_ROUNDING_MODE_RET(result, hf_get_rounding_mode(), from_int_mode, v, &flags);
+    HF_PROFILE_FN(HF_PROF_INT_TO_HALF, result);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Convertit un entier 32 bits en demi-flottant avec un mode d'arrondi explicite
+ *
+ * @param v L'entier à convertir
+ * @param mode Mode d'arrondi à appliquer
+ * @return Le demi-flottant correspondant
+ */
+uint16_t hf_from_int32_r(int32_t v, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    uint16_t result;
+    DISPATCH_ROUNDING_MODE_RET(result, mode, from_int_mode, v, &flags);
+    HF_PROFILE_FN(HF_PROF_INT_TO_HALF, result);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Convertit un tableau d'entiers 8 bits signés en demi-flottants (exacte)
+ *
+ * @param in Tableau source de n entiers
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_int8_n(const int8_t *in, uint16_t *out, size_t n) {
+    unsigned int flags = 0;
+    size_t i;
+
+    if(!CONV_PARALLEL(CONV_PAR_FROM_INT8, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        //|v| <= 128: toujours représentable, le mode d'arrondi est sans effet (aucune exception)
+        for(i = 0; i < n; i++) out[i] = from_int_mode(in[i], &flags, HF_ROUND_NEAREST_EVEN);
+    }
+}
+
+/**
+ * @brief Convertit un tableau d'entiers 8 bits non signés en demi-flottants (exacte)
+ *
+ * @param in Tableau source de n entiers
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_uint8_n(const uint8_t *in, uint16_t *out, size_t n) {
+    unsigned int flags = 0;
+    size_t i;
+
+    if(!CONV_PARALLEL(CONV_PAR_FROM_UINT8, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        for(i = 0; i < n; i++) out[i] = from_int_mode(in[i], &flags, HF_ROUND_NEAREST_EVEN);
+    }
+}
+
+/**
+ * @brief Convertit un tableau d'entiers 16 bits en demi-flottants (mode du thread lu une fois)
+ *
+ * @param in Tableau source de n entiers
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_int16_n(const int16_t *in, uint16_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_FROM_INT16, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), from_int16_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Convertit un tableau d'entiers 32 bits en demi-flottants (mode du thread lu une fois)
+ *
+ * @param in Tableau source de n entiers
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_from_int32_n(const int32_t *in, uint16_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_FROM_INT32, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), from_int32_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Convertit un demi-flottant en entier 32 bits par troncature (cast C)
+ *
+ * Lève invalide pour NaN et ±Inf, inexact si une partie fractionnaire est perdue.
+ *
+ * @param hf Le demi-flottant à convertir
+ * @return La partie entière, INT_MIN pour NaN et ±Inf
+ */
+int32_t hf_to_int32(uint16_t hf) {
+    unsigned int flags = HF_FE_INVALID;
+    int32_t result = INT_MIN;
+
+    HF_PROFILE_FN(HF_PROF_HALF_TO_INT, hf);
+    if((hf & ~HF_MASK_SIGN & 0xFFFFU) < HF_INFINITY_POS) {
+        flags = 0;
+        result = round_to_int(hf, &flags, HF_ROUND_TOWARD_ZERO);
+    }
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Convertit un demi-flottant en entier 32 bits par troncature saturée
+ *
+ * @param hf Le demi-flottant à convertir
+ * @return La partie entière, INT_MAX/INT_MIN pour ±Inf, 0 pour NaN
+ */
+int32_t hf_to_int32_sat(uint16_t hf) {
+    unsigned int flags = 0;
+    int32_t result = to_int_sat(hf, INT_MIN, INT_MAX, &flags, HF_ROUND_TOWARD_ZERO);
+
+    HF_PROFILE_FN(HF_PROF_HALF_TO_INT, hf);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Convertit un demi-flottant en entier 32 bits arrondi selon un mode explicite
+ *
+ * hf_to_int32_r(hf, hf_get_rounding_mode()) correspond à lrint().
+ *
+ * @param hf Le demi-flottant à convertir
+ * @param mode Mode d'arrondi à appliquer
+ * @return L'entier arrondi, INT_MAX/INT_MIN pour ±Inf, 0 pour NaN
+ */
+int32_t hf_to_int32_r(uint16_t hf, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    int32_t result;
+    HF_PROFILE_FN(HF_PROF_HALF_TO_INT, hf);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, to_int_sat, hf, INT_MIN, INT_MAX, &flags);
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Quantifie un tableau de demi-flottants en entiers 8 bits signés
+ *
+ * Arrondi selon le mode du thread (lu une fois), saturation à [-128, 127], NaN -> 0.
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n entiers
+ * @param n Nombre d'éléments
+ */
+void hf_to_int8_sat_n(const uint16_t *in, int8_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_TO_INT8, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), to_int8_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Quantifie un tableau de demi-flottants en entiers 8 bits non signés
+ *
+ * Arrondi selon le mode du thread (lu une fois), saturation à [0, 255], NaN -> 0.
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n entiers
+ * @param n Nombre d'éléments
+ */
+void hf_to_uint8_sat_n(const uint16_t *in, uint8_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_TO_UINT8, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), to_uint8_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Quantifie un tableau de demi-flottants en entiers 16 bits signés
+ *
+ * Arrondi selon le mode du thread (lu une fois), saturation à [-32768, 32767], NaN -> 0.
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n entiers
+ * @param n Nombre d'éléments
+ */
+void hf_to_int16_sat_n(const uint16_t *in, int16_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_TO_INT16, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), to_int16_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en entiers 32 bits
+ *
+ * Arrondi selon le mode du thread (lu une fois), ±Inf saturés, NaN -> 0.
+ *
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n entiers
+ * @param n Nombre d'éléments
+ */
+void hf_to_int32_sat_n(const uint16_t *in, int32_t *out, size_t n) {
+    if(!CONV_PARALLEL(CONV_PAR_TO_INT32, in, out, n)) {
+        HF_PROFILE_CALLS(HF_PROF_CONV_N, n);
+        DISPATCH_ROUNDING_MODE(hf_get_rounding_mode(), to_int32_block, in, out, n);
+    }
+}
+
+/**
+ * @brief Installe les noyaux correspondant au niveau sélectionné
+ */
+static void resolve_impl(void) {
+    hf_simd_level level = HF_ATOMIC_LOAD(selected_level);
+    from_float_fn from_fn = from_float_scalar;
+    to_float_fn to_fn = to_float_scalar;
+
+    if(level == HF_SIMD_AUTO) level = best_level();
+    switch(level) {
+#ifdef HF_CONV_X86
+        case HF_SIMD_SSE2:
+            from_fn = from_float_sse2;
+            to_fn = to_float_sse2;
+            break;
+        case HF_SIMD_AVX2:
+            from_fn = from_float_avx2;
+            to_fn = to_float_avx2;
+            break;
+        case HF_SIMD_F16C:
+            from_fn = from_float_f16c;
+            to_fn = to_float_f16c;
+            break;
+#endif
+#ifdef HF_CONV_NEON
+        case HF_SIMD_NEON:
+            to_fn = to_float_neon;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    HF_ATOMIC_STORE(from_float_impl, from_fn);
+    HF_ATOMIC_STORE(to_float_impl, to_fn);
+}
+
+/**
+ * @brief Détermine le meilleur niveau disponible sur ce processeur
+ *
+ * @return Niveau d'implémentation le plus performant supporté
+ */
+static hf_simd_level best_level(void) {
+    hf_simd_level result = HF_SIMD_SCALAR;
+
+    if(hf_simd_supported(HF_SIMD_NEON)) result = HF_SIMD_NEON;
+    else if(hf_simd_supported(HF_SIMD_F16C)) result = HF_SIMD_F16C;
+    else if(hf_simd_supported(HF_SIMD_AVX2)) result = HF_SIMD_AVX2;
+    else if(hf_simd_supported(HF_SIMD_SSE2)) result = HF_SIMD_SSE2;
+
+    return result;
+}
+
+/**
+ * @brief Conversion scalaire sans branchement fp16 -> float32 (identique à half_to_float)
+ *
+ * Les subnormaux sont convertis par un produit exact mant * 2^-24, ce qui évite
+ * la boucle de normalisation et reste correct en mode flush-to-zero (le résultat
+ * float32 est toujours normalisé).
+ *
+ * @param hf Motif binaire du demi-flottant
+ * @return Motif binaire du float32
+ */
+static uint32_t to_float_bits(uint16_t hf) {
+    union { float f; uint32_t u; } sub;
+    uint32_t sign = (uint32_t)(hf & HF_MASK_SIGN) << 16;
+    uint32_t em = hf & ~HF_MASK_SIGN & 0xFFFFU;
+    uint32_t normal = (em << 13) + (F32_EXP_REBIAS << 23);
+    uint32_t special = F32_INF_BITS | (em << 13) | ((em & HF_MASK_MANT) != 0 ? F32_QUIET_BIT : 0);
+    uint32_t result;
+
+    sub.f = (float)em * F32_TWO_M24;
+    result = em >= HF_INFINITY_POS ? special
+           : em > HF_MASK_MANT ? normal : sub.u;
+
+    return sign | result;
+}
+
+/**
+ * @brief Noyau portable float32 -> fp16 (boucle spécialisée pour le mode)
+ */
+static void from_float_scalar(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    DISPATCH_ROUNDING_MODE(mode, from_float_block, in, out, n);
+}
+
+/**
+ * @brief Boucle de from_float_scalar() (mode constant après spécialisation)
+ */
+static void from_float_block(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint32_t bits;
+        memcpy(&bits, &in[i], sizeof(bits));
+        out[i] = float_bits_to_half_inline(bits, &flags, mode);
+    }
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Noyau portable fp16 -> float32
+ */
+static void to_float_scalar(const uint16_t *in, float *out, size_t n) {
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint32_t bits = to_float_bits(in[i]);
+        memcpy(&out[i], &bits, sizeof(bits));
+    }
+}
+
+#ifdef HF_CONV_X86
+/**
+ * @brief Noyau SSE2 float32 -> fp16 (8 éléments par itération)
+ *
+ * Même calcul que float_bits_to_half_inline(), les tests du mode devenant des
+ * masques. SSE2 n'a pas de décalage variable par voie: la partie entière t et
+ * la partie fractionnaire r de |f| * 2^24 (produits et différences exacts sur la
+ * plage subnormale) donnent la mantisse subnormale, arrondie selon r > 1/2,
+ * r == 1/2 ou r > 0. Les floats subnormaux ne contribuent qu'un bit collant,
+ * calculé sur les bits pour rester exact en mode denormals-are-zero.
+ */
+HF_TARGET("sse2")
+static void from_float_sse2(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    const __m128i abs_mask = _mm_set1_epi32((int)F32_ABS_MASK);
+    const __m128i mant_mask = _mm_set1_epi32((int)F32_MANT_MASK);
+    const __m128i sign_mask = _mm_set1_epi32((int)HF_MASK_SIGN);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i rebias = _mm_set1_epi32(F32_EXP_REBIAS << 23);
+    const __m128i round_half = _mm_set1_epi32((int)F32_ROUND_HALF);
+    const __m128i round_dir = _mm_set1_epi32((int)F32_ROUND_DIR);
+    const __m128i max_finite = _mm_set1_epi32((int)HF_INFINITY_POS - 1);
+    const __m128i inf = _mm_set1_epi32((int)HF_INFINITY_POS);
+    const __m128i inf_bits = _mm_set1_epi32((int)F32_INF_BITS);
+    const __m128i nan_bits = _mm_set1_epi32((int)(HF_NAN & ~HF_INFINITY_POS));
+    const __m128i normal_min = _mm_set1_epi32((int)F32_HALF_MIN_BITS - 1);
+    const __m128i special_min = _mm_set1_epi32((int)F32_INF_BITS - 1);
+    const __m128i near = _mm_set1_epi32(mode == HF_ROUND_NEAREST_EVEN || mode == HF_ROUND_NEAREST_UP ? -1 : 0);
+    const __m128i rne = _mm_set1_epi32(mode == HF_ROUND_NEAREST_EVEN ? -1 : 0);
+    const __m128i away = _mm_set1_epi32(mode == HF_ROUND_NEAREST_UP ? -1 : 0);
+    const __m128i up = _mm_set1_epi32(mode == HF_ROUND_TOWARD_POS_INF ? -1 : 0);
+    const __m128i down = _mm_set1_epi32(mode == HF_ROUND_TOWARD_NEG_INF ? -1 : 0);
+    const __m128i quiet = _mm_set1_epi32((int)F32_QUIET_BIT);
+    const __m128i fe_invalid = _mm_set1_epi32((int)HF_FE_INVALID);
+    const __m128i fe_overflow = _mm_set1_epi32((int)(HF_FE_OVERFLOW | HF_FE_INEXACT));
+    const __m128i fe_underflow = _mm_set1_epi32((int)(HF_FE_UNDERFLOW | HF_FE_INEXACT));
+    const __m128i fe_inexact = _mm_set1_epi32((int)HF_FE_INEXACT);
+    const __m128 two_p24 = _mm_set1_ps(F32_TWO_P24);
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128i excepts = _mm_setzero_si128();
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8) {
+        __m128i packed[2];
+        int k;
+
+        for(k = 0; k < 2; k++) {
+            __m128i bits = _mm_castps_si128(_mm_loadu_ps(in + i + 4 * k));
+            __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), sign_mask);
+            __m128i abs_bits = _mm_and_si128(bits, abs_mask);
+            __m128i neg = _mm_srai_epi32(bits, 31);
+            __m128i dir = _mm_or_si128(_mm_andnot_si128(neg, up), _mm_and_si128(neg, down));
+            __m128i normal = _mm_sub_epi32(abs_bits, rebias);
+            __m128i lsb = _mm_and_si128(_mm_srli_epi32(normal, 13), one);
+            __m128i inc = _mm_add_epi32(_mm_and_si128(near, round_half), _mm_and_si128(rne, _mm_sub_epi32(lsb, one)));
+            __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(abs_bits), two_p24);
+            __m128i whole = _mm_cvttps_epi32(scaled);
+            __m128 frac = _mm_sub_ps(scaled, _mm_cvtepi32_ps(whole));
+            __m128i tiny = _mm_and_si128(_mm_cmpeq_epi32(_mm_srli_epi32(abs_bits, 23), _mm_setzero_si128()),
+                                         _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(abs_bits, mant_mask), _mm_setzero_si128()), one));
+            __m128i gt_half = _mm_castps_si128(_mm_cmpgt_ps(frac, half));
+            __m128i eq_half = _mm_castps_si128(_mm_cmpeq_ps(frac, half));
+            __m128i nonzero = _mm_or_si128(_mm_castps_si128(_mm_cmpgt_ps(frac, _mm_setzero_ps())), _mm_sub_epi32(_mm_setzero_si128(), tiny));
+            __m128i odd = _mm_cmpeq_epi32(_mm_and_si128(whole, one), one);
+            __m128i round_up = _mm_or_si128(_mm_or_si128(_mm_and_si128(near, gt_half),
+                                                         _mm_and_si128(eq_half, _mm_or_si128(away, _mm_and_si128(rne, odd)))),
+                                            _mm_and_si128(dir, nonzero));
+            __m128i subnormal = _mm_sub_epi32(whole, round_up);
+            __m128i limit = _mm_sub_epi32(max_finite, _mm_or_si128(near, dir));
+            __m128i special = _mm_or_si128(inf, _mm_and_si128(_mm_cmpgt_epi32(abs_bits, inf_bits),
+                                                              _mm_or_si128(nan_bits, _mm_and_si128(_mm_srli_epi32(abs_bits, 13), _mm_set1_epi32(HF_MASK_MANT)))));
+            __m128i is_special = _mm_cmpgt_epi32(abs_bits, special_min);
+            __m128i is_normal = _mm_cmpgt_epi32(abs_bits, normal_min);
+            __m128i lane_fe = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(abs_bits, round_dir), _mm_setzero_si128()), fe_inexact);
+            __m128i over, result;
+
+            //Chemin normal: incrément d'arrondi puis plafonnement à l'infini ou à 65504
+            inc = _mm_add_epi32(inc, _mm_and_si128(dir, round_dir));
+            normal = _mm_srli_epi32(_mm_add_epi32(normal, inc), 13);
+            lane_fe = _mm_or_si128(lane_fe, _mm_and_si128(_mm_cmpgt_epi32(normal, max_finite), fe_overflow));
+            over = _mm_cmpgt_epi32(normal, limit);
+            normal = _mm_or_si128(_mm_and_si128(over, limit), _mm_andnot_si128(over, normal));
+
+            //Exceptions de la voie selon le chemin retenu (normal, subnormal ou NaN signalant)
+            lane_fe = _mm_or_si128(_mm_and_si128(is_normal, lane_fe), _mm_andnot_si128(is_normal, _mm_and_si128(nonzero, fe_underflow)));
+            lane_fe = _mm_or_si128(_mm_andnot_si128(is_special, lane_fe),
+                                   _mm_and_si128(_mm_and_si128(is_special, _mm_cmpgt_epi32(abs_bits, inf_bits)),
+                                                 _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(abs_bits, quiet), _mm_setzero_si128()), fe_invalid)));
+            excepts = _mm_or_si128(excepts, lane_fe);
+
+            result = _mm_or_si128(_mm_and_si128(is_normal, normal), _mm_andnot_si128(is_normal, subnormal));
+            result = _mm_or_si128(_mm_and_si128(is_special, special), _mm_andnot_si128(is_special, result));
+            result = _mm_or_si128(result, sign);
+
+            //Extension de signe 16 -> 32 bits pour que le pack saturé signé soit exact
+            packed[k] = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        }
+
+        _mm_storeu_si128((__m128i *)(void *)(out + i), _mm_packs_epi32(packed[0], packed[1]));
+    }
+
+    //Réduction horizontale des exceptions des voies, publiées une seule fois
+    excepts = _mm_or_si128(excepts, _mm_shuffle_epi32(excepts, 0x4E));
+    excepts = _mm_or_si128(excepts, _mm_shuffle_epi32(excepts, 0xB1));
+    HF_FE_RAISE((unsigned int)_mm_cvtsi128_si32(excepts));
+
+    from_float_scalar(in + i, out + i, n - i, mode);
+}
+
+/**
+ * @brief Noyau SSE2 fp16 -> float32 (8 éléments par itération)
+ */
+HF_TARGET("sse2")
+static void to_float_sse2(const uint16_t *in, float *out, size_t n) {
+    const __m128i em_mask = _mm_set1_epi32(0x7FFF);
+    const __m128i sign_mask = _mm_set1_epi32((int)HF_MASK_SIGN);
+    const __m128i mant_mask = _mm_set1_epi32((int)HF_MASK_MANT);
+    const __m128i rebias = _mm_set1_epi32(F32_EXP_REBIAS << 23);
+    const __m128i inf = _mm_set1_epi32((int)F32_INF_BITS);
+    const __m128i quiet = _mm_set1_epi32((int)F32_QUIET_BIT);
+    const __m128i em_special = _mm_set1_epi32((int)HF_INFINITY_POS - 1);
+    const __m128i em_normal = _mm_set1_epi32((int)HF_MASK_MANT);
+    const __m128 two_m24 = _mm_set1_ps(F32_TWO_M24);
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8) {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i halves[2];
+        int k;
+
+        halves[0] = _mm_unpacklo_epi16(raw, _mm_setzero_si128());
+        halves[1] = _mm_unpackhi_epi16(raw, _mm_setzero_si128());
+
+        for(k = 0; k < 2; k++) {
+            __m128i sign = _mm_slli_epi32(_mm_and_si128(halves[k], sign_mask), 16);
+            __m128i em = _mm_and_si128(halves[k], em_mask);
+            __m128i shifted = _mm_slli_epi32(em, 13);
+            __m128i mant_zero = _mm_cmpeq_epi32(_mm_and_si128(em, mant_mask), _mm_setzero_si128());
+            __m128i normal = _mm_add_epi32(shifted, rebias);
+            __m128i special = _mm_or_si128(_mm_or_si128(shifted, inf), _mm_andnot_si128(mant_zero, quiet));
+            __m128i subnormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(em), two_m24));
+            __m128i is_special = _mm_cmpgt_epi32(em, em_special);
+            __m128i is_normal = _mm_cmpgt_epi32(em, em_normal);
+            __m128i result = _mm_or_si128(_mm_and_si128(is_normal, normal), _mm_andnot_si128(is_normal, subnormal));
+
+            result = _mm_or_si128(_mm_and_si128(is_special, special), _mm_andnot_si128(is_special, result));
+            _mm_storeu_ps(out + i + 4 * k, _mm_castsi128_ps(_mm_or_si128(result, sign)));
+        }
+    }
+
+    to_float_scalar(in + i, out + i, n - i);
+}
+
+/**
+ * @brief Noyau AVX2 float32 -> fp16 (16 éléments par itération)
+ *
+ * Même calcul que float_bits_to_half_inline(), les tests du mode devenant des
+ * masques et le décalage variable vpsrlvd donnant directement la mantisse
+ * subnormale arrondie.
+ */
+HF_TARGET("avx2")
+static void from_float_avx2(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    const __m256i abs_mask = _mm256_set1_epi32((int)F32_ABS_MASK);
+    const __m256i mant_mask = _mm256_set1_epi32((int)F32_MANT_MASK);
+    const __m256i implicit_bit = _mm256_set1_epi32((int)F32_IMPLICIT_BIT);
+    const __m256i sign_mask = _mm256_set1_epi32((int)HF_MASK_SIGN);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i rebias = _mm256_set1_epi32(F32_EXP_REBIAS << 23);
+    const __m256i round_half = _mm256_set1_epi32((int)F32_ROUND_HALF);
+    const __m256i round_dir = _mm256_set1_epi32((int)F32_ROUND_DIR);
+    const __m256i shift_base = _mm256_set1_epi32(F32_SUB_SHIFT_BASE);
+    const __m256i shift_min = _mm256_set1_epi32(13);
+    const __m256i shift_max = _mm256_set1_epi32(F32_SUB_SHIFT_MAX);
+    const __m256i max_finite = _mm256_set1_epi32((int)HF_INFINITY_POS - 1);
+    const __m256i inf = _mm256_set1_epi32((int)HF_INFINITY_POS);
+    const __m256i inf_bits = _mm256_set1_epi32((int)F32_INF_BITS);
+    const __m256i nan_bits = _mm256_set1_epi32((int)(HF_NAN & ~HF_INFINITY_POS));
+    const __m256i normal_min = _mm256_set1_epi32((int)F32_HALF_MIN_BITS - 1);
+    const __m256i special_min = _mm256_set1_epi32((int)F32_INF_BITS - 1);
+    const __m256i near = _mm256_set1_epi32(mode == HF_ROUND_NEAREST_EVEN || mode == HF_ROUND_NEAREST_UP ? -1 : 0);
+    const __m256i rne = _mm256_set1_epi32(mode == HF_ROUND_NEAREST_EVEN ? -1 : 0);
+    const __m256i up = _mm256_set1_epi32(mode == HF_ROUND_TOWARD_POS_INF ? -1 : 0);
+    const __m256i down = _mm256_set1_epi32(mode == HF_ROUND_TOWARD_NEG_INF ? -1 : 0);
+    const __m256i quiet = _mm256_set1_epi32((int)F32_QUIET_BIT);
+    const __m256i fe_invalid = _mm256_set1_epi32((int)HF_FE_INVALID);
+    const __m256i fe_overflow = _mm256_set1_epi32((int)(HF_FE_OVERFLOW | HF_FE_INEXACT));
+    const __m256i fe_underflow = _mm256_set1_epi32((int)(HF_FE_UNDERFLOW | HF_FE_INEXACT));
+    const __m256i fe_inexact = _mm256_set1_epi32((int)HF_FE_INEXACT);
+    __m256i excepts = _mm256_setzero_si256();
+    __m128i reduced;
+    size_t i = 0;
+
+    for(; i + 16 <= n; i += 16) {
+        __m256i packed[2];
+        int k;
+
+        for(k = 0; k < 2; k++) {
+            __m256i bits = _mm256_castps_si256(_mm256_loadu_ps(in + i + 8 * k));
+            __m256i sign = _mm256_and_si256(_mm256_srli_epi32(bits, 16), sign_mask);
+            __m256i abs_bits = _mm256_and_si256(bits, abs_mask);
+            __m256i exp = _mm256_srli_epi32(abs_bits, 23);
+            __m256i mant = _mm256_or_si256(_mm256_and_si256(abs_bits, mant_mask),
+                                           _mm256_andnot_si256(_mm256_cmpeq_epi32(exp, _mm256_setzero_si256()), implicit_bit));
+            __m256i neg = _mm256_srai_epi32(bits, 31);
+            __m256i dir = _mm256_or_si256(_mm256_andnot_si256(neg, up), _mm256_and_si256(neg, down));
+            __m256i shift = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(shift_base, exp), shift_min), shift_max);
+            __m256i sub_half = _mm256_sllv_epi32(one, _mm256_sub_epi32(shift, one));
+            __m256i sub_lsb = _mm256_and_si256(_mm256_srlv_epi32(mant, shift), one);
+            __m256i normal = _mm256_sub_epi32(abs_bits, rebias);
+            __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(normal, 13), one);
+            __m256i inc, subnormal, special, is_special, is_normal, result, lane_fe, sub_fe;
+
+            //Chemin normal: incrément d'arrondi puis plafonnement à l'infini ou à 65504
+            inc = _mm256_add_epi32(_mm256_and_si256(near, round_half), _mm256_and_si256(rne, _mm256_sub_epi32(lsb, one)));
+            inc = _mm256_add_epi32(inc, _mm256_and_si256(dir, round_dir));
+            normal = _mm256_srli_epi32(_mm256_add_epi32(normal, inc), 13);
+            lane_fe = _mm256_or_si256(_mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(abs_bits, round_dir), _mm256_setzero_si256()), fe_inexact),
+                                      _mm256_and_si256(_mm256_cmpgt_epi32(normal, max_finite), fe_overflow));
+            normal = _mm256_min_epu32(normal, _mm256_sub_epi32(max_finite, _mm256_or_si256(near, dir)));
+
+            //Chemin subnormal: même incrément à l'échelle du décalage variable
+            inc = _mm256_add_epi32(_mm256_and_si256(near, sub_half), _mm256_and_si256(rne, _mm256_sub_epi32(sub_lsb, one)));
+            inc = _mm256_add_epi32(inc, _mm256_and_si256(dir, _mm256_sub_epi32(_mm256_add_epi32(sub_half, sub_half), one)));
+            sub_fe = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(mant, _mm256_sub_epi32(_mm256_add_epi32(sub_half, sub_half), one)),
+                                                            _mm256_setzero_si256()), fe_underflow);
+            subnormal = _mm256_srlv_epi32(_mm256_add_epi32(mant, inc), shift);
+
+            special = _mm256_or_si256(inf, _mm256_and_si256(_mm256_cmpgt_epi32(abs_bits, inf_bits),
+                                                            _mm256_or_si256(nan_bits, _mm256_and_si256(_mm256_srli_epi32(abs_bits, 13), _mm256_set1_epi32(HF_MASK_MANT)))));
+            is_special = _mm256_cmpgt_epi32(abs_bits, special_min);
+            is_normal = _mm256_cmpgt_epi32(abs_bits, normal_min);
+
+            result = _mm256_blendv_epi8(subnormal, normal, is_normal);
+            result = _mm256_blendv_epi8(result, special, is_special);
+            packed[k] = _mm256_or_si256(result, sign);
+
+            //Exceptions de la voie selon le chemin retenu (normal, subnormal ou NaN signalant)
+            lane_fe = _mm256_blendv_epi8(sub_fe, lane_fe, is_normal);
+            lane_fe = _mm256_blendv_epi8(lane_fe, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(abs_bits, inf_bits),
+                                                                                    _mm256_cmpeq_epi32(_mm256_and_si256(abs_bits, quiet), _mm256_setzero_si256())),
+                                                                   fe_invalid), is_special);
+            excepts = _mm256_or_si256(excepts, lane_fe);
+        }
+
+        //vpackusdw travaille par moitiés de 128 bits: remettre les quadruplets dans l'ordre
+        _mm256_storeu_si256((__m256i *)(void *)(out + i),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi32(packed[0], packed[1]), 0xD8));
+    }
+
+    //Réduction horizontale des exceptions des voies, publiées une seule fois
+    reduced = _mm_or_si128(_mm256_castsi256_si128(excepts), _mm256_extracti128_si256(excepts, 1));
+    reduced = _mm_or_si128(reduced, _mm_shuffle_epi32(reduced, 0x4E));
+    reduced = _mm_or_si128(reduced, _mm_shuffle_epi32(reduced, 0xB1));
+    HF_FE_RAISE((unsigned int)_mm_cvtsi128_si32(reduced));
+
+    from_float_scalar(in + i, out + i, n - i, mode);
+}
+
+/**
+ * @brief Noyau AVX2 fp16 -> float32 (8 éléments par itération)
+ */
+HF_TARGET("avx2")
+static void to_float_avx2(const uint16_t *in, float *out, size_t n) {
+    const __m256i em_mask = _mm256_set1_epi32(0x7FFF);
+    const __m256i sign_mask = _mm256_set1_epi32((int)HF_MASK_SIGN);
+    const __m256i mant_mask = _mm256_set1_epi32((int)HF_MASK_MANT);
+    const __m256i rebias = _mm256_set1_epi32(F32_EXP_REBIAS << 23);
+    const __m256i inf = _mm256_set1_epi32((int)F32_INF_BITS);
+    const __m256i quiet = _mm256_set1_epi32((int)F32_QUIET_BIT);
+    const __m256i em_special = _mm256_set1_epi32((int)HF_INFINITY_POS - 1);
+    const __m256i em_normal = _mm256_set1_epi32((int)HF_MASK_MANT);
+    const __m256 two_m24 = _mm256_set1_ps(F32_TWO_M24);
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8) {
+        __m256i hf = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(const void *)(in + i)));
+        __m256i sign = _mm256_slli_epi32(_mm256_and_si256(hf, sign_mask), 16);
+        __m256i em = _mm256_and_si256(hf, em_mask);
+        __m256i shifted = _mm256_slli_epi32(em, 13);
+        __m256i mant_zero = _mm256_cmpeq_epi32(_mm256_and_si256(em, mant_mask), _mm256_setzero_si256());
+        __m256i normal = _mm256_add_epi32(shifted, rebias);
+        __m256i special = _mm256_or_si256(_mm256_or_si256(shifted, inf), _mm256_andnot_si256(mant_zero, quiet));
+        __m256i subnormal = _mm256_castps_si256(_mm256_mul_ps(_mm256_cvtepi32_ps(em), two_m24));
+        __m256i result = _mm256_blendv_epi8(subnormal, normal, _mm256_cmpgt_epi32(em, em_normal));
+
+        result = _mm256_blendv_epi8(result, special, _mm256_cmpgt_epi32(em, em_special));
+        _mm256_storeu_ps(out + i, _mm256_castsi256_ps(_mm256_or_si256(result, sign)));
+    }
+
+    to_float_scalar(in + i, out + i, n - i);
+}
+
+//Boucle vcvtps2ph (8 éléments par itération) avec un mode d'arrondi immédiat.
+//Une voie est inexacte si l'aller-retour exact fp16 -> float32 change ses bits;
+//les voies inexactes hors de [2^-14, 65504] (soupassement, dépassement, NaN)
+//sont rares et repassent par le calcul scalaire des exceptions
+#define F16C_FROM_LOOP(imm) \
+    for(; i + 8 <= n; i += 8) { \
+        __m256 x = _mm256_loadu_ps(in + i); \
+        __m128i h = _mm256_cvtps_ph(x, (imm)); \
+        __m256 diff = _mm256_xor_ps(x, _mm256_cvtph_ps(h)); \
+        __m256 abs_x = _mm256_and_ps(x, abs_mask); \
+        __m256 edge = _mm256_or_ps(_mm256_cmp_ps(abs_x, half_min, _CMP_LT_OQ), _mm256_cmp_ps(abs_x, half_max, _CMP_NLE_UQ)); \
+        _mm_storeu_si128((__m128i *)(void *)(out + i), h); \
+        inexact = _mm256_or_ps(inexact, _mm256_andnot_ps(edge, diff)); \
+        if(!_mm256_testz_si256(_mm256_castps_si256(edge), _mm256_castps_si256(diff))) { \
+            f16c_rare_flags(in + i, _mm256_movemask_ps(edge), &flags, (mode)); \
+        } \
+    }
+
+/**
+ * @brief Noyau F16C float32 -> fp16
+ *
+ * vcvtps2ph reçoit le mode en immédiat (au pair, vers zéro, vers +inf, vers -inf)
+ * et donne exactement float_to_half(). Il ne connaît pas les égalités loin de
+ * zéro, et en mode denormals-are-zero (MXCSR.DAZ, positionné par -ffast-math)
+ * il ignore les floats subnormaux, ce qui change les arrondis dirigés: ces cas
+ * passent par le noyau entier le plus large disponible.
+ */
+HF_TARGET("avx,f16c")
+static void from_float_f16c(const float *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32((int)F32_ABS_MASK));
+    const __m256 half_min = _mm256_set1_ps(F32_HALF_MIN);
+    const __m256 half_max = _mm256_set1_ps(F32_HALF_MAX);
+    int daz = (_mm_getcsr() & MXCSR_DAZ) != 0;
+    __m256 inexact = _mm256_setzero_ps();
+    unsigned int flags = 0;
+    size_t i = 0;
+
+    switch(mode) {
+        case HF_ROUND_NEAREST_EVEN:
+            F16C_FROM_LOOP(_MM_FROUND_TO_NEAREST_INT);
+            break;
+        case HF_ROUND_TOWARD_ZERO:
+            F16C_FROM_LOOP(_MM_FROUND_TO_ZERO);
+            break;
+        case HF_ROUND_TOWARD_POS_INF:
+            if(!daz) F16C_FROM_LOOP(_MM_FROUND_TO_POS_INF);
+            break;
+        case HF_ROUND_TOWARD_NEG_INF:
+            if(!daz) F16C_FROM_LOOP(_MM_FROUND_TO_NEG_INF);
+            break;
+        default:
+            break;
+    }
+
+    //Exceptions cumulées publiées une seule fois
+    if(!_mm256_testz_si256(_mm256_castps_si256(inexact), _mm256_castps_si256(inexact))) flags |= HF_FE_INEXACT;
+    HF_FE_RAISE(flags);
+
+    if(i == 0 && n >= 8) {
+        if(hf_simd_supported(HF_SIMD_AVX2)) from_float_avx2(in, out, n, mode);
+        else from_float_sse2(in, out, n, mode);
+    } else {
+        from_float_scalar(in + i, out + i, n - i, mode);
+    }
+}
+
+/**
+ * @brief Exceptions des voies rares d'un groupe de huit floats (calcul scalaire)
+ *
+ * @param in Les huit floats du groupe
+ * @param lanes Masque des voies à traiter (bit k = voie k)
+ * @param flags Mot d'exceptions local cumulé
+ * @param mode Mode d'arrondi du noyau
+ */
+static void f16c_rare_flags(const float *in, int lanes, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t bits;
+    int k;
+
+    for(k = 0; k < 8; k++) {
+        if(lanes & (1 << k)) {
+            memcpy(&bits, &in[k], sizeof(bits));
+            (void)float_bits_to_half_inline(bits, flags, mode);
+        }
+    }
+}
+
+/**
+ * @brief Noyau F16C fp16 -> float32 (8 éléments par itération)
+ *
+ * vcvtph2ps est exact, rend les NaN silencieux en conservant la charge utile
+ * et ignore le mode denormals-are-zero: identique à half_to_float.
+ */
+HF_TARGET("avx,f16c")
+static void to_float_f16c(const uint16_t *in, float *out, size_t n) {
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8) {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(raw));
+    }
+
+    to_float_scalar(in + i, out + i, n - i);
+}
+#endif //HF_CONV_X86
+
+#ifdef HF_CONV_NEON
+/**
+ * @brief Noyau NEON fp16 -> float32
+ *
+ * La conversion du type de stockage __fp16 produit fcvt (fcvtl une fois la
+ * boucle vectorisée), exacte et identique à half_to_float.
+ */
+static void to_float_neon(const uint16_t *in, float *out, size_t n) {
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        __fp16 hf;
+        memcpy(&hf, &in[i], sizeof(hf));
+        out[i] = (float)hf;
+    }
+}
+#endif //HF_CONV_NEON
+
+/**
+ * @brief Position du bit de poids fort d'un entier 64 bits non nul
+ */
+static int msb_index64(uint64_t x) {
+    int result = 0;
+
+    if(x >> 32) {x >>= 32; result += 32;}
+    if(x >> 16) {x >>= 16; result += 16;}
+    if(x >> 8) {x >>= 8; result += 8;}
+    while(x >>= 1) result++;
+
+    return result;
+}
+
+/**
+ * @brief Résultat d'un dépassement de capacité selon le mode d'arrondi
+ *
+ * Infini en arrondi au plus proche et vers l'infini du même signe, plus grand
+ * fini (65504) sinon.
+ */
+static uint16_t overflow_half(uint16_t sign, hf_rounding_mode mode) {
+    int to_inf = mode == HF_ROUND_NEAREST_EVEN || mode == HF_ROUND_NEAREST_UP
+              || (mode == HF_ROUND_TOWARD_POS_INF && !sign) || (mode == HF_ROUND_TOWARD_NEG_INF && sign);
+
+    return (uint16_t)(sign | (to_inf ? HF_INFINITY_POS : HF_INFINITY_POS - 1));
+}
+
+/**
+ * @brief Arrondit et compose la valeur mant * 2^(exp - 15) de précision arbitraire
+ *
+ * La mantisse large est ramenée à l'échelle de half_float (bit de poids fort en
+ * position 15, ou exposant HF_EXP_MIN pour les subnormaux) en repliant les bits
+ * perdus dans un bit collant, puis normalize_and_round_inline() arrondit une
+ * seule fois selon le mode.
+ *
+ * @param sign Signe (0 ou HF_MASK_SIGN)
+ * @param exp Exposant de la mantisse (même convention que half_float)
+ * @param mant Mantisse entière
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi (constant après spécialisation)
+ * @return Le demi-flottant arrondi
+ */
+static inline uint16_t round_pack_wide(uint16_t sign, int exp, uint64_t mant, unsigned int *flags, hf_rounding_mode mode) {
+    uint16_t result = sign;
+
+    if(mant != 0) {
+        int shift = msb_index64(mant) - HF_MANT_SHIFT;
+        int e = exp + shift;
+
+        if(e < HF_EXP_MIN) {
+            shift += HF_EXP_MIN - e;
+            e = HF_EXP_MIN;
+        }
+        if(e > HF_EXP_BIAS) {
+            HF_FE_ACCUM(flags, HF_FE_OVERFLOW | HF_FE_INEXACT);
+            result = overflow_half(sign, mode);
+        } else {
+            half_float hf;
+            uint64_t m;
+
+            if(shift >= 64) m = 1;
+            else if(shift > 0) m = (mant >> shift) | ((mant & ((1ULL << shift) - 1ULL)) != 0);
+            else m = mant << -shift;
+
+            hf.sign = sign;
+            hf.exp = e;
+            hf.mant = (int32_t)m;
+            normalize_and_round_inline(&hf, flags, mode);
+            result = hf.exp == HF_EXP_FULL ? overflow_half(sign, mode) : compose_half(&hf);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Conversion double -> fp16 avec un mode d'arrondi donné
+ */
+static inline uint16_t from_double_mode(double d, unsigned int *flags, hf_rounding_mode mode) {
+    uint64_t bits, mant;
+    uint16_t sign, result;
+    int exp;
+
+    memcpy(&bits, &d, sizeof(bits));
+    sign = (uint16_t)((bits >> 48) & HF_MASK_SIGN);
+    exp = (int)((bits >> 52) & 0x7FFU);
+    mant = bits & F64_MANT_MASK;
+
+    if(exp == 0x7FF) {
+        //Infini, ou NaN silencieux avec les bits de poids fort de la charge (invalide si signalant)
+        if(mant != 0 && !(mant & F64_QUIET_BIT)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+        result = (uint16_t)(sign | (mant != 0 ? HF_NAN | (uint16_t)(mant >> 42) : HF_INFINITY_POS));
+    } else if(exp == 0) {
+        //Zéro ou subnormal double (toujours sous le plus petit subnormal fp16)
+        result = round_pack_wide(sign, F64_EXP_SUB, mant, flags, mode);
+    } else {
+        result = round_pack_wide(sign, exp + F64_EXP_SUB - 1, mant | F64_IMPLICIT_BIT, flags, mode);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Conversion exacte fp16 -> motif binaire double
+ */
+static uint64_t to_double_bits(uint16_t hf) {
+    uint64_t sign = (uint64_t)(hf & HF_MASK_SIGN) << 48;
+    uint64_t exp = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
+    uint64_t mant = hf & HF_MASK_MANT;
+    uint64_t result = sign;
+
+    if(exp == HF_MASK_EXP) {
+        result |= F64_INF_BITS | (mant << 42) | (mant != 0 ? F64_QUIET_BIT : 0);
+    } else if(exp != 0) {
+        result |= ((exp + F64_EXP_REBIAS) << 52) | (mant << 42);
+    } else if(mant != 0) {
+        //Subnormal fp16: normalisé en double (bit de poids fort p -> exposant p - 24)
+        int p = msb_index64(mant);
+        result |= ((uint64_t)(p - 24 + 1023) << 52) | ((mant << (52 - p)) & F64_MANT_MASK);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Conversion entier -> fp16 avec un mode d'arrondi donné
+ */
+static inline uint16_t from_int_mode(int32_t v, unsigned int *flags, hf_rounding_mode mode) {
+    uint64_t mag = v < 0 ? (uint64_t)(-(int64_t)v) : (uint64_t)v;
+    return round_pack_wide(v < 0 ? HF_MASK_SIGN : 0, HF_MANT_SHIFT, mag, flags, mode);
+}
+
+/**
+ * @brief Arrondit un demi-flottant fini à l'entier selon le mode
+ *
+ * La valeur vaut m * 2^(e - 25) avec m la mantisse sur 11 bits: les bits sous
+ * la virgule sont résumés en bit de garde et bit collant pour should_round_up().
+ *
+ * @param hf Demi-flottant fini
+ * @param flags Mot d'exceptions local cumulé (inexact si une fraction est perdue)
+ * @param mode Mode d'arrondi
+ * @return L'entier arrondi (|résultat| <= 65504)
+ */
+static inline int32_t round_to_int(uint16_t hf, unsigned int *flags, hf_rounding_mode mode) {
+    uint16_t sign = hf & HF_MASK_SIGN;
+    int e = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
+    uint32_t m = hf & HF_MASK_MANT;
+    uint32_t q;
+
+    if(e != 0) m |= 1U << HF_MANT_BITS;
+    else e = 1;
+
+    if(e >= HF_MANT_BITS + HF_EXP_BIAS) {
+        q = m << (e - HF_MANT_BITS - HF_EXP_BIAS);
+    } else {
+        int s = HF_MANT_BITS + HF_EXP_BIAS - e;
+        uint32_t half = 1U << (s - 1);
+        uint32_t rem = m & ((1U << s) - 1U);
+        uint32_t round_bits = (rem >= half ? HF_GUARD_BIT : 0) | ((rem & (half - 1U)) != 0);
+
+        q = m >> s;
+        q += (uint32_t)should_round_up(round_bits, q & 1U, sign, mode);
+        if(rem) HF_FE_ACCUM(flags, HF_FE_INEXACT);
+    }
+
+    return sign ? -(int32_t)q : (int32_t)q;
+}
+
+/**
+ * @brief Conversion fp16 -> entier saturée dans [lo, hi], NaN -> 0
+ *
+ * Invalide pour NaN, ±Inf et toute valeur saturée (résultat non représentable).
+ */
+static inline int32_t to_int_sat(uint16_t hf, int32_t lo, int32_t hi, unsigned int *flags, hf_rounding_mode mode) {
+    uint16_t abs_bits = hf & ~HF_MASK_SIGN & 0xFFFFU;
+    unsigned int excepts = HF_FE_INVALID;
+    int32_t result = 0;
+
+    if(abs_bits == HF_INFINITY_POS) {
+        result = (hf & HF_MASK_SIGN) ? lo : hi;
+    } else if(abs_bits < HF_INFINITY_POS) {
+        excepts = 0;
+        result = round_to_int(hf, &excepts, mode);
+        //Saturation: invalide remplace l'indicateur inexact
+        if(result < lo || result > hi) {
+            excepts = HF_FE_INVALID;
+            result = result < lo ? lo : hi;
+        }
+    }
+    HF_FE_ACCUM(flags, excepts);
+
+    return result;
+}
+
+/**
+ * @brief Noyaux par lots (mode constant après spécialisation par DISPATCH_ROUNDING_MODE)
+ */
+static void from_double_block(const double *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = from_double_mode(in[i], &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void from_int16_block(const int16_t *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = from_int_mode(in[i], &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void from_int32_block(const int32_t *in, uint16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = from_int_mode(in[i], &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void to_int8_block(const uint16_t *in, int8_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = (int8_t)to_int_sat(in[i], SCHAR_MIN, SCHAR_MAX, &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void to_uint8_block(const uint16_t *in, uint8_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = (uint8_t)to_int_sat(in[i], 0, UCHAR_MAX, &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void to_int16_block(const uint16_t *in, int16_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = (int16_t)to_int_sat(in[i], SHRT_MIN, SHRT_MAX, &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+static void to_int32_block(const uint16_t *in, int32_t *out, size_t n, hf_rounding_mode mode) {
+    unsigned int flags = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) out[i] = to_int_sat(in[i], INT_MIN, INT_MAX, &flags, mode);
+    HF_FE_RAISE(flags);
+}
+
+#if defined(HF_THREADS)
+/**
+ * @brief Confie une conversion par lots au groupe de threads
+ *
+ * @param op Conversion du lot
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ * @return 1 si le lot a été traité en parallèle, 0 sinon
+ */
+static int conv_parallel(conv_par_op op, const void *in, void *out, size_t n) {
+    conv_par_task task;
+
+    task.op = op;
+    task.in = in;
+    task.out = out;
+
+    return hf_par_run(conv_par_body, &task, n);
+}
+
+/**
+ * @brief Traite la tranche [begin, end) d'une conversion répartie
+ *
+ * Rappelle la conversion publique sur la tranche (séquentielle depuis une tranche).
+ *
+ * @param ctx Lot (conv_par_task)
+ * @param begin Premier élément de la tranche
+ * @param end Fin (exclue) de la tranche
+ */
+static void conv_par_body(void *ctx, size_t begin, size_t end) {
+    const conv_par_task *task = (const conv_par_task *)ctx;
+    size_t n = end - begin;
+
+    switch(task->op) {
+        case CONV_PAR_FROM_FLOAT:  hf_from_float_n((const float *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_FLOAT:    hf_to_float_n((const uint16_t *)task->in + begin, (float *)task->out + begin, n); break;
+        case CONV_PAR_FROM_DOUBLE: hf_from_double_n((const double *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_DOUBLE:   hf_to_double_n((const uint16_t *)task->in + begin, (double *)task->out + begin, n); break;
+        case CONV_PAR_FROM_INT8:   hf_from_int8_n((const int8_t *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_FROM_UINT8:  hf_from_uint8_n((const uint8_t *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_FROM_INT16:  hf_from_int16_n((const int16_t *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_FROM_INT32:  hf_from_int32_n((const int32_t *)task->in + begin, (uint16_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_INT8:     hf_to_int8_sat_n((const uint16_t *)task->in + begin, (int8_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_UINT8:    hf_to_uint8_sat_n((const uint16_t *)task->in + begin, (uint8_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_INT16:    hf_to_int16_sat_n((const uint16_t *)task->in + begin, (int16_t *)task->out + begin, n); break;
+        case CONV_PAR_TO_INT32:    hf_to_int32_sat_n((const uint16_t *)task->in + begin, (int32_t *)task->out + begin, n); break;
+        default: break;
+    }
+}
+#endif
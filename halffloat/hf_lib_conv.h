@@ -0,0 +1,74 @@
+/**
+ * @file hf_lib_conv.h
+ * @brief Module de conversion Half-Float <-> float, double et entiers
+ *
+ * Module contenant les conversions de tableaux entre float32 et demi-flottants,
+ * avec sélection à l'exécution de l'implémentation la plus rapide disponible
+ * (SSE2, AVX2, F16C, NEON ou code scalaire portable). Toutes les implémentations
+ * sont identiques bit à bit à float_to_half() et half_to_float(), et
+ * hf_from_float_n arrondit dans le mode du thread.
+ *
+ * Les conversions depuis double et depuis les entiers sont directes (un seul
+ * arrondi, sans passer par float) et suivent le mode d'arrondi du thread, ou
+ * le mode passé aux variantes _r. En cas de dépassement, le résultat est
+ * l'infini ou le plus grand fini (65504) selon le mode, comme en IEEE 754.
+ * Les conversions vers les entiers saturent: ±Inf donne la borne du type et
+ * NaN donne 0, sauf hf_to_int32 qui reproduit le cast C (troncature) et
+ * renvoie INT_MIN pour NaN et ±Inf comme les instructions cvt x86.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_CONV_H
+#define HF_LIB_CONV_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+//Niveaux d'implémentation des conversions par lots
+typedef enum {
+    HF_SIMD_AUTO = 0,       //Meilleure implémentation disponible (par défaut)
+    HF_SIMD_SCALAR = 1,     //Code scalaire portable sans branchement
+    HF_SIMD_SSE2 = 2,       //SSE2 (4 voies)
+    HF_SIMD_AVX2 = 3,       //AVX2 (8 voies)
+    HF_SIMD_F16C = 4,       //Instructions matérielles F16C (vcvtph2ps)
+    HF_SIMD_NEON = 5        //Instructions matérielles NEON (fcvt)
+} hf_simd_level;
+
+//Conversions par lots
+HF_API void hf_from_float_n(const float *in, uint16_t *out, size_t n);
+HF_API void hf_to_float_n(const uint16_t *in, float *out, size_t n);
+
+//Conversions double <-> demi-flottant (NaN: charge conservée, rendue silencieuse)
+HF_API uint16_t hf_from_double(double d);
+HF_API uint16_t hf_from_double_r(double d, hf_rounding_mode mode);
+HF_API double hf_to_double(uint16_t hf);                                //exacte
+HF_API void hf_from_double_n(const double *in, uint16_t *out, size_t n);
+HF_API void hf_to_double_n(const uint16_t *in, double *out, size_t n);
+
+//Conversions entier -> demi-flottant
+HF_API uint16_t hf_from_int32(int32_t v);
+HF_API uint16_t hf_from_int32_r(int32_t v, hf_rounding_mode mode);
+HF_API void hf_from_int8_n(const int8_t *in, uint16_t *out, size_t n);    //exacte
+HF_API void hf_from_uint8_n(const uint8_t *in, uint16_t *out, size_t n);  //exacte
+HF_API void hf_from_int16_n(const int16_t *in, uint16_t *out, size_t n);
+HF_API void hf_from_int32_n(const int32_t *in, uint16_t *out, size_t n);
+
+//Conversions demi-flottant -> entier
+HF_API int32_t hf_to_int32(uint16_t hf);                                //troncature, NaN/Inf -> INT_MIN
+HF_API int32_t hf_to_int32_sat(uint16_t hf);                            //troncature saturée, NaN -> 0
+HF_API int32_t hf_to_int32_r(uint16_t hf, hf_rounding_mode mode);       //arrondi selon mode, saturé, NaN -> 0
+HF_API void hf_to_int8_sat_n(const uint16_t *in, int8_t *out, size_t n);    //mode du thread, saturé
+HF_API void hf_to_uint8_sat_n(const uint16_t *in, uint8_t *out, size_t n);
+HF_API void hf_to_int16_sat_n(const uint16_t *in, int16_t *out, size_t n);
+HF_API void hf_to_int32_sat_n(const uint16_t *in, int32_t *out, size_t n);
+
+//Sélection de l'implémentation
+HF_API int hf_simd_supported(hf_simd_level level);
+HF_API int hf_simd_select(hf_simd_level level);
+HF_API hf_simd_level hf_simd_selected(void);
+HF_API const char *hf_simd_name(hf_simd_level level);
+
+#endif //HF_LIB_CONV_H
@@ -14,6 +14,22 @@
 #include "hf_lib_common.h"
 #include "hf_lib_arith.h"
 
+//Nature d'un exposant de hf_pow (voir exponent_rational)
+#define POW_GENERAL         0                                   //Exposant quelconque: chemin ln/exp
+#define POW_INTEGER         1                                   //Exposant entier
+#define POW_HALF_INTEGER    2                                   //Exposant demi-entier (k + 1/2)
+
+//Nombres larges des puissances: mant * 2^(exp - 63), bit 63 de mant à 1
+#define WIDE_ONE            (1ULL << 63)                        //Mantisse large de 1.0
+#define WIDE_EXP_CLAMP      64                                  //Exposant au-delà duquel le résultat dépasse ou s'annule
+
+//Déclaration des helpers statiques
+static int exponent_rational(uint16_t hfexp, int32_t *twice);
+static uint16_t pow_wide(uint16_t hf, uint32_t k, int inverse, int root, unsigned int *flags, hf_rounding_mode mode);
+static uint64_t wide_mul(uint64_t a, uint64_t b, int64_t *exp, unsigned int *sticky);
+static uint64_t wide_inv(uint64_t mant, int64_t *exp, unsigned int *sticky);
+static uint64_t wide_sqrt(uint64_t mant, int64_t *exp, unsigned int *sticky);
+
 /**
  * @brief Calcule le logarithme naturel d'un demi-flottant
  * 
@@ -28,6 +44,8 @@ uint16_t hf_ln(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_LN, hf);
+
     //Initialisation par défaut - évite le branchement else
     result.sign = HF_ZERO_POS;
     result.exp = HF_EXP_FULL;  //Utilisé par les cas spéciaux (inf, NaN)
@@ -46,13 +64,14 @@ uint16_t hf_ln(uint16_t hf) {
         result = input;
     } else {
         //Calcul normal: ln(x) = exp*ln(2) + ln_table[mantisse]
-        int idx;
+        uint32_t idx;
         
         //Normaliser les nombres dénormalisés pour avoir le bit implicite et un exposant valide
         normalize_denormalized_mantissa(&input);
 
-        idx = (input.mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT;
-        result.mant = input.exp * LNI_2 + ln_table[idx];
+        //Mantisse fractionnaire Q15 (ln_table interpolée ou polynôme selon le moteur)
+        idx = (uint32_t)input.mant & (HF_MANT_NORM_MIN - 1);
+        result.mant = input.exp * LNI_2 + ln_mant_q15(idx);
         result.exp = 0;
         
         //Gestion du signe du résultat (réassignation conditionnelle)
@@ -85,6 +104,8 @@ uint16_t hf_exp(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_EXP, hf);
+
     //Initialisation par défaut
     result.sign = HF_ZERO_POS; //L'exponentielle est toujours positive (sauf NaN)
     result.exp = 0;
@@ -128,7 +149,9 @@ uint16_t hf_exp(uint16_t hf) {
  * @brief Calcule la puissance d'un demi-flottant
  * 
  * Cette fonction calcule hfbase^hfexp où hfbase et hfexp sont des demi-flottants (half-float).
- * Elle utilise la formule hfbase^hfexp = e^(hfexp * ln(hfbase)) pour effectuer le calcul.
+ * Les exposants entiers et demi-entiers (x^2, x^3, x^0.5, x^-1.5...) sont calculés
+ * comme hf_powi(), suivi d'une racine carrée large pour les demi-entiers, avec
+ * un seul arrondi final. Les autres utilisent hfbase^hfexp = e^(hfexp * ln(hfbase)).
  *
  * Conforme IEEE 754 et std::pow pour les cas spéciaux :
  *  - x^0 = 1 (même si x = NaN), 1^y = 1, (-1)^+/-inf = 1
@@ -147,6 +170,8 @@ uint16_t hf_pow(uint16_t hfbase, uint16_t hfexp) {
     half_float inputbase = decompose_half(hfbase);
     half_float inputexp  = decompose_half(hfexp);
 
+    HF_PROFILE_FN2(HF_PROF_POW, hfbase, hfexp);
+
     //Initialisation par défaut : 1.0
     result.sign = HF_ZERO_POS;
     result.exp  = 0;
@@ -156,6 +181,7 @@ uint16_t hf_pow(uint16_t hfbase, uint16_t hfexp) {
     if(!is_zero(&inputexp)) {
         uint16_t abs_base_bits = (uint16_t)(hfbase & ~HF_MASK_SIGN);
         int exp_int_part  = check_int_half(&inputexp);
+        int32_t twice;
 
         //|base| == 1 : tous les cas spéciaux (+/-1, +/-inf, NaN)
         if(abs_base_bits == HF_ONE_POS) {
@@ -218,10 +244,19 @@ uint16_t hf_pow(uint16_t hfbase, uint16_t hfexp) {
                 result.exp  = HF_EXP_FULL;
                 result.mant = 1;
             }
+            //Exposant entier ou demi-entier: puissance exacte en précision large, un seul arrondi
+            else if(exponent_rational(hfexp, &twice) != POW_GENERAL) {
+                unsigned int flags = 0;
+                uint32_t k = (uint32_t)(twice < 0 ? -twice : twice);
+                int root = (k & 1U) != 0;
+
+                result = decompose_half(pow_wide(hfbase, root ? k : k >> 1, twice < 0, root, &flags, hf_get_rounding_mode()));
+                HF_FE_RAISE(flags);
+            }
             else {
                 //Calcul général via ln/exp sur |base|, puis ajuste le signe si base < 0 et exposant entier impair
                 int32_t ln_base_fixed, exp_fixed_val, exp_ln_fixed;
-                int idx_ln, frac;
+                uint32_t idx_ln;
 
                 result.sign = HF_ZERO_POS;
                 if(inputbase.sign && exp_int_part >= 0) result.sign = (exp_int_part & 1) ? HF_ZERO_NEG : HF_ZERO_POS;
@@ -230,12 +265,8 @@ uint16_t hf_pow(uint16_t hfbase, uint16_t hfexp) {
                 normalize_denormalized_mantissa(&inputbase);
 
                 //CALCUL DIRECT ln(base)
-                idx_ln = (inputbase.mant >> HF_PRECISION_SHIFT) & HF_MASK_MANT;
-                ln_base_fixed = inputbase.exp * LNI_2 + ln_table[idx_ln];
-                if(idx_ln < LN_TABLE_SIZE - 1) {
-                    frac = inputbase.mant & HF_ROUND_BIT_MASK;
-                    ln_base_fixed += ((ln_table[idx_ln + 1] - ln_table[idx_ln]) * frac) >> HF_PRECISION_SHIFT;
-                }
+                idx_ln = (uint32_t)inputbase.mant & (HF_MANT_NORM_MIN - 1);
+                ln_base_fixed = inputbase.exp * LNI_2 + ln_mant_q15(idx_ln);
 
                 //CALCUL exp * ln(|base|)
                 exp_fixed_val = (inputexp.exp >= 0) ? (inputexp.mant << inputexp.exp) : (inputexp.mant >> -inputexp.exp);
@@ -255,6 +286,93 @@ uint16_t hf_pow(uint16_t hfbase, uint16_t hfexp) {
     return compose_half(&result);
 }
 
+/**
+ * @brief Calcule la puissance entière d'un demi-flottant
+ *
+ * Exponentiation par carrés successifs sur une mantisse large de 64 bits
+ * (tronquée avec bit collant après chaque produit), puis un seul arrondi
+ * selon le mode du thread. Exacte avant arrondi tant que |n| <= 5, donc
+ * correctement arrondie pour x^2, x^3, x^-2...; pour |n| plus grand l'erreur
+ * large reste de l'ordre de 2^-58 en relatif. Les exposants négatifs passent
+ * par une division large 128/64 bits de la puissance positive.
+ *
+ * Cas particuliers (comme pown):
+ *  - x^0 = 1 pour tout x, NaN compris
+ *  - (+/-0)^n: +/-0 si n > 0, +/-Inf si n < 0 (division par zéro), signe
+ *    négatif seulement pour -0 et n impair; de même (+/-Inf)^n
+ *  - NaN^n = NaN (invalide si signalant)
+ *
+ * @param hf La base
+ * @param n L'exposant entier
+ * @return hf^n
+ */
+uint16_t hf_powi(uint16_t hf, int n) {
+    uint16_t abs_bits = hf & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t sign = (n & 1) ? (hf & HF_MASK_SIGN) : 0;
+    uint32_t k = n < 0 ? 0U - (uint32_t)n : (uint32_t)n;
+    unsigned int flags = 0;
+    uint16_t result = HF_ONE_POS;
+
+    HF_PROFILE_FN(HF_PROF_POWI, hf);
+
+    if(n == 0) {
+        //x^0 = 1, déjà initialisé
+    } else if(abs_bits > HF_INFINITY_POS) {
+        result = HF_NAN;
+        if(!(hf & HF_NAN & HF_MASK_MANT)) flags = HF_FE_INVALID;
+    } else if(abs_bits == 0) {
+        result = (uint16_t)(sign | (n < 0 ? HF_INFINITY_POS : 0));
+        if(n < 0) flags = HF_FE_DIVBYZERO;
+    } else if(abs_bits == HF_INFINITY_POS) {
+        result = (uint16_t)(sign | (n < 0 ? 0 : HF_INFINITY_POS));
+    } else {
+        result = pow_wide(hf, k, n < 0, 0, &flags, hf_get_rounding_mode());
+    }
+
+    HF_FE_RAISE(flags);
+    return result;
+}
+
+/**
+ * @brief Élève un tableau de demi-flottants à une même puissance
+ *
+ * Calcule out[i] = hf_pow(a[i], hfexp), identique bit à bit. La nature de
+ * l'exposant est testée une seule fois: entier ou demi-entier, chaque base
+ * finie non nulle et différente de +/-1 passe directement par la puissance
+ * large, sans table de logarithme ni exp_fixed; les autres bases et les
+ * exposants quelconques passent par hf_pow().
+ *
+ * @param a Tableau des bases
+ * @param hfexp Exposant commun
+ * @param out Tableau résultat (peut être confondu avec a)
+ * @param n Nombre d'éléments
+ */
+void hf_pow_n(const uint16_t *a, uint16_t hfexp, uint16_t *out, size_t n) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    int32_t twice = 0;
+    int kind = exponent_rational(hfexp, &twice);
+    uint32_t k = (uint32_t)(twice < 0 ? -twice : twice);
+    int root = (k & 1U) != 0;
+    size_t i;
+
+    if(root == 0) k >>= 1;
+
+    HF_PROFILE_CALLS(HF_PROF_MATH_N, n);
+    for(i = 0; i < n; i++) {
+        uint16_t x = a[i];
+        uint16_t abs_bits = x & ~HF_MASK_SIGN & 0xFFFFU;
+
+        //Base finie non nulle, |x| != 1, positive pour un demi-entier
+        if(kind != POW_GENERAL && (uint16_t)(abs_bits - 1U) < HF_INFINITY_POS - 1U && abs_bits != HF_ONE_POS && !(root && (x & HF_MASK_SIGN))) {
+            out[i] = pow_wide(x, k, twice < 0, root, &flags, mode);
+        } else {
+            out[i] = hf_pow(x, hfexp);
+        }
+    }
+    HF_FE_RAISE(flags);
+}
+
 /**
  * @brief Calcule le logarithme en base 2 d'un demi-flottant
  *
@@ -265,6 +383,8 @@ uint16_t hf_log2(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_LOG2, hf);
+
     //Initialisation par defaut //évite branchement else
     result.sign = HF_ZERO_POS;
     result.exp  = HF_EXP_FULL; //utilisé pour inf/NaN par defaut
@@ -312,6 +432,8 @@ uint16_t hf_log10(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_LOG10, hf);
+
     //Initialisation par defaut //évite branchement else
     result.sign = HF_ZERO_POS;
     result.exp  = HF_EXP_FULL; //utilisé pour inf/NaN par defaut
@@ -359,6 +481,8 @@ uint16_t hf_exp2(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_EXP2, hf);
+
     //Initialisation par defaut
     result.sign = HF_ZERO_POS;
     result.exp = 0;
@@ -399,6 +523,8 @@ uint16_t hf_exp10(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_EXP10, hf);
+
     //Initialisation par defaut
     result.sign = HF_ZERO_POS;
     result.exp = 0;
@@ -435,6 +561,7 @@ uint16_t hf_exp10(uint16_t hf) {
  * @return e^a - 1
  */
 uint16_t hf_expm1(uint16_t a) {
+    HF_PROFILE_FN(HF_PROF_EXPM1, a);
     (void)a; return HF_NAN;
 }
 
@@ -445,5 +572,210 @@ uint16_t hf_expm1(uint16_t a) {
  * @return ln(1 + a)
  */
 uint16_t hf_log1p(uint16_t a) {
+    HF_PROFILE_FN(HF_PROF_LOG1P, a);
     (void)a; return HF_NAN;
 }
+
+/**
+ * @brief Reconnaît un exposant entier ou demi-entier
+ *
+ * @param hfexp L'exposant
+ * @param twice Reçoit 2 * hfexp (exact, |2 * hfexp| <= 131008) si reconnu
+ * @return POW_INTEGER, POW_HALF_INTEGER ou POW_GENERAL (NaN, infinis, autres)
+ */
+static int exponent_rational(uint16_t hfexp, int32_t *twice) {
+    uint32_t abs_bits = hfexp & ~HF_MASK_SIGN & 0xFFFFU;
+    int e = (int)(abs_bits >> HF_MANT_BITS);
+    uint32_t mant = (abs_bits & HF_MASK_MANT) | (e ? 1U << HF_MANT_BITS : 0U);
+    int result = POW_GENERAL;
+
+    //2 * |y| = mant * 2^(e - 24), e ramené à 1 pour les subnormaux
+    e += !e;
+    if(abs_bits < HF_INFINITY_POS) {
+        uint32_t t = 0;
+        int valid = 1;
+
+        if(e >= 24) t = mant << (e - 24);
+        else if(mant & ((1U << (24 - e)) - 1U)) valid = 0;
+        else t = mant >> (24 - e);
+
+        if(valid) {
+            *twice = (hfexp & HF_MASK_SIGN) ? -(int32_t)t : (int32_t)t;
+            result = (t & 1U) ? POW_HALF_INTEGER : POW_INTEGER;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Puissance rationnelle |hf|^(k / (1 + root)) en précision large, arrondie une fois
+ *
+ * Exponentiation par carrés sur des mantisses de 64 bits, puis inverse
+ * (exposant négatif) et racine carrée (exposant demi-entier), chacune
+ * tronquée avec bit collant: la valeur large minore la valeur exacte de
+ * quelques unités de 2^-63 au plus, et le bit collant dit si elle est exacte.
+ *
+ * @param hf Base finie non nulle
+ * @param k Numérateur de l'exposant (valeur absolue)
+ * @param inverse Vrai pour un exposant négatif
+ * @param root Vrai pour un exposant demi-entier (k impair, base positive)
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param mode Mode d'arrondi
+ * @return Le demi-flottant arrondi (négatif si hf < 0 et k impair, sans racine)
+ */
+static uint16_t pow_wide(uint16_t hf, uint32_t k, int inverse, int root, unsigned int *flags, hf_rounding_mode mode) {
+    uint32_t abs_bits = hf & ~HF_MASK_SIGN & 0xFFFFU;
+    int e = (int)(abs_bits >> HF_MANT_BITS);
+    uint64_t base = (uint64_t)((abs_bits & HF_MASK_MANT) | (e ? 1U << HF_MANT_BITS : 0U));
+    uint64_t mant = WIDE_ONE;
+    int64_t base_exp, exp = 0;
+    unsigned int sticky = 0;
+    int odd = (int)(k & 1U);
+    half_float result;
+
+    //Base normalisée: bit implicite au bit 63, exposant non biaisé
+    base_exp = (int64_t)(e + !e) - HF_EXP_BIAS - (hf_clz64(base) - (63 - HF_MANT_BITS));
+    base <<= hf_clz64(base);
+
+    //Carrés successifs: la base n'est élevée au carré que si un bit de k reste à traiter.
+    //|x| != 1: chaque facteur éloigne le résultat de 1 autant que la base, dont
+    //l'exposant hors de [-64, 64] garantit donc un dépassement ou un résultat nul
+    while(k != 0) {
+        if(k & 1U) {
+            exp += base_exp;
+            mant = wide_mul(mant, base, &exp, &sticky);
+        }
+        k >>= 1;
+        if(k != 0) {
+            base_exp *= 2;
+            base = wide_mul(base, base, &base_exp, &sticky);
+            if(base_exp > WIDE_EXP_CLAMP || base_exp < -WIDE_EXP_CLAMP) {
+                exp = base_exp > 0 ? 2 * WIDE_EXP_CLAMP : -2 * WIDE_EXP_CLAMP;
+                mant = WIDE_ONE;
+                sticky = 1;
+                k = 0;
+            }
+        }
+    }
+    if(inverse) mant = wide_inv(mant, &exp, &sticky);
+    if(root) mant = wide_sqrt(mant, &exp, &sticky);
+
+    //Arrondi unique: mantisse ramenée au format de half_float (bit 15) avec bit collant
+    result.sign = (!root && (hf & HF_MASK_SIGN) && odd) ? HF_ZERO_NEG : HF_ZERO_POS;
+    result.exp = (int)(exp > WIDE_EXP_CLAMP ? WIDE_EXP_CLAMP : exp < -WIDE_EXP_CLAMP ? -WIDE_EXP_CLAMP : exp);
+    result.mant = (int32_t)((mant >> 48) | ((mant & ((1ULL << 48) - 1ULL)) != 0) | (sticky != 0));
+    normalize_and_round_inline(&result, flags, mode);
+
+    return compose_half(&result);
+}
+
+/**
+ * @brief Produit de deux mantisses larges, tronqué à 64 bits
+ *
+ * Produit 64 x 64 -> 128 bits par quatre produits 32 x 32, renormalisé sur
+ * le bit 63 (exposant incrémenté si le produit atteint 2^127).
+ *
+ * @param a Première mantisse (bit 63 à 1)
+ * @param b Seconde mantisse (bit 63 à 1)
+ * @param exp Somme des exposants, ajustée
+ * @param sticky Mis à 1 si des bits non nuls sont tronqués
+ * @return Les 64 bits de poids fort du produit normalisé
+ */
+static uint64_t wide_mul(uint64_t a, uint64_t b, int64_t *exp, unsigned int *sticky) {
+    uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFULL;
+    uint64_t b1 = b >> 32, b0 = b & 0xFFFFFFFFULL;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+    uint64_t hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    uint64_t lo = (mid << 32) | (p00 & 0xFFFFFFFFULL);
+
+    if(hi >> 63) {
+        (*exp)++;
+    } else {
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+    }
+    *sticky |= lo != 0;
+
+    return hi;
+}
+
+/**
+ * @brief Inverse d'une mantisse large (division 2^127 / mant, un bit par itération)
+ *
+ * Si la mantisse d'entrée est déjà tronquée (sticky), le quotient est réduit
+ * d'une unité pour rester un minorant de l'inverse exact.
+ *
+ * @param mant Mantisse (bit 63 à 1)
+ * @param exp Exposant, remplacé par celui de l'inverse
+ * @param sticky Bit collant, mis à 1 si le reste est non nul
+ * @return La mantisse de l'inverse (bit 63 à 1)
+ */
+static uint64_t wide_inv(uint64_t mant, int64_t *exp, unsigned int *sticky) {
+    uint64_t q = WIDE_ONE;
+    uint64_t rem = WIDE_ONE;
+    int i;
+
+    if(mant == WIDE_ONE) {
+        //Puissance de deux: inverse exact, ou juste en dessous si l'entrée est tronquée
+        if(*sticky) q = ~0ULL;
+        *exp = *sticky ? -*exp - 1 : -*exp;
+    } else {
+        //1 / (mant * 2^(exp - 63)) = (2^127 / mant) * 2^((-exp - 1) - 63)
+        for(q = 0, i = 0; i < 64; i++) {
+            uint64_t carry = rem >> 63;
+
+            rem <<= 1;
+            q <<= 1;
+            if(carry || rem >= mant) {
+                rem -= mant;
+                q |= 1U;
+            }
+        }
+        if(*sticky && q > WIDE_ONE) q--;
+        *sticky |= rem != 0;
+        *exp = -*exp - 1;
+    }
+
+    return q;
+}
+
+/**
+ * @brief Racine carrée d'une mantisse large (32 bits de racine plus bit collant)
+ *
+ * @param mant Mantisse (bit 63 à 1)
+ * @param exp Exposant, remplacé par celui de la racine
+ * @param sticky Bit collant, mis à 1 si des bits sont perdus
+ * @return La mantisse de la racine (bit 63 à 1)
+ */
+static uint64_t wide_sqrt(uint64_t mant, int64_t *exp, unsigned int *sticky) {
+    int64_t e = *exp - 63;
+    uint64_t root = 0, rem = 0;
+    int i;
+
+    //Exposant pair: un bit de mantisse passe dans le bit collant si besoin
+    if(e & 1) {
+        *sticky |= (unsigned int)(mant & 1U);
+        mant >>= 1;
+        e++;
+    }
+
+    //Racine entière bit à bit: 2 bits du radicande par bit de racine
+    for(i = 0; i < 32; i++) {
+        uint64_t test;
+
+        rem = (rem << 2) | (mant >> 62);
+        mant <<= 2;
+        root <<= 1;
+        test = (root << 1) | 1U;
+        if(rem >= test) {
+            rem -= test;
+            root |= 1U;
+        }
+    }
+    *sticky |= rem != 0;
+    *exp = e / 2 + 31;
+
+    return root << 32;
+}
@@ -13,17 +13,22 @@
 #ifndef HF_LIB_EXP_H
 #define HF_LIB_EXP_H
 
+#include <stddef.h>
 #include "hf_common.h"
 
 //Fonctions exponentielles et logarithmiques
-uint16_t hf_ln(uint16_t a);           //Logarithme népérien
-uint16_t hf_log2(uint16_t a);         //Logarithme base 2
-uint16_t hf_log10(uint16_t a);        //Logarithme base 10
-uint16_t hf_exp(uint16_t a);          //Exponentielle
-uint16_t hf_exp2(uint16_t a);         //Exponentielle base 2
-uint16_t hf_exp10(uint16_t a);        //Exponentielle base 10
-uint16_t hf_pow(uint16_t a, uint16_t b); //Puissance a^b
-uint16_t hf_expm1(uint16_t a);        //exp(a) - 1
-uint16_t hf_log1p(uint16_t a);        //ln(1 + a)
+HF_API uint16_t hf_ln(uint16_t a);               //Logarithme népérien
+HF_API uint16_t hf_log2(uint16_t a);             //Logarithme base 2
+HF_API uint16_t hf_log10(uint16_t a);            //Logarithme base 10
+HF_API uint16_t hf_exp(uint16_t a);              //Exponentielle
+HF_API uint16_t hf_exp2(uint16_t a);             //Exponentielle base 2
+HF_API uint16_t hf_exp10(uint16_t a);            //Exponentielle base 10
+HF_API uint16_t hf_pow(uint16_t a, uint16_t b);  //Puissance a^b
+HF_API uint16_t hf_powi(uint16_t a, int n);      //Puissance entière a^n (un seul arrondi)
+HF_API uint16_t hf_expm1(uint16_t a);            //exp(a) - 1
+HF_API uint16_t hf_log1p(uint16_t a);            //ln(1 + a)
+
+//Version par lots à exposant commun (identique bit à bit à hf_pow)
+HF_API void hf_pow_n(const uint16_t *a, uint16_t b, uint16_t *out, size_t n);
 
 #endif //HF_LIB_EXP_H
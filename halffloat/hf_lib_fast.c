@@ -0,0 +1,470 @@
+/**
+ * @file hf_lib_fast.c
+ * @brief Implémentation des fonctions approchées rapides (hf_fast_*) pour Half-Float
+ *
+ * Une entrée finie m * 2^e (m entier de 11 bits) est convertie sans perte en
+ * virgule fixe, la fonction est évaluée en Q30 (polynômes minimax de Horner,
+ * produits 32x32 -> 64 bits) puis fast_pack() normalise par comptage des zéros
+ * de tête et arrondit une seule fois. Les exponentielles passent par 2^y:
+ * y = x * log2(e) en Q32, partie entière en exposant, 2^f sur [0, 1) par
+ * polynôme. Sinus et cosinus réduisent l'angle en quarts de tour avec 2/pi sur
+ * 52 bits (exact à 2^-36 près jusqu'à 65504) et réutilisent le polynôme du
+ * quart d'onde du moteur HF_ENGINE_POLY (hf_lib_common.h).
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include "hf_lib_fast.h"
+#include "hf_lib_common.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_trig.h"
+
+#define FAST_LOG2E_Q30      1549082005LL        //log2(e) en Q30
+#define FAST_LN2_Q30        744261118LL         //ln(2) en Q30
+#define FAST_2_PI_Q52       2867080569611330ULL //2/pi en Q52
+#define FAST_ONE_Q30        (1LL << 30)
+#define FAST_EXP_LIMIT      (24LL << 24)        //|x| saturé à 24 (Q24): e^24 déborde, e^-24 s'arrondit à 0
+
+//2^f sur [0, 1), Q30 (erreur relative < 4e-6)
+#define FAST_EXP2_C0        1073745574
+#define FAST_EXP2_C1        744074009
+#define FAST_EXP2_C2        259420703
+#define FAST_EXP2_C3        55560768
+#define FAST_EXP2_C4        14678383
+
+//ln(1 + u) / u sur [sqrt(2)/2 - 1, sqrt(2) - 1], Q30 (erreur relative < 1e-5)
+#define FAST_LN_C0          1073745841
+#define FAST_LN_C1          (-536757859)
+#define FAST_LN_C2          357190141
+#define FAST_LN_C3          (-273092116)
+#define FAST_LN_C4          235852197
+#define FAST_LN_C5          (-150530802)
+
+//Graine de 1/sqrt(x) sur les motifs fp16 et étape de Newton modifiée y * K1 * (K2 - x y^2), Q30:
+//constantes ajustées par recherche exhaustive (1.53 ULP au pire, 3.19 avec 0x59BB et y (3 - x y^2) / 2)
+#define FAST_RSQRT_MAGIC    0x5938
+#define FAST_RSQRT_K1       674309865LL
+#define FAST_RSQRT_K2       2768106422LL
+
+//Estimation linéaire de 1/M sur [1, 2): 24/17 - 8/17 M, Q30
+#define FAST_RCP_A          1515870810LL
+#define FAST_RCP_B          505290270LL
+
+//Déclaration des helpers statiques
+static uint16_t fast_pack(uint16_t sign, uint64_t n, int q);
+static uint32_t fast_decode(uint16_t abs, int *e);
+static uint32_t fast_decode_norm(uint16_t abs, int *e);
+static int64_t fast_exp_arg(uint16_t abs, int64_t scale);
+static uint32_t fast_exp2(int64_t y, int *k);
+static uint64_t fast_odd_small(uint32_t m, int e, uint32_t divisor);
+static uint16_t fast_sinus(uint16_t hfangle, uint32_t quadrant, int odd);
+
+/**
+ * @brief Calcule e^x en demi-précision (approché, au plus 1 ULP)
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return e^hf (NaN et infinis délégués à hf_exp)
+ */
+uint16_t hf_fast_exp(uint16_t hf) {
+    uint16_t abs = hf & 0x7FFFU;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_FAST, hf);
+
+    if(abs >= HF_INFINITY_POS) {
+        result = hf_exp(hf);
+    } else {
+        int64_t y = fast_exp_arg(abs, FAST_LOG2E_Q30);
+        uint32_t p;
+        int k;
+
+        p = fast_exp2((hf & HF_MASK_SIGN) ? -y : y, &k);
+        result = fast_pack(HF_ZERO_POS, p, 30 - k);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule ln(x) en demi-précision (approché, au plus 1 ULP)
+ *
+ * x = 2^e * (1 + u) avec 1 + u dans [sqrt(2)/2, sqrt(2)): ln(x) = e ln(2) + u P(u),
+ * sans cancellation au voisinage de 1.
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return ln(hf) (zéros, négatifs, infinis et NaN délégués à hf_ln)
+ */
+uint16_t hf_fast_ln(uint16_t hf) {
+    uint16_t abs = hf & 0x7FFFU;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_FAST, hf);
+
+    if(abs == 0 || abs >= HF_INFINITY_POS || (hf & HF_MASK_SIGN)) {
+        result = hf_ln(hf);
+    } else {
+        int e;
+        uint32_t m = fast_decode_norm(abs, &e);
+        int32_t u, p;
+        int64_t value;
+
+        //u en Q11 (exact), exposant de la mantisse [1, 2) repris dans e; passage en Q30
+        //par produit (|u| < 2^10, pas de dépassement) plutôt que décalage d'un négatif
+        e += 10;
+        if(m >= 1449U) {
+            u = (int32_t)m - 2048;
+            e++;
+        } else {
+            u = 2 * (int32_t)m - 2048;
+        }
+        u *= 1 << 19;
+
+        p = FAST_LN_C5;
+        p = FAST_LN_C4 + poly_mul_q30(p, u);
+        p = FAST_LN_C3 + poly_mul_q30(p, u);
+        p = FAST_LN_C2 + poly_mul_q30(p, u);
+        p = FAST_LN_C1 + poly_mul_q30(p, u);
+        p = FAST_LN_C0 + poly_mul_q30(p, u);
+
+        value = e * FAST_LN2_Q30 + (((int64_t)p * u) >> 30);
+        result = value < 0 ? fast_pack(HF_ZERO_NEG, (uint64_t)-value, 30) : fast_pack(HF_ZERO_POS, (uint64_t)value, 30);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule 1/sqrt(x) en demi-précision (approché, au plus 2 ULP)
+ *
+ * Graine y0 = FAST_RSQRT_MAGIC - (motif >> 1) sur le motif fp16 (même principe
+ * que 0x5F3759DF en binary32), puis une étape de Newton en virgule fixe dont
+ * les coefficients compensent l'erreur de la graine.
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return 1/sqrt(hf) (zéros, négatifs, infinis et NaN délégués à hf_rsqrt)
+ */
+uint16_t hf_fast_rsqrt(uint16_t hf) {
+    uint16_t abs = hf & 0x7FFFU;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_FAST, hf);
+
+    if(abs == 0 || abs >= HF_INFINITY_POS || (hf & HF_MASK_SIGN)) {
+        result = hf_rsqrt(hf);
+    } else {
+        int e, ey, shift;
+        uint32_t m = fast_decode_norm(abs, &e);
+        //Motif fp16 de x, exposant biaisé de 64 de plus pour rester positif sur les subnormaux
+        //(e >= -34): MAGIC - motif / 2 devient (MAGIC + 32 exposants) - motif biaisé / 2
+        uint32_t bits = ((uint32_t)(e + 25 + 64) << HF_MANT_BITS) + m - 1024U;
+        uint32_t ybits = FAST_RSQRT_MAGIC + (32U << HF_MANT_BITS) - (bits >> 1);
+        uint32_t my = (ybits & HF_MASK_MANT) | 0x400U;
+        uint64_t t;
+        int64_t g;
+
+        //x y0^2 en Q30 (proche de 1)
+        ey = (int)(ybits >> HF_MANT_BITS);
+        t = (uint64_t)m * my * my;
+        shift = e + 2 * ey - 20;
+        t = shift < 0 ? t >> -shift : t << shift;
+
+        g = ((FAST_RSQRT_K2 - (int64_t)t) * FAST_RSQRT_K1) >> 30;
+        result = fast_pack(HF_ZERO_POS, (uint64_t)my * (uint64_t)g, 55 - ey);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule tanh(x) en demi-précision (approché, au plus 1 ULP)
+ *
+ * tanh(x) = (1 - e^-2|x|) / (1 + e^-2|x|), x - x^3/3 pour |x| < 2^-4.
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return tanh(hf) (NaN et infinis délégués à hf_tanh)
+ */
+uint16_t hf_fast_tanh(uint16_t hf) {
+    uint16_t abs = hf & 0x7FFFU;
+    uint16_t sign = hf & HF_MASK_SIGN;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_FAST, hf);
+
+    if(abs >= HF_INFINITY_POS) {
+        result = hf_tanh(hf);
+    } else if(abs < 0x2C00U) {
+        int e;
+        uint32_t m = fast_decode(abs, &e);
+        result = fast_pack(sign, fast_odd_small(m, e, 3), 30 - e);
+    } else {
+        int64_t y = fast_exp_arg(abs, 2 * FAST_LOG2E_Q30);
+        uint64_t d;
+        uint32_t p;
+        int k;
+
+        //e^-2|x| = p 2^k en Q30 (k <= -1)
+        p = fast_exp2(-y, &k);
+        d = (uint64_t)p >> (-k > 63 ? 63 : -k);
+        result = fast_pack(sign, (((uint64_t)FAST_ONE_Q30 - d) << 30) / ((uint64_t)FAST_ONE_Q30 + d), 30);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule la sigmoïde 1 / (1 + e^-x) en demi-précision (approché, au plus 1 ULP)
+ *
+ * Avec E = e^-|x|: 1 / (1 + E) pour x >= 0, E / (1 + E) pour x < 0, ce qui
+ * garde la précision relative des très petits résultats.
+ *
+ * @param hf Demi-flottant d'entrée
+ * @return sigmoid(hf): +1 pour +inf, +0 pour -inf, NaN propagé
+ */
+uint16_t hf_fast_sigmoid(uint16_t hf) {
+    uint16_t abs = hf & 0x7FFFU;
+    uint16_t result;
+
+    HF_PROFILE_FN(HF_PROF_FAST, hf);
+
+    if(abs > HF_INFINITY_POS) {
+        result = hf | (1U << (HF_MANT_BITS - 1));
+    } else if(abs == HF_INFINITY_POS) {
+        result = (hf & HF_MASK_SIGN) ? HF_ZERO_POS : HF_ONE_POS;
+    } else {
+        int64_t y = fast_exp_arg(abs, FAST_LOG2E_Q30);
+        uint64_t d;
+        uint32_t p;
+        int k;
+
+        //E = e^-|x| = p 2^k en Q30 (k <= 0)
+        p = fast_exp2(-y, &k);
+        d = (uint64_t)FAST_ONE_Q30 + ((uint64_t)p >> (-k > 63 ? 63 : -k));
+        if(hf & HF_MASK_SIGN) {
+            result = fast_pack(HF_ZERO_POS, ((uint64_t)p << 30) / d, 30 - k);
+        } else {
+            result = fast_pack(HF_ZERO_POS, (1ULL << 60) / d, 30);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calcule sin(x) en demi-précision (approché, au plus 1 ULP)
+ *
+ * @param hfangle Angle en radians
+ * @return sin(hfangle) (NaN et infinis délégués à hf_sin)
+ */
+uint16_t hf_fast_sin(uint16_t hfangle) {
+    HF_PROFILE_FN(HF_PROF_FAST, hfangle);
+    return fast_sinus(hfangle, 0, 1);
+}
+
+/**
+ * @brief Calcule cos(x) en demi-précision (approché, au plus 1 ULP)
+ *
+ * @param hfangle Angle en radians
+ * @return cos(hfangle) (NaN et infinis délégués à hf_cos)
+ */
+uint16_t hf_fast_cos(uint16_t hfangle) {
+    HF_PROFILE_FN(HF_PROF_FAST, hfangle);
+    return fast_sinus(hfangle, 1, 0);
+}
+
+/**
+ * @brief Calcule x / y en demi-précision par estimation de l'inverse (approché, au plus 1 ULP)
+ *
+ * 1/y est estimé par 24/17 - 8/17 M (M mantisse de y dans [1, 2), erreur
+ * relative 1/17) puis affiné par deux étapes de Newton r = r (2 - M r),
+ * erreur relative < 1.2e-5; le quotient x * r est arrondi une seule fois.
+ *
+ * @param hf1 Dividende
+ * @param hf2 Diviseur
+ * @return hf1 / hf2 (zéros, infinis et NaN délégués à hf_div)
+ */
+uint16_t hf_fast_div(uint16_t hf1, uint16_t hf2) {
+    uint16_t abs1 = hf1 & 0x7FFFU;
+    uint16_t abs2 = hf2 & 0x7FFFU;
+    uint16_t result;
+
+    HF_PROFILE_FN2(HF_PROF_FAST, hf1, hf2);
+
+    if(abs1 == 0 || abs2 == 0 || abs1 >= HF_INFINITY_POS || abs2 >= HF_INFINITY_POS) {
+        result = hf_div(hf1, hf2);
+    } else {
+        int ex, ey;
+        uint32_t mx = fast_decode(abs1, &ex);
+        int64_t my = (int64_t)fast_decode_norm(abs2, &ey) << 20;
+        int64_t r = FAST_RCP_A - ((FAST_RCP_B * my) >> 30);
+
+        r = (r * ((2LL << 30) - ((my * r) >> 30))) >> 30;
+        r = (r * ((2LL << 30) - ((my * r) >> 30))) >> 30;
+        result = fast_pack((hf1 ^ hf2) & HF_MASK_SIGN, (uint64_t)mx * (uint64_t)r, 40 - ex + ey);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Arrondit n * 2^-q au demi-flottant le plus proche (égalités loin de zéro)
+ *
+ * n est ramené sur 31 bits significatifs par comptage des zéros de tête;
+ * les résultats sous-normaux sont arrondis au quantum 2^-24, les dépassements
+ * donnent l'infini.
+ *
+ * @param sign Signe du résultat (0 ou HF_MASK_SIGN)
+ * @param n Valeur entière positive (0 donne un zéro signé)
+ * @param q Nombre de bits fractionnaires de n
+ * @return Motif demi-flottant
+ */
+static uint16_t fast_pack(uint16_t sign, uint64_t n, int q) {
+    uint32_t bits = 0;
+
+    if(n != 0) {
+        int top = 63 - hf_clz64(n);
+        uint64_t m = top >= 30 ? n >> (top - 30) : n << (30 - top);
+        int biased = top - q + HF_EXP_BIAS;
+        int shift = 20 + (biased < 1 ? 1 - biased : 0);
+
+        if(biased > 31) biased = 31;
+        if(shift > 32) shift = 32;
+        bits = (uint32_t)(biased > 1 ? (biased - 1) << HF_MANT_BITS : 0) + (uint32_t)((m + (1ULL << (shift - 1))) >> shift);
+        if(bits > HF_INFINITY_POS) bits = HF_INFINITY_POS;
+    }
+
+    return (uint16_t)(bits | sign);
+}
+
+/**
+ * @brief Décompose la valeur absolue codée d'un fini en m * 2^e
+ *
+ * @param abs Motif sans signe (fini)
+ * @param e Reçoit l'exposant de m
+ * @return Mantisse entière m (bit implicite inclus, sans pour les sous-normaux)
+ */
+static HF_ALWAYS_INLINE uint32_t fast_decode(uint16_t abs, int *e) {
+    uint32_t biased = (uint32_t)abs >> HF_MANT_BITS;
+
+    *e = (int)(biased != 0 ? biased : 1) - HF_EXP_BIAS - HF_MANT_BITS;
+    return (abs & HF_MASK_MANT) | ((uint32_t)(biased != 0) << HF_MANT_BITS);
+}
+
+/**
+ * @brief Comme fast_decode, la mantisse des sous-normaux étant normalisée dans [1024, 2048)
+ *
+ * @param abs Motif sans signe (fini, non nul)
+ * @param e Reçoit l'exposant de m
+ * @return Mantisse entière m normalisée
+ */
+static HF_ALWAYS_INLINE uint32_t fast_decode_norm(uint16_t abs, int *e) {
+    uint32_t m = fast_decode(abs, e);
+
+    if(m < 0x400U) {
+        int shift = hf_clz32(m) - 21;
+        m <<= shift;
+        *e -= shift;
+    }
+
+    return m;
+}
+
+/**
+ * @brief Calcule |x| * scale en Q32 (scale en Q30), |x| saturé à 24
+ *
+ * @param abs Motif sans signe (fini)
+ * @param scale Facteur en Q30 (log2(e) ou 2 log2(e))
+ * @return |x| * scale en Q32
+ */
+static HF_ALWAYS_INLINE int64_t fast_exp_arg(uint16_t abs, int64_t scale) {
+    int e;
+    uint32_t m = fast_decode(abs, &e);
+    int64_t x = (int64_t)m << (e + 24);
+
+    if(x > FAST_EXP_LIMIT) x = FAST_EXP_LIMIT;
+    return (x * scale) >> 22;
+}
+
+/**
+ * @brief Calcule 2^y pour y en Q32
+ *
+ * @param y Exposant en Q32
+ * @param k Reçoit la partie entière floor(y)
+ * @return 2^(y - k) en Q30 dans [2^30, 2^31)
+ */
+static HF_ALWAYS_INLINE uint32_t fast_exp2(int64_t y, int *k) {
+    int32_t f = (int32_t)((uint32_t)y >> 2);
+    int32_t p = FAST_EXP2_C4;
+
+    *k = (int)(y >> 32);
+    p = FAST_EXP2_C3 + poly_mul_q30(p, f);
+    p = FAST_EXP2_C2 + poly_mul_q30(p, f);
+    p = FAST_EXP2_C1 + poly_mul_q30(p, f);
+
+    return (uint32_t)((int64_t)FAST_EXP2_C0 + (((int64_t)p * f) >> 30));
+}
+
+/**
+ * @brief Calcule x (1 - x^2 / divisor) pour x = m * 2^e petit (|x| < 2^-4)
+ *
+ * @param m Mantisse entière de x
+ * @param e Exposant de m (<= -15)
+ * @param divisor 3 (tanh) ou 6 (sin)
+ * @return Résultat m (1 - x^2 / divisor) en Q30 par rapport à m (valeur n * 2^(e-30))
+ */
+static HF_ALWAYS_INLINE uint64_t fast_odd_small(uint32_t m, int e, uint32_t divisor) {
+    int shift = -(2 * e + 30);
+    uint64_t square = (uint64_t)m * m;
+
+    square = shift > 63 ? 0 : square >> shift;
+    return (uint64_t)m * (uint64_t)(FAST_ONE_Q30 - (int64_t)(square / divisor));
+}
+
+/**
+ * @brief Sinus d'un angle décalé d'un nombre de quarts de tour
+ *
+ * |x| * 2/pi en quarts de tour Q32: les deux bits entiers de poids faible
+ * (plus le décalage) donnent le quadrant, la fraction t l'angle pi/2 t dans
+ * le quadrant (1 - t pour les quadrants impairs).
+ *
+ * @param hfangle Angle en radians
+ * @param quadrant Décalage en quarts de tour (0 pour sin, 1 pour cos)
+ * @param odd 1 si la fonction est impaire (signe de l'angle reporté)
+ * @return sin(hfangle + quadrant * pi/2)
+ */
+static uint16_t fast_sinus(uint16_t hfangle, uint32_t quadrant, int odd) {
+    uint16_t abs = hfangle & 0x7FFFU;
+    uint16_t sign = odd ? (hfangle & HF_MASK_SIGN) : HF_ZERO_POS;
+    uint16_t result;
+
+    if(abs >= HF_INFINITY_POS) {
+        result = odd ? hf_sin(hfangle) : hf_cos(hfangle);
+    } else if(odd && abs < 0x2C00U) {
+        int e;
+        uint32_t m = fast_decode(abs, &e);
+        result = fast_pack(sign, fast_odd_small(m, e, 6), 30 - e);
+    } else {
+        int e;
+        uint32_t m = fast_decode(abs, &e);
+        uint64_t phase = ((uint64_t)m * FAST_2_PI_Q52) >> (20 - e);
+        int32_t t = (int32_t)((uint32_t)phase >> 2);
+        int32_t u, p;
+
+        quadrant += (uint32_t)(phase >> 32);
+        if(quadrant & 1U) t = (int32_t)FAST_ONE_Q30 - t;
+        if(quadrant & 2U) sign ^= HF_MASK_SIGN;
+
+        //sin(pi/2 t) = t P(t^2), Q60
+        u = poly_mul_q30(t, t);
+        p = HF_POLY_SIN_C4;
+        p = HF_POLY_SIN_C3 + poly_mul_q30(p, u);
+        p = HF_POLY_SIN_C2 + poly_mul_q30(p, u);
+        p = HF_POLY_SIN_C1 + poly_mul_q30(p, u);
+        p = HF_POLY_SIN_C0 + poly_mul_q30(p, u);
+        result = fast_pack(sign, (uint64_t)((int64_t)p * t), 60);
+    }
+
+    return result;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file hf_lib_fast.h
+ * @brief Fonctions approchées rapides (hf_fast_*) pour Half-Float
+ *
+ * Variantes des fonctions de hf_lib_exp.h, hf_lib_trig.h et hf_lib_arith.h
+ * destinées aux calculs tolérant quelques ULP d'erreur (fonctions d'activation,
+ * normalisations): le calcul est fait en virgule fixe 32/64 bits par
+ * polynômes courts et estimations de Newton, suivi d'un seul arrondi au plus
+ * proche (égalités loin de zéro), sans mode d'arrondi du thread, sans
+ * indicateurs d'exception et sans normalize_and_round.
+ *
+ * Les entrées spéciales (NaN, infinis, zéros selon la fonction) sont
+ * déléguées à la fonction IEEE correspondante: les résultats spéciaux sont
+ * donc identiques. Les sous-normaux sont traités sur le chemin rapide.
+ *
+ * Erreur maximale mesurée par hf_verify sur les 65536 motifs (hf_fast_div:
+ * 65536 x 256 paires et 2^32 avec -x), par rapport au résultat exact arrondi:
+ *
+ *  - hf_fast_exp      1 ULP
+ *  - hf_fast_ln       1 ULP
+ *  - hf_fast_rsqrt    2 ULP  (graine par manipulation de bits, une étape de Newton)
+ *  - hf_fast_tanh     1 ULP
+ *  - hf_fast_sigmoid  1 ULP
+ *  - hf_fast_sin      0 ULP  (arrondi correct sur les 65536 motifs)
+ *  - hf_fast_cos      1 ULP
+ *  - hf_fast_div      1 ULP  (estimation linéaire de 1/y, deux étapes de Newton)
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_FAST_H
+#define HF_LIB_FAST_H
+
+#include "hf_common.h"
+
+HF_API uint16_t hf_fast_exp(uint16_t hf);
+HF_API uint16_t hf_fast_ln(uint16_t hf);
+HF_API uint16_t hf_fast_rsqrt(uint16_t hf);
+HF_API uint16_t hf_fast_tanh(uint16_t hf);
+HF_API uint16_t hf_fast_sigmoid(uint16_t hf);                  //1 / (1 + e^-x)
+HF_API uint16_t hf_fast_sin(uint16_t hfangle);
+HF_API uint16_t hf_fast_cos(uint16_t hfangle);
+HF_API uint16_t hf_fast_div(uint16_t hf1, uint16_t hf2);
+
+#endif //HF_LIB_FAST_H
@@ -0,0 +1,1140 @@
+/**
+ * @file hf_lib_fmt.c
+ * @brief Implémentation des formats courts bfloat16 et FP8 (E4M3, E5M2)
+ *
+ * Les noyaux (*_fmt) sont écrits une seule fois pour un format quelconque et
+ * reçoivent le format et le mode d'arrondi en dernier paramètre: appelés avec
+ * des constantes (DISPATCH_ROUNDING_MODE), ils sont instanciés pour chaque
+ * couple format/mode. Ils reprennent la structure des noyaux fp16 de
+ * hf_lib_arith.c sur les fonctions génériques de hf_common.h.
+ *
+ * Les conversions élargissent d'abord le motif source en binary32 exact, puis
+ * arrondissent une seule fois vers le format cible sans branchement
+ * (float_bits_to_fmt_inline), ce qui permet la vectorisation des boucles.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include <string.h>
+#include "hf_lib_fmt.h"
+
+//Classification d'un nombre décomposé dans le format fmt
+#define FMT_IS_NAN(hf, fmt)  ((hf).exp == HF_FMT_EXP_FULL(fmt) && (hf).mant != 0)
+#define FMT_IS_INF(hf, fmt)  ((hf).exp == HF_FMT_EXP_FULL(fmt) && (hf).mant == 0)
+#define FMT_IS_ZERO(hf, fmt) ((hf).exp != HF_FMT_EXP_FULL(fmt) && (hf).mant == 0)
+
+//Vrai si le motif est un NaN signalant (bit de poids fort de la mantisse à 0, jamais pour E4M3)
+#define FMT_IS_SNAN_BITS(bits, fmt) (!HF_FMT_FINITE_ONLY(fmt) && \
+    ((bits) & (HF_FMT_MASK_SIGN(fmt) - 1U)) > HF_FMT_INFINITY(fmt) && !((bits) & (1U << (HF_FMT_MANT_BITS(fmt) - 1))))
+
+//Déclaration des helpers statiques
+static HF_ALWAYS_INLINE uint16_t convert_bits(uint32_t bits, unsigned int *flags, hf_format from, hf_format to, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE uint16_t convert_scalar(uint32_t bits, hf_format from, hf_format to);
+static HF_ALWAYS_INLINE uint16_t fmt_from_float_scalar(float f, hf_format to);
+static HF_ALWAYS_INLINE float fmt_to_float_scalar(uint32_t bits, hf_format from);
+static HF_ALWAYS_INLINE void convert_loop(const void *in, void *out, size_t n, unsigned int *flags, hf_format from, hf_format to, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE void from_float_loop(const float *in, void *out, size_t n, unsigned int *flags, hf_format to, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE void to_float_loop(const void *in, float *out, size_t n, hf_format from);
+static HF_ALWAYS_INLINE void convert_batch(const void *in, void *out, size_t n, hf_format from, hf_format to);
+static HF_ALWAYS_INLINE void from_float_batch(const float *in, void *out, size_t n, hf_format to);
+static HF_ALWAYS_INLINE uint16_t add_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE uint16_t mul_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE uint16_t div_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE uint16_t sqrt_fmt(uint16_t x, unsigned int *flags, hf_format fmt, hf_rounding_mode mode);
+static HF_ALWAYS_INLINE uint16_t fma_fmt(uint16_t a, uint16_t b, uint16_t c, unsigned int *flags, hf_format fmt, hf_rounding_mode mode);
+static uint32_t fmt_isqrt(uint32_t value);
+
+/**
+ * @brief Convertit un float en bfloat16
+ *
+ * @param f Le float à convertir
+ * @return Le motif bfloat16 arrondi dans le mode du thread
+ */
+uint16_t bf16_from_float(float f) {
+    return fmt_from_float_scalar(f, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un bfloat16 en float (exacte)
+ *
+ * @param b Motif bfloat16
+ * @return La valeur float
+ */
+float bf16_to_float(uint16_t b) {
+    return fmt_to_float_scalar(b, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un demi-flottant en bfloat16
+ *
+ * @param hf Demi-flottant
+ * @return Le motif bfloat16 (arrondi de 10 à 7 bits de mantisse)
+ */
+uint16_t bf16_from_half(uint16_t hf) {
+    return convert_scalar(hf, HF_FORMAT_FP16, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un bfloat16 en demi-flottant
+ *
+ * @param b Motif bfloat16
+ * @return Le demi-flottant (dépassement et subnormaux selon le mode du thread)
+ */
+uint16_t bf16_to_half(uint16_t b) {
+    return convert_scalar(b, HF_FORMAT_BF16, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Additionne deux bfloat16
+ *
+ * @param x Premier opérande
+ * @param y Second opérande
+ * @return x + y arrondi dans le mode du thread
+ */
+uint16_t bf16_add(uint16_t x, uint16_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, add_fmt, x, y, &flags, HF_FORMAT_BF16);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Soustrait deux bfloat16
+ *
+ * @param x Premier opérande
+ * @param y Second opérande (soustrait)
+ * @return x - y arrondi dans le mode du thread
+ */
+uint16_t bf16_sub(uint16_t x, uint16_t y) {
+    return bf16_add(x, y ^ HF_FMT_MASK_SIGN(HF_FORMAT_BF16));
+}
+
+/**
+ * @brief Multiplie deux bfloat16
+ *
+ * @param x Premier facteur
+ * @param y Second facteur
+ * @return x * y arrondi dans le mode du thread
+ */
+uint16_t bf16_mul(uint16_t x, uint16_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, mul_fmt, x, y, &flags, HF_FORMAT_BF16);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Divise deux bfloat16
+ *
+ * @param x Dividende
+ * @param y Diviseur
+ * @return x / y arrondi dans le mode du thread
+ */
+uint16_t bf16_div(uint16_t x, uint16_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, div_fmt, x, y, &flags, HF_FORMAT_BF16);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Racine carrée d'un bfloat16
+ *
+ * @param x Argument
+ * @return sqrt(x) arrondi dans le mode du thread
+ */
+uint16_t bf16_sqrt(uint16_t x) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, sqrt_fmt, x, &flags, HF_FORMAT_BF16);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Multiplication-addition fusionnée de bfloat16
+ *
+ * @param a Premier facteur
+ * @param b Second facteur
+ * @param c Valeur ajoutée
+ * @return a * b + c avec un seul arrondi dans le mode du thread
+ */
+uint16_t bf16_fma(uint16_t a, uint16_t b, uint16_t c) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, fma_fmt, a, b, c, &flags, HF_FORMAT_BF16);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Convertit un float en FP8 E4M3
+ *
+ * @param f Le float à convertir
+ * @return Le motif E4M3 arrondi dans le mode du thread (NaN au-delà de 448)
+ */
+uint8_t fp8_e4m3_from_float(float f) {
+    return (uint8_t)fmt_from_float_scalar(f, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un FP8 E4M3 en float (exacte)
+ *
+ * @param q Motif E4M3
+ * @return La valeur float
+ */
+float fp8_e4m3_to_float(uint8_t q) {
+    return fmt_to_float_scalar(q, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un demi-flottant en FP8 E4M3
+ *
+ * @param hf Demi-flottant
+ * @return Le motif E4M3 arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_from_half(uint16_t hf) {
+    return (uint8_t)convert_scalar(hf, HF_FORMAT_FP16, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un FP8 E4M3 en demi-flottant (exacte)
+ *
+ * @param q Motif E4M3
+ * @return Le demi-flottant
+ */
+uint16_t fp8_e4m3_to_half(uint8_t q) {
+    return convert_scalar(q, HF_FORMAT_E4M3, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Convertit un bfloat16 en FP8 E4M3
+ *
+ * @param b Motif bfloat16
+ * @return Le motif E4M3 arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_from_bf16(uint16_t b) {
+    return (uint8_t)convert_scalar(b, HF_FORMAT_BF16, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un FP8 E4M3 en bfloat16 (exacte)
+ *
+ * @param q Motif E4M3
+ * @return Le motif bfloat16
+ */
+uint16_t fp8_e4m3_to_bf16(uint8_t q) {
+    return convert_scalar(q, HF_FORMAT_E4M3, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Additionne deux FP8 E4M3
+ *
+ * @param x Premier opérande
+ * @param y Second opérande
+ * @return x + y arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_add(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, add_fmt, x, y, &flags, HF_FORMAT_E4M3);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Soustrait deux FP8 E4M3
+ *
+ * @param x Premier opérande
+ * @param y Second opérande (soustrait)
+ * @return x - y arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_sub(uint8_t x, uint8_t y) {
+    return fp8_e4m3_add(x, (uint8_t)(y ^ HF_FMT_MASK_SIGN(HF_FORMAT_E4M3)));
+}
+
+/**
+ * @brief Multiplie deux FP8 E4M3
+ *
+ * @param x Premier facteur
+ * @param y Second facteur
+ * @return x * y arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_mul(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, mul_fmt, x, y, &flags, HF_FORMAT_E4M3);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Divise deux FP8 E4M3
+ *
+ * @param x Dividende
+ * @param y Diviseur
+ * @return x / y arrondi dans le mode du thread (NaN pour un fini non nul / 0)
+ */
+uint8_t fp8_e4m3_div(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, div_fmt, x, y, &flags, HF_FORMAT_E4M3);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Racine carrée d'un FP8 E4M3
+ *
+ * @param x Argument
+ * @return sqrt(x) arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_sqrt(uint8_t x) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, sqrt_fmt, x, &flags, HF_FORMAT_E4M3);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Multiplication-addition fusionnée de FP8 E4M3
+ *
+ * @param a Premier facteur
+ * @param b Second facteur
+ * @param c Valeur ajoutée
+ * @return a * b + c avec un seul arrondi dans le mode du thread
+ */
+uint8_t fp8_e4m3_fma(uint8_t a, uint8_t b, uint8_t c) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, fma_fmt, a, b, c, &flags, HF_FORMAT_E4M3);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Convertit un float en FP8 E5M2
+ *
+ * @param f Le float à convertir
+ * @return Le motif E5M2 arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_from_float(float f) {
+    return (uint8_t)fmt_from_float_scalar(f, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un FP8 E5M2 en float (exacte)
+ *
+ * @param q Motif E5M2
+ * @return La valeur float
+ */
+float fp8_e5m2_to_float(uint8_t q) {
+    return fmt_to_float_scalar(q, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un demi-flottant en FP8 E5M2
+ *
+ * @param hf Demi-flottant
+ * @return Le motif E5M2 (octet de poids fort arrondi dans le mode du thread)
+ */
+uint8_t fp8_e5m2_from_half(uint16_t hf) {
+    return (uint8_t)convert_scalar(hf, HF_FORMAT_FP16, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un FP8 E5M2 en demi-flottant (exacte)
+ *
+ * @param q Motif E5M2
+ * @return Le demi-flottant
+ */
+uint16_t fp8_e5m2_to_half(uint8_t q) {
+    return convert_scalar(q, HF_FORMAT_E5M2, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Convertit un bfloat16 en FP8 E5M2
+ *
+ * @param b Motif bfloat16
+ * @return Le motif E5M2 arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_from_bf16(uint16_t b) {
+    return (uint8_t)convert_scalar(b, HF_FORMAT_BF16, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un FP8 E5M2 en bfloat16 (exacte)
+ *
+ * @param q Motif E5M2
+ * @return Le motif bfloat16
+ */
+uint16_t fp8_e5m2_to_bf16(uint8_t q) {
+    return convert_scalar(q, HF_FORMAT_E5M2, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Additionne deux FP8 E5M2
+ *
+ * @param x Premier opérande
+ * @param y Second opérande
+ * @return x + y arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_add(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, add_fmt, x, y, &flags, HF_FORMAT_E5M2);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Soustrait deux FP8 E5M2
+ *
+ * @param x Premier opérande
+ * @param y Second opérande (soustrait)
+ * @return x - y arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_sub(uint8_t x, uint8_t y) {
+    return fp8_e5m2_add(x, (uint8_t)(y ^ HF_FMT_MASK_SIGN(HF_FORMAT_E5M2)));
+}
+
+/**
+ * @brief Multiplie deux FP8 E5M2
+ *
+ * @param x Premier facteur
+ * @param y Second facteur
+ * @return x * y arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_mul(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, mul_fmt, x, y, &flags, HF_FORMAT_E5M2);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Divise deux FP8 E5M2
+ *
+ * @param x Dividende
+ * @param y Diviseur
+ * @return x / y arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_div(uint8_t x, uint8_t y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, div_fmt, x, y, &flags, HF_FORMAT_E5M2);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Racine carrée d'un FP8 E5M2
+ *
+ * @param x Argument
+ * @return sqrt(x) arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_sqrt(uint8_t x) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, sqrt_fmt, x, &flags, HF_FORMAT_E5M2);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Multiplication-addition fusionnée de FP8 E5M2
+ *
+ * @param a Premier facteur
+ * @param b Second facteur
+ * @param c Valeur ajoutée
+ * @return a * b + c avec un seul arrondi dans le mode du thread
+ */
+uint8_t fp8_e5m2_fma(uint8_t a, uint8_t b, uint8_t c) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, fma_fmt, a, b, c, &flags, HF_FORMAT_E5M2);
+    HF_FE_RAISE(flags);
+
+    return (uint8_t)result;
+}
+
+/**
+ * @brief Convertit un tableau de floats en bfloat16
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void bf16_from_float_n(const float *in, uint16_t *out, size_t n) {
+    from_float_batch(in, out, n, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un tableau de bfloat16 en floats (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void bf16_to_float_n(const uint16_t *in, float *out, size_t n) {
+    to_float_loop(in, out, n, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en bfloat16
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void bf16_from_half_n(const uint16_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_FP16, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un tableau de bfloat16 en demi-flottants
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void bf16_to_half_n(const uint16_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_BF16, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Convertit un tableau de floats en FP8 E4M3
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_from_float_n(const float *in, uint8_t *out, size_t n) {
+    from_float_batch(in, out, n, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E4M3 en floats (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_to_float_n(const uint8_t *in, float *out, size_t n) {
+    to_float_loop(in, out, n, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en FP8 E4M3
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_from_half_n(const uint16_t *in, uint8_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_FP16, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E4M3 en demi-flottants (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_to_half_n(const uint8_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_E4M3, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Convertit un tableau de bfloat16 en FP8 E4M3
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_from_bf16_n(const uint16_t *in, uint8_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_BF16, HF_FORMAT_E4M3);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E4M3 en bfloat16 (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e4m3_to_bf16_n(const uint8_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_E4M3, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un tableau de floats en FP8 E5M2
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_from_float_n(const float *in, uint8_t *out, size_t n) {
+    from_float_batch(in, out, n, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E5M2 en floats (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_to_float_n(const uint8_t *in, float *out, size_t n) {
+    to_float_loop(in, out, n, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un tableau de demi-flottants en FP8 E5M2
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_from_half_n(const uint16_t *in, uint8_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_FP16, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E5M2 en demi-flottants (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_to_half_n(const uint8_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_E5M2, HF_FORMAT_FP16);
+}
+
+/**
+ * @brief Convertit un tableau de bfloat16 en FP8 E5M2
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_from_bf16_n(const uint16_t *in, uint8_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_BF16, HF_FORMAT_E5M2);
+}
+
+/**
+ * @brief Convertit un tableau de FP8 E5M2 en bfloat16 (exacte)
+ *
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ */
+void fp8_e5m2_to_bf16_n(const uint8_t *in, uint16_t *out, size_t n) {
+    convert_batch(in, out, n, HF_FORMAT_E5M2, HF_FORMAT_BF16);
+}
+
+/**
+ * @brief Convertit un motif d'un format court vers un autre (un seul arrondi)
+ *
+ * @param bits Motif source
+ * @param flags Mot d'exceptions local cumulé (HF_FE_*)
+ * @param from Format source
+ * @param to Format cible
+ * @param mode Mode d'arrondi
+ * @return Motif dans le format cible
+ */
+static HF_ALWAYS_INLINE uint16_t convert_bits(uint32_t bits, unsigned int *flags, hf_format from, hf_format to, hf_rounding_mode mode) {
+    //Le passage par float rend le NaN silencieux: l'opération invalide est levée ici
+    HF_FE_ACCUM(flags, FMT_IS_SNAN_BITS(bits, from) ? HF_FE_INVALID : 0U);
+    return float_bits_to_fmt_inline(fmt_bits_to_float_bits_inline(bits, from), flags, to, mode);
+}
+
+/**
+ * @brief Conversion scalaire entre formats courts dans le mode du thread
+ */
+static HF_ALWAYS_INLINE uint16_t convert_scalar(uint32_t bits, hf_format from, hf_format to) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, convert_bits, bits, &flags, from, to);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Conversion scalaire float -> format court dans le mode du thread
+ */
+static HF_ALWAYS_INLINE uint16_t fmt_from_float_scalar(float f, hf_format to) {
+    union { float f; uint32_t u; } conv = {f};
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    DISPATCH_ROUNDING_MODE_RET(result, mode, float_bits_to_fmt_inline, conv.u, &flags, to);
+    HF_FE_RAISE(flags);
+
+    return result;
+}
+
+/**
+ * @brief Conversion scalaire exacte format court -> float
+ */
+static HF_ALWAYS_INLINE float fmt_to_float_scalar(uint32_t bits, hf_format from) {
+    union { float f; uint32_t u; } conv;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT, 1);
+    conv.u = fmt_bits_to_float_bits_inline(bits, from);
+    return conv.f;
+}
+
+/**
+ * @brief Boucle de conversion entre formats courts (format et mode constants)
+ *
+ * Les motifs FP8 sont lus et écrits sur un octet, les autres sur deux.
+ */
+static HF_ALWAYS_INLINE void convert_loop(const void *in, void *out, size_t n, unsigned int *flags, hf_format from, hf_format to, hf_rounding_mode mode) {
+    const uint8_t *in8 = (const uint8_t *)in;
+    const uint16_t *in16 = (const uint16_t *)in;
+    uint8_t *out8 = (uint8_t *)out;
+    uint16_t *out16 = (uint16_t *)out;
+    unsigned int acc = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint32_t bits = HF_FMT_BITS(from) == 8 ? in8[i] : in16[i];
+        uint16_t result = convert_bits(bits, &acc, from, to, mode);
+
+        if(HF_FMT_BITS(to) == 8) out8[i] = (uint8_t)result;
+        else out16[i] = result;
+    }
+    HF_FE_ACCUM(flags, acc);
+}
+
+/**
+ * @brief Boucle de conversion float -> format court (format et mode constants)
+ */
+static HF_ALWAYS_INLINE void from_float_loop(const float *in, void *out, size_t n, unsigned int *flags, hf_format to, hf_rounding_mode mode) {
+    uint8_t *out8 = (uint8_t *)out;
+    uint16_t *out16 = (uint16_t *)out;
+    unsigned int acc = 0;
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        uint32_t bits;
+        uint16_t result;
+
+        memcpy(&bits, &in[i], sizeof(bits));
+        result = float_bits_to_fmt_inline(bits, &acc, to, mode);
+
+        if(HF_FMT_BITS(to) == 8) out8[i] = (uint8_t)result;
+        else out16[i] = result;
+    }
+    HF_FE_ACCUM(flags, acc);
+}
+
+/**
+ * @brief Boucle de conversion exacte format court -> float
+ */
+static HF_ALWAYS_INLINE void to_float_loop(const void *in, float *out, size_t n, hf_format from) {
+    const uint8_t *in8 = (const uint8_t *)in;
+    const uint16_t *in16 = (const uint16_t *)in;
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT_N, n);
+    for(i = 0; i < n; i++) {
+        uint32_t bits = fmt_bits_to_float_bits_inline(HF_FMT_BITS(from) == 8 ? in8[i] : in16[i], from);
+
+        memcpy(&out[i], &bits, sizeof(bits));
+    }
+}
+
+/**
+ * @brief Conversion par lots entre formats courts dans le mode du thread
+ */
+static HF_ALWAYS_INLINE void convert_batch(const void *in, void *out, size_t n, hf_format from, hf_format to) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT_N, n);
+    DISPATCH_ROUNDING_MODE(mode, convert_loop, in, out, n, &flags, from, to);
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Conversion par lots float -> format court dans le mode du thread
+ */
+static HF_ALWAYS_INLINE void from_float_batch(const float *in, void *out, size_t n, hf_format to) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+    unsigned int flags = 0;
+
+    HF_PROFILE_CALLS(HF_PROF_FMT_N, n);
+    DISPATCH_ROUNDING_MODE(mode, from_float_loop, in, out, n, &flags, to);
+    HF_FE_RAISE(flags);
+}
+
+/**
+ * @brief Addition dans le format fmt (corps instancié par format et par mode)
+ *
+ * Même enchaînement que l'addition fp16: alignement avec bit collant, somme
+ * signée puis un seul arrondi. Une somme exactement nulle de signes opposés
+ * vaut -0 en arrondi vers -inf et +0 sinon (IEEE 754).
+ */
+static HF_ALWAYS_INLINE uint16_t add_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    half_float result;
+    half_float input1 = decompose_fmt(x, fmt);
+    half_float input2 = decompose_fmt(y, fmt);
+
+    result.sign = HF_ZERO_POS;
+    result.exp = HF_FMT_EXP_FULL(fmt);
+    result.mant = 1;
+
+    //Gestion unifiée des NaN - propager le premier NaN rencontré
+    if(FMT_IS_NAN(input1, fmt) || FMT_IS_NAN(input2, fmt)) {
+        result.sign = FMT_IS_NAN(input1, fmt) ? input1.sign : input2.sign;
+        if(FMT_IS_SNAN_BITS(x, fmt) || FMT_IS_SNAN_BITS(y, fmt)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if(FMT_IS_INF(input1, fmt) || FMT_IS_INF(input2, fmt)) {
+        if(FMT_IS_INF(input1, fmt) && FMT_IS_INF(input2, fmt) && input1.sign != input2.sign) {
+            //Infini positif + Infini négatif = NaN négatif
+            result.sign = HF_ZERO_NEG;
+            HF_FE_ACCUM(flags, HF_FE_INVALID);
+        } else {
+            result = FMT_IS_INF(input1, fmt) ? input1 : input2;
+        }
+    } else {
+        int32_t sum;
+
+        align_mantissas(&input1, &input2);
+        sum = (input1.sign ? -input1.mant : input1.mant);
+        sum += (input2.sign ? -input2.mant : input2.mant);
+
+        result.exp = input1.exp;
+        result.mant = sum < 0 ? -sum : sum;
+        if(sum < 0) result.sign = HF_ZERO_NEG;
+        else if(sum == 0 && (input1.sign & input2.sign || (input1.sign != input2.sign && mode == HF_ROUND_TOWARD_NEG_INF))) {
+            result.sign = HF_ZERO_NEG;
+        }
+
+        normalize_and_round_fmt(&result, flags, fmt, mode);
+    }
+
+    return compose_fmt(&result, fmt);
+}
+
+/**
+ * @brief Multiplication dans le format fmt (corps instancié par format et par mode)
+ */
+static HF_ALWAYS_INLINE uint16_t mul_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    half_float result;
+    half_float input1 = decompose_fmt(x, fmt);
+    half_float input2 = decompose_fmt(y, fmt);
+
+    result.sign = HF_ZERO_POS;
+    result.exp = HF_FMT_EXP_FULL(fmt);
+    result.mant = 1;
+
+    //Gestion unifiée des NaN - propager le premier NaN rencontré
+    if(FMT_IS_NAN(input1, fmt) || FMT_IS_NAN(input2, fmt)) {
+        result.sign = FMT_IS_NAN(input1, fmt) ? input1.sign : input2.sign;
+        if(FMT_IS_SNAN_BITS(x, fmt) || FMT_IS_SNAN_BITS(y, fmt)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if((FMT_IS_INF(input1, fmt) && FMT_IS_ZERO(input2, fmt)) ||
+              (FMT_IS_INF(input2, fmt) && FMT_IS_ZERO(input1, fmt))) {
+        //Inf * 0 = NaN négatif
+        result.sign = HF_ZERO_NEG;
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else {
+        result.sign = input1.sign ^ input2.sign;
+        result.mant = 0;
+
+        if(FMT_IS_ZERO(input1, fmt) || FMT_IS_ZERO(input2, fmt)) {
+            result.exp = HF_FMT_EXP_MIN(fmt);
+        } else if(!FMT_IS_INF(input1, fmt) && !FMT_IS_INF(input2, fmt)) {
+            uint32_t mult_result;
+
+            //Subnormaux normalisés, produit des mantisses puis bit collant
+            normalize_mantissa_inline(&input1);
+            normalize_mantissa_inline(&input2);
+            mult_result = (uint32_t)input1.mant * (uint32_t)input2.mant;
+
+            result.exp = input1.exp + input2.exp;
+            result.mant = (int32_t)(mult_result >> HF_MANT_SHIFT) | ((mult_result & (HF_MANT_NORM_MIN - 1)) != 0);
+
+            normalize_and_round_fmt(&result, flags, fmt, mode);
+        }
+        //Par défaut: Résultat = infini
+    }
+
+    return compose_fmt(&result, fmt);
+}
+
+/**
+ * @brief Division dans le format fmt (corps instancié par format et par mode)
+ */
+static HF_ALWAYS_INLINE uint16_t div_fmt(uint16_t x, uint16_t y, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    half_float result;
+    half_float input1 = decompose_fmt(x, fmt);
+    half_float input2 = decompose_fmt(y, fmt);
+
+    result.sign = input1.sign ^ input2.sign;
+    result.exp = HF_FMT_EXP_FULL(fmt);
+    result.mant = 1;
+
+    //Gestion unifiée des NaN - propager le premier NaN rencontré
+    if(FMT_IS_NAN(input1, fmt) || FMT_IS_NAN(input2, fmt)) {
+        result.sign = FMT_IS_NAN(input1, fmt) ? input1.sign : input2.sign;
+        if(FMT_IS_SNAN_BITS(x, fmt) || FMT_IS_SNAN_BITS(y, fmt)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if((FMT_IS_INF(input1, fmt) && FMT_IS_INF(input2, fmt)) || (FMT_IS_ZERO(input1, fmt) && FMT_IS_ZERO(input2, fmt))) {
+        //Inf / Inf et 0 / 0 = NaN négatif
+        result.sign = HF_ZERO_NEG;
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if(FMT_IS_INF(input1, fmt) || FMT_IS_ZERO(input2, fmt)) {
+        //Inf / fini = Inf, fini / 0 = Inf (NaN pour E4M3)
+        if(FMT_IS_ZERO(input2, fmt) && !FMT_IS_INF(input1, fmt)) HF_FE_ACCUM(flags, HF_FE_DIVBYZERO);
+        result.mant = 0;
+    } else if(FMT_IS_INF(input2, fmt) || FMT_IS_ZERO(input1, fmt)) {
+        //Fini / Inf = 0 ou 0 / Fini = 0
+        result.exp = HF_FMT_EXP_MIN(fmt);
+        result.mant = 0;
+    } else {
+        uint32_t dividend;
+
+        //Subnormaux normalisés: le quotient garde au moins 15 bits significatifs
+        normalize_mantissa_inline(&input1);
+        normalize_mantissa_inline(&input2);
+        dividend = (uint32_t)input1.mant << HF_MANT_SHIFT;
+
+        result.exp = input1.exp - input2.exp;
+        result.mant = (int32_t)(dividend / (uint32_t)input2.mant);
+        if(dividend % (uint32_t)input2.mant) result.mant |= 1;
+
+        normalize_and_round_fmt(&result, flags, fmt, mode);
+    }
+
+    return compose_fmt(&result, fmt);
+}
+
+/**
+ * @brief Racine carrée dans le format fmt (corps instancié par format et par mode)
+ */
+static HF_ALWAYS_INLINE uint16_t sqrt_fmt(uint16_t x, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    half_float result;
+    half_float input = decompose_fmt(x, fmt);
+
+    //Initialisation par défaut: NaN positif (gère NaN et -x automatiquement)
+    result.sign = HF_ZERO_POS;
+    result.exp = HF_FMT_EXP_FULL(fmt);
+    result.mant = 1;
+
+    if(FMT_IS_ZERO(input, fmt)) {
+        //sqrt(+/-0) -> +/-0
+        result = input;
+    } else if(FMT_IS_INF(input, fmt) && !input.sign) {
+        //sqrt(+inf) -> +inf
+        result.mant = 0;
+    } else if(!input.sign && !FMT_IS_NAN(input, fmt)) {
+        uint32_t value, root;
+
+        //Mantisse normalisée puis exposant rendu pair (racine de 16 bits significatifs)
+        normalize_mantissa_inline(&input);
+        value = (uint32_t)input.mant << HF_MANT_SHIFT;
+        if(input.exp & 1) {
+            value <<= 1;
+            input.exp--;
+        }
+
+        //Bit collant si la racine entière n'est pas exacte
+        root = fmt_isqrt(value);
+        root |= root * root != value;
+
+        result.exp = input.exp / 2;
+        result.mant = (int32_t)root;
+        normalize_and_round_fmt(&result, flags, fmt, mode);
+    } else if(!FMT_IS_NAN(input, fmt) || FMT_IS_SNAN_BITS(x, fmt)) {
+        //Racine d'un négatif (ou NaN signalant): opération invalide
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
+    }
+
+    return compose_fmt(&result, fmt);
+}
+
+/**
+ * @brief Multiplication-addition fusionnée dans le format fmt
+ *
+ * Le produit de deux mantisses d'au plus 8 bits significatifs est exact sur
+ * 16 bits: ramené dans [2^15, 2^16) sans perte, il est aligné avec c après
+ * un élargissement de 8 bits des deux mantisses. Une annulation importante
+ * n'a donc lieu que sans bit perdu, et sinon le bit collant reste loin sous
+ * le bit de garde: l'unique arrondi final est correct (bf16, E4M3, E5M2).
+ */
+static HF_ALWAYS_INLINE uint16_t fma_fmt(uint16_t a, uint16_t b, uint16_t c, unsigned int *flags, hf_format fmt, hf_rounding_mode mode) {
+    half_float result;
+    half_float inputa = decompose_fmt(a, fmt);
+    half_float inputb = decompose_fmt(b, fmt);
+    half_float inputc = decompose_fmt(c, fmt);
+    uint16_t prod_sign = inputa.sign ^ inputb.sign;
+
+    result.sign = HF_ZERO_POS;
+    result.exp = HF_FMT_EXP_FULL(fmt);
+    result.mant = 1;
+
+    //Cas spéciaux: NaN - propager le premier NaN rencontré
+    if(FMT_IS_NAN(inputa, fmt) || FMT_IS_NAN(inputb, fmt) || FMT_IS_NAN(inputc, fmt)) {
+        if(FMT_IS_NAN(inputa, fmt)) result.sign = inputa.sign;
+        else if(FMT_IS_NAN(inputb, fmt)) result.sign = inputb.sign;
+        else result.sign = inputc.sign;
+        if(FMT_IS_SNAN_BITS(a, fmt) || FMT_IS_SNAN_BITS(b, fmt) || FMT_IS_SNAN_BITS(c, fmt)) HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if((FMT_IS_INF(inputa, fmt) && FMT_IS_ZERO(inputb, fmt)) || (FMT_IS_INF(inputb, fmt) && FMT_IS_ZERO(inputa, fmt))) {
+        //inf * 0 -> NaN négatif
+        result.sign = HF_ZERO_NEG;
+        HF_FE_ACCUM(flags, HF_FE_INVALID);
+    } else if(FMT_IS_INF(inputa, fmt) || FMT_IS_INF(inputb, fmt)) {
+        //Produit infini: inf - inf -> NaN, sinon inf
+        if(FMT_IS_INF(inputc, fmt) && prod_sign != inputc.sign) {
+            result.sign = HF_ZERO_NEG;
+            HF_FE_ACCUM(flags, HF_FE_INVALID);
+        } else {
+            result.sign = prod_sign;
+            result.mant = 0;
+        }
+    } else if(FMT_IS_INF(inputc, fmt)) {
+        result = inputc;
+    } else if(FMT_IS_ZERO(inputa, fmt) || FMT_IS_ZERO(inputb, fmt)) {
+        //Produit nul exact: c, ou zéro signé comme une addition
+        result = inputc;
+        if(FMT_IS_ZERO(inputc, fmt) && prod_sign != inputc.sign) {
+            result.sign = mode == HF_ROUND_TOWARD_NEG_INF ? HF_ZERO_NEG : HF_ZERO_POS;
+        }
+    } else {
+        uint32_t product;
+
+        //Produit exact ramené dans [2^15, 2^16)
+        normalize_mantissa_inline(&inputa);
+        normalize_mantissa_inline(&inputb);
+        product = ((uint32_t)inputa.mant * (uint32_t)inputb.mant) >> HF_MANT_SHIFT;
+        result.sign = prod_sign;
+        result.exp = inputa.exp + inputb.exp;
+        if(product >= HF_MANT_NORM_MAX) {
+            product >>= 1;
+            result.exp++;
+        }
+        result.mant = (int32_t)product;
+
+        if(!FMT_IS_ZERO(inputc, fmt)) {
+            int32_t sum;
+
+            //Élargissement de 8 bits puis addition avec bit collant
+            normalize_mantissa_inline(&inputc);
+            result.mant <<= 8;
+            result.exp -= 8;
+            inputc.mant <<= 8;
+            inputc.exp -= 8;
+            align_mantissas(&result, &inputc);
+            sum = (result.sign ? -result.mant : result.mant);
+            sum += (inputc.sign ? -inputc.mant : inputc.mant);
+
+            result.mant = sum < 0 ? -sum : sum;
+            result.sign = sum < 0 ? HF_ZERO_NEG : HF_ZERO_POS;
+            if(sum == 0) {
+                result.sign = mode == HF_ROUND_TOWARD_NEG_INF ? HF_ZERO_NEG : HF_ZERO_POS;
+                result.exp = HF_FMT_EXP_MIN(fmt);
+            }
+        }
+
+        normalize_and_round_fmt(&result, flags, fmt, mode);
+    }
+
+    return compose_fmt(&result, fmt);
+}
+
+/**
+ * @brief Racine carrée entière (chiffre par chiffre, deux bits par pas)
+ *
+ * @param value Entier non signé 32 bits
+ * @return floor(sqrt(value))
+ */
+static uint32_t fmt_isqrt(uint32_t value) {
+    uint32_t root = 0, bit = 1U << 30;
+
+    while(bit > value) bit >>= 2;
+    while(bit != 0) {
+        if(value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
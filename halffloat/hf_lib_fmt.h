@@ -0,0 +1,118 @@
+/**
+ * @file hf_lib_fmt.h
+ * @brief Formats courts bfloat16 et FP8 (E4M3, E5M2) pour Half-Float
+ *
+ * Chaque format est une instance du noyau commun de hf_common.h
+ * (decompose_fmt, normalize_and_round_fmt, compose_fmt) avec un format
+ * HF_FORMAT_* constant: le compilateur en tire un décodeur et un arrondi
+ * dédiés. Les motifs bf16 sont rangés dans un uint16_t, les motifs FP8 dans
+ * un uint8_t.
+ *
+ *  - bfloat16: 8 bits d'exposant (biais 127), 7 bits de mantisse, même plage
+ *    que float32 (plus grand fini 3.39e38).
+ *  - FP8 E5M2: 5 bits d'exposant (biais 15), 2 bits de mantisse, infinis et
+ *    NaN IEEE, plus grand fini 57344 (octet de poids fort d'un fp16).
+ *  - FP8 E4M3 (OCP): 4 bits d'exposant (biais 7), 3 bits de mantisse, sans
+ *    infini, seul S.1111.111 est NaN, plus grand fini 448. Sans saturation:
+ *    un dépassement arrondi vers l'infini donne NaN, un infini converti est
+ *    invalide et donne NaN.
+ *
+ * Toutes les opérations arrondissent une seule fois dans le mode du thread et
+ * lèvent les indicateurs HF_FE_*. Les conversions passent par la valeur
+ * binary32 exacte (toutes les valeurs de ces formats en sont), donc un seul
+ * arrondi entre deux formats quelconques; les NaN sont rendus silencieux, un
+ * NaN signalant lève l'opération invalide sauf vers float (comme half_to_float).
+ * La FMA est exacte: le produit de deux mantisses bf16 ou FP8 tient sans
+ * perte dans la mantisse interne. Les conversions par lots, sans branchement,
+ * sont vectorisables par le compilateur (sauf float -> E4M3 sur x86: décalages
+ * variables sur octets) et identiques aux versions scalaires.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_FMT_H
+#define HF_LIB_FMT_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+//Constantes remarquables
+#define BF16_INFINITY_POS       0x7F80U
+#define BF16_INFINITY_NEG       0xFF80U
+#define BF16_NAN                0x7FC0U
+#define BF16_ONE_POS            0x3F80U
+#define FP8_E4M3_NAN            0x7FU           //Seul NaN (avec son opposé 0xFF)
+#define FP8_E4M3_MAX            0x7EU           //448
+#define FP8_E4M3_ONE_POS        0x38U
+#define FP8_E5M2_INFINITY_POS   0x7CU
+#define FP8_E5M2_INFINITY_NEG   0xFCU
+#define FP8_E5M2_NAN            0x7EU
+#define FP8_E5M2_ONE_POS        0x3CU
+
+//bfloat16: conversions (vers float, fp16 et depuis FP8: exactes)
+HF_API uint16_t bf16_from_float(float f);
+HF_API float bf16_to_float(uint16_t b);
+HF_API uint16_t bf16_from_half(uint16_t hf);
+HF_API uint16_t bf16_to_half(uint16_t b);
+
+//bfloat16: arithmétique
+HF_API uint16_t bf16_add(uint16_t x, uint16_t y);
+HF_API uint16_t bf16_sub(uint16_t x, uint16_t y);
+HF_API uint16_t bf16_mul(uint16_t x, uint16_t y);
+HF_API uint16_t bf16_div(uint16_t x, uint16_t y);
+HF_API uint16_t bf16_sqrt(uint16_t x);
+HF_API uint16_t bf16_fma(uint16_t a, uint16_t b, uint16_t c);     //a*b+c, un seul arrondi
+
+//FP8 E4M3: conversions (vers float, fp16 et bf16: exactes)
+HF_API uint8_t fp8_e4m3_from_float(float f);
+HF_API float fp8_e4m3_to_float(uint8_t q);
+HF_API uint8_t fp8_e4m3_from_half(uint16_t hf);
+HF_API uint16_t fp8_e4m3_to_half(uint8_t q);
+HF_API uint8_t fp8_e4m3_from_bf16(uint16_t b);
+HF_API uint16_t fp8_e4m3_to_bf16(uint8_t q);
+
+//FP8 E4M3: arithmétique
+HF_API uint8_t fp8_e4m3_add(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e4m3_sub(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e4m3_mul(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e4m3_div(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e4m3_sqrt(uint8_t x);
+HF_API uint8_t fp8_e4m3_fma(uint8_t a, uint8_t b, uint8_t c);
+
+//FP8 E5M2: conversions (vers float, fp16 et bf16: exactes)
+HF_API uint8_t fp8_e5m2_from_float(float f);
+HF_API float fp8_e5m2_to_float(uint8_t q);
+HF_API uint8_t fp8_e5m2_from_half(uint16_t hf);
+HF_API uint16_t fp8_e5m2_to_half(uint8_t q);
+HF_API uint8_t fp8_e5m2_from_bf16(uint16_t b);
+HF_API uint16_t fp8_e5m2_to_bf16(uint8_t q);
+
+//FP8 E5M2: arithmétique
+HF_API uint8_t fp8_e5m2_add(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e5m2_sub(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e5m2_mul(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e5m2_div(uint8_t x, uint8_t y);
+HF_API uint8_t fp8_e5m2_sqrt(uint8_t x);
+HF_API uint8_t fp8_e5m2_fma(uint8_t a, uint8_t b, uint8_t c);
+
+//Conversions par lots (mode du thread lu une fois, identiques aux versions scalaires)
+HF_API void bf16_from_float_n(const float *in, uint16_t *out, size_t n);
+HF_API void bf16_to_float_n(const uint16_t *in, float *out, size_t n);
+HF_API void bf16_from_half_n(const uint16_t *in, uint16_t *out, size_t n);
+HF_API void bf16_to_half_n(const uint16_t *in, uint16_t *out, size_t n);
+HF_API void fp8_e4m3_from_float_n(const float *in, uint8_t *out, size_t n);
+HF_API void fp8_e4m3_to_float_n(const uint8_t *in, float *out, size_t n);
+HF_API void fp8_e4m3_from_half_n(const uint16_t *in, uint8_t *out, size_t n);
+HF_API void fp8_e4m3_to_half_n(const uint8_t *in, uint16_t *out, size_t n);
+HF_API void fp8_e4m3_from_bf16_n(const uint16_t *in, uint8_t *out, size_t n);
+HF_API void fp8_e4m3_to_bf16_n(const uint8_t *in, uint16_t *out, size_t n);
+HF_API void fp8_e5m2_from_float_n(const float *in, uint8_t *out, size_t n);
+HF_API void fp8_e5m2_to_float_n(const uint8_t *in, float *out, size_t n);
+HF_API void fp8_e5m2_from_half_n(const uint16_t *in, uint8_t *out, size_t n);
+HF_API void fp8_e5m2_to_half_n(const uint8_t *in, uint16_t *out, size_t n);
+HF_API void fp8_e5m2_from_bf16_n(const uint16_t *in, uint8_t *out, size_t n);
+HF_API void fp8_e5m2_to_bf16_n(const uint8_t *in, uint16_t *out, size_t n);
+
+#endif //HF_LIB_FMT_H
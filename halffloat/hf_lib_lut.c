@@ -0,0 +1,438 @@
+/**
+ * @file hf_lib_lut.c
+ * @brief Implémentation des tables exhaustives pour les fonctions unaires
+ *
+ * Les tables sont remplies en appelant l'implémentation algorithmique sur les
+ * 65536 motifs: elles sont donc identiques bit à bit au calcul, pour le mode
+ * d'arrondi et le moteur actifs lors de la génération. Le format .bin est un en-tête
+ * de 8 octets ("HFLUT1", mode, moteur) suivi des 65536 résultats en petit-boutiste.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "hf_lib_lut.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_trig.h"
+#include "hf_lib_par.h"
+
+#define HF_LUT_HEADER_SIZE 8                //Taille de l'en-tête du format .bin
+#define HF_LUT_MAGIC "HFLUT1"               //Signature du format .bin (6 octets)
+
+//Registre des fonctions unaires (toutes en mode algorithmique au départ)
+static hf_unary_lut_t unary_registry[HF_UNARY_COUNT] = {
+    {hf_sin, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_cos, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_tan, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_asin, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_acos, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_atan, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_sinh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_cosh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_tanh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_asinh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_acosh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_atanh, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_exp, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_exp2, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_exp10, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_expm1, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_ln, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_log2, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_log10, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_log1p, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_sqrt, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_rsqrt, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_cbrt, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE},
+    {hf_inv, NULL, NULL, HF_ROUND_NEAREST_EVEN, HF_ENGINE_TABLE}
+};
+
+//Noms des fonctions du registre (même ordre que hf_unary_id)
+static const char *unary_names[HF_UNARY_COUNT] = {
+    "sin", "cos", "tan", "asin", "acos", "atan",
+    "sinh", "cosh", "tanh", "asinh", "acosh", "atanh",
+    "exp", "exp2", "exp10", "expm1", "ln", "log2", "log10", "log1p",
+    "sqrt", "rsqrt", "cbrt", "inv"
+};
+
+//Fonction et tableaux d'un lot hf_unary_n réparti (HF_THREADS, voir hf_lib_par.h)
+#if defined(HF_THREADS)
+typedef struct {
+    hf_unary_id id;
+    const uint16_t *in;
+    uint16_t *out;
+} unary_par_task;
+
+#define UNARY_PARALLEL(id, in, out, n) unary_parallel((id), (in), (out), (n))
+#else
+#define UNARY_PARALLEL(id, in, out, n) 0
+#endif
+
+//Déclaration des helpers statiques
+static int lut_usable(const hf_unary_lut_t *lut);
+#if defined(HF_THREADS)
+static int unary_parallel(hf_unary_id id, const uint16_t *in, uint16_t *out, size_t n);
+static void unary_par_body(void *ctx, size_t begin, size_t end);
+#endif
+
+/**
+ * @brief Initialise une poignée en mode algorithmique
+ *
+ * @param lut Poignée à initialiser
+ * @param fn Implémentation algorithmique de la fonction
+ */
+void hf_lut_init(hf_unary_lut_t *lut, hf_unary_fn fn) {
+    lut->fn = fn;
+    lut->table = NULL;
+    lut->owned = NULL;
+    lut->mode = hf_get_rounding_mode();
+    lut->engine = hf_engine_selected();
+}
+
+/**
+ * @brief Génère la table complète d'une poignée à partir de son implémentation
+ *
+ * La table est calculée sous le mode d'arrondi et le moteur courants, mémorisés
+ * dans la poignée.
+ *
+ * @param lut Poignée initialisée par hf_lut_init
+ * @return 1 en cas de succès, 0 si l'allocation a échoué (poignée inchangée)
+ */
+int hf_lut_build(hf_unary_lut_t *lut) {
+    uint16_t *table = (uint16_t *)malloc(HF_LUT_SIZE * sizeof(uint16_t));
+    int result = 0;
+
+    if(table != NULL) {
+        unsigned int i;
+
+        for(i = 0; i < HF_LUT_SIZE; i++) table[i] = lut->fn((uint16_t)i);
+
+        hf_lut_free(lut);
+        lut->table = table;
+        lut->owned = table;
+        lut->mode = hf_get_rounding_mode();
+        lut->engine = hf_engine_selected();
+        result = 1;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Associe une table externe (par exemple générée par hf_lut_write_c) à une poignée
+ *
+ * La table n'est pas copiée et doit rester valide tant que la poignée l'utilise.
+ *
+ * @param lut Poignée initialisée par hf_lut_init
+ * @param table Table de 65536 résultats
+ * @param mode Mode d'arrondi sous lequel la table a été générée
+ * @param engine Moteur transcendant sous lequel la table a été générée
+ */
+void hf_lut_attach(hf_unary_lut_t *lut, const uint16_t *table, hf_rounding_mode mode, hf_engine engine) {
+    hf_lut_free(lut);
+    lut->table = table;
+    lut->mode = mode;
+    lut->engine = engine;
+}
+
+/**
+ * @brief Libère la table d'une poignée, qui repasse en mode algorithmique
+ *
+ * @param lut Poignée à libérer
+ */
+void hf_lut_free(hf_unary_lut_t *lut) {
+    free(lut->owned);
+    lut->owned = NULL;
+    lut->table = NULL;
+}
+
+/**
+ * @brief Évalue une poignée sur un tableau
+ *
+ * @param lut Poignée initialisée
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_lut_eval_n(const hf_unary_lut_t *lut, const uint16_t *in, uint16_t *out, size_t n) {
+    const uint16_t *table = lut->table;
+    size_t i;
+
+    if(table != NULL) {
+        HF_PROFILE_CALLS(HF_PROF_LUT_N, n);
+        for(i = 0; i < n; i++) out[i] = table[in[i]];
+    } else {
+        for(i = 0; i < n; i++) out[i] = lut->fn(in[i]);
+    }
+}
+
+/**
+ * @brief Enregistre la table d'une poignée dans un fichier binaire
+ *
+ * @param lut Poignée possédant une table
+ * @param path Chemin du fichier .bin
+ * @return 1 en cas de succès, 0 sinon
+ */
+int hf_lut_save(const hf_unary_lut_t *lut, const char *path) {
+    unsigned char header[HF_LUT_HEADER_SIZE];
+    unsigned char data[2 * 256];
+    FILE *file;
+    int result = 0;
+
+    if(lut->table != NULL && (file = fopen(path, "wb")) != NULL) {
+        unsigned int i;
+        int ok;
+
+        for(i = 0; i < 6; i++) header[i] = (unsigned char)HF_LUT_MAGIC[i];
+        header[6] = (unsigned char)lut->mode;
+        header[7] = (unsigned char)lut->engine;
+        ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+
+        //Écriture par blocs de 256 entrées
+        for(i = 0; ok && i < HF_LUT_SIZE; i += 256) {
+            unsigned int j;
+
+            for(j = 0; j < 256; j++) {
+                data[2 * j] = (unsigned char)(lut->table[i + j] & 0xFF);
+                data[2 * j + 1] = (unsigned char)(lut->table[i + j] >> 8);
+            }
+            ok = fwrite(data, 1, sizeof(data), file) == sizeof(data);
+        }
+
+        result = (fclose(file) == 0) && ok;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Charge une table depuis un fichier binaire produit par hf_lut_save
+ *
+ * @param lut Poignée initialisée par hf_lut_init (fonction de référence)
+ * @param path Chemin du fichier .bin
+ * @return 1 en cas de succès, 0 si le fichier est absent, tronqué ou invalide (poignée inchangée)
+ */
+int hf_lut_load(hf_unary_lut_t *lut, const char *path) {
+    unsigned char header[HF_LUT_HEADER_SIZE];
+    unsigned char data[2 * 256];
+    uint16_t *table = NULL;
+    FILE *file = fopen(path, "rb");
+    int result = 0;
+
+    if(file != NULL) {
+        unsigned int i;
+        int valid = fread(header, 1, sizeof(header), file) == sizeof(header)
+                 && header[6] <= HF_ROUND_TOWARD_NEG_INF && header[7] <= HF_ENGINE_POLY;
+
+        for(i = 0; valid && i < 6; i++) valid = header[i] == (unsigned char)HF_LUT_MAGIC[i];
+        if(valid) table = (uint16_t *)malloc(HF_LUT_SIZE * sizeof(uint16_t));
+        valid = valid && table != NULL;
+
+        //Lecture par blocs de 256 entrées
+        for(i = 0; valid && i < HF_LUT_SIZE; i += 256) {
+            unsigned int j;
+
+            valid = fread(data, 1, sizeof(data), file) == sizeof(data);
+            for(j = 0; valid && j < 256; j++) table[i + j] = (uint16_t)(data[2 * j] | (data[2 * j + 1] << 8));
+        }
+
+        //Le fichier doit se terminer exactement après la table
+        valid = valid && fgetc(file) == EOF;
+        fclose(file);
+
+        if(valid) {
+            hf_lut_free(lut);
+            lut->table = table;
+            lut->owned = table;
+            lut->mode = (hf_rounding_mode)header[6];
+            lut->engine = (hf_engine)header[7];
+            result = 1;
+        } else {
+            free(table);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Écrit la table d'une poignée sous forme de source C (tableau const)
+ *
+ * Le fichier produit définit `const uint16_t name[65536]`, à compiler avec
+ * l'application puis à associer via hf_lut_attach().
+ *
+ * @param lut Poignée possédant une table
+ * @param path Chemin du fichier .c
+ * @param name Nom du tableau généré
+ * @return 1 en cas de succès, 0 sinon
+ */
+int hf_lut_write_c(const hf_unary_lut_t *lut, const char *path, const char *name) {
+    FILE *file;
+    int result = 0;
+
+    if(lut->table != NULL && (file = fopen(path, "w")) != NULL) {
+        unsigned int i;
+        int ok;
+
+        ok = fprintf(file, "//Table générée par hf_lut_write_c (%u entrées, mode d'arrondi %d, moteur %d)\n",
+                     (unsigned int)HF_LUT_SIZE, (int)lut->mode, (int)lut->engine) > 0;
+        ok = ok && fprintf(file, "#include \"hf_common.h\"\n\nextern const uint16_t %s[%u];\n", name, (unsigned int)HF_LUT_SIZE) > 0;
+        ok = ok && fprintf(file, "const uint16_t %s[%u] = {\n", name, (unsigned int)HF_LUT_SIZE) > 0;
+        for(i = 0; ok && i < HF_LUT_SIZE; i++) {
+            const char *sep = (i % 8 == 7 || i == HF_LUT_SIZE - 1) ? ",\n" : ", ";
+            ok = fprintf(file, "%s0x%04X%s", (i % 8 == 0) ? "    " : "", (unsigned int)lut->table[i], sep) > 0;
+        }
+        ok = ok && fprintf(file, "};\n") > 0;
+
+        result = (fclose(file) == 0) && ok;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Active ou désactive la table exhaustive d'une fonction du registre
+ *
+ * L'activation génère la table sous le mode d'arrondi et le moteur courants; la désactivation
+ * libère la mémoire et repasse la fonction en mode algorithmique.
+ *
+ * @param id Identifiant de la fonction
+ * @param enable 1 pour le mode table, 0 pour le mode algorithmique
+ * @return 1 en cas de succès, 0 si l'identifiant est invalide ou l'allocation échoue
+ */
+int hf_unary_set_lut(hf_unary_id id, int enable) {
+    int result = 0;
+
+    if((unsigned int)id < HF_UNARY_COUNT) {
+        hf_unary_lut_t *lut = &unary_registry[id];
+
+        if(enable) {
+            result = lut_usable(lut) || hf_lut_build(lut);
+        } else {
+            hf_lut_free(lut);
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Indique si une fonction du registre est servie par sa table
+ *
+ * @param id Identifiant de la fonction
+ * @return 1 si la table est présente et générée sous le mode d'arrondi et le moteur courants, 0 sinon
+ */
+int hf_unary_is_lut(hf_unary_id id) {
+    return (unsigned int)id < HF_UNARY_COUNT && lut_usable(&unary_registry[id]);
+}
+
+/**
+ * @brief Renvoie la poignée d'une fonction du registre (chargement/enregistrement de sa table)
+ *
+ * @param id Identifiant de la fonction
+ * @return Poignée, ou NULL si l'identifiant est invalide
+ */
+hf_unary_lut_t *hf_unary_handle(hf_unary_id id) {
+    return (unsigned int)id < HF_UNARY_COUNT ? &unary_registry[id] : NULL;
+}
+
+/**
+ * @brief Renvoie le nom d'une fonction du registre
+ *
+ * @param id Identifiant de la fonction
+ * @return Chaîne constante ("?" si l'identifiant est invalide)
+ */
+const char *hf_unary_name(hf_unary_id id) {
+    return (unsigned int)id < HF_UNARY_COUNT ? unary_names[id] : "?";
+}
+
+/**
+ * @brief Évalue une fonction du registre
+ *
+ * La table n'est utilisée que si elle a été générée sous le mode d'arrondi et
+ * le moteur courants; sinon le calcul algorithmique est effectué.
+ *
+ * @param id Identifiant de la fonction (doit être valide)
+ * @param hf Argument demi-flottant
+ * @return Résultat demi-flottant
+ */
+uint16_t hf_unary(hf_unary_id id, uint16_t hf) {
+    const hf_unary_lut_t *lut = &unary_registry[id];
+    uint16_t result;
+
+    if(lut_usable(lut)) {
+        HF_PROFILE_CALLS(HF_PROF_LUT_N, 1);
+        result = lut->table[hf];
+    } else {
+        result = lut->fn(hf);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Évalue une fonction du registre sur un tableau
+ *
+ * @param id Identifiant de la fonction (doit être valide)
+ * @param in Tableau source de n demi-flottants
+ * @param out Tableau destination de n demi-flottants
+ * @param n Nombre d'éléments
+ */
+void hf_unary_n(hf_unary_id id, const uint16_t *in, uint16_t *out, size_t n) {
+    const hf_unary_lut_t *lut = &unary_registry[id];
+    size_t i;
+
+    if(!UNARY_PARALLEL(id, in, out, n)) {
+        if(lut_usable(lut)) {
+            hf_lut_eval_n(lut, in, out, n);
+        } else {
+            for(i = 0; i < n; i++) out[i] = lut->fn(in[i]);
+        }
+    }
+}
+
+/**
+ * @brief Vrai si la table d'une poignée existe et correspond au mode d'arrondi et au moteur courants
+ */
+static int lut_usable(const hf_unary_lut_t *lut) {
+    return lut->table != NULL && lut->mode == hf_get_rounding_mode() && lut->engine == hf_engine_selected();
+}
+
+#if defined(HF_THREADS)
+/**
+ * @brief Confie un lot hf_unary_n au groupe de threads
+ *
+ * @param id Identifiant de la fonction
+ * @param in Tableau source
+ * @param out Tableau destination
+ * @param n Nombre d'éléments
+ * @return 1 si le lot a été traité en parallèle, 0 sinon
+ */
+static int unary_parallel(hf_unary_id id, const uint16_t *in, uint16_t *out, size_t n) {
+    unary_par_task task;
+
+    task.id = id;
+    task.in = in;
+    task.out = out;
+
+    return hf_par_run(unary_par_body, &task, n);
+}
+
+/**
+ * @brief Traite la tranche [begin, end) d'un lot hf_unary_n réparti
+ *
+ * @param ctx Lot (unary_par_task)
+ * @param begin Premier élément de la tranche
+ * @param end Fin (exclue) de la tranche
+ */
+static void unary_par_body(void *ctx, size_t begin, size_t end) {
+    const unary_par_task *task = (const unary_par_task *)ctx;
+
+    hf_unary_n(task->id, task->in + begin, task->out + begin, end - begin);
+}
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file hf_lib_lut.h
+ * @brief Module de tables exhaustives pour les fonctions unaires Half-Float
+ *
+ * Une fonction unaire n'a que 65536 entrées possibles: une table complète de
+ * 128 Kio remplace chaque appel par une simple lecture. Les tables sont générées
+ * à partir des implémentations algorithmiques (à l'initialisation, ou hors ligne
+ * via un fichier .bin ou .c), et chaque fonction peut être basculée entre le mode
+ * table et le mode algorithmique pour arbitrer entre empreinte cache et latence.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_LUT_H
+#define HF_LIB_LUT_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+#define HF_LUT_SIZE 65536                   //Nombre d'entrées d'une table exhaustive
+
+//Fonction unaire sur demi-flottants
+typedef uint16_t (*hf_unary_fn)(uint16_t hf);
+
+//Poignée de table exhaustive pour une fonction unaire
+typedef struct {
+    hf_unary_fn fn;                         //Implémentation algorithmique de référence
+    const uint16_t *table;                  //Table des 65536 résultats (NULL: mode algorithmique)
+    uint16_t *owned;                        //Table allouée par la bibliothèque (libérée par hf_lut_free)
+    hf_rounding_mode mode;                  //Mode d'arrondi sous lequel la table a été générée
+    hf_engine engine;                       //Moteur transcendant sous lequel la table a été générée
+} hf_unary_lut_t;
+
+//Fonctions unaires gérées par le registre
+typedef enum {
+    HF_UNARY_SIN = 0,
+    HF_UNARY_COS,
+    HF_UNARY_TAN,
+    HF_UNARY_ASIN,
+    HF_UNARY_ACOS,
+    HF_UNARY_ATAN,
+    HF_UNARY_SINH,
+    HF_UNARY_COSH,
+    HF_UNARY_TANH,
+    HF_UNARY_ASINH,
+    HF_UNARY_ACOSH,
+    HF_UNARY_ATANH,
+    HF_UNARY_EXP,
+    HF_UNARY_EXP2,
+    HF_UNARY_EXP10,
+    HF_UNARY_EXPM1,
+    HF_UNARY_LN,
+    HF_UNARY_LOG2,
+    HF_UNARY_LOG10,
+    HF_UNARY_LOG1P,
+    HF_UNARY_SQRT,
+    HF_UNARY_RSQRT,
+    HF_UNARY_CBRT,
+    HF_UNARY_INV,
+    HF_UNARY_COUNT
+} hf_unary_id;
+
+//Gestion d'une poignée
+HF_API void hf_lut_init(hf_unary_lut_t *lut, hf_unary_fn fn);
+HF_API int hf_lut_build(hf_unary_lut_t *lut);
+HF_API void hf_lut_attach(hf_unary_lut_t *lut, const uint16_t *table, hf_rounding_mode mode, hf_engine engine);
+HF_API void hf_lut_free(hf_unary_lut_t *lut);
+HF_API void hf_lut_eval_n(const hf_unary_lut_t *lut, const uint16_t *in, uint16_t *out, size_t n);
+
+//Génération hors ligne et chargement
+HF_API int hf_lut_save(const hf_unary_lut_t *lut, const char *path);
+HF_API int hf_lut_load(hf_unary_lut_t *lut, const char *path);
+HF_API int hf_lut_write_c(const hf_unary_lut_t *lut, const char *path, const char *name);
+
+//Registre: choix table/algorithmique par fonction
+HF_API int hf_unary_set_lut(hf_unary_id id, int enable);
+HF_API int hf_unary_is_lut(hf_unary_id id);
+HF_API hf_unary_lut_t *hf_unary_handle(hf_unary_id id);
+HF_API const char *hf_unary_name(hf_unary_id id);
+HF_API uint16_t hf_unary(hf_unary_id id, uint16_t hf);
+HF_API void hf_unary_n(hf_unary_id id, const uint16_t *in, uint16_t *out, size_t n);
+
+/**
+ * @brief Évalue une poignée (lecture de table si présente, sinon calcul)
+ *
+ * La table reflète le mode d'arrondi de sa génération, sans vérification ici.
+ *
+ * @param lut Poignée initialisée
+ * @param hf Argument demi-flottant
+ * @return Résultat demi-flottant
+ */
+static inline uint16_t hf_lut_eval(const hf_unary_lut_t *lut, uint16_t hf) {
+    return lut->table != NULL ? lut->table[hf] : lut->fn(hf);
+}
+
+#endif //HF_LIB_LUT_H
@@ -10,9 +10,13 @@
  * @version 1.0
  */
 
+#include <string.h>
 #include "hf_lib_misc.h"
 #include "hf_lib_common.h"
 
+//Vrai si le motif 16 bits est un NaN
+#define IS_NAN_BITS(h) (((h) & (HF_INFINITY_POS | HF_MASK_MANT)) > HF_INFINITY_POS)
+
 /**
  * @brief Compare deux demi-flottants (IEEE 754 - half precision)
  *
@@ -35,6 +39,8 @@
 int hf_cmp(uint16_t hf1, uint16_t hf2) {
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
+
+    HF_PROFILE_FN2(HF_PROF_MISC, hf1, hf2);
     return compare_half(&input1, &input2);
 }
 
@@ -58,6 +64,8 @@ uint16_t hf_min(uint16_t hf1, uint16_t hf2) {
     uint16_t result = hf1;
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
+
+    HF_PROFILE_FN2(HF_PROF_MISC, hf1, hf2);
     
     //Si les deux sont NaN, retourner NaN
     if(is_nan(&input1) && is_nan(&input2)) {
@@ -107,6 +115,8 @@ uint16_t hf_max(uint16_t hf1, uint16_t hf2) {
     uint16_t result = hf1;
     half_float input1 = decompose_half(hf1);
     half_float input2 = decompose_half(hf2);
+
+    HF_PROFILE_FN2(HF_PROF_MISC, hf1, hf2);
     
     //Si les deux sont NaN, retourner NaN
     if(is_nan(&input1) && is_nan(&input2)) {
@@ -154,6 +164,8 @@ uint16_t hf_max(uint16_t hf1, uint16_t hf2) {
 uint16_t hf_modf(uint16_t hf, uint16_t *intpart) {
     half_float input = decompose_half(hf);
     half_float hf_frac;
+
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     
     //Initialisation
     hf_frac.sign = input.sign;
@@ -208,6 +220,8 @@ uint16_t hf_frexp(uint16_t hf, int *exp) {
     half_float mant = decompose_half(hf);
     int new_exp = 0;
 
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
+
     //Cas spéciaux: NaN, Inf, Zero -> renvoyer tel quel et exp=0
     if(!is_nan(&mant) && !is_infinity(&mant) && !is_zero(&mant)) {
         //Normaliser les subnormaux pour récupérer un bit implicite cohérent
@@ -236,6 +250,7 @@ uint16_t hf_frexp(uint16_t hf, int *exp) {
  * @return hf * 2^exp
  */
 uint16_t hf_ldexp(uint16_t hf, int exp) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     (void)hf; (void)exp; return HF_NAN;
 }
 
@@ -247,6 +262,7 @@ uint16_t hf_ldexp(uint16_t hf, int exp) {
  * @return hf * FLT_RADIX^n
  */
 uint16_t hf_scalbn(uint16_t hf, int n) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     (void)hf; (void)n; return HF_NAN;
 }
 
@@ -257,6 +273,7 @@ uint16_t hf_scalbn(uint16_t hf, int n) {
  * @return L'exposant sous forme flottante
  */
 uint16_t hf_logb(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     (void)hf; return HF_NAN;
 }
 
@@ -267,6 +284,7 @@ uint16_t hf_logb(uint16_t hf) {
  * @return L'exposant sous forme entière
  */
 int hf_ilogb(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
     (void)hf; return -1;
 }
 
@@ -278,6 +296,7 @@ int hf_ilogb(uint16_t hf) {
  * @return mag avec le signe de sign
  */
 uint16_t hf_copysign(uint16_t mag, uint16_t sign) {
+    HF_PROFILE_FN2(HF_PROF_MISC, mag, sign);
     //Copie le bit de signe depuis 'sign' vers 'mag' via masquage
     return (mag & ~HF_MASK_SIGN) | (sign & HF_MASK_SIGN);
 }
@@ -285,21 +304,78 @@ uint16_t hf_copysign(uint16_t mag, uint16_t sign) {
 /**
  * @brief Valeur suivante vers une direction donnée
  *
+ * Incrément ou décrément direct du motif 16 bits: les motifs d'un même signe
+ * sont rangés dans l'ordre des valeurs absolues, subnormaux et passage à
+ * l'infini compris. Seul zéro demande un traitement à part (plus petit
+ * subnormal du signe de to).
+ *
+ * Cas particuliers (IEEE 754):
+ *  - NaN si from ou to est NaN (invalide si signalant)
+ *  - to si from == to (nextafter(+0, -0) = -0)
+ *  - Dépassement depuis +/-65504 vers l'infini, soupassement (et inexact)
+ *    pour un résultat subnormal ou nul
+ *
  * @param from La valeur de départ
  * @param to La direction cible
  * @return La valeur suivante vers to
  */
 uint16_t hf_nextafter(uint16_t from, uint16_t to) {
-    (void)from; (void)to; return HF_NAN;
+    uint16_t afrom = from & ~HF_MASK_SIGN & 0xFFFFU;
+    uint16_t ato = to & ~HF_MASK_SIGN & 0xFFFFU;
+    unsigned int flags = 0;
+    uint16_t result;
+
+    HF_PROFILE_FN2(HF_PROF_MISC, from, to);
+
+    if(IS_NAN_BITS(from) || IS_NAN_BITS(to)) {
+        result = (uint16_t)(HF_NAN | ((IS_NAN_BITS(from) ? from : to) & HF_MASK_SIGN));
+        if((IS_NAN_BITS(from) && !(from & HF_NAN & HF_MASK_MANT)) || (IS_NAN_BITS(to) && !(to & HF_NAN & HF_MASK_MANT))) {
+            flags = HF_FE_INVALID;
+        }
+    } else if(from == to || (afrom == 0 && ato == 0)) {
+        result = to;
+    } else {
+        //Même signe et |to| > |from|: on s'éloigne de zéro, sinon on s'en approche
+        if(afrom == 0) result = (uint16_t)((to & HF_MASK_SIGN) | 1U);
+        else if(!((from ^ to) & HF_MASK_SIGN) && afrom < ato) result = (uint16_t)(from + 1U);
+        else result = (uint16_t)(from - 1U);
+
+        if((result & ~HF_MASK_SIGN & 0xFFFFU) == HF_INFINITY_POS) flags = HF_FE_OVERFLOW | HF_FE_INEXACT;
+        else if((result & HF_INFINITY_POS) == 0) flags = HF_FE_UNDERFLOW | HF_FE_INEXACT;
+    }
+
+    HF_FE_RAISE(flags);
+    return result;
 }
 
 /**
  * @brief Valeur suivante vers une direction donnée (long double)
  *
+ * Comme hf_nextafter(), la direction étant comparée en long double avec la
+ * valeur exacte de from: un to très proche mais différent de from donne
+ * bien le voisin fp16. Le NaN et le signe de to sont lus sur ses bits (en
+ * double), ce qui reste juste sous -ffast-math.
+ *
  * @param from La valeur de départ
  * @param to La direction cible (long double)
  * @return La valeur suivante vers to
  */
 uint16_t hf_nexttoward(uint16_t from, long double to) {
-    (void)from; (void)to; return HF_NAN;
+    double to_d = (double)to;
+    uint64_t bits;
+    uint16_t result;
+
+    memcpy(&bits, &to_d, sizeof(bits));
+
+    if((bits & 0x7FFFFFFFFFFFFFFFULL) > 0x7FF0000000000000ULL) {
+        result = hf_nextafter(from, (uint16_t)(HF_NAN | ((bits >> 48) & HF_MASK_SIGN)));
+    } else if(!IS_NAN_BITS(from) && to == (long double)half_to_float(from)) {
+        //Égalité: to converti, c'est-à-dire from avec le signe de to (zéros)
+        HF_PROFILE_FN(HF_PROF_MISC, from);
+        result = (uint16_t)((from & ~HF_MASK_SIGN) | ((bits >> 48) & HF_MASK_SIGN));
+    } else {
+        result = hf_nextafter(from, to > (long double)half_to_float(from) ? HF_INFINITY_POS : HF_INFINITY_NEG);
+    }
+
+    return result;
 }
@@ -0,0 +1,297 @@
+/**
+ * @file hf_lib_par.c
+ * @brief Implementation de la répartition des lots sur plusieurs threads
+ *
+ * Groupe persistant de threads: les travailleurs attendent un nouveau lot
+ * (compteur de génération sous verrou), calculent chacun leur tranche puis
+ * signalent la fin; l'appelant calcule la première tranche pendant ce temps.
+ * Sans HF_THREADS, seule la configuration est conservée et hf_par_run()
+ * renvoie toujours 0.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#if defined(HF_THREADS) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "hf_lib_par.h"
+
+#if defined(HF_THREADS)
+#include <pthread.h>
+#include <unistd.h>
+
+//Lot en cours (protégé par par_lock)
+typedef struct {
+    hf_par_body body;
+    void *ctx;
+    size_t n;
+    size_t chunk;                           //Longueur d'une tranche (multiple de HF_PAR_ALIGN)
+    unsigned int parts;                     //Tranches du lot (appelant compris)
+    unsigned int pending;                   //Tranches des travailleurs non terminées
+    hf_rounding_mode mode;                  //Mode d'arrondi de l'appelant
+    unsigned int flags[HF_PAR_MAX_THREADS]; //Indicateurs levés par chaque tranche
+} par_job;
+
+//Paramètres de démarrage d'un travailleur
+typedef struct {
+    unsigned int part;                      //Numéro de tranche (>= 1)
+    unsigned long generation;               //Dernier lot déjà soumis à la création
+} par_slot;
+
+//Déclaration des helpers statiques
+static void *par_worker(void *arg);
+static void par_run_part(par_job *job, unsigned int part);
+static unsigned int par_online_threads(void);
+static void par_stop(void);
+
+static pthread_mutex_t par_submit = PTHREAD_MUTEX_INITIALIZER;     //Tenu pendant un lot ou une reconfiguration
+static pthread_mutex_t par_lock = PTHREAD_MUTEX_INITIALIZER;       //Protège l'état ci-dessous
+static pthread_cond_t par_work = PTHREAD_COND_INITIALIZER;         //Nouveau lot ou arrêt
+static pthread_cond_t par_done = PTHREAD_COND_INITIALIZER;         //Fin des tranches des travailleurs
+static pthread_t par_threads[HF_PAR_MAX_THREADS];
+static par_slot par_slots[HF_PAR_MAX_THREADS];
+static unsigned int par_started = 0;                               //Travailleurs en cours d'exécution
+static int par_created = 0;                                        //Groupe déjà créé (même vide)
+static int par_stopping = 0;
+static unsigned long par_generation = 0;
+static par_job par_current;
+static HF_THREAD_LOCAL int par_inside = 0;                         //Thread en train de calculer une tranche
+#endif
+
+static unsigned int par_requested = 0;                             //0 = processeurs en ligne
+static size_t par_threshold = HF_PAR_THRESHOLD;
+
+/**
+ * @brief Choisit le nombre de threads utilisés par lot
+ *
+ * Le groupe existant est arrêté; il sera recréé avec la nouvelle taille au
+ * prochain lot. Sans HF_THREADS, le nombre retenu est toujours 1.
+ *
+ * @param threads Nombre de threads, appelant compris (0 = processeurs en ligne)
+ * @return Nombre de threads retenu (borné à HF_PAR_MAX_THREADS)
+ */
+unsigned int hf_par_set_threads(unsigned int threads) {
+    unsigned int result = 1;
+
+#if defined(HF_THREADS)
+    pthread_mutex_lock(&par_submit);
+    par_stop();
+    par_requested = threads > HF_PAR_MAX_THREADS ? HF_PAR_MAX_THREADS : threads;
+    pthread_mutex_unlock(&par_submit);
+    result = hf_par_get_threads();
+#else
+    par_requested = threads;
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Nombre de threads utilisés par lot
+ *
+ * @return Threads par lot, appelant compris (1 sans HF_THREADS)
+ */
+unsigned int hf_par_get_threads(void) {
+    unsigned int result = 1;
+
+#if defined(HF_THREADS)
+    result = par_requested ? par_requested : par_online_threads();
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Fixe le nombre minimal d'éléments d'un lot parallèle
+ *
+ * @param n Seuil en éléments (les lots plus courts restent séquentiels)
+ */
+void hf_par_set_threshold(size_t n) {
+    par_threshold = n < HF_PAR_ALIGN ? HF_PAR_ALIGN : n;
+}
+
+/**
+ * @brief Nombre minimal d'éléments d'un lot parallèle
+ *
+ * @return Seuil en éléments
+ */
+size_t hf_par_get_threshold(void) {
+    return par_threshold;
+}
+
+/**
+ * @brief Arrête et rejoint les threads du groupe
+ *
+ * Attend la fin du lot en cours éventuel. Le groupe est recréé au prochain
+ * lot assez long.
+ */
+void hf_par_shutdown(void) {
+#if defined(HF_THREADS)
+    pthread_mutex_lock(&par_submit);
+    par_stop();
+    pthread_mutex_unlock(&par_submit);
+#endif
+}
+
+/**
+ * @brief Exécute un lot sur le groupe de threads
+ *
+ * Le lot [0, n) est découpé en une tranche par thread, bornes multiples de
+ * HF_PAR_ALIGN; l'appelant traite la tranche 0. Les travailleurs reprennent
+ * le mode d'arrondi de l'appelant et leurs indicateurs d'exception sont
+ * levés chez l'appelant à la fin du lot.
+ *
+ * @param body Corps du lot
+ * @param ctx Contexte passé à body
+ * @param n Nombre d'éléments
+ * @return 1 si le lot a été traité, 0 s'il doit l'être séquentiellement
+ *         (HF_THREADS absent, lot sous le seuil, lot déjà en cours, un seul thread)
+ */
+int hf_par_run(hf_par_body body, void *ctx, size_t n) {
+    int result = 0;
+
+#if defined(HF_THREADS)
+    if(!par_inside && n >= par_threshold && pthread_mutex_trylock(&par_submit) == 0) {
+        unsigned int flags = 0, part, threads = hf_par_get_threads();
+        size_t blocks = (n + HF_PAR_ALIGN - 1) / HF_PAR_ALIGN;
+
+        pthread_mutex_lock(&par_lock);
+        if(!par_created) {
+            //Création paresseuse: threads - 1 travailleurs (échecs tolérés)
+            for(part = 1; part < threads; part++) {
+                par_slots[par_started].part = part;
+                par_slots[par_started].generation = par_generation;
+                if(pthread_create(&par_threads[par_started], NULL, par_worker, &par_slots[par_started]) != 0) break;
+                par_started++;
+            }
+            par_created = 1;
+        }
+
+        if(par_started > 0) {
+            //Découpage statique: même partition pour un même n et un même groupe
+            par_current.parts = par_started + 1;
+            if(par_current.parts > blocks) par_current.parts = (unsigned int)blocks;
+            par_current.chunk = (blocks + par_current.parts - 1) / par_current.parts * HF_PAR_ALIGN;
+            par_current.body = body;
+            par_current.ctx = ctx;
+            par_current.n = n;
+            par_current.mode = hf_get_rounding_mode();
+            par_current.pending = par_current.parts - 1;
+            par_generation++;
+            pthread_cond_broadcast(&par_work);
+            pthread_mutex_unlock(&par_lock);
+
+            //Tranche 0 sur l'appelant (ses indicateurs sont levés directement)
+            par_inside = 1;
+            body(ctx, 0, par_current.chunk < n ? par_current.chunk : n);
+            par_inside = 0;
+
+            pthread_mutex_lock(&par_lock);
+            while(par_current.pending > 0) pthread_cond_wait(&par_done, &par_lock);
+            for(part = 1; part < par_current.parts; part++) flags |= par_current.flags[part];
+            result = 1;
+        }
+        pthread_mutex_unlock(&par_lock);
+        pthread_mutex_unlock(&par_submit);
+        hf_feraiseexcept(flags);
+    }
+#else
+    (void)body; (void)ctx; (void)n;
+#endif
+
+    return result;
+}
+
+#if defined(HF_THREADS)
+/**
+ * @brief Boucle d'un travailleur: attend un lot, calcule sa tranche, signale la fin
+ *
+ * Le lot soumis juste après la création n'est pas manqué: la génération de
+ * départ est celle relevée par le créateur, pas celle lue au démarrage.
+ *
+ * @param arg Paramètres de démarrage (par_slot)
+ * @return NULL
+ */
+static void *par_worker(void *arg) {
+    unsigned int part = ((const par_slot *)arg)->part;
+    unsigned long seen = ((const par_slot *)arg)->generation;
+
+    par_inside = 1;
+    pthread_mutex_lock(&par_lock);
+    for(;;) {
+        while(par_generation == seen && !par_stopping) pthread_cond_wait(&par_work, &par_lock);
+        if(par_stopping) break;
+        seen = par_generation;
+
+        if(part < par_current.parts) {
+            //Le lot ne change pas avant la fin de toutes les tranches
+            pthread_mutex_unlock(&par_lock);
+            par_run_part(&par_current, part);
+            pthread_mutex_lock(&par_lock);
+            if(--par_current.pending == 0) pthread_cond_signal(&par_done);
+        }
+    }
+    pthread_mutex_unlock(&par_lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Calcule une tranche dans le mode d'arrondi de l'appelant
+ *
+ * Les indicateurs d'exception du travailleur sont effacés avant la tranche
+ * puis relevés dans job->flags[part].
+ *
+ * @param job Lot en cours
+ * @param part Numéro de tranche (>= 1)
+ */
+static void par_run_part(par_job *job, unsigned int part) {
+    size_t begin = (size_t)part * job->chunk;
+    size_t end = begin + job->chunk;
+
+    if(begin > job->n) begin = job->n;
+    if(end > job->n) end = job->n;
+
+    hf_set_rounding_mode(job->mode);
+    hf_feclearexcept(HF_FE_ALL_EXCEPT);
+    if(begin < end) job->body(job->ctx, begin, end);
+    job->flags[part] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+}
+
+/**
+ * @brief Nombre de processeurs en ligne
+ *
+ * @return Processeurs en ligne, borné à [1, HF_PAR_MAX_THREADS]
+ */
+static unsigned int par_online_threads(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int result = 1;
+
+    if(online > HF_PAR_MAX_THREADS) result = HF_PAR_MAX_THREADS;
+    else if(online > 1) result = (unsigned int)online;
+
+    return result;
+}
+
+/**
+ * @brief Arrête et rejoint les travailleurs (par_submit tenu par l'appelant)
+ */
+static void par_stop(void) {
+    unsigned int t;
+
+    pthread_mutex_lock(&par_lock);
+    par_stopping = 1;
+    pthread_cond_broadcast(&par_work);
+    pthread_mutex_unlock(&par_lock);
+    for(t = 0; t < par_started; t++) pthread_join(par_threads[t], NULL);
+
+    pthread_mutex_lock(&par_lock);
+    par_stopping = 0;
+    par_started = 0;
+    par_created = 0;
+    pthread_mutex_unlock(&par_lock);
+}
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file hf_lib_par.h
+ * @brief Répartition des noyaux par lots hf_*_n sur plusieurs threads
+ *
+ * Compilé avec HF_THREADS, un groupe persistant de threads (pthreads, créé
+ * au premier lot assez long) exécute les noyaux hf_*_n de hf_lib_arith.h,
+ * hf_lib_conv.h et hf_unary_n dès que n atteint le seuil (hf_par_set_threshold).
+ * Sans HF_THREADS, toutes les fonctions existent mais les lots restent sur
+ * le thread appelant.
+ *
+ *  - découpage statique: une tranche par thread (appelant compris), bornes
+ *    multiples de HF_PAR_ALIGN éléments; des tableaux alignés sur 64 octets
+ *    ne partagent donc aucune ligne de cache entre deux threads en écriture
+ *  - chaque tranche est calculée dans le mode d'arrondi de l'appelant; les
+ *    indicateurs d'exception levés par les threads sont réunis (OU) dans
+ *    ceux de l'appelant: résultats et indicateurs sont identiques bit à bit
+ *    à une exécution séquentielle, quel que soit le nombre de threads
+ *  - un seul lot parallèle à la fois: un lot soumis pendant qu'un autre
+ *    s'exécute, ou depuis une tranche en cours, est traité séquentiellement
+ *  - avec HF_PROFILE, chaque thread compte les éléments qu'il traite dans ses
+ *    propres compteurs
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_PAR_H
+#define HF_LIB_PAR_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+#ifndef HF_PAR_THRESHOLD
+#define HF_PAR_THRESHOLD 65536              //Seuil par défaut (éléments) de la répartition
+#endif
+#define HF_PAR_MAX_THREADS 64               //Nombre maximal de threads (appelant compris)
+#define HF_PAR_ALIGN 64                     //Granularité des tranches (éléments, >= 64 octets par tableau)
+
+//Corps d'un lot: traite les éléments [begin, end) du contexte ctx
+typedef void (*hf_par_body)(void *ctx, size_t begin, size_t end);
+
+//Configuration (à appeler hors de tout lot en cours)
+HF_API unsigned int hf_par_set_threads(unsigned int threads);  //0 = processeurs en ligne; renvoie le nombre retenu
+HF_API unsigned int hf_par_get_threads(void);                  //Threads utilisés par lot (appelant compris)
+HF_API void hf_par_set_threshold(size_t n);                     //Lots de moins de n éléments: séquentiels
+HF_API size_t hf_par_get_threshold(void);
+HF_API void hf_par_shutdown(void);                              //Arrête le groupe (recréé au besoin)
+
+//Exécute body sur [0, n) en parallèle si possible
+//Renvoie 1 si le lot a été traité, 0 si l'appelant doit le traiter lui-même
+HF_INTERNAL int hf_par_run(hf_par_body body, void *ctx, size_t n);
+
+#endif //HF_LIB_PAR_H
@@ -12,6 +12,9 @@
 
 #include "hf_lib_round.h"
 
+//Déclaration des helpers statiques
+static uint16_t round_nearest_integral(uint16_t hf, int ties_away);
+
 /**
  * @brief Arrondi vers l'entier superieur (plafond)
  * @param hf Le demi-flottant a arrondir vers le haut
@@ -19,6 +22,8 @@
  */
 uint16_t hf_ceil(uint16_t hf) {
     half_float result = decompose_half(hf);
+
+    HF_PROFILE_FN(HF_PROF_ROUND_INT, hf);
     
     //Traitement uniquement pour les nombres non speciaux
     if(!is_nan(&result) && !is_infinity(&result) && !is_zero(&result)) {
@@ -65,6 +70,8 @@ uint16_t hf_ceil(uint16_t hf) {
  */
 uint16_t hf_floor(uint16_t hf) {
     half_float result = decompose_half(hf);
+
+    HF_PROFILE_FN(HF_PROF_ROUND_INT, hf);
     
     //Traitement uniquement pour les nombres non speciaux
     if(!is_nan(&result) && !is_infinity(&result) && !is_zero(&result)) {
@@ -110,6 +117,8 @@ uint16_t hf_floor(uint16_t hf) {
  */
 uint16_t hf_round(uint16_t hf) {
     half_float result = decompose_half(hf);
+
+    HF_PROFILE_FN(HF_PROF_ROUND_INT, hf);
     
     //Traitement uniquement pour les nombres non speciaux
     if(!is_nan(&result) && !is_infinity(&result) && !is_zero(&result)) {
@@ -163,6 +172,8 @@ uint16_t hf_round(uint16_t hf) {
  */
 uint16_t hf_trunc(uint16_t hf) {
     half_float result = decompose_half(hf);
+
+    HF_PROFILE_FN(HF_PROF_ROUND_INT, hf);
     
     //Traitement uniquement pour les nombres non spéciaux
     if(!is_nan(&result) && !is_infinity(&result) && !is_zero(&result)) {
@@ -199,3 +210,88 @@ uint16_t hf_trunc(uint16_t hf) {
 uint16_t hf_int(uint16_t hf) {
     return hf_trunc(hf);
 }
+
+/**
+ * @brief Arrondi à l'entier selon le mode d'arrondi courant du thread
+ *
+ * Au plus près (pair ou loin de zéro), vers zéro, vers +inf ou vers -inf
+ * selon hf_get_rounding_mode(). Le signe est conservé (-0.25 donne -0),
+ * NaN et infinis sont retournés tels quels.
+ *
+ * @param hf Le demi-flottant à arrondir
+ * @return La valeur entière la plus proche selon le mode courant
+ */
+uint16_t hf_nearbyint(uint16_t hf) {
+    uint16_t result;
+
+    switch(hf_get_rounding_mode()) {
+        case HF_ROUND_TOWARD_ZERO:    result = hf_trunc(hf); break;
+        case HF_ROUND_TOWARD_POS_INF: result = hf_ceil(hf); break;
+        case HF_ROUND_TOWARD_NEG_INF: result = hf_floor(hf); break;
+        case HF_ROUND_NEAREST_UP:     result = round_nearest_integral(hf, 1); break;
+        default:                      result = round_nearest_integral(hf, 0); break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Arrondi à l'entier selon le mode d'arrondi courant du thread
+ *
+ * Même résultat que hf_nearbyint, mais lève HF_FE_INEXACT quand la valeur
+ * change (hf_nearbyint ne lève jamais d'exception) et HF_FE_INVALID pour un
+ * NaN signalant.
+ *
+ * @param hf Le demi-flottant à arrondir
+ * @return La valeur entière la plus proche selon le mode courant
+ */
+uint16_t hf_rint(uint16_t hf) {
+    uint16_t result = hf_nearbyint(hf);
+
+    if(result != hf) HF_FE_RAISE(HF_FE_INEXACT);
+    else if((hf & ~HF_MASK_SIGN & 0xFFFFU) > HF_INFINITY_POS && !(hf & HF_NAN & HF_MASK_MANT)) HF_FE_RAISE(HF_FE_INVALID);
+
+    return result;
+}
+
+/**
+ * @brief Arrondi à l'entier le plus proche, égalités au pair ou loin de zéro
+ *
+ * Travaille sur les bits: la mantisse (bit implicite compris) vaut
+ * m * 2^(e - 25), dont les s = 25 - e bits de poids faible sont fractionnaires.
+ *
+ * @param hf Le demi-flottant à arrondir
+ * @param ties_away 1 pour arrondir les égalités loin de zéro, 0 au pair
+ * @return La valeur entière la plus proche
+ */
+static uint16_t round_nearest_integral(uint16_t hf, int ties_away) {
+    uint32_t exp = (hf >> HF_MANT_BITS) & HF_MASK_EXP;
+    uint16_t result = hf;
+
+    HF_PROFILE_FN(HF_PROF_ROUND_INT, hf);
+
+    //|x| >= 1024 (déjà entier), NaN ou infini: inchangé
+    if(exp < HF_MANT_BITS + HF_EXP_BIAS) {
+        uint32_t mant = (hf & HF_MASK_MANT) | (exp ? (1U << HF_MANT_BITS) : 0U);
+        uint32_t shift = HF_MANT_BITS + HF_EXP_BIAS - exp;     //Bits fractionnaires (>= 1)
+        uint32_t q = 0;
+
+        //Au-delà de 12 bits fractionnaires, |x| < 0.5: le quotient reste nul
+        if(shift <= HF_MANT_BITS + 2) {
+            uint32_t frac = mant & ((1U << shift) - 1U);
+            uint32_t half = 1U << (shift - 1);
+            q = mant >> shift;
+            if(frac > half || (frac == half && (ties_away || (q & 1U)))) q++;
+        }
+
+        result = (uint16_t)(hf & HF_MASK_SIGN);
+        if(q != 0) {
+            //Entier exact (q <= 1025): exposant du bit de poids fort puis mantisse alignée
+            uint32_t p = 0;
+            while((q >> (p + 1)) != 0) p++;
+            result |= (uint16_t)(((p + HF_EXP_BIAS) << HF_MANT_BITS) | ((q << (HF_MANT_BITS - p)) & HF_MASK_MANT));
+        }
+    }
+
+    return result;
+}
@@ -16,12 +16,12 @@
 #include "hf_lib_common.h"
 
 /* Fonctions d'arrondis */
-uint16_t hf_ceil(uint16_t hf);
-uint16_t hf_floor(uint16_t hf);
-uint16_t hf_round(uint16_t hf);
-uint16_t hf_trunc(uint16_t hf);
-uint16_t hf_int(uint16_t hf);
-uint16_t hf_nearbyint(uint16_t hf);
-uint16_t hf_rint(uint16_t hf);
+HF_API uint16_t hf_ceil(uint16_t hf);
+HF_API uint16_t hf_floor(uint16_t hf);
+HF_API uint16_t hf_round(uint16_t hf);
+HF_API uint16_t hf_trunc(uint16_t hf);
+HF_API uint16_t hf_int(uint16_t hf);
+HF_API uint16_t hf_nearbyint(uint16_t hf);
+HF_API uint16_t hf_rint(uint16_t hf);
 
 #endif /* HF_LIB_ROUND_H */
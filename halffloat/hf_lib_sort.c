@@ -0,0 +1,360 @@
+/**
+ * @file hf_lib_sort.c
+ * @brief Implémentation du tri, de la sélection et de la classification de tableaux
+ *
+ * La clé d'ordre total inverse le bit de signe des positifs et tous les bits
+ * des négatifs; elle se compare comme un entier non signé et se retransforme
+ * sans perte en valeur, si bien que le tri ne déplace que des clés.
+ *
+ * hf_sort répartit d'abord les clés en place selon leur octet de poids fort
+ * (tri « drapeau américain »: histogramme de 256 cases puis permutation par
+ * échanges), puis réécrit chaque seau à partir de l'histogramme de son octet
+ * de poids faible. Les petits tableaux et petits seaux passent par un tri par
+ * insertion. Aucune allocation, mémoire auxiliaire de quelques kilo-octets.
+ *
+ * hf_topk détermine la clé seuil du k-ième élément par les mêmes histogrammes
+ * (deux lectures du tableau), recueille les indices retenus lors d'une
+ * troisième lecture puis ne trie que ces k indices (tri par tas).
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include <string.h>
+#include "hf_lib_sort.h"
+
+#define SORT_RADIX 256                      //Cases d'histogramme par octet de clé
+#define SORT_SMALL 32                       //En dessous, tri par insertion
+
+//NaN (exposant maximal et mantisse non nulle), signe ignoré
+#define IS_NAN_BITS(h) (((h) & (HF_INFINITY_POS | HF_MASK_MANT)) > HF_INFINITY_POS)
+
+//Déclaration des helpers statiques
+static inline uint16_t order_key(uint16_t hf);
+static inline uint16_t order_value(uint16_t key);
+static inline unsigned int class_of(uint16_t hf);
+static void insertion_sort_keys(uint16_t *keys, size_t n);
+static void radix_sort_keys(uint16_t *keys, size_t n);
+static int topk_after(const uint16_t *a, size_t i, size_t j);
+static void topk_sift_down(const uint16_t *a, size_t *idx, size_t root, size_t m);
+static void topk_sort(const uint16_t *a, size_t *idx, size_t m);
+
+/**
+ * @brief Classe IEEE 754 d'un demi-flottant
+ *
+ * @param hf Demi-flottant encodé
+ * @return Exactement une des constantes HF_CLASS_*
+ */
+unsigned int hf_classify(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_MISC, hf);
+    return class_of(hf);
+}
+
+/**
+ * @brief Masque de bits des éléments appartenant à un ensemble de classes
+ *
+ * @param in Tableau de demi-flottants
+ * @param classes Union de constantes HF_CLASS_* recherchées
+ * @param mask Masque résultat ((n + 63) / 64 mots, bit i = in[i] dans classes)
+ * @param n Nombre d'éléments
+ */
+void hf_classify_n(const uint16_t *in, unsigned int classes, uint64_t *mask, size_t n) {
+    size_t i, j;
+
+    HF_PROFILE_CALLS(HF_PROF_SORT_N, n);
+    for(i = 0; i < n; i += 64) {
+        size_t count = (n - i < 64) ? n - i : 64;
+        uint64_t word = 0;
+
+        for(j = 0; j < count; j++) {
+            word |= (uint64_t)((class_of(in[i + j]) & classes) != 0) << j;
+        }
+        mask[i >> 6] = word;
+    }
+}
+
+/**
+ * @brief Masque de bits des éléments NaN
+ *
+ * Équivalent à hf_classify_n(in, HF_CLASS_NAN, mask, n), sans calcul de classe.
+ *
+ * @param in Tableau de demi-flottants
+ * @param mask Masque résultat ((n + 63) / 64 mots, bit i = in[i] est NaN)
+ * @param n Nombre d'éléments
+ */
+void hf_isnan_n(const uint16_t *in, uint64_t *mask, size_t n) {
+    size_t i, j;
+
+    HF_PROFILE_CALLS(HF_PROF_SORT_N, n);
+    for(i = 0; i < n; i += 64) {
+        size_t count = (n - i < 64) ? n - i : 64;
+        uint64_t word = 0;
+
+        for(j = 0; j < count; j++) {
+            word |= (uint64_t)IS_NAN_BITS(in[i + j]) << j;
+        }
+        mask[i >> 6] = word;
+    }
+}
+
+/**
+ * @brief Trie un tableau en place par ordre total croissant
+ *
+ * Les NaN négatifs sont placés en tête, les NaN positifs en fin, -0 avant +0.
+ * Deux NaN de même signe sont ordonnés par leur charge utile.
+ *
+ * @param a Tableau à trier
+ * @param n Nombre d'éléments
+ */
+void hf_sort(uint16_t *a, size_t n) {
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_SORT_N, n);
+    for(i = 0; i < n; i++) a[i] = order_key(a[i]);
+
+    if(n < SORT_SMALL) {
+        insertion_sort_keys(a, n);
+    } else {
+        radix_sort_keys(a, n);
+    }
+
+    for(i = 0; i < n; i++) a[i] = order_value(a[i]);
+}
+
+/**
+ * @brief Indice du plus grand élément (mêmes règles que hf_max)
+ *
+ * Les NaN sont ignorés et +0 est plus grand que -0; à égalité, le premier
+ * indice est retenu.
+ *
+ * @param a Tableau de demi-flottants
+ * @param n Nombre d'éléments
+ * @return Indice du maximum, ou n si le tableau est vide ou ne contient que des NaN
+ */
+size_t hf_argmax(const uint16_t *a, size_t n) {
+    size_t result = n;
+    uint32_t best = 0;                      //Clé du meilleur + 1 (0: aucun)
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_SORT_N, n);
+    for(i = 0; i < n; i++) {
+        uint32_t key = (uint32_t)order_key(a[i]) + 1U;
+
+        if(!IS_NAN_BITS(a[i]) && key > best) {
+            best = key;
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Indices des k plus grands éléments, par valeur décroissante
+ *
+ * Les NaN sont ignorés, l'ordre est l'ordre total (+0 avant -0 en ordre
+ * décroissant) et à valeur égale les indices sont croissants.
+ *
+ * @param a Tableau de demi-flottants
+ * @param n Nombre d'éléments
+ * @param k Nombre d'indices demandés
+ * @param idx Tableau résultat (au moins min(k, n) indices)
+ * @return Nombre d'indices écrits: min(k, nombre d'éléments non NaN)
+ */
+size_t hf_topk(const uint16_t *a, size_t n, size_t k, size_t *idx) {
+    size_t hist[SORT_RADIX];
+    size_t above = 0;
+    size_t need, total = 0, m = 0;
+    size_t i;
+    uint32_t high, low, threshold = 0;
+
+    HF_PROFILE_CALLS(HF_PROF_SORT_N, n);
+    memset(hist, 0, sizeof(hist));
+    for(i = 0; i < n; i++) {
+        if(!IS_NAN_BITS(a[i])) hist[order_key(a[i]) >> 8]++;
+    }
+    for(i = 0; i < SORT_RADIX; i++) total += hist[i];
+    if(k > total) k = total;
+    need = k;
+
+    if(k > 0 && k < total) {
+        //Octet de poids fort du seuil: les seaux supérieurs contiennent moins de k éléments
+        for(high = SORT_RADIX - 1; above + hist[high] < k; high--) above += hist[high];
+
+        memset(hist, 0, sizeof(hist));
+        for(i = 0; i < n; i++) {
+            uint16_t key = order_key(a[i]);
+            if(!IS_NAN_BITS(a[i]) && (uint32_t)(key >> 8) == high) hist[key & 0xFFU]++;
+        }
+        for(low = SORT_RADIX - 1; above + hist[low] < k; low--) above += hist[low];
+
+        threshold = (high << 8) | low;
+        need = k - above;                   //Éléments égaux au seuil à retenir
+    }
+
+    //Recueil: clés au-dessus du seuil, puis les premiers éléments égaux au seuil
+    for(i = 0; i < n && m < k; i++) {
+        uint32_t key = order_key(a[i]);
+
+        if(!IS_NAN_BITS(a[i]) && key >= threshold) {
+            if(key > threshold) {
+                idx[m++] = i;
+            } else if(need > 0) {
+                idx[m++] = i;
+                need--;
+            }
+        }
+    }
+
+    topk_sort(a, idx, m);
+
+    return m;
+}
+
+/**
+ * @brief Clé d'ordre total d'un demi-flottant (comparable en non signé)
+ */
+static inline uint16_t order_key(uint16_t hf) {
+    return (uint16_t)(hf ^ ((uint16_t)(0U - (uint32_t)(hf >> 15)) | HF_MASK_SIGN));
+}
+
+/**
+ * @brief Valeur correspondant à une clé d'ordre total (inverse de order_key)
+ */
+static inline uint16_t order_value(uint16_t key) {
+    return (uint16_t)(key ^ ((uint16_t)(0U - (uint32_t)((key >> 15) ^ 1U)) | HF_MASK_SIGN));
+}
+
+/**
+ * @brief Classe HF_CLASS_* d'un demi-flottant à partir de ses bits
+ */
+static inline unsigned int class_of(uint16_t hf) {
+    uint32_t exp = hf & HF_INFINITY_POS;
+    uint32_t mant = hf & HF_MASK_MANT;
+    unsigned int rank;                      //0: inf, 1: normal, 2: sous-normal, 3: zéro
+    unsigned int result;
+
+    if(exp == HF_INFINITY_POS && mant != 0) {
+        result = (mant & (1U << (HF_MANT_BITS - 1))) ? HF_CLASS_QNAN : HF_CLASS_SNAN;
+    } else {
+        if(exp == HF_INFINITY_POS) rank = 0;
+        else if(exp != 0) rank = 1;
+        else rank = (mant != 0) ? 2 : 3;
+
+        //Les classes positives sont le miroir des négatives (bits 7 à 4)
+        result = 1U << ((hf & HF_MASK_SIGN) ? rank : 7U - rank);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Tri par insertion de clés (petits tableaux et petits seaux)
+ */
+static void insertion_sort_keys(uint16_t *keys, size_t n) {
+    size_t i, j;
+
+    for(i = 1; i < n; i++) {
+        uint16_t key = keys[i];
+
+        for(j = i; j > 0 && keys[j - 1] > key; j--) keys[j] = keys[j - 1];
+        keys[j] = key;
+    }
+}
+
+/**
+ * @brief Tri par base des clés: répartition par octet fort puis réécriture de chaque seau
+ */
+static void radix_sort_keys(uint16_t *keys, size_t n) {
+    size_t count[SORT_RADIX], next[SORT_RADIX], end[SORT_RADIX];
+    size_t pos = 0;
+    size_t i, b;
+
+    memset(count, 0, sizeof(count));
+    for(i = 0; i < n; i++) count[keys[i] >> 8]++;
+
+    for(b = 0; b < SORT_RADIX; b++) {
+        next[b] = pos;
+        pos += count[b];
+        end[b] = pos;
+    }
+
+    //Permutation en place: chaque clé est échangée vers son seau jusqu'à remplir le seau courant
+    for(b = 0; b < SORT_RADIX; b++) {
+        while(next[b] < end[b]) {
+            uint16_t key = keys[next[b]];
+            size_t dest = key >> 8;
+
+            if(dest == b) {
+                next[b]++;
+            } else {
+                keys[next[b]] = keys[next[dest]];
+                keys[next[dest]++] = key;
+            }
+        }
+    }
+
+    //Chaque seau partage son octet fort: l'histogramme de l'octet faible suffit à le réécrire
+    for(b = 0; b < SORT_RADIX; b++) {
+        uint16_t *bucket = keys + end[b] - count[b];
+
+        if(count[b] < SORT_SMALL) {
+            insertion_sort_keys(bucket, count[b]);
+        } else {
+            size_t low[SORT_RADIX];
+            size_t l, r;
+
+            memset(low, 0, sizeof(low));
+            for(i = 0; i < count[b]; i++) low[bucket[i] & 0xFFU]++;
+            for(i = 0, l = 0; l < SORT_RADIX; l++) {
+                for(r = 0; r < low[l]; r++) bucket[i++] = (uint16_t)((b << 8) | l);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Indique si l'élément i se place après l'élément j dans le résultat de hf_topk
+ */
+static int topk_after(const uint16_t *a, size_t i, size_t j) {
+    uint16_t ki = order_key(a[i]);
+    uint16_t kj = order_key(a[j]);
+
+    return ki < kj || (ki == kj && i > j);
+}
+
+/**
+ * @brief Fait descendre idx[root] dans le tas (racine: élément placé le plus loin)
+ */
+static void topk_sift_down(const uint16_t *a, size_t *idx, size_t root, size_t m) {
+    size_t child;
+
+    while((child = 2 * root + 1) < m) {
+        size_t tmp;
+
+        if(child + 1 < m && topk_after(a, idx[child + 1], idx[child])) child++;
+        if(!topk_after(a, idx[child], idx[root])) break;
+
+        tmp = idx[root];
+        idx[root] = idx[child];
+        idx[child] = tmp;
+        root = child;
+    }
+}
+
+/**
+ * @brief Trie les indices retenus par valeur décroissante puis indice croissant (tri par tas)
+ */
+static void topk_sort(const uint16_t *a, size_t *idx, size_t m) {
+    size_t i;
+
+    for(i = m / 2; i > 0; i--) topk_sift_down(a, idx, i - 1, m);
+
+    for(i = m; i > 1; i--) {
+        size_t tmp = idx[0];
+        idx[0] = idx[i - 1];
+        idx[i - 1] = tmp;
+        topk_sift_down(a, idx, 0, i - 1);
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file hf_lib_sort.h
+ * @brief Tri, sélection et classification de tableaux de demi-flottants
+ *
+ * Le tri et la sélection suivent l'ordre total IEEE 754 (totalOrder):
+ * -NaN < -Inf < ... < -0 < +0 < ... < +Inf < +NaN. Chaque valeur est ramenée
+ * à une clé entière 16 bits non signée de même ordre, ce qui permet un tri
+ * par base (deux passes d'histogramme de 256 cases) au lieu de comparaisons.
+ *
+ * La classification en masse produit un masque de bits: le bit (i & 63) du
+ * mot mask[i >> 6] correspond à l'élément i, les bits au-delà de n du dernier
+ * mot sont nuls. Le tableau de masque contient (n + 63) / 64 mots.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_SORT_H
+#define HF_LIB_SORT_H
+
+#include <stddef.h>
+#include "hf_common.h"
+
+//Classes IEEE 754 (un bit par classe, dans l'ordre de l'instruction fclass RISC-V)
+#define HF_CLASS_NEG_INF        0x001U
+#define HF_CLASS_NEG_NORMAL     0x002U
+#define HF_CLASS_NEG_SUBNORMAL  0x004U
+#define HF_CLASS_NEG_ZERO       0x008U
+#define HF_CLASS_POS_ZERO       0x010U
+#define HF_CLASS_POS_SUBNORMAL  0x020U
+#define HF_CLASS_POS_NORMAL     0x040U
+#define HF_CLASS_POS_INF        0x080U
+#define HF_CLASS_SNAN           0x100U  //NaN signalant (bit de poids fort de la mantisse à 0)
+#define HF_CLASS_QNAN           0x200U  //NaN silencieux
+
+//Regroupements usuels
+#define HF_CLASS_NAN            (HF_CLASS_SNAN | HF_CLASS_QNAN)
+#define HF_CLASS_INF            (HF_CLASS_NEG_INF | HF_CLASS_POS_INF)
+#define HF_CLASS_ZERO           (HF_CLASS_NEG_ZERO | HF_CLASS_POS_ZERO)
+#define HF_CLASS_SUBNORMAL      (HF_CLASS_NEG_SUBNORMAL | HF_CLASS_POS_SUBNORMAL)
+#define HF_CLASS_NORMAL         (HF_CLASS_NEG_NORMAL | HF_CLASS_POS_NORMAL)
+#define HF_CLASS_FINITE         (HF_CLASS_ZERO | HF_CLASS_SUBNORMAL | HF_CLASS_NORMAL)
+
+//Classification
+HF_API unsigned int hf_classify(uint16_t hf);                                                   //une classe HF_CLASS_*
+HF_API void hf_classify_n(const uint16_t *in, unsigned int classes, uint64_t *mask, size_t n);  //bit = classe dans classes
+HF_API void hf_isnan_n(const uint16_t *in, uint64_t *mask, size_t n);
+
+//Tri croissant en place selon l'ordre total
+HF_API void hf_sort(uint16_t *a, size_t n);
+
+//Sélection (NaN ignorés, à égalité l'indice le plus petit l'emporte)
+HF_API size_t hf_argmax(const uint16_t *a, size_t n);                       //n si aucun élément non NaN
+HF_API size_t hf_topk(const uint16_t *a, size_t n, size_t k, size_t *idx);  //indices des k plus grands, décroissants
+
+#endif //HF_LIB_SORT_H
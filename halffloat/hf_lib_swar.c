@@ -0,0 +1,735 @@
+/**
+ * @file hf_lib_swar.c
+ * @brief Implémentation des opérations SWAR pour Half-Float
+ *
+ * Les voies sont traitées par arithmétique entière sans retenue entre voies:
+ * les tests portent sur les 15 bits sans signe de chaque voie (valeur absolue
+ * codée), dont le bit 15 libre recueille la retenue du test. Les macros SWAR_*
+ * décrivent chaque calcul une seule fois pour les deux largeurs (hf2, hf4),
+ * H désignant le masque des bits de signe de toutes les voies.
+ *
+ * L'ordre des valeurs est obtenu par la clé d'ordre total classique: bit de
+ * signe inversé pour les positifs, tous les bits inversés pour les négatifs,
+ * ce qui ramène la comparaison à une comparaison non signée par voie.
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include "hf_lib_swar.h"
+#include "hf_lib_arith.h"
+
+#define HF2_SIGN ((hf2)0x80008000U)                     //Bits de signe des 2 voies
+#define HF4_SIGN ((hf4)0x8000800080008000ULL)           //Bits de signe des 4 voies
+#define HF2_REP(c) ((hf2)(c) * 0x00010001U)             //Constante répliquée sur 2 voies
+#define HF4_REP(c) ((hf4)(c) * 0x0001000100010001ULL)   //Constante répliquée sur 4 voies
+
+//Seuil en valeur absolue codée: bit 15 de (a + SWAR_GE_K(c)) <=> a >= c (1 <= c <= 0x8000)
+#define SWAR_GE_K(c) (0x8000U - (c))
+
+//Étend un masque ne contenant que des bits de signe à des voies pleines (0xFFFF)
+#define SWAR_FULL(m) (((m) - ((m) >> 15)) | (m))
+
+//Bit de signe des voies non nulles de d
+#define SWAR_NONZERO(d, H) (((((d) & ~(H)) + ~(H)) | (d)) & (H))
+
+//Bit de signe des voies de a (15 bits) supérieures ou égales au seuil de k = REP(SWAR_GE_K(c))
+#define SWAR_GE(a, k, H) (((a) + (k)) & (H))
+
+//Bit de signe des voies où a < b (comparaison non signée sur 16 bits)
+#define SWAR_LT(a, b, H) (((~(a) & (b)) | (~((a) ^ (b)) & ~(((a) | (H)) - ((b) & ~(H))))) & (H))
+
+//Clé d'ordre total par voie (-0 juste avant +0)
+#define SWAR_KEY(x, H) ((x) ^ (SWAR_FULL((x) & (H)) | (H)))
+
+//Bit de signe des voies NaN (valeur absolue > 0x7C00)
+#define SWAR_NAN(x, H, REP) SWAR_GE((x) & ~(H), REP(SWAR_GE_K(HF_INFINITY_POS + 1U)), H)
+
+//Bit de signe des voies de valeur absolue nulle
+#define SWAR_ZERO(x, H) (~SWAR_NONZERO((x) & ~(H), H) & (H))
+
+//Déclaration des helpers statiques
+static hf2 hf2_order_key(hf2 x);
+static hf4 hf4_order_key(hf4 x);
+
+/**
+ * @brief Assemble deux demi-flottants en un hf2
+ *
+ * @param lane0 Voie 0 (bits de poids faible)
+ * @param lane1 Voie 1
+ * @return Le mot de deux voies
+ */
+hf2 hf2_pack(uint16_t lane0, uint16_t lane1) {
+    return (hf2)lane0 | ((hf2)lane1 << 16);
+}
+
+/**
+ * @brief Assemble quatre demi-flottants en un hf4
+ *
+ * @param lane0 Voie 0 (bits de poids faible)
+ * @param lane1 Voie 1
+ * @param lane2 Voie 2
+ * @param lane3 Voie 3
+ * @return Le mot de quatre voies
+ */
+hf4 hf4_pack(uint16_t lane0, uint16_t lane1, uint16_t lane2, uint16_t lane3) {
+    return (hf4)lane0 | ((hf4)lane1 << 16) | ((hf4)lane2 << 32) | ((hf4)lane3 << 48);
+}
+
+/**
+ * @brief Extrait une voie d'un hf2
+ *
+ * @param x Mot de deux voies
+ * @param lane Numéro de voie (0 ou 1)
+ * @return Le demi-flottant de la voie
+ */
+uint16_t hf2_lane(hf2 x, int lane) {
+    return (uint16_t)(x >> (16 * (lane & 1)));
+}
+
+/**
+ * @brief Extrait une voie d'un hf4
+ *
+ * @param x Mot de quatre voies
+ * @param lane Numéro de voie (0 à 3)
+ * @return Le demi-flottant de la voie
+ */
+uint16_t hf4_lane(hf4 x, int lane) {
+    return (uint16_t)(x >> (16 * (lane & 3)));
+}
+
+/**
+ * @brief Charge deux demi-flottants consécutifs (indépendant du boutisme)
+ *
+ * @param p Tableau source (p[0] dans la voie 0)
+ * @return Le mot de deux voies
+ */
+hf2 hf2_load(const uint16_t *p) {
+    return hf2_pack(p[0], p[1]);
+}
+
+/**
+ * @brief Charge quatre demi-flottants consécutifs (indépendant du boutisme)
+ *
+ * @param p Tableau source (p[0] dans la voie 0)
+ * @return Le mot de quatre voies
+ */
+hf4 hf4_load(const uint16_t *p) {
+    return hf4_pack(p[0], p[1], p[2], p[3]);
+}
+
+/**
+ * @brief Range les deux voies d'un hf2 dans un tableau
+ *
+ * @param p Tableau destination (voie 0 dans p[0])
+ * @param x Mot de deux voies
+ */
+void hf2_store(uint16_t *p, hf2 x) {
+    p[0] = (uint16_t)x;
+    p[1] = (uint16_t)(x >> 16);
+}
+
+/**
+ * @brief Range les quatre voies d'un hf4 dans un tableau
+ *
+ * @param p Tableau destination (voie 0 dans p[0])
+ * @param x Mot de quatre voies
+ */
+void hf4_store(uint16_t *p, hf4 x) {
+    p[0] = (uint16_t)x;
+    p[1] = (uint16_t)(x >> 16);
+    p[2] = (uint16_t)(x >> 32);
+    p[3] = (uint16_t)(x >> 48);
+}
+
+/**
+ * @brief Négation de chaque voie (inversion du bit de signe, NaN compris)
+ *
+ * @param x Mot de deux voies
+ * @return -x voie par voie
+ */
+hf2 hf2_neg(hf2 x) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return x ^ HF2_SIGN;
+}
+
+/**
+ * @brief Négation de chaque voie (inversion du bit de signe, NaN compris)
+ *
+ * @param x Mot de quatre voies
+ * @return -x voie par voie
+ */
+hf4 hf4_neg(hf4 x) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return x ^ HF4_SIGN;
+}
+
+/**
+ * @brief Valeur absolue de chaque voie (effacement du bit de signe)
+ *
+ * @param x Mot de deux voies
+ * @return |x| voie par voie
+ */
+hf2 hf2_abs(hf2 x) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return x & ~HF2_SIGN;
+}
+
+/**
+ * @brief Valeur absolue de chaque voie (effacement du bit de signe)
+ *
+ * @param x Mot de quatre voies
+ * @return |x| voie par voie
+ */
+hf4 hf4_abs(hf4 x) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return x & ~HF4_SIGN;
+}
+
+/**
+ * @brief Copie le signe de chaque voie de sign sur la voie de mag
+ *
+ * @param mag Mot fournissant les magnitudes
+ * @param sign Mot fournissant les signes
+ * @return Le mot composé voie par voie
+ */
+hf2 hf2_copysign(hf2 mag, hf2 sign) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return (mag & ~HF2_SIGN) | (sign & HF2_SIGN);
+}
+
+/**
+ * @brief Copie le signe de chaque voie de sign sur la voie de mag
+ *
+ * @param mag Mot fournissant les magnitudes
+ * @param sign Mot fournissant les signes
+ * @return Le mot composé voie par voie
+ */
+hf4 hf4_copysign(hf4 mag, hf4 sign) {
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return (mag & ~HF4_SIGN) | (sign & HF4_SIGN);
+}
+
+/**
+ * @brief Masque des voies NaN
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies NaN, 0 ailleurs
+ */
+hf2 hf2_isnan(hf2 x) {
+    hf2 m = SWAR_NAN(x, HF2_SIGN, HF2_REP);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies NaN
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies NaN, 0 ailleurs
+ */
+hf4 hf4_isnan(hf4 x) {
+    hf4 m = SWAR_NAN(x, HF4_SIGN, HF4_REP);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies infinies (de l'un ou l'autre signe)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies infinies, 0 ailleurs
+ */
+hf2 hf2_isinf(hf2 x) {
+    hf2 m = SWAR_ZERO(x ^ HF2_REP(HF_INFINITY_POS), HF2_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies infinies (de l'un ou l'autre signe)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies infinies, 0 ailleurs
+ */
+hf4 hf4_isinf(hf4 x) {
+    hf4 m = SWAR_ZERO(x ^ HF4_REP(HF_INFINITY_POS), HF4_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies finies (ni NaN ni infinies)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies finies, 0 ailleurs
+ */
+hf2 hf2_isfinite(hf2 x) {
+    hf2 m = ~SWAR_GE(x & ~HF2_SIGN, HF2_REP(SWAR_GE_K(HF_INFINITY_POS)), HF2_SIGN) & HF2_SIGN;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies finies (ni NaN ni infinies)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies finies, 0 ailleurs
+ */
+hf4 hf4_isfinite(hf4 x) {
+    hf4 m = ~SWAR_GE(x & ~HF4_SIGN, HF4_REP(SWAR_GE_K(HF_INFINITY_POS)), HF4_SIGN) & HF4_SIGN;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies nulles (+0 ou -0)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies nulles, 0 ailleurs
+ */
+hf2 hf2_iszero(hf2 x) {
+    hf2 m = SWAR_ZERO(x, HF2_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies nulles (+0 ou -0)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies nulles, 0 ailleurs
+ */
+hf4 hf4_iszero(hf4 x) {
+    hf4 m = SWAR_ZERO(x, HF4_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies sous-normales (non nulles)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies sous-normales, 0 ailleurs
+ */
+hf2 hf2_issubnormal(hf2 x) {
+    hf2 a = x & ~HF2_SIGN;
+    hf2 m = SWAR_NONZERO(a, HF2_SIGN) & ~SWAR_GE(a, HF2_REP(SWAR_GE_K(HF_MASK_MANT + 1U)), HF2_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies sous-normales (non nulles)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies sous-normales, 0 ailleurs
+ */
+hf4 hf4_issubnormal(hf4 x) {
+    hf4 a = x & ~HF4_SIGN;
+    hf4 m = SWAR_NONZERO(a, HF4_SIGN) & ~SWAR_GE(a, HF4_REP(SWAR_GE_K(HF_MASK_MANT + 1U)), HF4_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies normales (finies, non nulles, non sous-normales)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies normales, 0 ailleurs
+ */
+hf2 hf2_isnormal(hf2 x) {
+    hf2 a = x & ~HF2_SIGN;
+    hf2 m = SWAR_GE(a, HF2_REP(SWAR_GE_K(HF_MASK_MANT + 1U)), HF2_SIGN)
+            & ~SWAR_GE(a, HF2_REP(SWAR_GE_K(HF_INFINITY_POS)), HF2_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies normales (finies, non nulles, non sous-normales)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies normales, 0 ailleurs
+ */
+hf4 hf4_isnormal(hf4 x) {
+    hf4 a = x & ~HF4_SIGN;
+    hf4 m = SWAR_GE(a, HF4_REP(SWAR_GE_K(HF_MASK_MANT + 1U)), HF4_SIGN)
+            & ~SWAR_GE(a, HF4_REP(SWAR_GE_K(HF_INFINITY_POS)), HF4_SIGN);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies dont le bit de signe est positionné (-0 et NaN négatifs compris)
+ *
+ * @param x Mot de deux voies
+ * @return 0xFFFF dans les voies négatives, 0 ailleurs
+ */
+hf2 hf2_signbit(hf2 x) {
+    hf2 m = x & HF2_SIGN;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies dont le bit de signe est positionné (-0 et NaN négatifs compris)
+ *
+ * @param x Mot de quatre voies
+ * @return 0xFFFF dans les voies négatives, 0 ailleurs
+ */
+hf4 hf4_signbit(hf4 x) {
+    hf4 m = x & HF4_SIGN;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies égales (+0 == -0, NaN différent de tout)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return 0xFFFF dans les voies où x == y, 0 ailleurs
+ */
+hf2 hf2_eq(hf2 x, hf2 y) {
+    hf2 nan = SWAR_NAN(x, HF2_SIGN, HF2_REP) | SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 m = ~SWAR_NONZERO(hf2_order_key(x) ^ hf2_order_key(y), HF2_SIGN) & HF2_SIGN & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies égales (+0 == -0, NaN différent de tout)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return 0xFFFF dans les voies où x == y, 0 ailleurs
+ */
+hf4 hf4_eq(hf4 x, hf4 y) {
+    hf4 nan = SWAR_NAN(x, HF4_SIGN, HF4_REP) | SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 m = ~SWAR_NONZERO(hf4_order_key(x) ^ hf4_order_key(y), HF4_SIGN) & HF4_SIGN & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies où x < y (faux si l'une des voies est NaN)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return 0xFFFF dans les voies où x < y, 0 ailleurs
+ */
+hf2 hf2_lt(hf2 x, hf2 y) {
+    hf2 nan = SWAR_NAN(x, HF2_SIGN, HF2_REP) | SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 kx = hf2_order_key(x);
+    hf2 ky = hf2_order_key(y);
+    hf2 m = SWAR_LT(kx, ky, HF2_SIGN) & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies où x < y (faux si l'une des voies est NaN)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return 0xFFFF dans les voies où x < y, 0 ailleurs
+ */
+hf4 hf4_lt(hf4 x, hf4 y) {
+    hf4 nan = SWAR_NAN(x, HF4_SIGN, HF4_REP) | SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 kx = hf4_order_key(x);
+    hf4 ky = hf4_order_key(y);
+    hf4 m = SWAR_LT(kx, ky, HF4_SIGN) & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies où x <= y (faux si l'une des voies est NaN)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return 0xFFFF dans les voies où x <= y, 0 ailleurs
+ */
+hf2 hf2_le(hf2 x, hf2 y) {
+    hf2 nan = SWAR_NAN(x, HF2_SIGN, HF2_REP) | SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 kx = hf2_order_key(x);
+    hf2 ky = hf2_order_key(y);
+    hf2 m = ~SWAR_LT(ky, kx, HF2_SIGN) & HF2_SIGN & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Masque des voies où x <= y (faux si l'une des voies est NaN)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return 0xFFFF dans les voies où x <= y, 0 ailleurs
+ */
+hf4 hf4_le(hf4 x, hf4 y) {
+    hf4 nan = SWAR_NAN(x, HF4_SIGN, HF4_REP) | SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 kx = hf4_order_key(x);
+    hf4 ky = hf4_order_key(y);
+    hf4 m = ~SWAR_LT(ky, kx, HF4_SIGN) & HF4_SIGN & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return SWAR_FULL(m);
+}
+
+/**
+ * @brief Comparaison voie par voie avec les codes de hf_cmp
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return Par voie: -2 (NaN), -1 (x < y), 0 (x == y) ou 1 (x > y) sur 16 bits
+ */
+hf2 hf2_cmp(hf2 x, hf2 y) {
+    hf2 nan = SWAR_NAN(x, HF2_SIGN, HF2_REP) | SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 kx = hf2_order_key(x);
+    hf2 ky = hf2_order_key(y);
+    hf2 lt = SWAR_LT(kx, ky, HF2_SIGN) & ~nan;
+    hf2 gt = SWAR_LT(ky, kx, HF2_SIGN) & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return (SWAR_FULL(nan) & HF2_REP(0xFFFEU)) | SWAR_FULL(lt) | (gt >> 15);
+}
+
+/**
+ * @brief Comparaison voie par voie avec les codes de hf_cmp
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return Par voie: -2 (NaN), -1 (x < y), 0 (x == y) ou 1 (x > y) sur 16 bits
+ */
+hf4 hf4_cmp(hf4 x, hf4 y) {
+    hf4 nan = SWAR_NAN(x, HF4_SIGN, HF4_REP) | SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 kx = hf4_order_key(x);
+    hf4 ky = hf4_order_key(y);
+    hf4 lt = SWAR_LT(kx, ky, HF4_SIGN) & ~nan;
+    hf4 gt = SWAR_LT(ky, kx, HF4_SIGN) & ~nan;
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return (SWAR_FULL(nan) & HF4_REP(0xFFFEU)) | SWAR_FULL(lt) | (gt >> 15);
+}
+
+/**
+ * @brief Sélection voie par voie
+ *
+ * @param mask Masque de voies (0xFFFF ou 0 par voie)
+ * @param x Voies retenues là où le masque est vrai
+ * @param y Voies retenues ailleurs
+ * @return Le mot sélectionné
+ */
+hf2 hf2_select(hf2 mask, hf2 x, hf2 y) {
+    return (x & mask) | (y & ~mask);
+}
+
+/**
+ * @brief Sélection voie par voie
+ *
+ * @param mask Masque de voies (0xFFFF ou 0 par voie)
+ * @param x Voies retenues là où le masque est vrai
+ * @param y Voies retenues ailleurs
+ * @return Le mot sélectionné
+ */
+hf4 hf4_select(hf4 mask, hf4 x, hf4 y) {
+    return (x & mask) | (y & ~mask);
+}
+
+/**
+ * @brief Minimum voie par voie (mêmes règles que hf_min)
+ *
+ * Une voie NaN cède la place à l'autre opérande, deux NaN donnent HF_NAN et
+ * min(+0,-0) = -0: la clé d'ordre total brute place -0 avant +0.
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return Le minimum voie par voie
+ */
+hf2 hf2_min(hf2 x, hf2 y) {
+    hf2 nx = SWAR_NAN(x, HF2_SIGN, HF2_REP);
+    hf2 ny = SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 gt = SWAR_LT(SWAR_KEY(y, HF2_SIGN), SWAR_KEY(x, HF2_SIGN), HF2_SIGN);
+    hf2 result = hf2_select(SWAR_FULL(gt), y, x);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    result = hf2_select(SWAR_FULL(ny & ~nx), x, result);
+    result = hf2_select(SWAR_FULL(nx & ~ny), y, result);
+    result = hf2_select(SWAR_FULL(nx & ny), HF2_REP(HF_NAN), result);
+
+    return result;
+}
+
+/**
+ * @brief Minimum voie par voie (mêmes règles que hf_min)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return Le minimum voie par voie
+ */
+hf4 hf4_min(hf4 x, hf4 y) {
+    hf4 nx = SWAR_NAN(x, HF4_SIGN, HF4_REP);
+    hf4 ny = SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 gt = SWAR_LT(SWAR_KEY(y, HF4_SIGN), SWAR_KEY(x, HF4_SIGN), HF4_SIGN);
+    hf4 result = hf4_select(SWAR_FULL(gt), y, x);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    result = hf4_select(SWAR_FULL(ny & ~nx), x, result);
+    result = hf4_select(SWAR_FULL(nx & ~ny), y, result);
+    result = hf4_select(SWAR_FULL(nx & ny), HF4_REP(HF_NAN), result);
+
+    return result;
+}
+
+/**
+ * @brief Maximum voie par voie (mêmes règles que hf_max)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return Le maximum voie par voie
+ */
+hf2 hf2_max(hf2 x, hf2 y) {
+    hf2 nx = SWAR_NAN(x, HF2_SIGN, HF2_REP);
+    hf2 ny = SWAR_NAN(y, HF2_SIGN, HF2_REP);
+    hf2 lt = SWAR_LT(SWAR_KEY(x, HF2_SIGN), SWAR_KEY(y, HF2_SIGN), HF2_SIGN);
+    hf2 result = hf2_select(SWAR_FULL(lt), y, x);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    result = hf2_select(SWAR_FULL(ny & ~nx), x, result);
+    result = hf2_select(SWAR_FULL(nx & ~ny), y, result);
+    result = hf2_select(SWAR_FULL(nx & ny), HF2_REP(HF_NAN), result);
+
+    return result;
+}
+
+/**
+ * @brief Maximum voie par voie (mêmes règles que hf_max)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return Le maximum voie par voie
+ */
+hf4 hf4_max(hf4 x, hf4 y) {
+    hf4 nx = SWAR_NAN(x, HF4_SIGN, HF4_REP);
+    hf4 ny = SWAR_NAN(y, HF4_SIGN, HF4_REP);
+    hf4 lt = SWAR_LT(SWAR_KEY(x, HF4_SIGN), SWAR_KEY(y, HF4_SIGN), HF4_SIGN);
+    hf4 result = hf4_select(SWAR_FULL(lt), y, x);
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    result = hf4_select(SWAR_FULL(ny & ~nx), x, result);
+    result = hf4_select(SWAR_FULL(nx & ~ny), y, result);
+    result = hf4_select(SWAR_FULL(nx & ny), HF4_REP(HF_NAN), result);
+
+    return result;
+}
+
+/**
+ * @brief Addition voie par voie (résultats identiques à hf_add)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return x + y voie par voie
+ */
+hf2 hf2_add(hf2 x, hf2 y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return hf2_pack(hf_add_r(hf2_lane(x, 0), hf2_lane(y, 0), mode),
+                    hf_add_r(hf2_lane(x, 1), hf2_lane(y, 1), mode));
+}
+
+/**
+ * @brief Addition voie par voie (résultats identiques à hf_add)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return x + y voie par voie
+ */
+hf4 hf4_add(hf4 x, hf4 y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return hf4_pack(hf_add_r(hf4_lane(x, 0), hf4_lane(y, 0), mode),
+                    hf_add_r(hf4_lane(x, 1), hf4_lane(y, 1), mode),
+                    hf_add_r(hf4_lane(x, 2), hf4_lane(y, 2), mode),
+                    hf_add_r(hf4_lane(x, 3), hf4_lane(y, 3), mode));
+}
+
+/**
+ * @brief Multiplication voie par voie (résultats identiques à hf_mul)
+ *
+ * @param x Premier mot de deux voies
+ * @param y Second mot de deux voies
+ * @return x * y voie par voie
+ */
+hf2 hf2_mul(hf2 x, hf2 y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 2);
+    return hf2_pack(hf_mul_r(hf2_lane(x, 0), hf2_lane(y, 0), mode),
+                    hf_mul_r(hf2_lane(x, 1), hf2_lane(y, 1), mode));
+}
+
+/**
+ * @brief Multiplication voie par voie (résultats identiques à hf_mul)
+ *
+ * @param x Premier mot de quatre voies
+ * @param y Second mot de quatre voies
+ * @return x * y voie par voie
+ */
+hf4 hf4_mul(hf4 x, hf4 y) {
+    hf_rounding_mode mode = hf_get_rounding_mode();
+
+    HF_PROFILE_CALLS(HF_PROF_SWAR, 4);
+    return hf4_pack(hf_mul_r(hf4_lane(x, 0), hf4_lane(y, 0), mode),
+                    hf_mul_r(hf4_lane(x, 1), hf4_lane(y, 1), mode),
+                    hf_mul_r(hf4_lane(x, 2), hf4_lane(y, 2), mode),
+                    hf_mul_r(hf4_lane(x, 3), hf4_lane(y, 3), mode));
+}
+
+/**
+ * @brief Clé d'ordre par voie avec -0 ramené à +0 (égalité IEEE des zéros)
+ *
+ * @param x Mot de deux voies
+ * @return Clés comparables en non signé voie par voie
+ */
+static hf2 hf2_order_key(hf2 x) {
+    hf2 z = SWAR_ZERO(x, HF2_SIGN);
+    hf2 v = x & ~SWAR_FULL(z);
+
+    return SWAR_KEY(v, HF2_SIGN);
+}
+
+/**
+ * @brief Clé d'ordre par voie avec -0 ramené à +0 (égalité IEEE des zéros)
+ *
+ * @param x Mot de quatre voies
+ * @return Clés comparables en non signé voie par voie
+ */
+static hf4 hf4_order_key(hf4 x) {
+    hf4 z = SWAR_ZERO(x, HF4_SIGN);
+    hf4 v = x & ~SWAR_FULL(z);
+
+    return SWAR_KEY(v, HF4_SIGN);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file hf_lib_swar.h
+ * @brief Opérations SWAR (plusieurs demi-flottants par registre) pour Half-Float
+ *
+ * Deux demi-flottants sont rangés dans un uint32_t (type hf2) et quatre dans
+ * un uint64_t (type hf4), la voie 0 occupant les 16 bits de poids faible.
+ * Signe, valeur absolue, classification, comparaisons et min/max sont
+ * calculés sur toutes les voies à la fois par arithmétique entière, ce qui
+ * double ou quadruple le débit sur les processeurs sans unité vectorielle.
+ *
+ * Les prédicats renvoient un masque de voies: 0xFFFF dans chaque voie vraie,
+ * 0 sinon, utilisable directement avec hf2_select/hf4_select.
+ * Chaque voie donne exactement le même résultat que la fonction scalaire
+ * correspondante (hf_neg, hf_cmp, hf_min, hf_add...).
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#ifndef HF_LIB_SWAR_H
+#define HF_LIB_SWAR_H
+
+#include "hf_common.h"
+
+typedef uint32_t hf2;                       //2 demi-flottants (voie 0 = bits 0-15)
+typedef uint64_t hf4;                       //4 demi-flottants (voie 0 = bits 0-15)
+
+//Construction et accès aux voies
+HF_API hf2 hf2_pack(uint16_t lane0, uint16_t lane1);
+HF_API hf4 hf4_pack(uint16_t lane0, uint16_t lane1, uint16_t lane2, uint16_t lane3);
+HF_API uint16_t hf2_lane(hf2 x, int lane);
+HF_API uint16_t hf4_lane(hf4 x, int lane);
+HF_API hf2 hf2_load(const uint16_t *p);     //p[0] dans la voie 0
+HF_API hf4 hf4_load(const uint16_t *p);
+HF_API void hf2_store(uint16_t *p, hf2 x);
+HF_API void hf4_store(uint16_t *p, hf4 x);
+
+//Opérations sur le signe
+HF_API hf2 hf2_neg(hf2 x);
+HF_API hf4 hf4_neg(hf4 x);
+HF_API hf2 hf2_abs(hf2 x);
+HF_API hf4 hf4_abs(hf4 x);
+HF_API hf2 hf2_copysign(hf2 mag, hf2 sign);
+HF_API hf4 hf4_copysign(hf4 mag, hf4 sign);
+
+//Classification (masques de voies)
+HF_API hf2 hf2_isnan(hf2 x);
+HF_API hf4 hf4_isnan(hf4 x);
+HF_API hf2 hf2_isinf(hf2 x);
+HF_API hf4 hf4_isinf(hf4 x);
+HF_API hf2 hf2_isfinite(hf2 x);
+HF_API hf4 hf4_isfinite(hf4 x);
+HF_API hf2 hf2_iszero(hf2 x);
+HF_API hf4 hf4_iszero(hf4 x);
+HF_API hf2 hf2_issubnormal(hf2 x);
+HF_API hf4 hf4_issubnormal(hf4 x);
+HF_API hf2 hf2_isnormal(hf2 x);
+HF_API hf4 hf4_isnormal(hf4 x);
+HF_API hf2 hf2_signbit(hf2 x);
+HF_API hf4 hf4_signbit(hf4 x);
+
+//Comparaisons (masques de voies, faux si une voie est NaN)
+HF_API hf2 hf2_eq(hf2 x, hf2 y);
+HF_API hf4 hf4_eq(hf4 x, hf4 y);
+HF_API hf2 hf2_lt(hf2 x, hf2 y);
+HF_API hf4 hf4_lt(hf4 x, hf4 y);
+HF_API hf2 hf2_le(hf2 x, hf2 y);
+HF_API hf4 hf4_le(hf4 x, hf4 y);
+
+//Code de hf_cmp par voie sur 16 bits en complément à deux (-2, -1, 0, 1)
+HF_API hf2 hf2_cmp(hf2 x, hf2 y);
+HF_API hf4 hf4_cmp(hf4 x, hf4 y);
+
+//Sélection et min/max
+HF_API hf2 hf2_select(hf2 mask, hf2 x, hf2 y);  //x dans les voies vraies, y ailleurs
+HF_API hf4 hf4_select(hf4 mask, hf4 x, hf4 y);
+HF_API hf2 hf2_min(hf2 x, hf2 y);
+HF_API hf4 hf4_min(hf4 x, hf4 y);
+HF_API hf2 hf2_max(hf2 x, hf2 y);
+HF_API hf4 hf4_max(hf4 x, hf4 y);
+
+//Arithmétique voie par voie (mode d'arrondi du thread lu une seule fois)
+HF_API hf2 hf2_add(hf2 x, hf2 y);
+HF_API hf4 hf4_add(hf4 x, hf4 y);
+HF_API hf2 hf2_mul(hf2 x, hf2 y);
+HF_API hf4 hf4_mul(hf4 x, hf4 y);
+
+#endif //HF_LIB_SWAR_H
@@ -18,8 +18,12 @@
 
 //Déclarations des fonctions static (définies en fin de fichier)
 static uint16_t sinus_shiftable(uint16_t hf, uint16_t shift);
+static int sinus_reduce(uint16_t hfangle, uint32_t *phase, uint16_t *special);
+static uint16_t sinus_from_phase(uint32_t phase);
 static uint16_t asinus_shiftable(uint16_t hf, uint32_t shift);
 static void cosh_sinh_helper(int32_t x_abs, half_float *result, int32_t *exp_pos, int32_t *exp_neg);
+static int32_t hyper_fixed_abs(const half_float *input);
+static void hyper_halve(half_float *result, int32_t value);
 
 /**
  * @brief Calcule le sinus d'un angle exprimé en demi-précision.
@@ -36,6 +40,7 @@ static void cosh_sinh_helper(int32_t x_abs, half_float *result, int32_t *exp_pos
  * @see sinus_shiftable
  */
 uint16_t hf_sin(uint16_t hfangle) {
+    HF_PROFILE_FN(HF_PROF_SIN, hfangle);
     return sinus_shiftable(hfangle, 0);
 }
 
@@ -56,9 +61,58 @@ uint16_t hf_sin(uint16_t hfangle) {
  */
 uint16_t hf_cos(uint16_t hfangle) {
     const uint16_t COS_SHIFT = 16384;
+
+    HF_PROFILE_FN(HF_PROF_COS, hfangle);
     return sinus_shiftable(hfangle, COS_SHIFT);
 }
 
+/**
+ * @brief Calcule simultanément le sinus et le cosinus d'un angle
+ *
+ * La réduction de l'angle n'est effectuée qu'une fois, puis les deux valeurs
+ * sont lues dans sin_table (le cosinus avec un décalage de phase de pi/2).
+ * Résultats identiques bit à bit à hf_sin() et hf_cos().
+ *
+ * @param hfangle L'angle en radians, représenté en format demi-précision.
+ * @param s Pointeur recevant sin(hfangle)
+ * @param c Pointeur recevant cos(hfangle)
+ */
+void hf_sincos(uint16_t hfangle, uint16_t *s, uint16_t *c) {
+    const uint16_t COS_SHIFT = 16384;
+    uint32_t phase;
+    uint16_t special;
+
+    HF_PROFILE_FN(HF_PROF_SINCOS, hfangle);
+
+    if(sinus_reduce(hfangle, &phase, &special)) {
+        *s = sinus_from_phase(phase);
+        *c = sinus_from_phase(phase + COS_SHIFT);
+    } else {
+        *s = special;
+        *c = special;
+    }
+}
+
+/**
+ * @brief Calcule le sinus et le cosinus d'un tableau d'angles
+ *
+ * Calcule s[i] = sin(in[i]) et c[i] = cos(in[i]), identiques bit à bit à hf_sincos().
+ *
+ * @param in Tableau des angles en radians
+ * @param s Tableau des sinus (peut être confondu avec in)
+ * @param c Tableau des cosinus
+ * @param n Nombre d'éléments
+ */
+void hf_sincos_n(const uint16_t *in, uint16_t *s, uint16_t *c, size_t n) {
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_MATH_N, n);
+    for(i = 0; i < n; i++) {
+        uint16_t x = in[i];
+        hf_sincos(x, &s[i], &c[i]);
+    }
+}
+
 /**
  * @brief Calcule la tangente d'un angle en demi-précision.
  *
@@ -76,6 +130,8 @@ uint16_t hf_tan(uint16_t hfangle) {
     half_float result;
     half_float angle_hf = decompose_half(hfangle);
 
+    HF_PROFILE_FN(HF_PROF_TAN, hfangle);
+
     result.sign = HF_ZERO_POS;
     result.mant = 0;
     result.exp = 0;
@@ -93,6 +149,7 @@ uint16_t hf_tan(uint16_t hfangle) {
     } else {
         const int32_t SWITCH_NORM_75DEG = 27306;  //65536 * (5pi/12) / pi
         const uint16_t *table_ptr = tan_table_low;
+        const uint16_t *slopes_ptr = TAN_SLOPES_LOW;
         int32_t qshift = 2;
         int32_t norm, input_norm, range_norm, frac, value;
         int interp_index;
@@ -113,16 +170,17 @@ uint16_t hf_tan(uint16_t hfangle) {
             range_norm = 32768 - SWITCH_NORM_75DEG;
             qshift = 9; //Q6->Q15
             table_ptr = tan_table_high;
+            slopes_ptr = TAN_SLOPES_HIGH;
         }
         
-        //Interpolation via table_interpolate sur la table tan
+        //Interpolation (ordre TAN_INTERP) sur la table tan
         interp_index = (input_norm * TAN_DUAL_TABLE_SIZE) / range_norm;
         frac = ((input_norm * TAN_DUAL_TABLE_SIZE) % range_norm << 7) / range_norm;
 
         //la table contient TAN_DUAL_TABLE_SIZE+1 entrées pour permettre
         //un accès sûr à idx1 lors de l'interpolation
         //on passe donc la longueur complète pour que table_interpolate clamp correctement
-        value = table_interpolate(table_ptr, TAN_DUAL_TABLE_SIZE + 1, (interp_index << 7) | frac, 7);
+        value = TABLE_INTERPOLATE(TAN_INTERP, table_ptr, slopes_ptr, TAN_DUAL_TABLE_SIZE + 1, (interp_index << 7) | frac, 7);
         value <<= qshift;
         result.mant = value;
         
@@ -156,6 +214,7 @@ uint16_t hf_tan(uint16_t hfangle) {
  * @return L'angle en radians (asin: [-pi/2, pi/2], acos: [0, pi])
  */
 uint16_t hf_asin(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_ASIN, hf);
     return asinus_shiftable(hf, 0UL);
 }
 
@@ -166,6 +225,7 @@ uint16_t hf_asin(uint16_t hf) {
  * @return L'angle en radians dans [0, pi]
  */
 uint16_t hf_acos(uint16_t hf) {
+    HF_PROFILE_FN(HF_PROF_ACOS, hf);
     return asinus_shiftable(hf, ACOS_SHIFT);
 }
 
@@ -182,6 +242,8 @@ uint16_t hf_atan(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_ATAN, hf);
+
     result.sign = input.sign;
     result.exp = 0;
     result.mant = 0;
@@ -223,8 +285,8 @@ uint16_t hf_atan(uint16_t hf) {
             if(ratio > (1 << 15)) ratio = (1 << 15);
         }
 
-        //Interpolation via table_interpolate sur atan_table
-        value = table_interpolate(atan_table, ATAN_TABLE_SIZE, ratio, ATAN_INDEX_SHIFT);
+        //atan du rapport (atan_table interpolée ou polynôme selon le moteur)
+        value = atan_unit_q15(ratio);
 
         //Complément si |x|>1 : angle = pi/2 - atan(1/|x|)
         if(use_complement) value = PI_1_2_Q15 - value;
@@ -242,7 +304,10 @@ uint16_t hf_atan(uint16_t hf) {
  * @brief Calcule l'arc tangente à deux arguments (atan2)
  * 
  * Calcule l'angle θ tel que tan(θ) = y/x, en utilisant les signes
- * pour déterminer le quadrant correct.
+ * pour déterminer le quadrant correct. L'angle est formé en Q15 absolu à
+ * partir de atan_unit_q15() (au plus 2 ULP), sauf pour |y/x| < 2^-4 avec
+ * x > 0 où r - r^3/3 est calculé en relatif (petits angles à une demi-ULP
+ * près). atan2(+/-0, -0) = +/-pi.
  * 
  * @param hfy Coordonnée Y
  * @param hfx Coordonnée X
@@ -253,6 +318,8 @@ uint16_t hf_atan2(uint16_t hfy, uint16_t hfx) {
     half_float inputy = decompose_half(hfy);
     half_float inputx = decompose_half(hfx);
     
+    HF_PROFILE_FN2(HF_PROF_ATAN2, hfy, hfx);
+
     result.sign = inputy.sign;
     result.exp = 0;
     result.mant = 0;
@@ -275,29 +342,56 @@ uint16_t hf_atan2(uint16_t hfy, uint16_t hfx) {
         //inputx positif -> 0
         normalize_and_round(&result);
     }
-    //Calcul normal (inclut atan2(0,0) qui retourne 0)
-    else if(!(is_zero(&inputy) && is_zero(&inputx))) {
+    //atan2(+/-0, +/-0): +/-0 pour x = +0, +/-pi pour x = -0
+    else if(is_zero(&inputy) && is_zero(&inputx)) {
+        if(inputx.sign) {
+            result.mant = PI_Q15;
+            normalize_and_round(&result);
+        }
+    }
+    //Calcul normal
+    else {
         half_float *numerator = &inputy;
         half_float *denominator = &inputx;
-        int32_t exp_diff = inputy.exp - inputx.exp;
-        int use_complement = (exp_diff > 0 || (exp_diff == 0 && inputy.mant > inputx.mant));
-        int32_t ratio;
-        
+        int32_t exp_diff;
+        int use_complement;
+        int shift;
+
+        //Mantisses normalisées: le rapport garde toute sa précision pour les sous-normaux
+        if(!is_zero(&inputy)) normalize_denormalized_mantissa(&inputy);
+        if(!is_zero(&inputx)) normalize_denormalized_mantissa(&inputx);
+        exp_diff = inputy.exp - inputx.exp;
+        use_complement = is_zero(&inputx) || (!is_zero(&inputy) && (exp_diff > 0 || (exp_diff == 0 && inputy.mant > inputx.mant)));
+
         if(use_complement) {
             exp_diff = -exp_diff;
             numerator = &inputx;
             denominator = &inputy;
         }
-        
-        //Calcul du ratio en Q15
-        ratio = (int32_t)(((int64_t)numerator->mant << (Q15_SHIFT + exp_diff)) / denominator->mant);
-        ratio = (ratio < 0) ? 0 : ((ratio > Q15_ONE) ? Q15_ONE : ratio);
-        
-        //Interpolation via table_interpolate sur atan_table
-        result.mant = table_interpolate(atan_table, ATAN_TABLE_SIZE, ratio, ATAN_INDEX_SHIFT);
-        if(use_complement) result.mant = PI_1_2_Q15 - result.mant;
-        if(inputx.sign) result.mant = PI_Q15 - result.mant;
-        
+
+        if(!use_complement && !inputx.sign && exp_diff < -4 && !is_zero(&inputy)) {
+            //Petit angle (|y/x| < 2^-4, x > 0): r - r^3/3 (reste sous 2^-18 en relatif), au lieu d'un angle Q15 absolu
+            uint64_t q = ((uint64_t)inputy.mant << 30) / (uint64_t)inputx.mant;    //r = q 2^(exp_diff - 30)
+            uint64_t square = (q * q) >> 30;                                        //r^2 = square 2^(2 exp_diff - 30)
+
+            shift = 30 - 2 * exp_diff;
+            result.mant = (int32_t)((q - (shift < 64 ? q * square / 3 >> shift : 0)) | 1U);
+            result.exp = exp_diff - 15;
+        } else {
+            int32_t ratio;
+
+            //Calcul du ratio en Q15 (nul si le numérateur est sous 2^-16 fois le dénominateur)
+            shift = Q15_SHIFT + exp_diff;
+            ratio = shift >= 0 ? (int32_t)(((int64_t)numerator->mant << shift) / denominator->mant)
+                  : (shift > -16 ? (int32_t)((numerator->mant >> -shift) / denominator->mant) : 0);
+            ratio = (ratio < 0) ? 0 : ((ratio > Q15_ONE) ? Q15_ONE : ratio);
+
+            //atan du rapport (atan_table interpolée ou polynôme selon le moteur)
+            result.mant = atan_unit_q15(ratio);
+            if(use_complement) result.mant = PI_1_2_Q15 - result.mant;
+            if(inputx.sign) result.mant = PI_Q15 - result.mant;
+        }
+
         normalize_and_round(&result);
     }
     
@@ -320,6 +414,8 @@ uint16_t hf_sinh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_SINH, hf);
+
     //Initialisation optimisée pour les cas spéciaux
     result.sign = input.sign;
     result.exp = HF_EXP_FULL;
@@ -336,26 +432,11 @@ uint16_t hf_sinh(uint16_t hf) {
         result = input;
     } else if(!is_infinity(&input)) {
         //Calcul via table exp : sinh(x) = sign(x) * (e^|x| - e^(-|x|)) / 2
-        int32_t x_abs, exp_pos, exp_neg, diff;
+        int32_t exp_pos, exp_neg;
 
-        //Préparer |x| en format fixe
-        x_abs = input.mant;
-        x_abs = (input.exp >= 0) ? (x_abs << input.exp) : (x_abs >> -input.exp);
-        if(x_abs < 0) x_abs = -x_abs;
-        
-        //Calculer e^|x| et e^(-|x|) via helper
-        cosh_sinh_helper(x_abs, &result, &exp_pos, &exp_neg);
-        
-        //Soustraire: e^x - e^(-x)
-        diff = exp_pos - exp_neg;
-        result.mant = diff >> 1;  //Diviser par 2 directement
-    
-        if(result.mant == 0 && diff != 0) {
-            result.exp--;
-            result.mant = diff >> 1;
-        }
-        
-        normalize_and_round(&result);
+        //Calculer e^|x| et e^(-|x|) via helper, puis (e^x - e^(-x)) / 2
+        cosh_sinh_helper(hyper_fixed_abs(&input), &result, &exp_pos, &exp_neg);
+        hyper_halve(&result, exp_pos - exp_neg);
     }
 
     return compose_half(&result);
@@ -378,6 +459,8 @@ uint16_t hf_cosh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_COSH, hf);
+
     //Initialisation optimisée pour les cas spéciaux
     result.sign = HF_ZERO_POS;  //cosh est toujours positif
     result.exp = HF_EXP_FULL;
@@ -389,31 +472,80 @@ uint16_t hf_cosh(uint16_t hf) {
         result.mant = 1;
     } else if(!is_infinity(&input)) {
         //Calcul via table exp : cosh(x) = (e^|x| + e^(-|x|)) / 2
-        int32_t x_abs, exp_pos, exp_neg, sum;
+        int32_t exp_pos, exp_neg;
 
-        //Préparer |x| en format fixe
-        x_abs = input.mant;
-        x_abs = (input.exp >= 0) ? (x_abs << input.exp) : (x_abs >> -input.exp);
-        if(x_abs < 0) x_abs = -x_abs;
-        
-        //Calculer e^|x| et e^(-|x|) via helper
-        cosh_sinh_helper(x_abs, &result, &exp_pos, &exp_neg);
-        
-        //Additionner: e^|x| + e^(-|x|)
-        sum = exp_pos + exp_neg;
-        result.mant = sum >> 1;  //Diviser par 2 directement
-        
-        if(result.mant == 0 && sum != 0) {
-            result.exp--;
-            result.mant = sum >> 1;
-        }
-        
-        normalize_and_round(&result);
+        //Calculer e^|x| et e^(-|x|) via helper, puis (e^|x| + e^(-|x|)) / 2
+        cosh_sinh_helper(hyper_fixed_abs(&input), &result, &exp_pos, &exp_neg);
+        hyper_halve(&result, exp_pos + exp_neg);
     }
 
     return compose_half(&result);
 }
 
+/**
+ * @brief Calcule simultanément sinh(x) et cosh(x)
+ *
+ * e^|x| (exp_table) et e^(-|x|) ne sont calculés qu'une fois, puis combinés
+ * en différence et en somme. Résultats identiques bit à bit à hf_sinh() et hf_cosh().
+ *
+ * @param hf Demi-flottant d'entrée (x)
+ * @param sh Pointeur recevant sinh(x)
+ * @param ch Pointeur recevant cosh(x)
+ */
+void hf_sinhcosh(uint16_t hf, uint16_t *sh, uint16_t *ch) {
+    half_float sinh_res, cosh_res;
+    half_float input = decompose_half(hf);
+
+    HF_PROFILE_FN(HF_PROF_SINHCOSH, hf);
+
+    //Initialisation pour les cas spéciaux (cosh est toujours positif)
+    sinh_res.sign = input.sign;
+    sinh_res.exp = HF_EXP_FULL;
+    sinh_res.mant = 0;
+    cosh_res.sign = HF_ZERO_POS;
+    cosh_res.exp = HF_EXP_FULL;
+    cosh_res.mant = 0;
+
+    if(is_nan(&input)) {
+        sinh_res.mant = 1;
+        cosh_res.mant = 1;
+    } else if(!is_infinity(&input)) {
+        int32_t exp_pos, exp_neg;
+
+        //Calcul commun de e^|x| et e^(-|x|), exposant partagé par les deux résultats
+        cosh_sinh_helper(hyper_fixed_abs(&input), &cosh_res, &exp_pos, &exp_neg);
+        sinh_res.exp = cosh_res.exp;
+
+        hyper_halve(&cosh_res, exp_pos + exp_neg);
+        //sinh(x) ~= x pour les subnormaux: renvoyer l'entrée comme hf_sinh()
+        if(is_subnormal(&input)) sinh_res = input;
+        else hyper_halve(&sinh_res, exp_pos - exp_neg);
+    }
+
+    *sh = compose_half(&sinh_res);
+    *ch = compose_half(&cosh_res);
+}
+
+/**
+ * @brief Calcule sinh et cosh d'un tableau de demi-flottants
+ *
+ * Calcule sh[i] = sinh(in[i]) et ch[i] = cosh(in[i]), identiques bit à bit à hf_sinhcosh().
+ *
+ * @param in Tableau d'entrée
+ * @param sh Tableau des sinus hyperboliques (peut être confondu avec in)
+ * @param ch Tableau des cosinus hyperboliques
+ * @param n Nombre d'éléments
+ */
+void hf_sinhcosh_n(const uint16_t *in, uint16_t *sh, uint16_t *ch, size_t n) {
+    size_t i;
+
+    HF_PROFILE_CALLS(HF_PROF_MATH_N, n);
+    for(i = 0; i < n; i++) {
+        uint16_t x = in[i];
+        hf_sinhcosh(x, &sh[i], &ch[i]);
+    }
+}
+
 /**
  * @brief Calcule la tangente hyperbolique d'un demi-flottant
  *
@@ -428,6 +560,8 @@ uint16_t hf_tanh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_TANH, hf);
+
     //Gestion des cas spéciaux en début de fonction
     result.sign = input.sign;
     result.exp = HF_EXP_FULL;
@@ -493,6 +627,8 @@ uint16_t hf_asinh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_ASINH, hf);
+
     result.sign = input.sign;
     result.exp = 0;
     result.mant = 0;
@@ -537,6 +673,8 @@ uint16_t hf_acosh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_ACOSH, hf);
+
     result.sign = HF_ZERO_POS;
     result.exp = 0;
     result.mant = 0;
@@ -592,6 +730,8 @@ uint16_t hf_atanh(uint16_t hf) {
     half_float result;
     half_float input = decompose_half(hf);
 
+    HF_PROFILE_FN(HF_PROF_ATANH, hf);
+
     result.sign = input.sign;
     result.exp = 0;
     result.mant = 0;
@@ -649,57 +789,84 @@ uint16_t hf_atanh(uint16_t hf) {
  * @return Le résultat du sinus/cosinus
  */
 static uint16_t sinus_shiftable(uint16_t hfangle, uint16_t shift) {
-    half_float result;
+    uint32_t phase;
+    uint16_t result;
+
+    if(sinus_reduce(hfangle, &phase, &result)) result = sinus_from_phase(phase + shift);
+
+    return result;
+}
+
+/**
+ * @brief Réduit un angle en phase fixe sur 16 bits (un tour = 65536)
+ *
+ * Étape commune à sin, cos et sincos: la phase obtenue sert pour tous
+ * les décalages (pi/2 pour le cosinus).
+ *
+ * @param hfangle L'angle en radians, en demi-précision
+ * @param phase Phase réduite (non masquée, avant application du décalage)
+ * @param special NaN à retourner si l'angle est NaN ou infini
+ * @return 1 si phase est valide, 0 si special doit être retourné
+ */
+static int sinus_reduce(uint16_t hfangle, uint32_t *phase, uint16_t *special) {
     half_float angle_hf = decompose_half(hfangle);
-    
-    //Initialisation par défaut: calcul trigonométrique normal
-    result.sign = HF_ZERO_POS;
-    result.exp = 0;
-    result.mant = 1;
-    
-    //Gestion unifiée des cas spéciaux
-    if(is_nan(&angle_hf)) {
-        //Propager le signe original pour les NaN
-        result.sign = angle_hf.sign;
-        result.exp = HF_EXP_FULL;
-    } else if(is_infinity(&angle_hf)) {
-        //Pour les infinis, retourner NaN négatif selon la convention
-        result.sign = HF_ZERO_NEG;
+    int valid = 0;
+
+    if(is_nan(&angle_hf) || is_infinity(&angle_hf)) {
+        //NaN: propager le signe original; infini: NaN négatif selon la convention
+        half_float result;
+        result.sign = is_nan(&angle_hf) ? angle_hf.sign : HF_ZERO_NEG;
         result.exp = HF_EXP_FULL;
+        result.mant = 1;
+        *special = compose_half(&result);
     } else {
-        //Calcul trigonométrique par table et interpolation
-        int32_t norm = angle_hf.mant;
-        uint32_t idx_q4;
-
         //Normalisation de la mantisse pour obtenir une représentation fixe de l'angle
+        int32_t norm = angle_hf.mant;
         norm = angle_hf.exp >= 0 ? norm << angle_hf.exp : norm >> -angle_hf.exp;
 
-        //Réduction de l'angle à l'intervalle [0, 65535] et application du décalage
+        //Réduction de l'angle à l'intervalle [0, 65535], symétrie pour les angles négatifs
         norm = (int32_t)reduce_radian_uword((uint32_t)norm, 0);
         if(angle_hf.sign) norm = 65536 - norm;
-        norm = (norm + shift) & 0xffff;
-        
-        //Interpolation via table_interpolate sur sin_table
-        //Construction d'un index Q4 monotone dans le premier quadrant
-        //et réfléchi dans le second pour une interpolation croissante
-        //Si le bit 14 (0x4000) est activé, on est dans le quadrant réfléchi
-        idx_q4 = (unsigned int)(norm & 0x3fffu);
-        if(norm & 0x4000) idx_q4 = 0x3fffu - idx_q4;
-
-        //table_interpolate nécessite une entrée supplémentaire pour l'indexation sûre
-        result.mant = table_interpolate(sin_table, SIN_TABLE_SIZE + 1, idx_q4, 4);
-        
-        //Application du signe pour les quadrants 2 et 3 (bit 15 indique la demi-onde)
-        if(norm & HF_MASK_SIGN) result.mant = -result.mant;
-        if(result.mant < 0) {
-            result.sign = HF_ZERO_NEG;
-            result.mant = -result.mant;
-        }
+        *phase = (uint32_t)norm;
+        valid = 1;
+    }
 
-        //Normalisation et arrondi du résultat final
-        normalize_and_round(&result);
+    return valid;
+}
+
+/**
+ * @brief Calcule le sinus d'une phase fixe (un tour = 65536) par table
+ *
+ * @param phase Phase éventuellement décalée (seuls les 16 bits de poids faible comptent)
+ * @return Le sinus de la phase en format demi-précision
+ */
+static uint16_t sinus_from_phase(uint32_t phase) {
+    half_float result;
+    uint32_t norm = phase & 0xffffu;
+    uint32_t idx_q4;
+
+    result.sign = HF_ZERO_POS;
+    result.exp = 0;
+
+    //Quart d'onde (sin_table interpolée ou polynôme selon le moteur)
+    //Construction d'un index Q4 monotone dans le premier quadrant
+    //et réfléchi dans le second pour une interpolation croissante
+    //Si le bit 14 (0x4000) est activé, on est dans le quadrant réfléchi
+    idx_q4 = norm & 0x3fffu;
+    if(norm & 0x4000) idx_q4 = 0x3fffu - idx_q4;
+
+    result.mant = sin_quarter_q15(idx_q4);
+
+    //Application du signe pour les quadrants 2 et 3 (bit 15 indique la demi-onde)
+    if(norm & HF_MASK_SIGN) result.mant = -result.mant;
+    if(result.mant < 0) {
+        result.sign = HF_ZERO_NEG;
+        result.mant = -result.mant;
     }
 
+    //Normalisation et arrondi du résultat final
+    normalize_and_round(&result);
+
     return compose_half(&result);
 }
 
@@ -733,7 +900,7 @@ static uint16_t asinus_shiftable(uint16_t hf, uint32_t shift) {
             //permettre un accès sûr à idx1 lors de l'interpolation.
             //On passe donc la longueur complète à table_interpolate.
             result.exp = 0;
-            result.mant = (int32_t)table_interpolate(asin_table, ASIN_TABLE_SIZE + 1, norm, bits);
+            result.mant = (int32_t)TABLE_INTERPOLATE(ASIN_INTERP, asin_table, ASIN_SLOPES, ASIN_TABLE_SIZE + 1, norm, bits);
            
             //Appliquer le shift pour acos, ou le signe pour asin
             if(shift) {
@@ -785,3 +952,35 @@ static void cosh_sinh_helper(int32_t x_abs, half_float *result, int32_t *exp_pos
         if(shift < 31) *exp_neg >>= shift; else *exp_neg = 0;  //e^(-x) négligeable
     }
 }
+
+/**
+ * @brief Convertit |x| en format fixe pour les fonctions hyperboliques
+ *
+ * @param input Demi-flottant décomposé (ni NaN ni infini)
+ * @return |x| en format fixe (même échelle que la mantisse décomposée)
+ */
+static int32_t hyper_fixed_abs(const half_float *input) {
+    int32_t x_abs = input->mant;
+
+    x_abs = (input->exp >= 0) ? (x_abs << input->exp) : (x_abs >> -input->exp);
+    if(x_abs < 0) x_abs = -x_abs;
+
+    return x_abs;
+}
+
+/**
+ * @brief Divise par 2 une combinaison e^|x| +/- e^(-|x|) puis normalise et arrondit
+ *
+ * @param result Résultat dont l'exposant a été fixé par cosh_sinh_helper
+ * @param value Somme (cosh) ou différence (sinh) des mantisses alignées
+ */
+static void hyper_halve(half_float *result, int32_t value) {
+    result->mant = value >> 1;  //Diviser par 2 directement
+
+    if(result->mant == 0 && value != 0) {
+        result->exp--;
+        result->mant = value >> 1;
+    }
+
+    normalize_and_round(result);
+}
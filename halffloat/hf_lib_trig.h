@@ -13,23 +13,30 @@
 #ifndef HF_LIB_TRIG_H
 #define HF_LIB_TRIG_H
 
+#include <stddef.h>
 #include "hf_common.h"
 
 //Fonctions trigonométriques
-uint16_t hf_sin(uint16_t hfangle);           //Sinus
-uint16_t hf_cos(uint16_t hfangle);           //Cosinus
-uint16_t hf_tan(uint16_t hfangle);           //Tangente
-uint16_t hf_asin(uint16_t hf);               //Arc sinus
-uint16_t hf_acos(uint16_t hf);               //Arc cosinus
-uint16_t hf_atan(uint16_t hf);               //Arc tangente
-uint16_t hf_atan2(uint16_t hfy, uint16_t hfx); //Arc tangente à 2 arguments
+HF_API uint16_t hf_sin(uint16_t hfangle);                           //Sinus
+HF_API uint16_t hf_cos(uint16_t hfangle);                           //Cosinus
+HF_API uint16_t hf_tan(uint16_t hfangle);                           //Tangente
+HF_API uint16_t hf_asin(uint16_t hf);                               //Arc sinus
+HF_API uint16_t hf_acos(uint16_t hf);                               //Arc cosinus
+HF_API uint16_t hf_atan(uint16_t hf);                               //Arc tangente
+HF_API uint16_t hf_atan2(uint16_t hfy, uint16_t hfx);               //Arc tangente à 2 arguments
+HF_API void hf_sincos(uint16_t hfangle, uint16_t *s, uint16_t *c);  //Sinus et cosinus (réduction commune)
 
 //Fonctions hyperboliques
-uint16_t hf_sinh(uint16_t hf);               //Sinus hyperbolique
-uint16_t hf_cosh(uint16_t hf);               //Cosinus hyperbolique
-uint16_t hf_tanh(uint16_t hf);               //Tangente hyperbolique
-uint16_t hf_asinh(uint16_t hf);              //Arc sinus hyperbolique
-uint16_t hf_acosh(uint16_t hf);              //Arc cosinus hyperbolique
-uint16_t hf_atanh(uint16_t hf);              //Arc tangente hyperbolique
+HF_API uint16_t hf_sinh(uint16_t hf);                              //Sinus hyperbolique
+HF_API uint16_t hf_cosh(uint16_t hf);                              //Cosinus hyperbolique
+HF_API uint16_t hf_tanh(uint16_t hf);                              //Tangente hyperbolique
+HF_API uint16_t hf_asinh(uint16_t hf);                             //Arc sinus hyperbolique
+HF_API uint16_t hf_acosh(uint16_t hf);                             //Arc cosinus hyperbolique
+HF_API uint16_t hf_atanh(uint16_t hf);                             //Arc tangente hyperbolique
+HF_API void hf_sinhcosh(uint16_t hf, uint16_t *sh, uint16_t *ch);  //sinh et cosh (exponentielle commune)
+
+//Opérations par lots sur tableaux (identiques bit à bit aux versions scalaires)
+HF_API void hf_sincos_n(const uint16_t *in, uint16_t *s, uint16_t *c, size_t n);
+HF_API void hf_sinhcosh_n(const uint16_t *in, uint16_t *sh, uint16_t *ch, size_t n);
 
 #endif //HF_LIB_TRIG_H
@@ -16,16 +16,92 @@
 #include "hf_precalc.h"
 #include <math.h>
 
+#ifndef HF_PRECALC_RUNTIME
+//Tables constantes générées par hf_precalc_gen (cible `make tables`); l'en-tête
+//s'arrête sur #error si ses tailles ou ordres diffèrent de hf_precalc.h
+#include "hf_precalc_tables.h"
+
+/**
+ * @brief Initialise toutes les tables (sans effet: tables constantes)
+ */
+void hf_precalc_init(void) {
+}
+
+//Les tables étant constantes, les fonctions de remplissage n'ont plus rien à faire
+void fill_sin_table(void) {
+}
+
+void fill_asin_table(void) {
+}
+
+void fill_atan_table(void) {
+}
+
+void fill_ln_table(void) {
+}
+
+void fill_exp_table(void) {
+}
+
+void fill_tan_tables_dual(void) {
+}
+
+#else //HF_PRECALC_RUNTIME
+
 uint16_t sin_table[SIN_TABLE_SIZE+1];
 uint16_t asin_table[ASIN_TABLE_SIZE + 1];
 uint16_t atan_table[ATAN_TABLE_SIZE + 1];
-uint16_t ln_table[LN_TABLE_SIZE];
+uint16_t ln_table[LN_TABLE_SIZE + 1];
 uint16_t exp_table[EXP_TABLE_SIZE+1];
 
 //TABLES DUALES OPTIMISÉES Q13/Q6
 uint16_t tan_table_low[TAN_DUAL_TABLE_SIZE+1];   //[0°, 75°] Q13 format (16-bit)
 uint16_t tan_table_high[TAN_DUAL_TABLE_SIZE+1];  //[75°, 90°] Q6 format (16-bit)
 
+//Tables de pentes (interpolation cubique uniquement)
+#if SIN_INTERP == HF_INTERP_CUBIC
+uint16_t sin_slopes[SIN_TABLE_SIZE + 1];
+#endif
+#if ASIN_INTERP == HF_INTERP_CUBIC
+uint16_t asin_slopes[ASIN_TABLE_SIZE + 1];
+#endif
+#if ATAN_INTERP == HF_INTERP_CUBIC
+uint16_t atan_slopes[ATAN_TABLE_SIZE + 1];
+#endif
+#if LN_INTERP == HF_INTERP_CUBIC
+uint16_t ln_slopes[LN_TABLE_SIZE + 1];
+#endif
+#if EXP_INTERP == HF_INTERP_CUBIC
+uint16_t exp_slopes[EXP_TABLE_SIZE + 1];
+#endif
+#if TAN_INTERP == HF_INTERP_CUBIC
+uint16_t tan_slopes_low[TAN_DUAL_TABLE_SIZE + 1];
+uint16_t tan_slopes_high[TAN_DUAL_TABLE_SIZE + 1];
+#endif
+
+#define PRECALC_HAS_SLOPES (SIN_INTERP == HF_INTERP_CUBIC || ASIN_INTERP == HF_INTERP_CUBIC \
+    || ATAN_INTERP == HF_INTERP_CUBIC || LN_INTERP == HF_INTERP_CUBIC || EXP_INTERP == HF_INTERP_CUBIC \
+    || TAN_INTERP == HF_INTERP_CUBIC)
+
+#if PRECALC_HAS_SLOPES
+//Déclaration des helpers statiques
+static uint16_t slope_to_fixed(double slope, const uint16_t *table, int count, int i);
+#endif
+
+/**
+ * @brief Remplit toutes les tables de précalcul
+ *
+ * Équivalent aux appels successifs de toutes les fonctions fill_*().
+ */
+void hf_precalc_init(void) {
+    fill_sin_table();
+    fill_asin_table();
+    fill_atan_table();
+    fill_exp_table();
+    fill_ln_table();
+    fill_tan_tables_dual();
+}
+
 /**
  * @brief Remplit la table de sinus
  * 
@@ -44,6 +120,14 @@ void fill_sin_table(void) {
         double sin_val = sin(angle);
         sin_table[i] = (uint16_t)(uint32_t)(sin_val * 32768.0 + 0.5); //Conversion en format fixe Q15
     }
+
+#if SIN_INTERP == HF_INTERP_CUBIC
+    //Pentes: d/di sin(pi/2 * i/N) = cos(angle) * pi/2 / N
+    for(i = 0; i <= SIN_TABLE_SIZE; i++) {
+        double angle = (M_PI / 2) * i / SIN_TABLE_SIZE;
+        sin_slopes[i] = slope_to_fixed(cos(angle) * (M_PI / 2) / SIN_TABLE_SIZE * 32768.0, sin_table, SIN_TABLE_SIZE + 1, i);
+    }
+#endif
 }
 
 /**
@@ -64,6 +148,15 @@ void fill_asin_table(void) {
         double asin_val = asin(x);
         asin_table[i] = (uint16_t)(uint32_t)(asin_val * 32768.0 + 0.5); //Conversion en format fixe Q15
     }
+
+#if ASIN_INTERP == HF_INTERP_CUBIC
+    //Pentes: 1/sqrt(1 - x^2) / N (infinie en x = 1, bornée par slope_to_fixed)
+    for(i = 0; i <= ASIN_TABLE_SIZE; i++) {
+        double x = (double)i / ASIN_TABLE_SIZE;
+        double slope = i < ASIN_TABLE_SIZE ? 1.0 / sqrt(1.0 - x * x) / ASIN_TABLE_SIZE * 32768.0 : 65535.0;
+        asin_slopes[i] = slope_to_fixed(slope, asin_table, ASIN_TABLE_SIZE + 1, i);
+    }
+#endif
 }
 
 /**
@@ -84,6 +177,14 @@ void fill_atan_table(void) {
         double atan_val = atan(x);
         atan_table[i] = (uint16_t)(uint32_t)(atan_val * 32768.0 + 0.5); //Conversion en format fixe Q15
     }
+
+#if ATAN_INTERP == HF_INTERP_CUBIC
+    //Pentes: 1/(1 + x^2) / N
+    for(i = 0; i <= ATAN_TABLE_SIZE; i++) {
+        double x = (double)i / ATAN_TABLE_SIZE;
+        atan_slopes[i] = slope_to_fixed(1.0 / (1.0 + x * x) / ATAN_TABLE_SIZE * 32768.0, atan_table, ATAN_TABLE_SIZE + 1, i);
+    }
+#endif
 }
 
 /**
@@ -93,18 +194,26 @@ void fill_atan_table(void) {
  * Les valeurs sont converties en format Q14 pour optimiser les calculs de 
  * logarithmes en demi-précision.
  * 
- * La table couvre l'intervalle [1, 2[ avec LN_TABLE_SIZE points, 
- * permettant une interpolation rapide et précise.
+ * La table couvre l'intervalle [1, 2] avec LN_TABLE_SIZE+1 points (la dernière
+ * entrée, ln(2), borne l'interpolation du dernier intervalle).
  */
 void fill_ln_table(void) {
     int i;
 
-    for(i = 0; i < LN_TABLE_SIZE; i++) {
+    for(i = 0; i <= LN_TABLE_SIZE; i++) {
         double x = 1.0 + (double)i / LN_TABLE_SIZE;
         double ln_val = log(x);
         uint16_t fixed_point = (uint16_t)(ln_val * 32768.0 + 0.5);  //Q15 format
         ln_table[i] = fixed_point;
     }
+
+#if LN_INTERP == HF_INTERP_CUBIC
+    //Pentes: 1/x / N
+    for(i = 0; i <= LN_TABLE_SIZE; i++) {
+        double x = 1.0 + (double)i / LN_TABLE_SIZE;
+        ln_slopes[i] = slope_to_fixed(1.0 / x / LN_TABLE_SIZE * 32768.0, ln_table, LN_TABLE_SIZE + 1, i);
+    }
+#endif
 }
 
 /**
@@ -128,6 +237,14 @@ void fill_exp_table(void) {
         if(fixed_point>0xffff) fixed_point=0xffff;
         exp_table[i] = (uint16_t)fixed_point;
     }
+
+#if EXP_INTERP == HF_INTERP_CUBIC
+    //Pentes: exp(x) * ln(2) / N
+    for(i = 0; i <= EXP_TABLE_SIZE; i++) {
+        double x = (double)i / EXP_TABLE_SIZE * log(2.0);
+        exp_slopes[i] = slope_to_fixed(exp(x) * log(2.0) / EXP_TABLE_SIZE * 32768.0, exp_table, EXP_TABLE_SIZE + 1, i);
+    }
+#endif
 }
 
 /**
@@ -170,4 +287,52 @@ void fill_tan_tables_dual(void) {
         
         tan_table_high[i] = (uint16_t)(tan_val * 64.0 + 0.5);  //Q6 format
     }
+
+#if TAN_INTERP == HF_INTERP_CUBIC
+    //Pentes: (1 + tan^2) * largeur du pas, dans le format de chaque table
+    for(i = 0; i <= TAN_DUAL_TABLE_SIZE; i++) {
+        double step_low = TAN_SWITCH_RADIANS / TAN_DUAL_TABLE_SIZE;
+        double step_high = (M_PI/2 - TAN_SWITCH_RADIANS) / TAN_DUAL_TABLE_SIZE;
+        double tan_low = tan(step_low * i);
+        double tan_high = i < TAN_DUAL_TABLE_SIZE ? tan(TAN_SWITCH_RADIANS + step_high * i) : 1e6;
+
+        tan_slopes_low[i] = slope_to_fixed((1.0 + tan_low * tan_low) * step_low * 8192.0, tan_table_low, TAN_DUAL_TABLE_SIZE + 1, i);
+        tan_slopes_high[i] = slope_to_fixed((1.0 + tan_high * tan_high) * step_high * 64.0, tan_table_high, TAN_DUAL_TABLE_SIZE + 1, i);
+    }
+#endif
+}
+
+#if PRECALC_HAS_SLOPES
+/**
+ * @brief Convertit une pente analytique (unités de table par pas) en entrée de table de pentes
+ *
+ * La pente est bornée à 3 fois la différence finie de chaque intervalle
+ * adjacent (condition de Fritsch-Carlson): l'interpolation d'Hermite reste
+ * alors monotone et ne dépasse pas les valeurs tabulées, y compris près des
+ * singularités (asin en 1, tan en pi/2) et des valeurs saturées.
+ *
+ * @param slope Pente analytique
+ * @param table Table de valeurs déjà remplie
+ * @param count Nombre d'entrées de la table
+ * @param i Indice de l'entrée
+ * @return Pente arrondie, dans [0, 65535]
+ */
+static uint16_t slope_to_fixed(double slope, const uint16_t *table, int count, int i) {
+    double limit = 65535.0;
+
+    if(i > 0) {
+        double delta = (double)table[i] - (double)table[i - 1];
+        if(3.0 * delta < limit) limit = 3.0 * delta;
+    }
+    if(i < count - 1) {
+        double delta = (double)table[i + 1] - (double)table[i];
+        if(3.0 * delta < limit) limit = 3.0 * delta;
+    }
+    if(slope > limit) slope = limit;
+    if(slope < 0.0) slope = 0.0;
+
+    return (uint16_t)(slope + 0.5);
 }
+#endif
+
+#endif //HF_PRECALC_RUNTIME
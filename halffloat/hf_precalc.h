@@ -4,7 +4,8 @@
  * 
  * Ce fichier définit les tables de recherche précalculées utilisées pour
  * accélérer les calculs des fonctions transcendantes et trigonométriques.
- * Les tables incluent sin, ln, exp et tan avec interpolation linéaire.
+ * Les tables incluent sin, ln, exp et tan avec interpolation linéaire,
+ * quadratique ou cubique (résolution et ordre configurables par famille).
  * 
  * @author Seg
  * @date Octobre 2025
@@ -14,15 +15,57 @@
 #ifndef HF_PRECALC_H
 #define HF_PRECALC_H
 
+#include <stddef.h>
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-#define SIN_TABLE_SIZE 1024
-#define ASIN_TABLE_SIZE 1024
+/*
+ * Résolution et ordre d'interpolation des tables, par famille de fonctions
+ * (à fixer à la compilation, ex: -DSIN_TABLE_BITS=8 -DSIN_INTERP=HF_INTERP_CUBIC)
+ *
+ *  - *_TABLE_BITS : log2 du nombre d'intervalles de la table
+ *  - *_INTERP     : HF_INTERP_LINEAR (défaut), HF_INTERP_QUADRATIC (3 points,
+ *                   sans mémoire supplémentaire) ou HF_INTERP_CUBIC (Hermite,
+ *                   avec une table de pentes stockée à côté des valeurs)
+ *
+ * Une table plus petite avec une interpolation d'ordre supérieur garde une
+ * précision comparable pour une empreinte cache réduite. Hors HF_PRECALC_RUNTIME,
+ * toute modification impose de régénérer hf_precalc_tables.h (`make tables`)
+ * avec les mêmes options.
+ */
+#define HF_INTERP_LINEAR 1
+#define HF_INTERP_QUADRATIC 2
+#define HF_INTERP_CUBIC 3
+
+//Famille sin/cos: quart d'onde [0, pi/2]
+#ifndef SIN_TABLE_BITS
+#define SIN_TABLE_BITS 10
+#endif
+#ifndef SIN_INTERP
+#define SIN_INTERP HF_INTERP_LINEAR
+#endif
+#define SIN_TABLE_SIZE (1 << SIN_TABLE_BITS)
+#define SIN_INDEX_SHIFT (14 - SIN_TABLE_BITS)
+
+//Famille asin/acos: [0, 1]
+#ifndef ASIN_TABLE_BITS
 #define ASIN_TABLE_BITS 10
-#define ATAN_TABLE_SIZE 1024
+#endif
+#ifndef ASIN_INTERP
+#define ASIN_INTERP HF_INTERP_LINEAR
+#endif
+#define ASIN_TABLE_SIZE (1 << ASIN_TABLE_BITS)
+
+//Famille atan/atan2: [0, 1]
+#ifndef ATAN_TABLE_BITS
 #define ATAN_TABLE_BITS 10
+#endif
+#ifndef ATAN_INTERP
+#define ATAN_INTERP HF_INTERP_LINEAR
+#endif
+#define ATAN_TABLE_SIZE (1 << ATAN_TABLE_BITS)
 
 /*
  * Paramètres dérivés pour l'interpolation atan
@@ -36,35 +79,126 @@
 #define ATAN_Q_BITS        15
 #define ATAN_INDEX_SHIFT   (ATAN_Q_BITS - ATAN_TABLE_BITS)
 #define ATAN_INTERP_SHIFT  (ATAN_INDEX_SHIFT - 1)
-#define LN_TABLE_SIZE 1024
-#define EXP_TABLE_SIZE_SHIFT 8
+
+//Famille ln/log2/log10/pow: mantisse [1, 2[ (10 bits: une entrée par mantisse, lecture exacte)
+#ifndef LN_TABLE_BITS
+#define LN_TABLE_BITS 10
+#endif
+#ifndef LN_INTERP
+#define LN_INTERP HF_INTERP_LINEAR
+#endif
+#define LN_TABLE_SIZE (1 << LN_TABLE_BITS)
+#define LN_INDEX_SHIFT (HF_MANT_SHIFT - LN_TABLE_BITS)
+
+//Famille exp/exp2/exp10/sinh/cosh/tanh: [0, ln(2)]
+#ifndef EXP_TABLE_BITS
+#define EXP_TABLE_BITS 8
+#endif
+#ifndef EXP_INTERP
+#define EXP_INTERP HF_INTERP_LINEAR
+#endif
+#define EXP_TABLE_SIZE_SHIFT EXP_TABLE_BITS
 #define EXP_TABLE_SIZE (1<<EXP_TABLE_SIZE_SHIFT)
 #define EXP_TABLE_PRECISION 15
 #define EXP_PRECISION_SHIFT 8
 #define ACOS_SHIFT ((uint32_t)(M_PI / 2.0 * 32768.0 + 0.5))
 
 //DUAL-TABLE TAN OPTIMISÉ
-#define TAN_DUAL_TABLE_SIZE 256              //256 entrées par table
+#ifndef TAN_DUAL_TABLE_BITS
+#define TAN_DUAL_TABLE_BITS 8
+#endif
+#ifndef TAN_INTERP
+#define TAN_INTERP HF_INTERP_LINEAR
+#endif
+#define TAN_DUAL_TABLE_SIZE (1 << TAN_DUAL_TABLE_BITS) //256 entrées par table par défaut
 #define TAN_SWITCH_RADIANS 1.30899693899575  //75° en radians = 5pi/12 (point de bascule)
 
+#if SIN_TABLE_BITS < 4 || SIN_TABLE_BITS > 13 || ASIN_TABLE_BITS < 4 || ASIN_TABLE_BITS > 14 \
+ || ATAN_TABLE_BITS < 4 || ATAN_TABLE_BITS > 13 || LN_TABLE_BITS < 4 || LN_TABLE_BITS > 10 \
+ || EXP_TABLE_BITS < 4 || EXP_TABLE_BITS > 12 || TAN_DUAL_TABLE_BITS < 4 || TAN_DUAL_TABLE_BITS > 12
+#error "Résolution de table hors limites (SIN/ATAN: 4..13, ASIN: 4..14, LN: 4..10, EXP/TAN: 4..12)"
+#endif
+
 #define LNI_2 22713 //ln(2) * 32768 (Q15) - constante utilisée par les fonctions optimisées
 
-void fill_sin_table(void);
-void fill_asin_table(void);
-void fill_atan_table(void);
-void fill_ln_table(void);
-void fill_exp_table(void);
-void fill_tan_tables_dual(void);       //Tables duales optimales Q13/Q6
+/*
+ * Par défaut les tables sont des constantes générées à la compilation
+ * (hf_precalc_tables.h, cible `make tables`): elles sont placées en .rodata,
+ * partagées entre processus et ne demandent aucune initialisation. Définir
+ * HF_PRECALC_RUNTIME pour revenir aux tables modifiables remplies par fill_*().
+ */
+#ifdef HF_PRECALC_RUNTIME
+#if defined(HF_INLINE)
+#error "HF_PRECALC_RUNTIME n'est pas disponible en mode HF_INLINE (tables propres à chaque unité de traduction)"
+#endif
+#define HF_PRECALC_CONST
+#else
+#define HF_PRECALC_CONST const
+#endif
+
+//Remplissage des tables (sans effet hors HF_PRECALC_RUNTIME)
+HF_API void hf_precalc_init(void);
+HF_INTERNAL void fill_sin_table(void);
+HF_INTERNAL void fill_asin_table(void);
+HF_INTERNAL void fill_atan_table(void);
+HF_INTERNAL void fill_ln_table(void);
+HF_INTERNAL void fill_exp_table(void);
+HF_INTERNAL void fill_tan_tables_dual(void);  //Tables duales optimales Q13/Q6
 
-extern uint16_t sin_table[SIN_TABLE_SIZE+1];
-extern uint16_t asin_table[ASIN_TABLE_SIZE + 1];
-extern uint16_t atan_table[ATAN_TABLE_SIZE + 1];
-extern uint16_t ln_table[LN_TABLE_SIZE];
-extern uint16_t exp_table[EXP_TABLE_SIZE+1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t sin_table[SIN_TABLE_SIZE+1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t asin_table[ASIN_TABLE_SIZE + 1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t atan_table[ATAN_TABLE_SIZE + 1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t ln_table[LN_TABLE_SIZE + 1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t exp_table[EXP_TABLE_SIZE+1];
 
 //TABLES DUALES OPTIMISÉES Q13/Q6
-extern uint16_t tan_table_low[TAN_DUAL_TABLE_SIZE+1];   //[0°, 75°] Q13 format (16-bit)
-extern uint16_t tan_table_high[TAN_DUAL_TABLE_SIZE+1];  //[75°, 90°] Q6 format (16-bit)
+HF_DATA_DECL HF_PRECALC_CONST uint16_t tan_table_low[TAN_DUAL_TABLE_SIZE+1];   //[0°, 75°] Q13 format (16-bit)
+HF_DATA_DECL HF_PRECALC_CONST uint16_t tan_table_high[TAN_DUAL_TABLE_SIZE+1];  //[75°, 90°] Q6 format (16-bit)
+
+/*
+ * Tables de pentes pour l'interpolation cubique (HF_INTERP_CUBIC uniquement):
+ * dérivée par pas de table, dans le format de la table de valeurs. Les macros
+ * *_SLOPES valent NULL pour les autres ordres d'interpolation.
+ */
+#if SIN_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t sin_slopes[SIN_TABLE_SIZE + 1];
+#define SIN_SLOPES sin_slopes
+#else
+#define SIN_SLOPES NULL
+#endif
+#if ASIN_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t asin_slopes[ASIN_TABLE_SIZE + 1];
+#define ASIN_SLOPES asin_slopes
+#else
+#define ASIN_SLOPES NULL
+#endif
+#if ATAN_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t atan_slopes[ATAN_TABLE_SIZE + 1];
+#define ATAN_SLOPES atan_slopes
+#else
+#define ATAN_SLOPES NULL
+#endif
+#if LN_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t ln_slopes[LN_TABLE_SIZE + 1];
+#define LN_SLOPES ln_slopes
+#else
+#define LN_SLOPES NULL
+#endif
+#if EXP_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t exp_slopes[EXP_TABLE_SIZE + 1];
+#define EXP_SLOPES exp_slopes
+#else
+#define EXP_SLOPES NULL
+#endif
+#if TAN_INTERP == HF_INTERP_CUBIC
+HF_DATA_DECL HF_PRECALC_CONST uint16_t tan_slopes_low[TAN_DUAL_TABLE_SIZE + 1];
+HF_DATA_DECL HF_PRECALC_CONST uint16_t tan_slopes_high[TAN_DUAL_TABLE_SIZE + 1];
+#define TAN_SLOPES_LOW tan_slopes_low
+#define TAN_SLOPES_HIGH tan_slopes_high
+#else
+#define TAN_SLOPES_LOW NULL
+#define TAN_SLOPES_HIGH NULL
+#endif
 
 //Tables tan duales: Q13 haute précision (max=8.0) + Q6 grande plage (max=1024)
 
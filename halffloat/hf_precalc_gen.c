@@ -0,0 +1,144 @@
+/**
+ * @file hf_precalc_gen.c
+ * @brief Générateur des tables de précalcul constantes (hf_precalc_tables.h)
+ *
+ * Programme autonome compilé avec HF_PRECALC_RUNTIME: il remplit les tables
+ * par les fonctions fill_*() habituelles puis les écrit sous forme de tableaux
+ * const, inclus par hf_precalc.c dans la compilation par défaut. Les tailles,
+ * ordres d'interpolation et tables de pentes sont ceux des options de
+ * compilation du générateur (voir hf_precalc.h).
+ *
+ * Usage: hf_precalc_gen [fichier_sortie]   (défaut: hf_precalc_tables.h)
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include "hf_common.h"
+#include "hf_precalc.h"
+
+#ifndef HF_PRECALC_RUNTIME
+#error "hf_precalc_gen doit être compilé avec -DHF_PRECALC_RUNTIME"
+#endif
+
+//Déclaration des helpers statiques
+static int write_table(FILE *file, const char *name, const char *size_expr, const uint16_t *table, int count);
+
+/**
+ * @brief Point d'entrée du générateur de tables
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Tableau des arguments (argv[1]: fichier de sortie optionnel)
+ * @return 0 en cas de succès, 1 en cas d'erreur d'écriture
+ */
+int main(int argc, char *argv[]) {
+    const char *path = argc > 1 ? argv[1] : "hf_precalc_tables.h";
+    FILE *file;
+    int ok;
+
+    hf_precalc_init();
+
+    file = fopen(path, "w");
+    if(file == NULL) {
+        fprintf(stderr, "hf_precalc_gen: impossible d'ouvrir %s\n", path);
+        return 1;
+    }
+
+    ok = fprintf(file,
+        "/**\n"
+        " * @file hf_precalc_tables.h\n"
+        " * @brief Tables de précalcul constantes (générées par hf_precalc_gen, ne pas modifier)\n"
+        " *\n"
+        " * Inclus uniquement par hf_precalc.c. Régénérer avec 'make tables' après toute\n"
+        " * modification des tailles ou des fonctions fill_*() de hf_precalc.c.\n"
+        " */\n\n"
+        "#ifndef HF_PRECALC_TABLES_H\n"
+        "#define HF_PRECALC_TABLES_H\n\n"
+        "//Tailles utilisées lors de la génération (dimensions des tableaux ci-dessous)\n"
+        "#define HF_GEN_SIN_TABLE_SIZE %d\n"
+        "#define HF_GEN_ASIN_TABLE_SIZE %d\n"
+        "#define HF_GEN_ATAN_TABLE_SIZE %d\n"
+        "#define HF_GEN_LN_TABLE_SIZE %d\n"
+        "#define HF_GEN_EXP_TABLE_SIZE %d\n"
+        "#define HF_GEN_TAN_DUAL_TABLE_SIZE %d\n\n"
+        "//Ordres d'interpolation utilisés lors de la génération (pentes présentes si HF_INTERP_CUBIC)\n"
+        "#define HF_GEN_SIN_INTERP %d\n"
+        "#define HF_GEN_ASIN_INTERP %d\n"
+        "#define HF_GEN_ATAN_INTERP %d\n"
+        "#define HF_GEN_LN_INTERP %d\n"
+        "#define HF_GEN_EXP_INTERP %d\n"
+        "#define HF_GEN_TAN_INTERP %d\n\n"
+        "//Arrêt explicite si hf_precalc.h demande d'autres tailles ou ordres (sinon\n"
+        "//tableaux tronqués, complétés par des zéros ou pentes manquantes)\n"
+        "#if HF_GEN_SIN_TABLE_SIZE != SIN_TABLE_SIZE || HF_GEN_ASIN_TABLE_SIZE != ASIN_TABLE_SIZE \\\n"
+        " || HF_GEN_ATAN_TABLE_SIZE != ATAN_TABLE_SIZE || HF_GEN_LN_TABLE_SIZE != LN_TABLE_SIZE \\\n"
+        " || HF_GEN_EXP_TABLE_SIZE != EXP_TABLE_SIZE || HF_GEN_TAN_DUAL_TABLE_SIZE != TAN_DUAL_TABLE_SIZE\n"
+        "#error \"hf_precalc_tables.h ne correspond pas aux tailles de hf_precalc.h: relancer 'make tables'\"\n"
+        "#elif (HF_GEN_SIN_INTERP == HF_INTERP_CUBIC) != (SIN_INTERP == HF_INTERP_CUBIC) \\\n"
+        " || (HF_GEN_ASIN_INTERP == HF_INTERP_CUBIC) != (ASIN_INTERP == HF_INTERP_CUBIC) \\\n"
+        " || (HF_GEN_ATAN_INTERP == HF_INTERP_CUBIC) != (ATAN_INTERP == HF_INTERP_CUBIC) \\\n"
+        " || (HF_GEN_LN_INTERP == HF_INTERP_CUBIC) != (LN_INTERP == HF_INTERP_CUBIC) \\\n"
+        " || (HF_GEN_EXP_INTERP == HF_INTERP_CUBIC) != (EXP_INTERP == HF_INTERP_CUBIC) \\\n"
+        " || (HF_GEN_TAN_INTERP == HF_INTERP_CUBIC) != (TAN_INTERP == HF_INTERP_CUBIC)\n"
+        "#error \"hf_precalc_tables.h ne correspond pas aux ordres d'interpolation de hf_precalc.h: relancer 'make tables'\"\n"
+        "#else\n",
+        SIN_TABLE_SIZE, ASIN_TABLE_SIZE, ATAN_TABLE_SIZE, LN_TABLE_SIZE, EXP_TABLE_SIZE, TAN_DUAL_TABLE_SIZE,
+        SIN_INTERP, ASIN_INTERP, ATAN_INTERP, LN_INTERP, EXP_INTERP, TAN_INTERP) > 0;
+
+    ok = ok && write_table(file, "sin_table", "HF_GEN_SIN_TABLE_SIZE + 1", sin_table, SIN_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "asin_table", "HF_GEN_ASIN_TABLE_SIZE + 1", asin_table, ASIN_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "atan_table", "HF_GEN_ATAN_TABLE_SIZE + 1", atan_table, ATAN_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "ln_table", "HF_GEN_LN_TABLE_SIZE + 1", ln_table, LN_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "exp_table", "HF_GEN_EXP_TABLE_SIZE + 1", exp_table, EXP_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "tan_table_low", "HF_GEN_TAN_DUAL_TABLE_SIZE + 1", tan_table_low, TAN_DUAL_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "tan_table_high", "HF_GEN_TAN_DUAL_TABLE_SIZE + 1", tan_table_high, TAN_DUAL_TABLE_SIZE + 1);
+#if SIN_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "sin_slopes", "HF_GEN_SIN_TABLE_SIZE + 1", sin_slopes, SIN_TABLE_SIZE + 1);
+#endif
+#if ASIN_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "asin_slopes", "HF_GEN_ASIN_TABLE_SIZE + 1", asin_slopes, ASIN_TABLE_SIZE + 1);
+#endif
+#if ATAN_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "atan_slopes", "HF_GEN_ATAN_TABLE_SIZE + 1", atan_slopes, ATAN_TABLE_SIZE + 1);
+#endif
+#if LN_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "ln_slopes", "HF_GEN_LN_TABLE_SIZE + 1", ln_slopes, LN_TABLE_SIZE + 1);
+#endif
+#if EXP_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "exp_slopes", "HF_GEN_EXP_TABLE_SIZE + 1", exp_slopes, EXP_TABLE_SIZE + 1);
+#endif
+#if TAN_INTERP == HF_INTERP_CUBIC
+    ok = ok && write_table(file, "tan_slopes_low", "HF_GEN_TAN_DUAL_TABLE_SIZE + 1", tan_slopes_low, TAN_DUAL_TABLE_SIZE + 1);
+    ok = ok && write_table(file, "tan_slopes_high", "HF_GEN_TAN_DUAL_TABLE_SIZE + 1", tan_slopes_high, TAN_DUAL_TABLE_SIZE + 1);
+#endif
+    ok = ok && fprintf(file, "\n#endif\n\n#endif //HF_PRECALC_TABLES_H\n") > 0;
+    ok = (fclose(file) == 0) && ok;
+
+    if(!ok) fprintf(stderr, "hf_precalc_gen: erreur d'écriture dans %s\n", path);
+
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief Écrit une table sous forme de tableau const (8 valeurs par ligne)
+ *
+ * @param file Fichier de sortie
+ * @param name Nom du tableau
+ * @param size_expr Expression de taille reprise dans la déclaration
+ * @param table Valeurs de la table
+ * @param count Nombre d'entrées
+ * @return 1 en cas de succès, 0 sinon
+ */
+static int write_table(FILE *file, const char *name, const char *size_expr, const uint16_t *table, int count) {
+    int ok = fprintf(file, "\nHF_DATA const uint16_t %s[%s] = {\n", name, size_expr) > 0;
+    int i;
+
+    for(i = 0; ok && i < count; i++) {
+        const char *sep = (i % 8 == 7 || i == count - 1) ? ",\n" : ", ";
+        ok = fprintf(file, "%s0x%04X%s", (i % 8 == 0) ? "    " : "", (unsigned int)table[i], sep) > 0;
+    }
+
+    return ok && fprintf(file, "};\n") > 0;
+}
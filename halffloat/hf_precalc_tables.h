@@ -0,0 +1,681 @@
+/**
+ * @file hf_precalc_tables.h
+ * @brief Tables de précalcul constantes (générées par hf_precalc_gen, ne pas modifier)
+ *
+ * Inclus uniquement par hf_precalc.c. Régénérer avec 'make tables' après toute
+ * modification des tailles ou des fonctions fill_*() de hf_precalc.c.
+ */
+
+#ifndef HF_PRECALC_TABLES_H
+#define HF_PRECALC_TABLES_H
+
+//Tailles utilisées lors de la génération (dimensions des tableaux ci-dessous)
+#define HF_GEN_SIN_TABLE_SIZE 1024
+#define HF_GEN_ASIN_TABLE_SIZE 1024
+#define HF_GEN_ATAN_TABLE_SIZE 1024
+#define HF_GEN_LN_TABLE_SIZE 1024
+#define HF_GEN_EXP_TABLE_SIZE 256
+#define HF_GEN_TAN_DUAL_TABLE_SIZE 256
+
+//Ordres d'interpolation utilisés lors de la génération (pentes présentes si HF_INTERP_CUBIC)
+#define HF_GEN_SIN_INTERP 1
+#define HF_GEN_ASIN_INTERP 1
+#define HF_GEN_ATAN_INTERP 1
+#define HF_GEN_LN_INTERP 1
+#define HF_GEN_EXP_INTERP 1
+#define HF_GEN_TAN_INTERP 1
+
+//Arrêt explicite si hf_precalc.h demande d'autres tailles ou ordres (sinon
+//tableaux tronqués, complétés par des zéros ou pentes manquantes)
+#if HF_GEN_SIN_TABLE_SIZE != SIN_TABLE_SIZE || HF_GEN_ASIN_TABLE_SIZE != ASIN_TABLE_SIZE \
+ || HF_GEN_ATAN_TABLE_SIZE != ATAN_TABLE_SIZE || HF_GEN_LN_TABLE_SIZE != LN_TABLE_SIZE \
+ || HF_GEN_EXP_TABLE_SIZE != EXP_TABLE_SIZE || HF_GEN_TAN_DUAL_TABLE_SIZE != TAN_DUAL_TABLE_SIZE
+#error "hf_precalc_tables.h ne correspond pas aux tailles de hf_precalc.h: relancer 'make tables'"
+#elif (HF_GEN_SIN_INTERP == HF_INTERP_CUBIC) != (SIN_INTERP == HF_INTERP_CUBIC) \
+ || (HF_GEN_ASIN_INTERP == HF_INTERP_CUBIC) != (ASIN_INTERP == HF_INTERP_CUBIC) \
+ || (HF_GEN_ATAN_INTERP == HF_INTERP_CUBIC) != (ATAN_INTERP == HF_INTERP_CUBIC) \
+ || (HF_GEN_LN_INTERP == HF_INTERP_CUBIC) != (LN_INTERP == HF_INTERP_CUBIC) \
+ || (HF_GEN_EXP_INTERP == HF_INTERP_CUBIC) != (EXP_INTERP == HF_INTERP_CUBIC) \
+ || (HF_GEN_TAN_INTERP == HF_INTERP_CUBIC) != (TAN_INTERP == HF_INTERP_CUBIC)
+#error "hf_precalc_tables.h ne correspond pas aux ordres d'interpolation de hf_precalc.h: relancer 'make tables'"
+#else
+
+HF_DATA const uint16_t sin_table[HF_GEN_SIN_TABLE_SIZE + 1] = {
+    0x0000, 0x0032, 0x0065, 0x0097, 0x00C9, 0x00FB, 0x012E, 0x0160,
+    0x0192, 0x01C4, 0x01F7, 0x0229, 0x025B, 0x028D, 0x02C0, 0x02F2,
+    0x0324, 0x0356, 0x0389, 0x03BB, 0x03ED, 0x041F, 0x0452, 0x0484,
+    0x04B6, 0x04E8, 0x051B, 0x054D, 0x057F, 0x05B1, 0x05E3, 0x0616,
+    0x0648, 0x067A, 0x06AC, 0x06DE, 0x0711, 0x0743, 0x0775, 0x07A7,
+    0x07D9, 0x080C, 0x083E, 0x0870, 0x08A2, 0x08D4, 0x0906, 0x0938,
+    0x096B, 0x099D, 0x09CF, 0x0A01, 0x0A33, 0x0A65, 0x0A97, 0x0AC9,
+    0x0AFB, 0x0B2D, 0x0B60, 0x0B92, 0x0BC4, 0x0BF6, 0x0C28, 0x0C5A,
+    0x0C8C, 0x0CBE, 0x0CF0, 0x0D22, 0x0D54, 0x0D86, 0x0DB8, 0x0DEA,
+    0x0E1C, 0x0E4E, 0x0E80, 0x0EB2, 0x0EE4, 0x0F15, 0x0F47, 0x0F79,
+    0x0FAB, 0x0FDD, 0x100F, 0x1041, 0x1073, 0x10A4, 0x10D6, 0x1108,
+    0x113A, 0x116C, 0x119E, 0x11CF, 0x1201, 0x1233, 0x1265, 0x1296,
+    0x12C8, 0x12FA, 0x132B, 0x135D, 0x138F, 0x13C1, 0x13F2, 0x1424,
+    0x1455, 0x1487, 0x14B9, 0x14EA, 0x151C, 0x154D, 0x157F, 0x15B1,
+    0x15E2, 0x1614, 0x1645, 0x1677, 0x16A8, 0x16DA, 0x170B, 0x173C,
+    0x176E, 0x179F, 0x17D1, 0x1802, 0x1833, 0x1865, 0x1896, 0x18C7,
+    0x18F9, 0x192A, 0x195B, 0x198D, 0x19BE, 0x19EF, 0x1A20, 0x1A51,
+    0x1A83, 0x1AB4, 0x1AE5, 0x1B16, 0x1B47, 0x1B78, 0x1BA9, 0x1BDA,
+    0x1C0C, 0x1C3D, 0x1C6E, 0x1C9F, 0x1CD0, 0x1D01, 0x1D31, 0x1D62,
+    0x1D93, 0x1DC4, 0x1DF5, 0x1E26, 0x1E57, 0x1E88, 0x1EB8, 0x1EE9,
+    0x1F1A, 0x1F4B, 0x1F7B, 0x1FAC, 0x1FDD, 0x200E, 0x203E, 0x206F,
+    0x209F, 0x20D0, 0x2101, 0x2131, 0x2162, 0x2192, 0x21C3, 0x21F3,
+    0x2224, 0x2254, 0x2284, 0x22B5, 0x22E5, 0x2316, 0x2346, 0x2376,
+    0x23A7, 0x23D7, 0x2407, 0x2437, 0x2467, 0x2498, 0x24C8, 0x24F8,
+    0x2528, 0x2558, 0x2588, 0x25B8, 0x25E8, 0x2618, 0x2648, 0x2678,
+    0x26A8, 0x26D8, 0x2708, 0x2738, 0x2768, 0x2797, 0x27C7, 0x27F7,
+    0x2827, 0x2856, 0x2886, 0x28B6, 0x28E5, 0x2915, 0x2945, 0x2974,
+    0x29A4, 0x29D3, 0x2A03, 0x2A32, 0x2A62, 0x2A91, 0x2AC1, 0x2AF0,
+    0x2B1F, 0x2B4F, 0x2B7E, 0x2BAD, 0x2BDC, 0x2C0C, 0x2C3B, 0x2C6A,
+    0x2C99, 0x2CC8, 0x2CF7, 0x2D26, 0x2D55, 0x2D84, 0x2DB3, 0x2DE2,
+    0x2E11, 0x2E40, 0x2E6F, 0x2E9E, 0x2ECC, 0x2EFB, 0x2F2A, 0x2F59,
+    0x2F87, 0x2FB6, 0x2FE5, 0x3013, 0x3042, 0x3070, 0x309F, 0x30CD,
+    0x30FC, 0x312A, 0x3159, 0x3187, 0x31B5, 0x31E4, 0x3212, 0x3240,
+    0x326E, 0x329D, 0x32CB, 0x32F9, 0x3327, 0x3355, 0x3383, 0x33B1,
+    0x33DF, 0x340D, 0x343B, 0x3469, 0x3497, 0x34C4, 0x34F2, 0x3520,
+    0x354E, 0x357B, 0x35A9, 0x35D7, 0x3604, 0x3632, 0x365F, 0x368D,
+    0x36BA, 0x36E8, 0x3715, 0x3742, 0x3770, 0x379D, 0x37CA, 0x37F7,
+    0x3825, 0x3852, 0x387F, 0x38AC, 0x38D9, 0x3906, 0x3933, 0x3960,
+    0x398D, 0x39BA, 0x39E7, 0x3A13, 0x3A40, 0x3A6D, 0x3A9A, 0x3AC6,
+    0x3AF3, 0x3B20, 0x3B4C, 0x3B79, 0x3BA5, 0x3BD2, 0x3BFE, 0x3C2A,
+    0x3C57, 0x3C83, 0x3CAF, 0x3CDC, 0x3D08, 0x3D34, 0x3D60, 0x3D8C,
+    0x3DB8, 0x3DE4, 0x3E10, 0x3E3C, 0x3E68, 0x3E94, 0x3EC0, 0x3EEC,
+    0x3F17, 0x3F43, 0x3F6F, 0x3F9A, 0x3FC6, 0x3FF1, 0x401D, 0x4048,
+    0x4074, 0x409F, 0x40CB, 0x40F6, 0x4121, 0x414D, 0x4178, 0x41A3,
+    0x41CE, 0x41F9, 0x4224, 0x424F, 0x427A, 0x42A5, 0x42D0, 0x42FB,
+    0x4326, 0x4351, 0x437B, 0x43A6, 0x43D1, 0x43FB, 0x4426, 0x4450,
+    0x447B, 0x44A5, 0x44D0, 0x44FA, 0x4524, 0x454F, 0x4579, 0x45A3,
+    0x45CD, 0x45F7, 0x4621, 0x464B, 0x4675, 0x469F, 0x46C9, 0x46F3,
+    0x471D, 0x4747, 0x4770, 0x479A, 0x47C4, 0x47ED, 0x4817, 0x4840,
+    0x486A, 0x4893, 0x48BD, 0x48E6, 0x490F, 0x4939, 0x4962, 0x498B,
+    0x49B4, 0x49DD, 0x4A06, 0x4A2F, 0x4A58, 0x4A81, 0x4AAA, 0x4AD3,
+    0x4AFB, 0x4B24, 0x4B4D, 0x4B75, 0x4B9E, 0x4BC7, 0x4BEF, 0x4C17,
+    0x4C40, 0x4C68, 0x4C91, 0x4CB9, 0x4CE1, 0x4D09, 0x4D31, 0x4D59,
+    0x4D81, 0x4DA9, 0x4DD1, 0x4DF9, 0x4E21, 0x4E49, 0x4E71, 0x4E98,
+    0x4EC0, 0x4EE8, 0x4F0F, 0x4F37, 0x4F5E, 0x4F85, 0x4FAD, 0x4FD4,
+    0x4FFB, 0x5023, 0x504A, 0x5071, 0x5098, 0x50BF, 0x50E6, 0x510D,
+    0x5134, 0x515B, 0x5181, 0x51A8, 0x51CF, 0x51F5, 0x521C, 0x5243,
+    0x5269, 0x5290, 0x52B6, 0x52DC, 0x5303, 0x5329, 0x534F, 0x5375,
+    0x539B, 0x53C1, 0x53E7, 0x540D, 0x5433, 0x5459, 0x547F, 0x54A4,
+    0x54CA, 0x54F0, 0x5515, 0x553B, 0x5560, 0x5586, 0x55AB, 0x55D0,
+    0x55F6, 0x561B, 0x5640, 0x5665, 0x568A, 0x56AF, 0x56D4, 0x56F9,
+    0x571E, 0x5743, 0x5767, 0x578C, 0x57B1, 0x57D5, 0x57FA, 0x581E,
+    0x5843, 0x5867, 0x588C, 0x58B0, 0x58D4, 0x58F8, 0x591C, 0x5940,
+    0x5964, 0x5988, 0x59AC, 0x59D0, 0x59F4, 0x5A18, 0x5A3B, 0x5A5F,
+    0x5A82, 0x5AA6, 0x5AC9, 0x5AED, 0x5B10, 0x5B34, 0x5B57, 0x5B7A,
+    0x5B9D, 0x5BC0, 0x5BE3, 0x5C06, 0x5C29, 0x5C4C, 0x5C6F, 0x5C91,
+    0x5CB4, 0x5CD7, 0x5CF9, 0x5D1C, 0x5D3E, 0x5D61, 0x5D83, 0x5DA5,
+    0x5DC8, 0x5DEA, 0x5E0C, 0x5E2E, 0x5E50, 0x5E72, 0x5E94, 0x5EB6,
+    0x5ED7, 0x5EF9, 0x5F1B, 0x5F3C, 0x5F5E, 0x5F80, 0x5FA1, 0x5FC2,
+    0x5FE4, 0x6005, 0x6026, 0x6047, 0x6068, 0x6089, 0x60AA, 0x60CB,
+    0x60EC, 0x610D, 0x612E, 0x614E, 0x616F, 0x6190, 0x61B0, 0x61D1,
+    0x61F1, 0x6211, 0x6232, 0x6252, 0x6272, 0x6292, 0x62B2, 0x62D2,
+    0x62F2, 0x6312, 0x6332, 0x6351, 0x6371, 0x6391, 0x63B0, 0x63D0,
+    0x63EF, 0x640F, 0x642E, 0x644D, 0x646C, 0x648B, 0x64AB, 0x64CA,
+    0x64E9, 0x6507, 0x6526, 0x6545, 0x6564, 0x6582, 0x65A1, 0x65C0,
+    0x65DE, 0x65FC, 0x661B, 0x6639, 0x6657, 0x6675, 0x6693, 0x66B2,
+    0x66D0, 0x66ED, 0x670B, 0x6729, 0x6747, 0x6764, 0x6782, 0x67A0,
+    0x67BD, 0x67DA, 0x67F8, 0x6815, 0x6832, 0x6850, 0x686D, 0x688A,
+    0x68A7, 0x68C4, 0x68E0, 0x68FD, 0x691A, 0x6937, 0x6953, 0x6970,
+    0x698C, 0x69A9, 0x69C5, 0x69E1, 0x69FD, 0x6A1A, 0x6A36, 0x6A52,
+    0x6A6E, 0x6A89, 0x6AA5, 0x6AC1, 0x6ADD, 0x6AF8, 0x6B14, 0x6B30,
+    0x6B4B, 0x6B66, 0x6B82, 0x6B9D, 0x6BB8, 0x6BD3, 0x6BEE, 0x6C09,
+    0x6C24, 0x6C3F, 0x6C5A, 0x6C75, 0x6C8F, 0x6CAA, 0x6CC4, 0x6CDF,
+    0x6CF9, 0x6D14, 0x6D2E, 0x6D48, 0x6D62, 0x6D7C, 0x6D96, 0x6DB0,
+    0x6DCA, 0x6DE4, 0x6DFE, 0x6E17, 0x6E31, 0x6E4A, 0x6E64, 0x6E7D,
+    0x6E97, 0x6EB0, 0x6EC9, 0x6EE2, 0x6EFB, 0x6F14, 0x6F2D, 0x6F46,
+    0x6F5F, 0x6F78, 0x6F90, 0x6FA9, 0x6FC2, 0x6FDA, 0x6FF2, 0x700B,
+    0x7023, 0x703B, 0x7053, 0x706B, 0x7083, 0x709B, 0x70B3, 0x70CB,
+    0x70E3, 0x70FA, 0x7112, 0x712A, 0x7141, 0x7158, 0x7170, 0x7187,
+    0x719E, 0x71B5, 0x71CC, 0x71E3, 0x71FA, 0x7211, 0x7228, 0x723F,
+    0x7255, 0x726C, 0x7282, 0x7299, 0x72AF, 0x72C5, 0x72DC, 0x72F2,
+    0x7308, 0x731E, 0x7334, 0x734A, 0x735F, 0x7375, 0x738B, 0x73A0,
+    0x73B6, 0x73CB, 0x73E1, 0x73F6, 0x740B, 0x7421, 0x7436, 0x744B,
+    0x7460, 0x7475, 0x7489, 0x749E, 0x74B3, 0x74C7, 0x74DC, 0x74F0,
+    0x7505, 0x7519, 0x752D, 0x7542, 0x7556, 0x756A, 0x757E, 0x7592,
+    0x75A6, 0x75B9, 0x75CD, 0x75E1, 0x75F4, 0x7608, 0x761B, 0x762E,
+    0x7642, 0x7655, 0x7668, 0x767B, 0x768E, 0x76A1, 0x76B4, 0x76C7,
+    0x76D9, 0x76EC, 0x76FE, 0x7711, 0x7723, 0x7736, 0x7748, 0x775A,
+    0x776C, 0x777E, 0x7790, 0x77A2, 0x77B4, 0x77C6, 0x77D8, 0x77E9,
+    0x77FB, 0x780C, 0x781E, 0x782F, 0x7840, 0x7851, 0x7863, 0x7874,
+    0x7885, 0x7895, 0x78A6, 0x78B7, 0x78C8, 0x78D8, 0x78E9, 0x78F9,
+    0x790A, 0x791A, 0x792A, 0x793A, 0x794A, 0x795B, 0x796A, 0x797A,
+    0x798A, 0x799A, 0x79AA, 0x79B9, 0x79C9, 0x79D8, 0x79E7, 0x79F7,
+    0x7A06, 0x7A15, 0x7A24, 0x7A33, 0x7A42, 0x7A51, 0x7A60, 0x7A6E,
+    0x7A7D, 0x7A8C, 0x7A9A, 0x7AA8, 0x7AB7, 0x7AC5, 0x7AD3, 0x7AE1,
+    0x7AEF, 0x7AFD, 0x7B0B, 0x7B19, 0x7B27, 0x7B34, 0x7B42, 0x7B50,
+    0x7B5D, 0x7B6A, 0x7B78, 0x7B85, 0x7B92, 0x7B9F, 0x7BAC, 0x7BB9,
+    0x7BC6, 0x7BD3, 0x7BDF, 0x7BEC, 0x7BF9, 0x7C05, 0x7C11, 0x7C1E,
+    0x7C2A, 0x7C36, 0x7C42, 0x7C4E, 0x7C5A, 0x7C66, 0x7C72, 0x7C7E,
+    0x7C89, 0x7C95, 0x7CA0, 0x7CAC, 0x7CB7, 0x7CC2, 0x7CCE, 0x7CD9,
+    0x7CE4, 0x7CEF, 0x7CFA, 0x7D05, 0x7D0F, 0x7D1A, 0x7D25, 0x7D2F,
+    0x7D3A, 0x7D44, 0x7D4E, 0x7D58, 0x7D63, 0x7D6D, 0x7D77, 0x7D81,
+    0x7D8A, 0x7D94, 0x7D9E, 0x7DA7, 0x7DB1, 0x7DBA, 0x7DC4, 0x7DCD,
+    0x7DD6, 0x7DE0, 0x7DE9, 0x7DF2, 0x7DFB, 0x7E03, 0x7E0C, 0x7E15,
+    0x7E1E, 0x7E26, 0x7E2F, 0x7E37, 0x7E3F, 0x7E48, 0x7E50, 0x7E58,
+    0x7E60, 0x7E68, 0x7E70, 0x7E78, 0x7E7F, 0x7E87, 0x7E8E, 0x7E96,
+    0x7E9D, 0x7EA5, 0x7EAC, 0x7EB3, 0x7EBA, 0x7EC1, 0x7EC8, 0x7ECF,
+    0x7ED6, 0x7EDD, 0x7EE3, 0x7EEA, 0x7EF0, 0x7EF7, 0x7EFD, 0x7F03,
+    0x7F0A, 0x7F10, 0x7F16, 0x7F1C, 0x7F22, 0x7F27, 0x7F2D, 0x7F33,
+    0x7F38, 0x7F3E, 0x7F43, 0x7F49, 0x7F4E, 0x7F53, 0x7F58, 0x7F5D,
+    0x7F62, 0x7F67, 0x7F6C, 0x7F71, 0x7F75, 0x7F7A, 0x7F7E, 0x7F83,
+    0x7F87, 0x7F8B, 0x7F90, 0x7F94, 0x7F98, 0x7F9C, 0x7FA0, 0x7FA3,
+    0x7FA7, 0x7FAB, 0x7FAE, 0x7FB2, 0x7FB5, 0x7FB9, 0x7FBC, 0x7FBF,
+    0x7FC2, 0x7FC5, 0x7FC8, 0x7FCB, 0x7FCE, 0x7FD1, 0x7FD3, 0x7FD6,
+    0x7FD9, 0x7FDB, 0x7FDD, 0x7FE0, 0x7FE2, 0x7FE4, 0x7FE6, 0x7FE8,
+    0x7FEA, 0x7FEC, 0x7FED, 0x7FEF, 0x7FF1, 0x7FF2, 0x7FF4, 0x7FF5,
+    0x7FF6, 0x7FF7, 0x7FF8, 0x7FF9, 0x7FFA, 0x7FFB, 0x7FFC, 0x7FFD,
+    0x7FFE, 0x7FFE, 0x7FFF, 0x7FFF, 0x7FFF, 0x8000, 0x8000, 0x8000,
+    0x8000,
+};
+
+HF_DATA const uint16_t asin_table[HF_GEN_ASIN_TABLE_SIZE + 1] = {
+    0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00A0, 0x00C0, 0x00E0,
+    0x0100, 0x0120, 0x0140, 0x0160, 0x0180, 0x01A0, 0x01C0, 0x01E0,
+    0x0200, 0x0220, 0x0240, 0x0260, 0x0280, 0x02A0, 0x02C0, 0x02E0,
+    0x0300, 0x0320, 0x0340, 0x0360, 0x0380, 0x03A0, 0x03C0, 0x03E0,
+    0x0400, 0x0420, 0x0440, 0x0460, 0x0480, 0x04A0, 0x04C0, 0x04E0,
+    0x0500, 0x0520, 0x0540, 0x0560, 0x0580, 0x05A0, 0x05C0, 0x05E1,
+    0x0601, 0x0621, 0x0641, 0x0661, 0x0681, 0x06A1, 0x06C1, 0x06E1,
+    0x0701, 0x0721, 0x0741, 0x0761, 0x0781, 0x07A1, 0x07C1, 0x07E1,
+    0x0801, 0x0821, 0x0841, 0x0862, 0x0882, 0x08A2, 0x08C2, 0x08E2,
+    0x0902, 0x0922, 0x0942, 0x0962, 0x0982, 0x09A2, 0x09C2, 0x09E3,
+    0x0A03, 0x0A23, 0x0A43, 0x0A63, 0x0A83, 0x0AA3, 0x0AC3, 0x0AE3,
+    0x0B03, 0x0B24, 0x0B44, 0x0B64, 0x0B84, 0x0BA4, 0x0BC4, 0x0BE4,
+    0x0C05, 0x0C25, 0x0C45, 0x0C65, 0x0C85, 0x0CA5, 0x0CC5, 0x0CE6,
+    0x0D06, 0x0D26, 0x0D46, 0x0D66, 0x0D86, 0x0DA7, 0x0DC7, 0x0DE7,
+    0x0E07, 0x0E27, 0x0E48, 0x0E68, 0x0E88, 0x0EA8, 0x0EC8, 0x0EE9,
+    0x0F09, 0x0F29, 0x0F49, 0x0F6A, 0x0F8A, 0x0FAA, 0x0FCA, 0x0FEA,
+    0x100B, 0x102B, 0x104B, 0x106C, 0x108C, 0x10AC, 0x10CC, 0x10ED,
+    0x110D, 0x112D, 0x114D, 0x116E, 0x118E, 0x11AE, 0x11CF, 0x11EF,
+    0x120F, 0x1230, 0x1250, 0x1270, 0x1291, 0x12B1, 0x12D1, 0x12F2,
+    0x1312, 0x1332, 0x1353, 0x1373, 0x1394, 0x13B4, 0x13D4, 0x13F5,
+    0x1415, 0x1435, 0x1456, 0x1476, 0x1497, 0x14B7, 0x14D8, 0x14F8,
+    0x1518, 0x1539, 0x1559, 0x157A, 0x159A, 0x15BB, 0x15DB, 0x15FC,
+    0x161C, 0x163D, 0x165D, 0x167E, 0x169E, 0x16BF, 0x16DF, 0x1700,
+    0x1720, 0x1741, 0x1761, 0x1782, 0x17A2, 0x17C3, 0x17E3, 0x1804,
+    0x1825, 0x1845, 0x1866, 0x1886, 0x18A7, 0x18C8, 0x18E8, 0x1909,
+    0x1929, 0x194A, 0x196B, 0x198B, 0x19AC, 0x19CD, 0x19ED, 0x1A0E,
+    0x1A2F, 0x1A4F, 0x1A70, 0x1A91, 0x1AB1, 0x1AD2, 0x1AF3, 0x1B14,
+    0x1B34, 0x1B55, 0x1B76, 0x1B97, 0x1BB7, 0x1BD8, 0x1BF9, 0x1C1A,
+    0x1C3A, 0x1C5B, 0x1C7C, 0x1C9D, 0x1CBE, 0x1CDE, 0x1CFF, 0x1D20,
+    0x1D41, 0x1D62, 0x1D83, 0x1DA4, 0x1DC5, 0x1DE5, 0x1E06, 0x1E27,
+    0x1E48, 0x1E69, 0x1E8A, 0x1EAB, 0x1ECC, 0x1EED, 0x1F0E, 0x1F2F,
+    0x1F50, 0x1F71, 0x1F92, 0x1FB3, 0x1FD4, 0x1FF5, 0x2016, 0x2037,
+    0x2058, 0x2079, 0x209A, 0x20BB, 0x20DC, 0x20FD, 0x211E, 0x213F,
+    0x2161, 0x2182, 0x21A3, 0x21C4, 0x21E5, 0x2206, 0x2227, 0x2249,
+    0x226A, 0x228B, 0x22AC, 0x22CD, 0x22EF, 0x2310, 0x2331, 0x2352,
+    0x2374, 0x2395, 0x23B6, 0x23D7, 0x23F9, 0x241A, 0x243B, 0x245D,
+    0x247E, 0x249F, 0x24C1, 0x24E2, 0x2504, 0x2525, 0x2546, 0x2568,
+    0x2589, 0x25AB, 0x25CC, 0x25ED, 0x260F, 0x2630, 0x2652, 0x2673,
+    0x2695, 0x26B6, 0x26D8, 0x26F9, 0x271B, 0x273D, 0x275E, 0x2780,
+    0x27A1, 0x27C3, 0x27E5, 0x2806, 0x2828, 0x2849, 0x286B, 0x288D,
+    0x28AE, 0x28D0, 0x28F2, 0x2914, 0x2935, 0x2957, 0x2979, 0x299B,
+    0x29BC, 0x29DE, 0x2A00, 0x2A22, 0x2A44, 0x2A65, 0x2A87, 0x2AA9,
+    0x2ACB, 0x2AED, 0x2B0F, 0x2B31, 0x2B53, 0x2B74, 0x2B96, 0x2BB8,
+    0x2BDA, 0x2BFC, 0x2C1E, 0x2C40, 0x2C62, 0x2C84, 0x2CA6, 0x2CC8,
+    0x2CEB, 0x2D0D, 0x2D2F, 0x2D51, 0x2D73, 0x2D95, 0x2DB7, 0x2DD9,
+    0x2DFC, 0x2E1E, 0x2E40, 0x2E62, 0x2E84, 0x2EA7, 0x2EC9, 0x2EEB,
+    0x2F0D, 0x2F30, 0x2F52, 0x2F74, 0x2F97, 0x2FB9, 0x2FDB, 0x2FFE,
+    0x3020, 0x3043, 0x3065, 0x3088, 0x30AA, 0x30CC, 0x30EF, 0x3111,
+    0x3134, 0x3156, 0x3179, 0x319C, 0x31BE, 0x31E1, 0x3203, 0x3226,
+    0x3249, 0x326B, 0x328E, 0x32B1, 0x32D3, 0x32F6, 0x3319, 0x333B,
+    0x335E, 0x3381, 0x33A4, 0x33C6, 0x33E9, 0x340C, 0x342F, 0x3452,
+    0x3475, 0x3498, 0x34BB, 0x34DD, 0x3500, 0x3523, 0x3546, 0x3569,
+    0x358C, 0x35AF, 0x35D2, 0x35F6, 0x3619, 0x363C, 0x365F, 0x3682,
+    0x36A5, 0x36C8, 0x36EB, 0x370F, 0x3732, 0x3755, 0x3778, 0x379C,
+    0x37BF, 0x37E2, 0x3805, 0x3829, 0x384C, 0x3870, 0x3893, 0x38B6,
+    0x38DA, 0x38FD, 0x3921, 0x3944, 0x3968, 0x398B, 0x39AF, 0x39D2,
+    0x39F6, 0x3A19, 0x3A3D, 0x3A61, 0x3A84, 0x3AA8, 0x3ACC, 0x3AEF,
+    0x3B13, 0x3B37, 0x3B5B, 0x3B7E, 0x3BA2, 0x3BC6, 0x3BEA, 0x3C0E,
+    0x3C32, 0x3C56, 0x3C7A, 0x3C9E, 0x3CC1, 0x3CE5, 0x3D09, 0x3D2E,
+    0x3D52, 0x3D76, 0x3D9A, 0x3DBE, 0x3DE2, 0x3E06, 0x3E2A, 0x3E4E,
+    0x3E73, 0x3E97, 0x3EBB, 0x3EDF, 0x3F04, 0x3F28, 0x3F4C, 0x3F71,
+    0x3F95, 0x3FBA, 0x3FDE, 0x4002, 0x4027, 0x404B, 0x4070, 0x4095,
+    0x40B9, 0x40DE, 0x4102, 0x4127, 0x414C, 0x4170, 0x4195, 0x41BA,
+    0x41DE, 0x4203, 0x4228, 0x424D, 0x4272, 0x4297, 0x42BB, 0x42E0,
+    0x4305, 0x432A, 0x434F, 0x4374, 0x4399, 0x43BE, 0x43E3, 0x4409,
+    0x442E, 0x4453, 0x4478, 0x449D, 0x44C2, 0x44E8, 0x450D, 0x4532,
+    0x4558, 0x457D, 0x45A2, 0x45C8, 0x45ED, 0x4613, 0x4638, 0x465E,
+    0x4683, 0x46A9, 0x46CE, 0x46F4, 0x471A, 0x473F, 0x4765, 0x478B,
+    0x47B1, 0x47D6, 0x47FC, 0x4822, 0x4848, 0x486E, 0x4894, 0x48BA,
+    0x48E0, 0x4906, 0x492C, 0x4952, 0x4978, 0x499E, 0x49C4, 0x49EA,
+    0x4A10, 0x4A37, 0x4A5D, 0x4A83, 0x4AAA, 0x4AD0, 0x4AF6, 0x4B1D,
+    0x4B43, 0x4B6A, 0x4B90, 0x4BB7, 0x4BDD, 0x4C04, 0x4C2A, 0x4C51,
+    0x4C78, 0x4C9F, 0x4CC5, 0x4CEC, 0x4D13, 0x4D3A, 0x4D61, 0x4D88,
+    0x4DAE, 0x4DD5, 0x4DFC, 0x4E23, 0x4E4B, 0x4E72, 0x4E99, 0x4EC0,
+    0x4EE7, 0x4F0E, 0x4F36, 0x4F5D, 0x4F84, 0x4FAC, 0x4FD3, 0x4FFA,
+    0x5022, 0x5049, 0x5071, 0x5099, 0x50C0, 0x50E8, 0x5110, 0x5137,
+    0x515F, 0x5187, 0x51AF, 0x51D6, 0x51FE, 0x5226, 0x524E, 0x5276,
+    0x529E, 0x52C6, 0x52EE, 0x5317, 0x533F, 0x5367, 0x538F, 0x53B8,
+    0x53E0, 0x5408, 0x5431, 0x5459, 0x5482, 0x54AA, 0x54D3, 0x54FB,
+    0x5524, 0x554D, 0x5575, 0x559E, 0x55C7, 0x55F0, 0x5619, 0x5642,
+    0x566B, 0x5694, 0x56BD, 0x56E6, 0x570F, 0x5738, 0x5761, 0x578B,
+    0x57B4, 0x57DD, 0x5807, 0x5830, 0x585A, 0x5883, 0x58AD, 0x58D6,
+    0x5900, 0x592A, 0x5953, 0x597D, 0x59A7, 0x59D1, 0x59FB, 0x5A25,
+    0x5A4F, 0x5A79, 0x5AA3, 0x5ACD, 0x5AF7, 0x5B22, 0x5B4C, 0x5B76,
+    0x5BA1, 0x5BCB, 0x5BF5, 0x5C20, 0x5C4B, 0x5C75, 0x5CA0, 0x5CCB,
+    0x5CF5, 0x5D20, 0x5D4B, 0x5D76, 0x5DA1, 0x5DCC, 0x5DF7, 0x5E22,
+    0x5E4D, 0x5E79, 0x5EA4, 0x5ECF, 0x5EFB, 0x5F26, 0x5F52, 0x5F7D,
+    0x5FA9, 0x5FD4, 0x6000, 0x602C, 0x6058, 0x6084, 0x60AF, 0x60DB,
+    0x6107, 0x6134, 0x6160, 0x618C, 0x61B8, 0x61E5, 0x6211, 0x623D,
+    0x626A, 0x6296, 0x62C3, 0x62F0, 0x631C, 0x6349, 0x6376, 0x63A3,
+    0x63D0, 0x63FD, 0x642A, 0x6457, 0x6484, 0x64B2, 0x64DF, 0x650C,
+    0x653A, 0x6567, 0x6595, 0x65C3, 0x65F0, 0x661E, 0x664C, 0x667A,
+    0x66A8, 0x66D6, 0x6704, 0x6732, 0x6761, 0x678F, 0x67BD, 0x67EC,
+    0x681A, 0x6849, 0x6878, 0x68A6, 0x68D5, 0x6904, 0x6933, 0x6962,
+    0x6991, 0x69C0, 0x69F0, 0x6A1F, 0x6A4E, 0x6A7E, 0x6AAD, 0x6ADD,
+    0x6B0D, 0x6B3D, 0x6B6C, 0x6B9C, 0x6BCC, 0x6BFD, 0x6C2D, 0x6C5D,
+    0x6C8D, 0x6CBE, 0x6CEE, 0x6D1F, 0x6D4F, 0x6D80, 0x6DB1, 0x6DE2,
+    0x6E13, 0x6E44, 0x6E75, 0x6EA6, 0x6ED8, 0x6F09, 0x6F3B, 0x6F6C,
+    0x6F9E, 0x6FD0, 0x7002, 0x7034, 0x7066, 0x7098, 0x70CA, 0x70FD,
+    0x712F, 0x7162, 0x7194, 0x71C7, 0x71FA, 0x722D, 0x7260, 0x7293,
+    0x72C6, 0x72F9, 0x732D, 0x7360, 0x7394, 0x73C8, 0x73FB, 0x742F,
+    0x7463, 0x7497, 0x74CC, 0x7500, 0x7535, 0x7569, 0x759E, 0x75D3,
+    0x7608, 0x763D, 0x7672, 0x76A7, 0x76DC, 0x7712, 0x7747, 0x777D,
+    0x77B3, 0x77E9, 0x781F, 0x7855, 0x788C, 0x78C2, 0x78F9, 0x792F,
+    0x7966, 0x799D, 0x79D4, 0x7A0B, 0x7A43, 0x7A7A, 0x7AB2, 0x7AEA,
+    0x7B21, 0x7B59, 0x7B92, 0x7BCA, 0x7C02, 0x7C3B, 0x7C74, 0x7CAD,
+    0x7CE6, 0x7D1F, 0x7D58, 0x7D91, 0x7DCB, 0x7E05, 0x7E3F, 0x7E79,
+    0x7EB3, 0x7EED, 0x7F28, 0x7F63, 0x7F9E, 0x7FD9, 0x8014, 0x804F,
+    0x808B, 0x80C6, 0x8102, 0x813E, 0x817B, 0x81B7, 0x81F4, 0x8230,
+    0x826D, 0x82AA, 0x82E8, 0x8325, 0x8363, 0x83A1, 0x83DF, 0x841D,
+    0x845C, 0x849A, 0x84D9, 0x8518, 0x8558, 0x8597, 0x85D7, 0x8617,
+    0x8657, 0x8697, 0x86D8, 0x8719, 0x875A, 0x879B, 0x87DC, 0x881E,
+    0x8860, 0x88A2, 0x88E5, 0x8928, 0x896B, 0x89AE, 0x89F1, 0x8A35,
+    0x8A79, 0x8ABD, 0x8B02, 0x8B47, 0x8B8C, 0x8BD1, 0x8C17, 0x8C5D,
+    0x8CA3, 0x8CE9, 0x8D30, 0x8D77, 0x8DBF, 0x8E06, 0x8E4E, 0x8E97,
+    0x8EE0, 0x8F29, 0x8F72, 0x8FBC, 0x9006, 0x9050, 0x909B, 0x90E6,
+    0x9132, 0x917E, 0x91CA, 0x9216, 0x9263, 0x92B1, 0x92FF, 0x934D,
+    0x939C, 0x93EB, 0x943A, 0x948A, 0x94DB, 0x952C, 0x957D, 0x95CF,
+    0x9621, 0x9674, 0x96C7, 0x971B, 0x9770, 0x97C5, 0x981A, 0x9870,
+    0x98C7, 0x991E, 0x9976, 0x99CE, 0x9A27, 0x9A81, 0x9ADB, 0x9B36,
+    0x9B91, 0x9BEE, 0x9C4B, 0x9CA8, 0x9D07, 0x9D66, 0x9DC6, 0x9E27,
+    0x9E89, 0x9EEB, 0x9F4F, 0x9FB3, 0xA018, 0xA07F, 0xA0E6, 0xA14E,
+    0xA1B7, 0xA221, 0xA28D, 0xA2F9, 0xA367, 0xA3D6, 0xA446, 0xA4B8,
+    0xA52B, 0xA59F, 0xA615, 0xA68C, 0xA705, 0xA780, 0xA7FC, 0xA87A,
+    0xA8FA, 0xA97C, 0xAA00, 0xAA87, 0xAB0F, 0xAB9A, 0xAC28, 0xACB8,
+    0xAD4B, 0xADE2, 0xAE7B, 0xAF18, 0xAFB9, 0xB05E, 0xB107, 0xB1B5,
+    0xB268, 0xB320, 0xB3DF, 0xB4A5, 0xB572, 0xB649, 0xB729, 0xB814,
+    0xB90D, 0xBA16, 0xBB33, 0xBC68, 0xBDBF, 0xBF43, 0xC110, 0xC368,
+    0xC910,
+};
+
+HF_DATA const uint16_t atan_table[HF_GEN_ATAN_TABLE_SIZE + 1] = {
+    0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00A0, 0x00C0, 0x00E0,
+    0x0100, 0x0120, 0x0140, 0x0160, 0x0180, 0x01A0, 0x01C0, 0x01E0,
+    0x0200, 0x0220, 0x0240, 0x0260, 0x0280, 0x02A0, 0x02C0, 0x02E0,
+    0x0300, 0x0320, 0x0340, 0x0360, 0x0380, 0x03A0, 0x03C0, 0x03E0,
+    0x0400, 0x0420, 0x0440, 0x0460, 0x0480, 0x049F, 0x04BF, 0x04DF,
+    0x04FF, 0x051F, 0x053F, 0x055F, 0x057F, 0x059F, 0x05BF, 0x05DF,
+    0x05FF, 0x061F, 0x063F, 0x065F, 0x067F, 0x069E, 0x06BE, 0x06DE,
+    0x06FE, 0x071E, 0x073E, 0x075E, 0x077E, 0x079E, 0x07BE, 0x07DD,
+    0x07FD, 0x081D, 0x083D, 0x085D, 0x087D, 0x089D, 0x08BD, 0x08DC,
+    0x08FC, 0x091C, 0x093C, 0x095C, 0x097C, 0x099B, 0x09BB, 0x09DB,
+    0x09FB, 0x0A1B, 0x0A3A, 0x0A5A, 0x0A7A, 0x0A9A, 0x0ABA, 0x0AD9,
+    0x0AF9, 0x0B19, 0x0B39, 0x0B58, 0x0B78, 0x0B98, 0x0BB8, 0x0BD7,
+    0x0BF7, 0x0C17, 0x0C36, 0x0C56, 0x0C76, 0x0C96, 0x0CB5, 0x0CD5,
+    0x0CF5, 0x0D14, 0x0D34, 0x0D54, 0x0D73, 0x0D93, 0x0DB3, 0x0DD2,
+    0x0DF2, 0x0E11, 0x0E31, 0x0E51, 0x0E70, 0x0E90, 0x0EAF, 0x0ECF,
+    0x0EEF, 0x0F0E, 0x0F2E, 0x0F4D, 0x0F6D, 0x0F8C, 0x0FAC, 0x0FCB,
+    0x0FEB, 0x100A, 0x102A, 0x1049, 0x1069, 0x1088, 0x10A8, 0x10C7,
+    0x10E7, 0x1106, 0x1126, 0x1145, 0x1164, 0x1184, 0x11A3, 0x11C3,
+    0x11E2, 0x1201, 0x1221, 0x1240, 0x125F, 0x127F, 0x129E, 0x12BD,
+    0x12DD, 0x12FC, 0x131B, 0x133B, 0x135A, 0x1379, 0x1398, 0x13B8,
+    0x13D7, 0x13F6, 0x1415, 0x1435, 0x1454, 0x1473, 0x1492, 0x14B1,
+    0x14D1, 0x14F0, 0x150F, 0x152E, 0x154D, 0x156C, 0x158B, 0x15AA,
+    0x15CA, 0x15E9, 0x1608, 0x1627, 0x1646, 0x1665, 0x1684, 0x16A3,
+    0x16C2, 0x16E1, 0x1700, 0x171F, 0x173E, 0x175D, 0x177C, 0x179B,
+    0x17B9, 0x17D8, 0x17F7, 0x1816, 0x1835, 0x1854, 0x1873, 0x1892,
+    0x18B0, 0x18CF, 0x18EE, 0x190D, 0x192C, 0x194A, 0x1969, 0x1988,
+    0x19A7, 0x19C5, 0x19E4, 0x1A03, 0x1A21, 0x1A40, 0x1A5F, 0x1A7D,
+    0x1A9C, 0x1ABB, 0x1AD9, 0x1AF8, 0x1B17, 0x1B35, 0x1B54, 0x1B72,
+    0x1B91, 0x1BAF, 0x1BCE, 0x1BEC, 0x1C0B, 0x1C29, 0x1C48, 0x1C66,
+    0x1C85, 0x1CA3, 0x1CC2, 0x1CE0, 0x1CFE, 0x1D1D, 0x1D3B, 0x1D59,
+    0x1D78, 0x1D96, 0x1DB4, 0x1DD3, 0x1DF1, 0x1E0F, 0x1E2E, 0x1E4C,
+    0x1E6A, 0x1E88, 0x1EA7, 0x1EC5, 0x1EE3, 0x1F01, 0x1F1F, 0x1F3D,
+    0x1F5B, 0x1F7A, 0x1F98, 0x1FB6, 0x1FD4, 0x1FF2, 0x2010, 0x202E,
+    0x204C, 0x206A, 0x2088, 0x20A6, 0x20C4, 0x20E2, 0x2100, 0x211E,
+    0x213C, 0x2159, 0x2177, 0x2195, 0x21B3, 0x21D1, 0x21EF, 0x220C,
+    0x222A, 0x2248, 0x2266, 0x2283, 0x22A1, 0x22BF, 0x22DD, 0x22FA,
+    0x2318, 0x2336, 0x2353, 0x2371, 0x238E, 0x23AC, 0x23CA, 0x23E7,
+    0x2405, 0x2422, 0x2440, 0x245D, 0x247B, 0x2498, 0x24B6, 0x24D3,
+    0x24F0, 0x250E, 0x252B, 0x2549, 0x2566, 0x2583, 0x25A1, 0x25BE,
+    0x25DB, 0x25F8, 0x2616, 0x2633, 0x2650, 0x266D, 0x268B, 0x26A8,
+    0x26C5, 0x26E2, 0x26FF, 0x271C, 0x2739, 0x2756, 0x2774, 0x2791,
+    0x27AE, 0x27CB, 0x27E8, 0x2805, 0x2822, 0x283F, 0x285B, 0x2878,
+    0x2895, 0x28B2, 0x28CF, 0x28EC, 0x2909, 0x2926, 0x2942, 0x295F,
+    0x297C, 0x2999, 0x29B5, 0x29D2, 0x29EF, 0x2A0B, 0x2A28, 0x2A45,
+    0x2A61, 0x2A7E, 0x2A9B, 0x2AB7, 0x2AD4, 0x2AF0, 0x2B0D, 0x2B29,
+    0x2B46, 0x2B62, 0x2B7F, 0x2B9B, 0x2BB8, 0x2BD4, 0x2BF0, 0x2C0D,
+    0x2C29, 0x2C45, 0x2C62, 0x2C7E, 0x2C9A, 0x2CB7, 0x2CD3, 0x2CEF,
+    0x2D0B, 0x2D27, 0x2D44, 0x2D60, 0x2D7C, 0x2D98, 0x2DB4, 0x2DD0,
+    0x2DEC, 0x2E08, 0x2E24, 0x2E40, 0x2E5C, 0x2E78, 0x2E94, 0x2EB0,
+    0x2ECC, 0x2EE8, 0x2F04, 0x2F20, 0x2F3C, 0x2F57, 0x2F73, 0x2F8F,
+    0x2FAB, 0x2FC7, 0x2FE2, 0x2FFE, 0x301A, 0x3035, 0x3051, 0x306D,
+    0x3088, 0x30A4, 0x30BF, 0x30DB, 0x30F7, 0x3112, 0x312E, 0x3149,
+    0x3165, 0x3180, 0x319B, 0x31B7, 0x31D2, 0x31EE, 0x3209, 0x3224,
+    0x3240, 0x325B, 0x3276, 0x3292, 0x32AD, 0x32C8, 0x32E3, 0x32FE,
+    0x331A, 0x3335, 0x3350, 0x336B, 0x3386, 0x33A1, 0x33BC, 0x33D7,
+    0x33F2, 0x340D, 0x3428, 0x3443, 0x345E, 0x3479, 0x3494, 0x34AF,
+    0x34CA, 0x34E5, 0x3500, 0x351A, 0x3535, 0x3550, 0x356B, 0x3585,
+    0x35A0, 0x35BB, 0x35D5, 0x35F0, 0x360B, 0x3625, 0x3640, 0x365B,
+    0x3675, 0x3690, 0x36AA, 0x36C5, 0x36DF, 0x36FA, 0x3714, 0x372E,
+    0x3749, 0x3763, 0x377E, 0x3798, 0x37B2, 0x37CD, 0x37E7, 0x3801,
+    0x381B, 0x3836, 0x3850, 0x386A, 0x3884, 0x389E, 0x38B8, 0x38D3,
+    0x38ED, 0x3907, 0x3921, 0x393B, 0x3955, 0x396F, 0x3989, 0x39A3,
+    0x39BD, 0x39D7, 0x39F0, 0x3A0A, 0x3A24, 0x3A3E, 0x3A58, 0x3A72,
+    0x3A8B, 0x3AA5, 0x3ABF, 0x3AD9, 0x3AF2, 0x3B0C, 0x3B26, 0x3B3F,
+    0x3B59, 0x3B72, 0x3B8C, 0x3BA6, 0x3BBF, 0x3BD9, 0x3BF2, 0x3C0C,
+    0x3C25, 0x3C3E, 0x3C58, 0x3C71, 0x3C8B, 0x3CA4, 0x3CBD, 0x3CD7,
+    0x3CF0, 0x3D09, 0x3D22, 0x3D3C, 0x3D55, 0x3D6E, 0x3D87, 0x3DA0,
+    0x3DB9, 0x3DD3, 0x3DEC, 0x3E05, 0x3E1E, 0x3E37, 0x3E50, 0x3E69,
+    0x3E82, 0x3E9B, 0x3EB4, 0x3ECD, 0x3EE5, 0x3EFE, 0x3F17, 0x3F30,
+    0x3F49, 0x3F62, 0x3F7A, 0x3F93, 0x3FAC, 0x3FC4, 0x3FDD, 0x3FF6,
+    0x400E, 0x4027, 0x4040, 0x4058, 0x4071, 0x4089, 0x40A2, 0x40BA,
+    0x40D3, 0x40EB, 0x4104, 0x411C, 0x4135, 0x414D, 0x4165, 0x417E,
+    0x4196, 0x41AE, 0x41C7, 0x41DF, 0x41F7, 0x420F, 0x4227, 0x4240,
+    0x4258, 0x4270, 0x4288, 0x42A0, 0x42B8, 0x42D0, 0x42E8, 0x4300,
+    0x4318, 0x4330, 0x4348, 0x4360, 0x4378, 0x4390, 0x43A8, 0x43C0,
+    0x43D8, 0x43EF, 0x4407, 0x441F, 0x4437, 0x444E, 0x4466, 0x447E,
+    0x4495, 0x44AD, 0x44C5, 0x44DC, 0x44F4, 0x450C, 0x4523, 0x453B,
+    0x4552, 0x456A, 0x4581, 0x4598, 0x45B0, 0x45C7, 0x45DF, 0x45F6,
+    0x460D, 0x4625, 0x463C, 0x4653, 0x466B, 0x4682, 0x4699, 0x46B0,
+    0x46C7, 0x46DF, 0x46F6, 0x470D, 0x4724, 0x473B, 0x4752, 0x4769,
+    0x4780, 0x4797, 0x47AE, 0x47C5, 0x47DC, 0x47F3, 0x480A, 0x4821,
+    0x4838, 0x484E, 0x4865, 0x487C, 0x4893, 0x48AA, 0x48C0, 0x48D7,
+    0x48EE, 0x4904, 0x491B, 0x4932, 0x4948, 0x495F, 0x4976, 0x498C,
+    0x49A3, 0x49B9, 0x49D0, 0x49E6, 0x49FD, 0x4A13, 0x4A29, 0x4A40,
+    0x4A56, 0x4A6D, 0x4A83, 0x4A99, 0x4AB0, 0x4AC6, 0x4ADC, 0x4AF2,
+    0x4B09, 0x4B1F, 0x4B35, 0x4B4B, 0x4B61, 0x4B77, 0x4B8D, 0x4BA3,
+    0x4BBA, 0x4BD0, 0x4BE6, 0x4BFC, 0x4C12, 0x4C28, 0x4C3D, 0x4C53,
+    0x4C69, 0x4C7F, 0x4C95, 0x4CAB, 0x4CC1, 0x4CD6, 0x4CEC, 0x4D02,
+    0x4D18, 0x4D2D, 0x4D43, 0x4D59, 0x4D6F, 0x4D84, 0x4D9A, 0x4DAF,
+    0x4DC5, 0x4DDB, 0x4DF0, 0x4E06, 0x4E1B, 0x4E31, 0x4E46, 0x4E5B,
+    0x4E71, 0x4E86, 0x4E9C, 0x4EB1, 0x4EC6, 0x4EDC, 0x4EF1, 0x4F06,
+    0x4F1C, 0x4F31, 0x4F46, 0x4F5B, 0x4F70, 0x4F86, 0x4F9B, 0x4FB0,
+    0x4FC5, 0x4FDA, 0x4FEF, 0x5004, 0x5019, 0x502E, 0x5043, 0x5058,
+    0x506D, 0x5082, 0x5097, 0x50AC, 0x50C1, 0x50D6, 0x50EA, 0x50FF,
+    0x5114, 0x5129, 0x513E, 0x5152, 0x5167, 0x517C, 0x5190, 0x51A5,
+    0x51BA, 0x51CE, 0x51E3, 0x51F8, 0x520C, 0x5221, 0x5235, 0x524A,
+    0x525E, 0x5273, 0x5287, 0x529C, 0x52B0, 0x52C4, 0x52D9, 0x52ED,
+    0x5301, 0x5316, 0x532A, 0x533E, 0x5353, 0x5367, 0x537B, 0x538F,
+    0x53A3, 0x53B8, 0x53CC, 0x53E0, 0x53F4, 0x5408, 0x541C, 0x5430,
+    0x5444, 0x5458, 0x546C, 0x5480, 0x5494, 0x54A8, 0x54BC, 0x54D0,
+    0x54E4, 0x54F8, 0x550C, 0x551F, 0x5533, 0x5547, 0x555B, 0x556E,
+    0x5582, 0x5596, 0x55AA, 0x55BD, 0x55D1, 0x55E5, 0x55F8, 0x560C,
+    0x561F, 0x5633, 0x5646, 0x565A, 0x566E, 0x5681, 0x5694, 0x56A8,
+    0x56BB, 0x56CF, 0x56E2, 0x56F6, 0x5709, 0x571C, 0x5730, 0x5743,
+    0x5756, 0x5769, 0x577D, 0x5790, 0x57A3, 0x57B6, 0x57C9, 0x57DD,
+    0x57F0, 0x5803, 0x5816, 0x5829, 0x583C, 0x584F, 0x5862, 0x5875,
+    0x5888, 0x589B, 0x58AE, 0x58C1, 0x58D4, 0x58E7, 0x58FA, 0x590D,
+    0x591F, 0x5932, 0x5945, 0x5958, 0x596B, 0x597D, 0x5990, 0x59A3,
+    0x59B6, 0x59C8, 0x59DB, 0x59EE, 0x5A00, 0x5A13, 0x5A25, 0x5A38,
+    0x5A4B, 0x5A5D, 0x5A70, 0x5A82, 0x5A95, 0x5AA7, 0x5ABA, 0x5ACC,
+    0x5ADE, 0x5AF1, 0x5B03, 0x5B16, 0x5B28, 0x5B3A, 0x5B4D, 0x5B5F,
+    0x5B71, 0x5B83, 0x5B96, 0x5BA8, 0x5BBA, 0x5BCC, 0x5BDE, 0x5BF0,
+    0x5C03, 0x5C15, 0x5C27, 0x5C39, 0x5C4B, 0x5C5D, 0x5C6F, 0x5C81,
+    0x5C93, 0x5CA5, 0x5CB7, 0x5CC9, 0x5CDB, 0x5CED, 0x5CFF, 0x5D11,
+    0x5D22, 0x5D34, 0x5D46, 0x5D58, 0x5D6A, 0x5D7B, 0x5D8D, 0x5D9F,
+    0x5DB1, 0x5DC2, 0x5DD4, 0x5DE6, 0x5DF7, 0x5E09, 0x5E1B, 0x5E2C,
+    0x5E3E, 0x5E4F, 0x5E61, 0x5E72, 0x5E84, 0x5E95, 0x5EA7, 0x5EB8,
+    0x5ECA, 0x5EDB, 0x5EED, 0x5EFE, 0x5F0F, 0x5F21, 0x5F32, 0x5F43,
+    0x5F55, 0x5F66, 0x5F77, 0x5F88, 0x5F9A, 0x5FAB, 0x5FBC, 0x5FCD,
+    0x5FDE, 0x5FF0, 0x6001, 0x6012, 0x6023, 0x6034, 0x6045, 0x6056,
+    0x6067, 0x6078, 0x6089, 0x609A, 0x60AB, 0x60BC, 0x60CD, 0x60DE,
+    0x60EF, 0x6100, 0x6111, 0x6122, 0x6132, 0x6143, 0x6154, 0x6165,
+    0x6176, 0x6186, 0x6197, 0x61A8, 0x61B9, 0x61C9, 0x61DA, 0x61EB,
+    0x61FB, 0x620C, 0x621D, 0x622D, 0x623E, 0x624E, 0x625F, 0x626F,
+    0x6280, 0x6290, 0x62A1, 0x62B1, 0x62C2, 0x62D2, 0x62E3, 0x62F3,
+    0x6303, 0x6314, 0x6324, 0x6334, 0x6345, 0x6355, 0x6365, 0x6376,
+    0x6386, 0x6396, 0x63A6, 0x63B7, 0x63C7, 0x63D7, 0x63E7, 0x63F7,
+    0x6407, 0x6418, 0x6428, 0x6438, 0x6448, 0x6458, 0x6468, 0x6478,
+    0x6488,
+};
+
+HF_DATA const uint16_t ln_table[HF_GEN_LN_TABLE_SIZE + 1] = {
+    0x0000, 0x0020, 0x0040, 0x0060, 0x0080, 0x00A0, 0x00BF, 0x00DF,
+    0x00FF, 0x011F, 0x013E, 0x015E, 0x017E, 0x019D, 0x01BD, 0x01DD,
+    0x01FC, 0x021C, 0x023B, 0x025A, 0x027A, 0x0299, 0x02B9, 0x02D8,
+    0x02F7, 0x0316, 0x0336, 0x0355, 0x0374, 0x0393, 0x03B2, 0x03D1,
+    0x03F0, 0x040F, 0x042E, 0x044D, 0x046C, 0x048B, 0x04AA, 0x04C9,
+    0x04E8, 0x0506, 0x0525, 0x0544, 0x0563, 0x0581, 0x05A0, 0x05BF,
+    0x05DD, 0x05FC, 0x061A, 0x0639, 0x0657, 0x0676, 0x0694, 0x06B2,
+    0x06D1, 0x06EF, 0x070D, 0x072C, 0x074A, 0x0768, 0x0786, 0x07A4,
+    0x07C3, 0x07E1, 0x07FF, 0x081D, 0x083B, 0x0859, 0x0877, 0x0895,
+    0x08B3, 0x08D0, 0x08EE, 0x090C, 0x092A, 0x0948, 0x0966, 0x0983,
+    0x09A1, 0x09BF, 0x09DC, 0x09FA, 0x0A17, 0x0A35, 0x0A53, 0x0A70,
+    0x0A8E, 0x0AAB, 0x0AC8, 0x0AE6, 0x0B03, 0x0B21, 0x0B3E, 0x0B5B,
+    0x0B78, 0x0B96, 0x0BB3, 0x0BD0, 0x0BED, 0x0C0A, 0x0C27, 0x0C45,
+    0x0C62, 0x0C7F, 0x0C9C, 0x0CB9, 0x0CD6, 0x0CF3, 0x0D0F, 0x0D2C,
+    0x0D49, 0x0D66, 0x0D83, 0x0DA0, 0x0DBC, 0x0DD9, 0x0DF6, 0x0E13,
+    0x0E2F, 0x0E4C, 0x0E68, 0x0E85, 0x0EA2, 0x0EBE, 0x0EDB, 0x0EF7,
+    0x0F14, 0x0F30, 0x0F4C, 0x0F69, 0x0F85, 0x0FA1, 0x0FBE, 0x0FDA,
+    0x0FF6, 0x1013, 0x102F, 0x104B, 0x1067, 0x1083, 0x109F, 0x10BB,
+    0x10D7, 0x10F4, 0x1110, 0x112C, 0x1148, 0x1163, 0x117F, 0x119B,
+    0x11B7, 0x11D3, 0x11EF, 0x120B, 0x1226, 0x1242, 0x125E, 0x127A,
+    0x1295, 0x12B1, 0x12CD, 0x12E8, 0x1304, 0x131F, 0x133B, 0x1356,
+    0x1372, 0x138D, 0x13A9, 0x13C4, 0x13E0, 0x13FB, 0x1417, 0x1432,
+    0x144D, 0x1468, 0x1484, 0x149F, 0x14BA, 0x14D5, 0x14F1, 0x150C,
+    0x1527, 0x1542, 0x155D, 0x1578, 0x1593, 0x15AE, 0x15C9, 0x15E4,
+    0x15FF, 0x161A, 0x1635, 0x1650, 0x166B, 0x1686, 0x16A0, 0x16BB,
+    0x16D6, 0x16F1, 0x170C, 0x1726, 0x1741, 0x175C, 0x1776, 0x1791,
+    0x17AC, 0x17C6, 0x17E1, 0x17FB, 0x1816, 0x1830, 0x184B, 0x1865,
+    0x1880, 0x189A, 0x18B4, 0x18CF, 0x18E9, 0x1903, 0x191E, 0x1938,
+    0x1952, 0x196D, 0x1987, 0x19A1, 0x19BB, 0x19D5, 0x19F0, 0x1A0A,
+    0x1A24, 0x1A3E, 0x1A58, 0x1A72, 0x1A8C, 0x1AA6, 0x1AC0, 0x1ADA,
+    0x1AF4, 0x1B0E, 0x1B28, 0x1B41, 0x1B5B, 0x1B75, 0x1B8F, 0x1BA9,
+    0x1BC3, 0x1BDC, 0x1BF6, 0x1C10, 0x1C29, 0x1C43, 0x1C5D, 0x1C76,
+    0x1C90, 0x1CAA, 0x1CC3, 0x1CDD, 0x1CF6, 0x1D10, 0x1D29, 0x1D43,
+    0x1D5C, 0x1D76, 0x1D8F, 0x1DA8, 0x1DC2, 0x1DDB, 0x1DF4, 0x1E0E,
+    0x1E27, 0x1E40, 0x1E5A, 0x1E73, 0x1E8C, 0x1EA5, 0x1EBE, 0x1ED8,
+    0x1EF1, 0x1F0A, 0x1F23, 0x1F3C, 0x1F55, 0x1F6E, 0x1F87, 0x1FA0,
+    0x1FB9, 0x1FD2, 0x1FEB, 0x2004, 0x201D, 0x2036, 0x204F, 0x2067,
+    0x2080, 0x2099, 0x20B2, 0x20CB, 0x20E3, 0x20FC, 0x2115, 0x212E,
+    0x2146, 0x215F, 0x2178, 0x2190, 0x21A9, 0x21C1, 0x21DA, 0x21F3,
+    0x220B, 0x2224, 0x223C, 0x2255, 0x226D, 0x2285, 0x229E, 0x22B6,
+    0x22CF, 0x22E7, 0x22FF, 0x2318, 0x2330, 0x2348, 0x2361, 0x2379,
+    0x2391, 0x23A9, 0x23C2, 0x23DA, 0x23F2, 0x240A, 0x2422, 0x243A,
+    0x2453, 0x246B, 0x2483, 0x249B, 0x24B3, 0x24CB, 0x24E3, 0x24FB,
+    0x2513, 0x252B, 0x2543, 0x255A, 0x2572, 0x258A, 0x25A2, 0x25BA,
+    0x25D2, 0x25EA, 0x2601, 0x2619, 0x2631, 0x2649, 0x2660, 0x2678,
+    0x2690, 0x26A7, 0x26BF, 0x26D7, 0x26EE, 0x2706, 0x271D, 0x2735,
+    0x274D, 0x2764, 0x277C, 0x2793, 0x27AB, 0x27C2, 0x27DA, 0x27F1,
+    0x2808, 0x2820, 0x2837, 0x284F, 0x2866, 0x287D, 0x2895, 0x28AC,
+    0x28C3, 0x28DA, 0x28F2, 0x2909, 0x2920, 0x2937, 0x294E, 0x2966,
+    0x297D, 0x2994, 0x29AB, 0x29C2, 0x29D9, 0x29F0, 0x2A07, 0x2A1E,
+    0x2A35, 0x2A4C, 0x2A63, 0x2A7A, 0x2A91, 0x2AA8, 0x2ABF, 0x2AD6,
+    0x2AED, 0x2B04, 0x2B1B, 0x2B32, 0x2B48, 0x2B5F, 0x2B76, 0x2B8D,
+    0x2BA3, 0x2BBA, 0x2BD1, 0x2BE8, 0x2BFE, 0x2C15, 0x2C2C, 0x2C42,
+    0x2C59, 0x2C70, 0x2C86, 0x2C9D, 0x2CB3, 0x2CCA, 0x2CE1, 0x2CF7,
+    0x2D0E, 0x2D24, 0x2D3B, 0x2D51, 0x2D67, 0x2D7E, 0x2D94, 0x2DAB,
+    0x2DC1, 0x2DD7, 0x2DEE, 0x2E04, 0x2E1B, 0x2E31, 0x2E47, 0x2E5D,
+    0x2E74, 0x2E8A, 0x2EA0, 0x2EB6, 0x2ECD, 0x2EE3, 0x2EF9, 0x2F0F,
+    0x2F25, 0x2F3B, 0x2F52, 0x2F68, 0x2F7E, 0x2F94, 0x2FAA, 0x2FC0,
+    0x2FD6, 0x2FEC, 0x3002, 0x3018, 0x302E, 0x3044, 0x305A, 0x3070,
+    0x3086, 0x309C, 0x30B1, 0x30C7, 0x30DD, 0x30F3, 0x3109, 0x311F,
+    0x3134, 0x314A, 0x3160, 0x3176, 0x318B, 0x31A1, 0x31B7, 0x31CD,
+    0x31E2, 0x31F8, 0x320E, 0x3223, 0x3239, 0x324E, 0x3264, 0x327A,
+    0x328F, 0x32A5, 0x32BA, 0x32D0, 0x32E5, 0x32FB, 0x3310, 0x3326,
+    0x333B, 0x3351, 0x3366, 0x337B, 0x3391, 0x33A6, 0x33BC, 0x33D1,
+    0x33E6, 0x33FC, 0x3411, 0x3426, 0x343C, 0x3451, 0x3466, 0x347B,
+    0x3491, 0x34A6, 0x34BB, 0x34D0, 0x34E5, 0x34FA, 0x3510, 0x3525,
+    0x353A, 0x354F, 0x3564, 0x3579, 0x358E, 0x35A3, 0x35B8, 0x35CD,
+    0x35E2, 0x35F7, 0x360C, 0x3621, 0x3636, 0x364B, 0x3660, 0x3675,
+    0x368A, 0x369F, 0x36B4, 0x36C9, 0x36DD, 0x36F2, 0x3707, 0x371C,
+    0x3731, 0x3745, 0x375A, 0x376F, 0x3784, 0x3798, 0x37AD, 0x37C2,
+    0x37D7, 0x37EB, 0x3800, 0x3815, 0x3829, 0x383E, 0x3852, 0x3867,
+    0x387C, 0x3890, 0x38A5, 0x38B9, 0x38CE, 0x38E2, 0x38F7, 0x390B,
+    0x3920, 0x3934, 0x3949, 0x395D, 0x3972, 0x3986, 0x399B, 0x39AF,
+    0x39C3, 0x39D8, 0x39EC, 0x3A00, 0x3A15, 0x3A29, 0x3A3D, 0x3A52,
+    0x3A66, 0x3A7A, 0x3A8F, 0x3AA3, 0x3AB7, 0x3ACB, 0x3ADF, 0x3AF4,
+    0x3B08, 0x3B1C, 0x3B30, 0x3B44, 0x3B58, 0x3B6D, 0x3B81, 0x3B95,
+    0x3BA9, 0x3BBD, 0x3BD1, 0x3BE5, 0x3BF9, 0x3C0D, 0x3C21, 0x3C35,
+    0x3C49, 0x3C5D, 0x3C71, 0x3C85, 0x3C99, 0x3CAD, 0x3CC1, 0x3CD5,
+    0x3CE9, 0x3CFC, 0x3D10, 0x3D24, 0x3D38, 0x3D4C, 0x3D60, 0x3D73,
+    0x3D87, 0x3D9B, 0x3DAF, 0x3DC3, 0x3DD6, 0x3DEA, 0x3DFE, 0x3E11,
+    0x3E25, 0x3E39, 0x3E4C, 0x3E60, 0x3E74, 0x3E87, 0x3E9B, 0x3EAF,
+    0x3EC2, 0x3ED6, 0x3EE9, 0x3EFD, 0x3F11, 0x3F24, 0x3F38, 0x3F4B,
+    0x3F5F, 0x3F72, 0x3F86, 0x3F99, 0x3FAD, 0x3FC0, 0x3FD4, 0x3FE7,
+    0x3FFA, 0x400E, 0x4021, 0x4035, 0x4048, 0x405B, 0x406F, 0x4082,
+    0x4095, 0x40A9, 0x40BC, 0x40CF, 0x40E2, 0x40F6, 0x4109, 0x411C,
+    0x412F, 0x4143, 0x4156, 0x4169, 0x417C, 0x4190, 0x41A3, 0x41B6,
+    0x41C9, 0x41DC, 0x41EF, 0x4202, 0x4215, 0x4229, 0x423C, 0x424F,
+    0x4262, 0x4275, 0x4288, 0x429B, 0x42AE, 0x42C1, 0x42D4, 0x42E7,
+    0x42FA, 0x430D, 0x4320, 0x4333, 0x4346, 0x4358, 0x436B, 0x437E,
+    0x4391, 0x43A4, 0x43B7, 0x43CA, 0x43DD, 0x43EF, 0x4402, 0x4415,
+    0x4428, 0x443B, 0x444D, 0x4460, 0x4473, 0x4486, 0x4498, 0x44AB,
+    0x44BE, 0x44D0, 0x44E3, 0x44F6, 0x4509, 0x451B, 0x452E, 0x4540,
+    0x4553, 0x4566, 0x4578, 0x458B, 0x459D, 0x45B0, 0x45C3, 0x45D5,
+    0x45E8, 0x45FA, 0x460D, 0x461F, 0x4632, 0x4644, 0x4657, 0x4669,
+    0x467C, 0x468E, 0x46A0, 0x46B3, 0x46C5, 0x46D8, 0x46EA, 0x46FD,
+    0x470F, 0x4721, 0x4734, 0x4746, 0x4758, 0x476B, 0x477D, 0x478F,
+    0x47A1, 0x47B4, 0x47C6, 0x47D8, 0x47EB, 0x47FD, 0x480F, 0x4821,
+    0x4833, 0x4846, 0x4858, 0x486A, 0x487C, 0x488E, 0x48A0, 0x48B3,
+    0x48C5, 0x48D7, 0x48E9, 0x48FB, 0x490D, 0x491F, 0x4931, 0x4943,
+    0x4955, 0x4967, 0x497A, 0x498C, 0x499E, 0x49B0, 0x49C2, 0x49D4,
+    0x49E5, 0x49F7, 0x4A09, 0x4A1B, 0x4A2D, 0x4A3F, 0x4A51, 0x4A63,
+    0x4A75, 0x4A87, 0x4A99, 0x4AAA, 0x4ABC, 0x4ACE, 0x4AE0, 0x4AF2,
+    0x4B04, 0x4B15, 0x4B27, 0x4B39, 0x4B4B, 0x4B5D, 0x4B6E, 0x4B80,
+    0x4B92, 0x4BA4, 0x4BB5, 0x4BC7, 0x4BD9, 0x4BEA, 0x4BFC, 0x4C0E,
+    0x4C1F, 0x4C31, 0x4C43, 0x4C54, 0x4C66, 0x4C78, 0x4C89, 0x4C9B,
+    0x4CAC, 0x4CBE, 0x4CCF, 0x4CE1, 0x4CF3, 0x4D04, 0x4D16, 0x4D27,
+    0x4D39, 0x4D4A, 0x4D5C, 0x4D6D, 0x4D7F, 0x4D90, 0x4DA1, 0x4DB3,
+    0x4DC4, 0x4DD6, 0x4DE7, 0x4DF9, 0x4E0A, 0x4E1B, 0x4E2D, 0x4E3E,
+    0x4E50, 0x4E61, 0x4E72, 0x4E84, 0x4E95, 0x4EA6, 0x4EB7, 0x4EC9,
+    0x4EDA, 0x4EEB, 0x4EFD, 0x4F0E, 0x4F1F, 0x4F30, 0x4F42, 0x4F53,
+    0x4F64, 0x4F75, 0x4F86, 0x4F98, 0x4FA9, 0x4FBA, 0x4FCB, 0x4FDC,
+    0x4FED, 0x4FFF, 0x5010, 0x5021, 0x5032, 0x5043, 0x5054, 0x5065,
+    0x5076, 0x5087, 0x5098, 0x50A9, 0x50BA, 0x50CB, 0x50DC, 0x50ED,
+    0x50FE, 0x510F, 0x5120, 0x5131, 0x5142, 0x5153, 0x5164, 0x5175,
+    0x5186, 0x5197, 0x51A8, 0x51B9, 0x51CA, 0x51DB, 0x51EC, 0x51FC,
+    0x520D, 0x521E, 0x522F, 0x5240, 0x5251, 0x5261, 0x5272, 0x5283,
+    0x5294, 0x52A5, 0x52B5, 0x52C6, 0x52D7, 0x52E8, 0x52F8, 0x5309,
+    0x531A, 0x532B, 0x533B, 0x534C, 0x535D, 0x536D, 0x537E, 0x538F,
+    0x539F, 0x53B0, 0x53C1, 0x53D1, 0x53E2, 0x53F3, 0x5403, 0x5414,
+    0x5424, 0x5435, 0x5445, 0x5456, 0x5467, 0x5477, 0x5488, 0x5498,
+    0x54A9, 0x54B9, 0x54CA, 0x54DA, 0x54EB, 0x54FB, 0x550C, 0x551C,
+    0x552D, 0x553D, 0x554D, 0x555E, 0x556E, 0x557F, 0x558F, 0x55A0,
+    0x55B0, 0x55C0, 0x55D1, 0x55E1, 0x55F1, 0x5602, 0x5612, 0x5622,
+    0x5633, 0x5643, 0x5653, 0x5664, 0x5674, 0x5684, 0x5694, 0x56A5,
+    0x56B5, 0x56C5, 0x56D5, 0x56E6, 0x56F6, 0x5706, 0x5716, 0x5727,
+    0x5737, 0x5747, 0x5757, 0x5767, 0x5777, 0x5788, 0x5798, 0x57A8,
+    0x57B8, 0x57C8, 0x57D8, 0x57E8, 0x57F8, 0x5809, 0x5819, 0x5829,
+    0x5839, 0x5849, 0x5859, 0x5869, 0x5879, 0x5889, 0x5899, 0x58A9,
+    0x58B9,
+};
+
+HF_DATA const uint16_t exp_table[HF_GEN_EXP_TABLE_SIZE + 1] = {
+    0x8000, 0x8059, 0x80B2, 0x810B, 0x8165, 0x81BF, 0x8219, 0x8273,
+    0x82CE, 0x8328, 0x8383, 0x83DF, 0x843A, 0x8496, 0x84F2, 0x854E,
+    0x85AB, 0x8608, 0x8665, 0x86C2, 0x871F, 0x877D, 0x87DB, 0x883A,
+    0x8898, 0x88F7, 0x8956, 0x89B5, 0x8A15, 0x8A75, 0x8AD5, 0x8B35,
+    0x8B96, 0x8BF7, 0x8C58, 0x8CB9, 0x8D1B, 0x8D7D, 0x8DDF, 0x8E41,
+    0x8EA4, 0x8F07, 0x8F6B, 0x8FCE, 0x9032, 0x9096, 0x90FA, 0x915F,
+    0x91C4, 0x9229, 0x928E, 0x92F4, 0x935A, 0x93C0, 0x9427, 0x948E,
+    0x94F5, 0x955C, 0x95C4, 0x962C, 0x9694, 0x96FD, 0x9765, 0x97CF,
+    0x9838, 0x98A2, 0x990C, 0x9976, 0x99E0, 0x9A4B, 0x9AB6, 0x9B22,
+    0x9B8D, 0x9BF9, 0x9C65, 0x9CD2, 0x9D3F, 0x9DAC, 0x9E19, 0x9E87,
+    0x9EF5, 0x9F64, 0x9FD2, 0xA041, 0xA0B0, 0xA120, 0xA190, 0xA200,
+    0xA270, 0xA2E1, 0xA352, 0xA3C3, 0xA435, 0xA4A7, 0xA519, 0xA58C,
+    0xA5FF, 0xA672, 0xA6E6, 0xA759, 0xA7CE, 0xA842, 0xA8B7, 0xA92C,
+    0xA9A1, 0xAA17, 0xAA8D, 0xAB04, 0xAB7A, 0xABF1, 0xAC69, 0xACE0,
+    0xAD58, 0xADD1, 0xAE49, 0xAEC2, 0xAF3B, 0xAFB5, 0xB02F, 0xB0A9,
+    0xB124, 0xB19F, 0xB21A, 0xB296, 0xB312, 0xB38E, 0xB40B, 0xB488,
+    0xB505, 0xB583, 0xB601, 0xB67F, 0xB6FE, 0xB77D, 0xB7FC, 0xB87C,
+    0xB8FC, 0xB97C, 0xB9FD, 0xBA7E, 0xBAFF, 0xBB81, 0xBC03, 0xBC86,
+    0xBD09, 0xBD8C, 0xBE0F, 0xBE93, 0xBF18, 0xBF9C, 0xC021, 0xC0A7,
+    0xC12C, 0xC1B2, 0xC239, 0xC2C0, 0xC347, 0xC3CE, 0xC456, 0xC4DF,
+    0xC567, 0xC5F0, 0xC67A, 0xC703, 0xC78D, 0xC818, 0xC8A3, 0xC92E,
+    0xC9BA, 0xCA46, 0xCAD2, 0xCB5F, 0xCBEC, 0xCC7A, 0xCD08, 0xCD96,
+    0xCE25, 0xCEB4, 0xCF43, 0xCFD3, 0xD063, 0xD0F4, 0xD185, 0xD216,
+    0xD2A8, 0xD33A, 0xD3CD, 0xD460, 0xD4F3, 0xD587, 0xD61B, 0xD6B0,
+    0xD745, 0xD7DA, 0xD870, 0xD906, 0xD99D, 0xDA34, 0xDACC, 0xDB63,
+    0xDBFC, 0xDC94, 0xDD2E, 0xDDC7, 0xDE61, 0xDEFB, 0xDF96, 0xE031,
+    0xE0CD, 0xE169, 0xE205, 0xE2A2, 0xE340, 0xE3DD, 0xE47B, 0xE51A,
+    0xE5B9, 0xE658, 0xE6F8, 0xE799, 0xE839, 0xE8DB, 0xE97C, 0xEA1E,
+    0xEAC1, 0xEB64, 0xEC07, 0xECAB, 0xED4F, 0xEDF4, 0xEE99, 0xEF3F,
+    0xEFE5, 0xF08B, 0xF132, 0xF1DA, 0xF281, 0xF32A, 0xF3D3, 0xF47C,
+    0xF525, 0xF5D0, 0xF67A, 0xF725, 0xF7D1, 0xF87D, 0xF929, 0xF9D6,
+    0xFA84, 0xFB32, 0xFBE0, 0xFC8F, 0xFD3E, 0xFDEE, 0xFE9E, 0xFF4F,
+    0xFFFF,
+};
+
+HF_DATA const uint16_t tan_table_low[HF_GEN_TAN_DUAL_TABLE_SIZE + 1] = {
+    0x0000, 0x002A, 0x0054, 0x007E, 0x00A8, 0x00D1, 0x00FB, 0x0125,
+    0x014F, 0x0179, 0x01A3, 0x01CD, 0x01F7, 0x0221, 0x024B, 0x0276,
+    0x02A0, 0x02CA, 0x02F4, 0x031E, 0x0349, 0x0373, 0x039D, 0x03C8,
+    0x03F2, 0x041D, 0x0448, 0x0472, 0x049D, 0x04C8, 0x04F3, 0x051E,
+    0x0549, 0x0574, 0x059F, 0x05CA, 0x05F5, 0x0621, 0x064C, 0x0678,
+    0x06A3, 0x06CF, 0x06FB, 0x0727, 0x0753, 0x077F, 0x07AB, 0x07D8,
+    0x0804, 0x0831, 0x085D, 0x088A, 0x08B7, 0x08E4, 0x0911, 0x093F,
+    0x096C, 0x099A, 0x09C7, 0x09F5, 0x0A23, 0x0A51, 0x0A80, 0x0AAE,
+    0x0ADD, 0x0B0C, 0x0B3B, 0x0B6A, 0x0B99, 0x0BC8, 0x0BF8, 0x0C28,
+    0x0C58, 0x0C88, 0x0CB9, 0x0CE9, 0x0D1A, 0x0D4B, 0x0D7C, 0x0DAE,
+    0x0DDF, 0x0E11, 0x0E43, 0x0E76, 0x0EA8, 0x0EDB, 0x0F0E, 0x0F41,
+    0x0F75, 0x0FA9, 0x0FDD, 0x1011, 0x1046, 0x107A, 0x10B0, 0x10E5,
+    0x111B, 0x1151, 0x1187, 0x11BE, 0x11F5, 0x122C, 0x1263, 0x129B,
+    0x12D3, 0x130C, 0x1345, 0x137E, 0x13B8, 0x13F2, 0x142C, 0x1467,
+    0x14A2, 0x14DD, 0x1519, 0x1556, 0x1592, 0x15CF, 0x160D, 0x164B,
+    0x1689, 0x16C8, 0x1708, 0x1748, 0x1788, 0x17C9, 0x180A, 0x184C,
+    0x188E, 0x18D1, 0x1914, 0x1958, 0x199C, 0x19E1, 0x1A27, 0x1A6D,
+    0x1AB4, 0x1AFB, 0x1B43, 0x1B8C, 0x1BD5, 0x1C1F, 0x1C6A, 0x1CB5,
+    0x1D01, 0x1D4D, 0x1D9B, 0x1DE9, 0x1E38, 0x1E87, 0x1ED8, 0x1F29,
+    0x1F7B, 0x1FCE, 0x2022, 0x2076, 0x20CC, 0x2122, 0x2179, 0x21D1,
+    0x222B, 0x2285, 0x22E0, 0x233C, 0x2399, 0x23F7, 0x2457, 0x24B7,
+    0x2519, 0x257C, 0x25E0, 0x2645, 0x26AB, 0x2713, 0x277C, 0x27E6,
+    0x2852, 0x28BF, 0x292D, 0x299D, 0x2A0F, 0x2A82, 0x2AF7, 0x2B6D,
+    0x2BE5, 0x2C5E, 0x2CD9, 0x2D57, 0x2DD5, 0x2E56, 0x2ED9, 0x2F5E,
+    0x2FE4, 0x306D, 0x30F8, 0x3185, 0x3214, 0x32A6, 0x333A, 0x33D0,
+    0x3469, 0x3505, 0x35A3, 0x3644, 0x36E8, 0x378F, 0x3838, 0x38E5,
+    0x3995, 0x3A48, 0x3AFF, 0x3BB9, 0x3C76, 0x3D37, 0x3DFD, 0x3EC6,
+    0x3F93, 0x4064, 0x413A, 0x4214, 0x42F3, 0x43D6, 0x44BF, 0x45AD,
+    0x46A0, 0x4799, 0x4897, 0x499C, 0x4AA6, 0x4BB8, 0x4CCF, 0x4DEE,
+    0x4F14, 0x5042, 0x5177, 0x52B4, 0x53FA, 0x5549, 0x56A1, 0x5803,
+    0x596F, 0x5AE6, 0x5C67, 0x5DF4, 0x5F8D, 0x6133, 0x62E6, 0x64A7,
+    0x6677, 0x6856, 0x6A46, 0x6C46, 0x6E59, 0x707E, 0x72B8, 0x7507,
+    0x776D,
+};
+
+HF_DATA const uint16_t tan_table_high[HF_GEN_TAN_DUAL_TABLE_SIZE + 1] = {
+    0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6,
+    0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE,
+    0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107,
+    0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010F, 0x0110, 0x0111,
+    0x0112, 0x0114, 0x0115, 0x0116, 0x0118, 0x0119, 0x011A, 0x011C,
+    0x011D, 0x011E, 0x0120, 0x0121, 0x0123, 0x0124, 0x0125, 0x0127,
+    0x0128, 0x012A, 0x012B, 0x012D, 0x012E, 0x0130, 0x0131, 0x0133,
+    0x0135, 0x0136, 0x0138, 0x0139, 0x013B, 0x013D, 0x013E, 0x0140,
+    0x0142, 0x0143, 0x0145, 0x0147, 0x0149, 0x014B, 0x014C, 0x014E,
+    0x0150, 0x0152, 0x0154, 0x0156, 0x0158, 0x015A, 0x015C, 0x015E,
+    0x0160, 0x0162, 0x0164, 0x0166, 0x0168, 0x016A, 0x016C, 0x016F,
+    0x0171, 0x0173, 0x0175, 0x0178, 0x017A, 0x017C, 0x017F, 0x0181,
+    0x0184, 0x0186, 0x0189, 0x018B, 0x018E, 0x0190, 0x0193, 0x0196,
+    0x0198, 0x019B, 0x019E, 0x01A1, 0x01A4, 0x01A7, 0x01A9, 0x01AC,
+    0x01AF, 0x01B3, 0x01B6, 0x01B9, 0x01BC, 0x01BF, 0x01C2, 0x01C6,
+    0x01C9, 0x01CD, 0x01D0, 0x01D4, 0x01D7, 0x01DB, 0x01DF, 0x01E2,
+    0x01E6, 0x01EA, 0x01EE, 0x01F2, 0x01F6, 0x01FA, 0x01FE, 0x0203,
+    0x0207, 0x020B, 0x0210, 0x0214, 0x0219, 0x021E, 0x0222, 0x0227,
+    0x022C, 0x0231, 0x0237, 0x023C, 0x0241, 0x0247, 0x024C, 0x0252,
+    0x0257, 0x025D, 0x0263, 0x0269, 0x0270, 0x0276, 0x027C, 0x0283,
+    0x028A, 0x0291, 0x0298, 0x029F, 0x02A6, 0x02AE, 0x02B5, 0x02BD,
+    0x02C5, 0x02CD, 0x02D6, 0x02DE, 0x02E7, 0x02F0, 0x02F9, 0x0303,
+    0x030D, 0x0316, 0x0321, 0x032B, 0x0336, 0x0341, 0x034C, 0x0358,
+    0x0364, 0x0370, 0x037D, 0x0389, 0x0397, 0x03A5, 0x03B3, 0x03C1,
+    0x03D0, 0x03E0, 0x03F0, 0x0401, 0x0412, 0x0423, 0x0436, 0x0449,
+    0x045C, 0x0471, 0x0486, 0x049C, 0x04B2, 0x04CA, 0x04E3, 0x04FC,
+    0x0517, 0x0533, 0x054F, 0x056E, 0x058D, 0x05AE, 0x05D1, 0x05F6,
+    0x061C, 0x0644, 0x066E, 0x069B, 0x06CA, 0x06FB, 0x0730, 0x0768,
+    0x07A3, 0x07E2, 0x0825, 0x086D, 0x08BA, 0x090D, 0x0966, 0x09C7,
+    0x0A2F, 0x0AA0, 0x0B1C, 0x0BA4, 0x0C39, 0x0CDD, 0x0D94, 0x0E61,
+    0x0F47, 0x104C, 0x1176, 0x12CE, 0x145F, 0x1639, 0x1872, 0x1B29,
+    0x1E8F, 0x22EC, 0x28BE, 0x30E4, 0x3D1D, 0x517D, 0x7A3B, 0xF476,
+    0x0000,
+};
+
+#endif
+
+#endif //HF_PRECALC_TABLES_H
@@ -17,13 +17,34 @@
 #include <math.h>
 #include "hf_tests.h"
 #include "hf_lib_arith.h"
+#include "hf_lib_conv.h"
+#include "hf_lib_lut.h"
+#include "hf_lib_common.h"
 #include "hf_lib_exp.h"
 #include "hf_lib_trig.h"
 #include "hf_lib_round.h"
 #include "hf_lib_misc.h"
+#include "hf_lib_blas.h"
+#include "hf_lib_swar.h"
+#include "hf_lib_sort.h"
+#include "hf_lib_fmt.h"
+#include "hf_lib_fast.h"
+#include "hf_lib_act.h"
+#include "hf_lib_complex.h"
+#include "hf_lib_par.h"
 
 //Prototype de la fonction utilitaire locale (doit être avant toute utilisation)
 static void print_formatted_table(const char *title, const char **headers, int num_cols, float data[][8], int num_rows);
+static uint16_t ref_round_half(double d, hf_rounding_mode mode);
+static int ref_fmt_class(uint32_t bits, int fmt);
+static double ref_fmt_value(uint32_t bits, int fmt);
+static uint32_t ref_round_fmt(double d, hf_format fmt, hf_rounding_mode mode);
+static unsigned int ref_fmt_flags(double d, uint32_t code, hf_format fmt);
+static double ref_fmt_exact(int op, double a, double b, double c);
+static uint32_t fmt_test_convert(int conv, uint32_t x);
+static void fmt_test_convert_n(int conv, const uint32_t *in, uint32_t *out, size_t n);
+static uint32_t fmt_test_arith(hf_format fmt, int op, uint32_t a, uint32_t b, uint32_t c);
+static uint16_t arith_test_op(int op, uint16_t x, uint16_t y, hf_rounding_mode mode);
 
 /**
  * @brief Fonction de débogage pour tester la fonction hf_int avec divers cas de test
@@ -48,7 +69,7 @@ void debug_int(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests étendus
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_int)", "Result (std::int)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -83,7 +104,7 @@ void debug_ceil(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_ceil)", "Result (ceilf)", "Difference"};
     int i;
 
@@ -114,7 +135,7 @@ void debug_floor(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_floor)", "Result (floorf)", "Difference"};
     int i;
 
@@ -145,7 +166,7 @@ void debug_round(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_round)", "Result (roundf)", "Difference"};
     int i;
 
@@ -176,7 +197,7 @@ void debug_trunc(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_trunc)", "Result (truncf)", "Difference"};
     int i;
 
@@ -197,6 +218,38 @@ void debug_trunc(void) {
     printf("\n");
 }
 
+/**
+ * @brief Teste hf_nearbyint dans chacun des modes d'arrondi (égalités comprises)
+ */
+void debug_nearbyint(void) {
+    float test_cases[] = {
+        0.0f, -0.0f, 0.25f, -0.25f, 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f,
+        2.3f, -2.7f, 1023.5f, -1022.5f, 65504.0f,
+        half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
+    };
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
+    const char *headers[] = {"Value", "NEAREST_EVEN", "NEAREST_UP", "TOWARD_ZERO", "TOWARD_POS_INF", "TOWARD_NEG_INF"};
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    int i, mode;
+
+    for(i = 0; i < num_tests; i++) {
+        //float_to_half suit le mode du thread, modifié par la boucle ci-dessous
+        uint16_t value_half = float_to_half_r(test_cases[i], saved_mode);
+
+        results[i][0] = half_to_float(value_half);
+        for(mode = 0; mode < 5; mode++) {
+            hf_set_rounding_mode((hf_rounding_mode)mode);
+            results[i][mode + 1] = half_to_float(hf_nearbyint(value_half));
+        }
+    }
+
+    hf_set_rounding_mode(saved_mode);
+
+    print_formatted_table("### HF_NEARBYINT (par mode d'arrondi)", headers, 6, results, num_tests);
+    printf("\n");
+}
+
 /**
  * @brief Teste hf_min sur divers cas
  */
@@ -209,7 +262,7 @@ void debug_min(void) {
         {half_to_float(HF_NAN), half_to_float(HF_NAN)}
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value1", "Value2", "Result (hf_min)", "Result (fminf)", "Difference"};
     int i;
     for(i = 0; i < num_tests; i++) {
@@ -243,7 +296,7 @@ void debug_max(void) {
         {half_to_float(HF_NAN), half_to_float(HF_NAN)}
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value1", "Value2", "Result (hf_max)", "Result (fmaxf)", "Difference"};
     int i;
     for(i = 0; i < num_tests; i++) {
@@ -338,7 +391,7 @@ void debug_copysign(void) {
         {half_to_float(HF_INFINITY_POS), -0.0f}
     };
     int num_tests = sizeof(test_values) / sizeof(test_values[0]);
-    float results[10][8];
+    float results[sizeof(test_values) / sizeof(test_values[0])][8];
     const char *headers[] = {"Mag", "SignFrom", "Result (my)", "Result (expected)", "Diff"};
     int i;
 
@@ -440,7 +493,7 @@ void debug_abs(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[30][8]; //Tableau statique étendu pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_abs)", "Result (fabsf)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -489,7 +542,7 @@ void debug_neg(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[30][8]; //Tableau statique étendu pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_neg)", "Result (-value)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -546,7 +599,7 @@ void debug_add(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value1", "Value2", "Result (my_add)", "Result (std::add)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -617,7 +670,7 @@ void debug_mul(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value1", "Value2", "Result (my_mul)", "Result (std::mul)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -685,7 +738,7 @@ void debug_div(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value1", "Value2", "Result (my_div)", "Result (std::div)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -746,7 +799,7 @@ void debug_inv(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[100][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_inv)", "Result (1.0/x)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -794,7 +847,7 @@ void debug_sqrt(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests étendus
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_sqrt)", "Result (std::sqrt)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -876,7 +929,7 @@ void debug_rsqrt(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
    
-    float results[50][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_rsqrt)", "Result (1/std::sqrt)", "Difference"};
    
     for(i = 0; i < num_tests; i++) {
@@ -894,7 +947,7 @@ void debug_rsqrt(void) {
         } else if(isinf(value_converted)) {
             std_result = (value_converted > 0.0f) ? 0.0f : NAN;
         } else if(value_converted == 0.0f) {
-            std_result = INFINITY;
+            std_result = copysignf(INFINITY, value_converted);
         } else if(value_converted < 0.0f) {
             std_result = NAN;
         } else {
@@ -925,7 +978,7 @@ void debug_fma(void) {
         {0.000061035f, 2.0f, 0.0001f},
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[10][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"a", "b", "c", "Result (hf_fma)", "Result (float)", "Difference"};
     int i;
 
@@ -954,6 +1007,1051 @@ void debug_fma(void) {
     printf("\n");
 }
 
+/**
+ * @brief Vérifie les variantes par lots (hf_*_n) contre les fonctions scalaires
+ *
+ * Applique chaque opération par lots à l'ensemble des 65536 motifs 16 bits
+ * (combinés à un second opérande pseudo-aléatoire) pour chacun des modes
+ * d'arrondi, et compte les résultats qui diffèrent de la version scalaire.
+ * Toutes les colonnes doivent valoir 0.
+ */
+void debug_batch(void) {
+    static uint16_t a[65536], b[65536], c[65536], out[65536];
+    const char *headers[] = {"Mode", "add_n", "sub_n", "mul_n", "div_n", "fma_n", "sqrt_n"};
+    float results[5][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    int mode;
+    unsigned int i;
+
+    //Entrées: tous les motifs (NaN, infinis, subnormaux compris) et un second opérande mélangé
+    for(i = 0; i < 65536; i++) {
+        a[i] = (uint16_t)i;
+        b[i] = (uint16_t)(i * 40503U + 12345U);
+        c[i] = (uint16_t)((i * 2654435761U) >> 16);
+    }
+
+    for(mode = 0; mode < 5; mode++) {
+        int errors[6] = {0, 0, 0, 0, 0, 0};
+        int j;
+
+        hf_set_rounding_mode((hf_rounding_mode)mode);
+
+        hf_add_n(a, b, out, 65536);
+        for(i = 0; i < 65536; i++) errors[0] += out[i] != hf_add(a[i], b[i]);
+        hf_sub_n(a, b, out, 65536);
+        for(i = 0; i < 65536; i++) errors[1] += out[i] != hf_sub(a[i], b[i]);
+        hf_mul_n(a, b, out, 65536);
+        for(i = 0; i < 65536; i++) errors[2] += out[i] != hf_mul(a[i], b[i]);
+        hf_div_n(a, b, out, 65536);
+        for(i = 0; i < 65536; i++) errors[3] += out[i] != hf_div(a[i], b[i]);
+        hf_fma_n(a, b, c, out, 65536);
+        for(i = 0; i < 65536; i++) errors[4] += out[i] != hf_fma(a[i], b[i], c[i]);
+        hf_sqrt_n(a, out, 65536);
+        for(i = 0; i < 65536; i++) errors[5] += out[i] != hf_sqrt(a[i]);
+
+        results[mode][0] = (float)mode;
+        for(j = 0; j < 6; j++) results[mode][j + 1] = (float)errors[j];
+    }
+
+    hf_set_rounding_mode(saved_mode);
+
+    print_formatted_table("### HF_*_N (ecarts avec les versions scalaires)", headers, 7, results, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Fonction de débogage pour tester les conversions par lots hf_from_float_n/hf_to_float_n
+ *
+ * Pour chaque implémentation disponible (scalaire, SSE2, AVX2, F16C, NEON), compare
+ * bit à bit les conversions par lots avec half_to_float() sur les 65536 motifs et
+ * avec float_to_half() sur des floats couvrant tous les exposants, y compris les
+ * égalités d'arrondi, les subnormaux et les NaN, dans chacun des cinq modes
+ * d'arrondi. Vérifie aussi float_to_half_r sur les floats finis contre la
+ * référence par recherche dichotomique.
+ */
+void debug_conv(void) {
+    static const uint32_t low_bits[8] = {0x0000, 0x1000, 0x0FFF, 0x1001, 0x2000, 0x3000, 0x3FFF, 0x0001};
+    static uint16_t halves[65536], half_out[262144];
+    static float floats[262144], float_out[65536];
+    const char *headers[] = {"Niveau", "Dispo", "to_float", "even", "away", "zero", "+inf", "-inf"};
+    float results[5][8];
+    hf_simd_level saved_level = hf_simd_selected();
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    int level, mode, errors_ref = 0;
+    unsigned int i;
+
+    //Entrées: tous les demi-flottants, et floats (signe, exposant, 9 bits de mantisse) x motifs de poids faible
+    for(i = 0; i < 65536; i++) halves[i] = (uint16_t)i;
+    for(i = 0; i < 262144; i++) {
+        uint32_t bits = ((i >> 3) << 14) | low_bits[i & 7];
+        memcpy(&floats[i], &bits, sizeof(bits));
+    }
+
+    //Arrondi correct de la version scalaire (référence exacte en double).
+    //Tout est lu sur les bits: -ffast-math supprime le test f - f != 0 des
+    //floats finis, et l'édition de liens active FTZ/DAZ qui ramènerait les
+    //float subnormaux à zéro lors de la conversion en double
+    for(mode = HF_ROUND_NEAREST_EVEN; mode <= HF_ROUND_TOWARD_NEG_INF; mode++) {
+        for(i = 0; i < 262144; i++) {
+            uint32_t bits, exp, mant;
+            double value;
+
+            memcpy(&bits, &floats[i], sizeof(bits));
+            exp = (bits >> 23) & 0xFFU;
+            mant = bits & 0x7FFFFFU;
+            if(exp == 0xFFU) continue;
+            value = exp ? ldexp((double)(mant | 0x800000U), (int)exp - 150) : ldexp((double)mant, -149);
+            if(bits & 0x80000000U) value = -value;
+            errors_ref += float_to_half_r(floats[i], (hf_rounding_mode)mode) != ref_round_half(value, (hf_rounding_mode)mode);
+        }
+    }
+
+    for(level = HF_SIMD_SCALAR; level <= HF_SIMD_NEON; level++) {
+        int errors[6] = {0, 0, 0, 0, 0, 0};
+        int available = hf_simd_select((hf_simd_level)level);
+
+        if(available) {
+            hf_to_float_n(halves, float_out, 65536);
+            for(i = 0; i < 65536; i++) {
+                float ref = half_to_float(halves[i]);
+                errors[0] += memcmp(&float_out[i], &ref, sizeof(ref)) != 0;
+            }
+            for(mode = HF_ROUND_NEAREST_EVEN; mode <= HF_ROUND_TOWARD_NEG_INF; mode++) {
+                hf_set_rounding_mode((hf_rounding_mode)mode);
+                hf_from_float_n(floats, half_out, 262144);
+                for(i = 0; i < 262144; i++) errors[mode + 1] += half_out[i] != float_to_half(floats[i]);
+            }
+            hf_set_rounding_mode(saved_mode);
+        }
+
+        results[level - HF_SIMD_SCALAR][0] = (float)level;
+        results[level - HF_SIMD_SCALAR][1] = (float)available;
+        for(i = 0; i < 6; i++) results[level - HF_SIMD_SCALAR][i + 2] = (float)errors[i];
+    }
+
+    hf_simd_select(saved_level);
+
+    print_formatted_table("### HF_FROM_FLOAT_N / HF_TO_FLOAT_N (ecarts avec les versions scalaires)", headers, 8, results, 5);
+    printf("Implementation retenue: %s\n", hf_simd_name(hf_simd_selected()));
+    printf("Ecarts float_to_half_r / reference (5 modes): %d\n\n", errors_ref);
+}
+
+/**
+ * @brief Fonction de débogage pour tester les conversions double et entières
+ *
+ * Pour chaque mode d'arrondi, compare hf_from_double_r et hf_from_int32_r à une
+ * référence obtenue par recherche dichotomique parmi les demi-flottants (valeurs
+ * exactes de hf_to_double), hf_to_int32_r à floor/ceil/trunc, et les versions par
+ * lots aux versions scalaires. Vérifie aussi hf_to_double contre half_to_float
+ * sur les 65536 motifs et le cas de double arrondi 1 + 2^-11 + 2^-40.
+ */
+void debug_conv_int(void) {
+    static double doubles[4096];
+    static int32_t ints[4096], int_out[4096];
+    static uint16_t halves[4096], half_out[4096];
+    static int16_t shorts[4096], short_out[4096];
+    static int8_t bytes[256];
+    const char *headers[] = {"Mode", "from_double", "from_int32", "to_int32_r", "to_double"};
+    float results[5][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    unsigned int seed = 0x13579BDU;
+    int errors_double = 0, m, i;
+
+    //hf_to_double exacte et identique à half_to_float (charges de NaN comprises).
+    //Les NaN sont repérés sur les bits: -ffast-math supprime les tests d != d
+    for(i = 0; i < 65536; i++) {
+        double d = hf_to_double((uint16_t)i), f = (double)half_to_float((uint16_t)i);
+        int nan = (i & 0x7C00) == 0x7C00 && (i & 0x3FF) != 0;
+
+        errors_double += memcmp(&d, &f, sizeof(d)) != 0 && !nan;
+        errors_double += !nan && hf_from_double(d) != (uint16_t)i;
+    }
+    //Pas de double arrondi: via float, 1 + 2^-11 + 2^-40 deviendrait une égalité arrondie à 1
+    errors_double += hf_from_double(1.0 + ldexp(1.0, -11) + ldexp(1.0, -40)) != 0x3C01;
+
+    for(i = 0; i < 4096; i++) {
+        seed = seed * 1103515245U + 12345U;
+        doubles[i] = ldexp(1.0 + (double)(seed >> 8) / 16777216.0, (int)(seed % 48U) - 30);
+        if(seed & 0x80U) doubles[i] = -doubles[i];
+        if(i < 64) doubles[i] = ldexp((double)(2 * i + 1), -25 + (i & 15)); //égalités exactes
+        ints[i] = (int32_t)(seed >> 1) >> (seed % 24U);
+        if(i < 2048) ints[i] = (i - 1024) * 37;
+        halves[i] = (uint16_t)(seed >> 16);
+        shorts[i] = (int16_t)(seed >> 12);
+    }
+    for(i = 0; i < 256; i++) bytes[i] = (int8_t)(i - 128);
+    ints[2048] = 2147483647;
+    ints[2049] = -2147483647 - 1;
+
+    for(m = 0; m < 5; m++) {
+        hf_rounding_mode mode = (hf_rounding_mode)m;
+        int errors[3] = {0, 0, 0};
+
+        for(i = 0; i < 4096; i++) {
+            double x = hf_to_double(halves[i]), expect;
+
+            errors[0] += hf_from_double_r(doubles[i], mode) != ref_round_half(doubles[i], mode);
+            errors[1] += hf_from_int32_r(ints[i], mode) != ref_round_half((double)ints[i], mode);
+
+            if((halves[i] & 0x7C00) == 0x7C00 && (halves[i] & 0x3FF) != 0) expect = 0.0;
+            else if(mode == HF_ROUND_TOWARD_ZERO) expect = x < 0 ? ceil(x) : floor(x);
+            else if(mode == HF_ROUND_TOWARD_POS_INF) expect = ceil(x);
+            else if(mode == HF_ROUND_TOWARD_NEG_INF) expect = floor(x);
+            else {
+                expect = floor(x + 0.5);
+                if(expect - x == 0.5 && (mode == HF_ROUND_NEAREST_EVEN ? fmod(expect, 2.0) != 0.0 : x < 0)) expect -= 1.0;
+            }
+            if(x > 2147483647.0) expect = 2147483647.0;
+            if(x < -2147483648.0) expect = -2147483648.0;
+            errors[2] += hf_to_int32_r(halves[i], mode) != (int32_t)expect;
+        }
+
+        //Lots: identiques aux versions scalaires avec le mode du thread
+        hf_set_rounding_mode(mode);
+        hf_from_double_n(doubles, half_out, 4096);
+        for(i = 0; i < 4096; i++) errors[0] += half_out[i] != hf_from_double(doubles[i]);
+        hf_from_int32_n(ints, half_out, 4096);
+        for(i = 0; i < 4096; i++) errors[1] += half_out[i] != hf_from_int32(ints[i]);
+        hf_from_int16_n(shorts, half_out, 4096);
+        for(i = 0; i < 4096; i++) errors[1] += half_out[i] != hf_from_int32(shorts[i]);
+        hf_from_int8_n(bytes, half_out, 256);
+        for(i = 0; i < 256; i++) errors[1] += hf_to_double(half_out[i]) != (double)bytes[i];
+        hf_to_int32_sat_n(halves, int_out, 4096);
+        for(i = 0; i < 4096; i++) errors[2] += int_out[i] != hf_to_int32_r(halves[i], mode);
+        hf_to_int16_sat_n(halves, short_out, 4096);
+        for(i = 0; i < 4096; i++) {
+            int32_t r = hf_to_int32_r(halves[i], mode);
+            errors[2] += short_out[i] != (int16_t)(r < -32768 ? -32768 : r > 32767 ? 32767 : r);
+        }
+
+        results[m][0] = (float)m;
+        results[m][1] = (float)errors[0];
+        results[m][2] = (float)errors[1];
+        results[m][3] = (float)errors[2];
+        results[m][4] = (float)errors_double;
+    }
+    hf_set_rounding_mode(saved_mode);
+
+    printf("Modes: 0 = au plus proche (pair), 1 = au plus proche (loin de 0), 2 = vers 0, 3 = vers +inf, 4 = vers -inf\n");
+    print_formatted_table("### HF_FROM_DOUBLE / HF_FROM_INT32 / HF_TO_INT32_R (ecarts avec les references)", headers, 5, results, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Fonction de débogage pour tester les tables exhaustives des fonctions unaires
+ *
+ * Active la table de chaque fonction du registre et compare, sur les 65536 motifs,
+ * les lectures hf_unary()/hf_unary_n() avec l'implémentation algorithmique. Vérifie
+ * aussi l'aller-retour hf_lut_save()/hf_lut_load() d'une table, et qu'une table
+ * générée sous un moteur n'est plus servie après hf_engine_select().
+ */
+void debug_lut(void) {
+    static uint16_t in[HF_LUT_SIZE], out[HF_LUT_SIZE];
+    const char *headers[] = {"Fonction", "hf_unary", "hf_unary_n"};
+    const char *path = "hf_lut_test.bin";
+    float results[HF_UNARY_COUNT][8];
+    hf_unary_lut_t loaded;
+    hf_engine saved_engine = hf_engine_selected();
+    int id;
+    int roundtrip_errors = 0;
+    int engine_errors = 0;
+    unsigned int i;
+
+    for(i = 0; i < HF_LUT_SIZE; i++) in[i] = (uint16_t)i;
+
+    for(id = 0; id < HF_UNARY_COUNT; id++) {
+        hf_unary_fn fn = hf_unary_handle((hf_unary_id)id)->fn;
+        int errors[2] = {0, 0};
+
+        if(hf_unary_set_lut((hf_unary_id)id, 1) && hf_unary_is_lut((hf_unary_id)id)) {
+            hf_unary_n((hf_unary_id)id, in, out, HF_LUT_SIZE);
+            for(i = 0; i < HF_LUT_SIZE; i++) {
+                uint16_t ref = fn((uint16_t)i);
+                errors[0] += hf_unary((hf_unary_id)id, (uint16_t)i) != ref;
+                errors[1] += out[i] != ref;
+            }
+        } else {
+            errors[0] = errors[1] = HF_LUT_SIZE;
+        }
+
+        results[id][0] = (float)id;
+        results[id][1] = (float)errors[0];
+        results[id][2] = (float)errors[1];
+    }
+
+    //Aller-retour par fichier de la table exp
+    hf_lut_init(&loaded, hf_exp);
+    if(hf_lut_save(hf_unary_handle(HF_UNARY_EXP), path) && hf_lut_load(&loaded, path)) {
+        for(i = 0; i < HF_LUT_SIZE; i++) roundtrip_errors += hf_lut_eval(&loaded, (uint16_t)i) != hf_exp((uint16_t)i);
+    } else {
+        roundtrip_errors = -1;
+    }
+    hf_lut_free(&loaded);
+    remove(path);
+
+    //Changement de moteur: les tables sin/exp générées sous l'autre moteur sont ignorées
+    hf_engine_select(saved_engine == HF_ENGINE_POLY ? HF_ENGINE_TABLE : HF_ENGINE_POLY);
+    engine_errors += hf_unary_is_lut(HF_UNARY_SIN) + hf_unary_is_lut(HF_UNARY_EXP);
+    hf_unary_n(HF_UNARY_EXP, in, out, HF_LUT_SIZE);
+    for(i = 0; i < HF_LUT_SIZE; i++) {
+        engine_errors += hf_unary(HF_UNARY_SIN, (uint16_t)i) != hf_sin((uint16_t)i);
+        engine_errors += out[i] != hf_exp((uint16_t)i);
+    }
+    hf_engine_select(saved_engine);
+
+    for(id = 0; id < HF_UNARY_COUNT; id++) hf_unary_set_lut((hf_unary_id)id, 0);
+
+    print_formatted_table("### HF_UNARY_LUT (ecarts avec les versions algorithmiques)", headers, 3, results, HF_UNARY_COUNT);
+    printf("Aller-retour hf_lut_save/hf_lut_load: %d ecart(s)\n", roundtrip_errors);
+    printf("Tables sin/exp apres changement de moteur: %d ecart(s)\n\n", engine_errors);
+}
+
+/**
+ * @brief Compare les ordres d'interpolation des tables (linéaire, quadratique, cubique)
+ *
+ * Construit des tables de sinus Q15 sur [0, pi/2] de 16 à 256 intervalles
+ * (avec pentes pour l'ordre cubique) et mesure l'erreur maximale de chaque
+ * interpolateur par rapport à sin(), en LSB Q15.
+ */
+void debug_interp(void) {
+    static uint16_t table[257], slopes[257];
+    const char *headers[] = {"Intervalles", "Lineaire", "Quadratique", "Cubique"};
+    float results[5][8];
+    int row, n, i, order;
+
+    for(row = 0; row < 5; row++) {
+        n = 16 << row;
+
+        for(i = 0; i <= n; i++) {
+            double angle = (M_PI / 2) * i / n;
+            table[i] = (uint16_t)(sin(angle) * 32768.0 + 0.5);
+            slopes[i] = (uint16_t)(cos(angle) * (M_PI / 2) / n * 32768.0 + 0.5);
+        }
+
+        results[row][0] = (float)n;
+        for(order = HF_INTERP_LINEAR; order <= HF_INTERP_CUBIC; order++) {
+            double max_err = 0.0;
+            uint32_t index;
+
+            //Indice à 8 bits de fraction sur toute la table
+            for(index = 0; index <= (uint32_t)n << 8; index++) {
+                double ref = sin((M_PI / 2) * index / (n << 8)) * 32768.0;
+                int value = TABLE_INTERPOLATE(order, table, slopes, n + 1, index, 8);
+                double err = fabs(value - ref);
+                if(err > max_err) max_err = err;
+            }
+            results[row][order] = (float)max_err;
+        }
+    }
+
+    print_formatted_table("### TABLE_INTERPOLATE (erreur max en LSB Q15, table sin)", headers, 4, results, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Compare hf_dot (accumulateur exact) à une chaîne de hf_fma et vérifie gemv/gemm
+ *
+ * Vecteurs pseudo-aléatoires de valeurs dans [-1, 1] (exposant >= -6): la somme
+ * en double est alors exacte et sert de référence. Les erreurs sont exprimées en
+ * ULP demi-précision de la référence; hf_dot doit rester <= 0.5. Le second
+ * tableau compte les écarts de hf_gemv/hf_gemm/hf_axpy avec hf_dot (doivent valoir 0).
+ */
+void debug_blas(void) {
+    static uint16_t a[4096], b[4096], mat[64 * 96], mat2[96 * 48], out[64 * 48], col[96];
+    const char *headers[] = {"n", "Reference", "hf_dot", "Err dot (ulp)", "Chaine fma", "Err fma (ulp)"};
+    const char *headers2[] = {"Noyau", "Ecarts"};
+    float results[5][8], checks[3][8];
+    unsigned int seed = 0x12345678U;
+    int row, i, j, errors;
+
+    for(i = 0; i < 4096; i++) {
+        seed = seed * 1103515245U + 12345U;
+        a[i] = (uint16_t)(((seed >> 16) & 0x83FFU) | ((9U + (seed >> 8) % 7U) << HF_MANT_BITS));
+        seed = seed * 1103515245U + 12345U;
+        b[i] = (uint16_t)(((seed >> 16) & 0x83FFU) | ((9U + (seed >> 8) % 7U) << HF_MANT_BITS));
+    }
+
+    for(row = 0; row < 5; row++) {
+        int n = 16 << (row * 2);
+        double ref = 0.0, ulp;
+        uint16_t dot, chain = HF_ZERO_POS;
+        int exponent;
+
+        for(i = 0; i < n; i++) {
+            ref += (double)half_to_float(a[i]) * (double)half_to_float(b[i]);
+            chain = hf_fma(a[i], b[i], chain);
+        }
+        dot = hf_dot(a, b, (size_t)n);
+        frexp(ref, &exponent);
+        ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+
+        results[row][0] = (float)n;
+        results[row][1] = (float)ref;
+        results[row][2] = half_to_float(dot);
+        results[row][3] = (float)(fabs((double)half_to_float(dot) - ref) / ulp);
+        results[row][4] = half_to_float(chain);
+        results[row][5] = (float)(fabs((double)half_to_float(chain) - ref) / ulp);
+    }
+
+    print_formatted_table("### HF_DOT (accumulateur exact) / chaine HF_FMA", headers, 6, results, 5);
+
+    //gemv et gemm doivent reproduire hf_dot ligne par ligne / colonne par colonne
+    for(i = 0; i < 64 * 96; i++) mat[i] = a[i % 4096] ^ (uint16_t)((i & 1) << HF_SIGN_BITS);
+    for(i = 0; i < 96 * 48; i++) mat2[i] = b[(i * 7) % 4096];
+
+    hf_gemv(mat, 96, b, out, 64, 96);
+    for(errors = 0, i = 0; i < 64; i++) errors += out[i] != hf_dot(&mat[i * 96], b, 96);
+    checks[0][0] = 0.0f;
+    checks[0][1] = (float)errors;
+
+    hf_gemm(mat, 96, mat2, 48, out, 48, 64, 48, 96);
+    for(errors = 0, j = 0; j < 48; j++) {
+        for(i = 0; i < 96; i++) col[i] = mat2[i * 48 + j];
+        for(i = 0; i < 64; i++) errors += out[i * 48 + j] != hf_dot(&mat[i * 96], col, 96);
+    }
+    checks[1][0] = 1.0f;
+    checks[1][1] = (float)errors;
+
+    for(i = 0; i < 256; i++) out[i] = b[i];
+    hf_axpy(a[0], a, out, 256);
+    for(errors = 0, i = 0; i < 256; i++) {
+        uint16_t pair_a[2], pair_b[2];
+        pair_a[0] = a[0];
+        pair_a[1] = b[i];
+        pair_b[0] = a[i];
+        pair_b[1] = HF_ONE_POS;
+        errors += out[i] != hf_dot(pair_a, pair_b, 2);
+    }
+    checks[2][0] = 2.0f;
+    checks[2][1] = (float)errors;
+
+    print_formatted_table("### HF_GEMV (0) / HF_GEMM (1) / HF_AXPY (2) (ecarts avec hf_dot)", headers2, 2, checks, 3);
+    printf("\n");
+}
+
+/**
+ * @brief Vérifie hf_sincos/hf_sinhcosh (et leurs versions par lots) contre les fonctions séparées
+ *
+ * Parcourt les 65536 motifs 16 bits pour chacun des modes d'arrondi et compte
+ * les résultats qui diffèrent de hf_sin/hf_cos et hf_sinh/hf_cosh.
+ * Toutes les colonnes doivent valoir 0.
+ */
+void debug_sincos(void) {
+    static uint16_t in[65536], out1[65536], out2[65536];
+    const char *headers[] = {"Mode", "sincos", "sincos_n", "sinhcosh", "sinhcosh_n"};
+    float results[5][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    int mode;
+    unsigned int i;
+
+    for(i = 0; i < 65536; i++) in[i] = (uint16_t)i;
+
+    for(mode = 0; mode < 5; mode++) {
+        int errors[4] = {0, 0, 0, 0};
+        int j;
+
+        hf_set_rounding_mode((hf_rounding_mode)mode);
+
+        for(i = 0; i < 65536; i++) {
+            uint16_t s, c, sh, ch;
+            hf_sincos(in[i], &s, &c);
+            hf_sinhcosh(in[i], &sh, &ch);
+            errors[0] += s != hf_sin(in[i]) || c != hf_cos(in[i]);
+            errors[2] += sh != hf_sinh(in[i]) || ch != hf_cosh(in[i]);
+        }
+        hf_sincos_n(in, out1, out2, 65536);
+        for(i = 0; i < 65536; i++) errors[1] += out1[i] != hf_sin(in[i]) || out2[i] != hf_cos(in[i]);
+        hf_sinhcosh_n(in, out1, out2, 65536);
+        for(i = 0; i < 65536; i++) errors[3] += out1[i] != hf_sinh(in[i]) || out2[i] != hf_cosh(in[i]);
+
+        results[mode][0] = (float)mode;
+        for(j = 0; j < 4; j++) results[mode][j + 1] = (float)errors[j];
+    }
+
+    hf_set_rounding_mode(saved_mode);
+
+    print_formatted_table("### HF_SINCOS / HF_SINHCOSH (ecarts avec les fonctions separees)", headers, 5, results, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Vérifie les opérations SWAR (hf2/hf4) voie par voie contre les fonctions scalaires
+ *
+ * Parcourt les 65536 motifs 16 bits, associés à 16 seconds opérandes (zéros,
+ * infinis, NaN et valeurs réparties), et compte pour chaque largeur les voies
+ * qui diffèrent de hf_neg/hf_abs/hf_copysign, de la classification, de
+ * hf_cmp, de hf_min/hf_max et de hf_add/hf_mul.
+ * Toutes les colonnes doivent valoir 0.
+ */
+void debug_swar(void) {
+    static const uint16_t others[16] = {
+        HF_ZERO_POS, HF_ZERO_NEG, HF_ONE_POS, 0xBC00U, HF_INFINITY_POS, HF_INFINITY_NEG, HF_NAN, 0xFE01U,
+        0x0001U, 0x83FFU, 0x0400U, 0x7BFFU, 0xFBFFU, 0x3555U, 0xC248U, 0x5A5AU
+    };
+    const char *headers[] = {"Voies", "Signe", "Classification", "hf_cmp", "min/max", "add/mul"};
+    float results[2][8];
+    int errors[2][5];
+    unsigned int i, j;
+    int lane, k;
+
+    memset(errors, 0, sizeof(errors));
+
+    for(i = 0; i < 65536; i++) {
+        for(j = 0; j < 16; j += 2) {
+            uint16_t x[4], y[4];
+            hf2 x2, y2, r2[10];
+            hf4 x4, y4, r4[10];
+
+            x[0] = (uint16_t)i;
+            x[1] = others[j];
+            x[2] = (uint16_t)(i ^ HF_MASK_SIGN);
+            x[3] = (uint16_t)(i * 40503U);
+            y[0] = others[j];
+            y[1] = (uint16_t)i;
+            y[2] = others[j + 1];
+            y[3] = (uint16_t)i;
+
+            x2 = hf2_load(x);
+            y2 = hf2_load(y);
+            x4 = hf4_load(x);
+            y4 = hf4_load(y);
+
+            r2[0] = hf2_neg(x2);      r4[0] = hf4_neg(x4);
+            r2[1] = hf2_abs(x2);      r4[1] = hf4_abs(x4);
+            r2[2] = hf2_copysign(x2, y2); r4[2] = hf4_copysign(x4, y4);
+            r2[3] = hf2_cmp(x2, y2);  r4[3] = hf4_cmp(x4, y4);
+            r2[4] = hf2_min(x2, y2);  r4[4] = hf4_min(x4, y4);
+            r2[5] = hf2_max(x2, y2);  r4[5] = hf4_max(x4, y4);
+            r2[6] = hf2_add(x2, y2);  r4[6] = hf4_add(x4, y4);
+            r2[7] = hf2_mul(x2, y2);  r4[7] = hf4_mul(x4, y4);
+            //Classification codée sur un mot par largeur (un bit par prédicat)
+            r2[8] = (hf2_isnan(x2) & 0x00010001U) | (hf2_isinf(x2) & 0x00020002U) | (hf2_isfinite(x2) & 0x00040004U)
+                    | (hf2_iszero(x2) & 0x00080008U) | (hf2_issubnormal(x2) & 0x00100010U)
+                    | (hf2_isnormal(x2) & 0x00200020U) | (hf2_signbit(x2) & 0x00400040U);
+            r4[8] = (hf4_isnan(x4) & 0x0001000100010001ULL) | (hf4_isinf(x4) & 0x0002000200020002ULL)
+                    | (hf4_isfinite(x4) & 0x0004000400040004ULL) | (hf4_iszero(x4) & 0x0008000800080008ULL)
+                    | (hf4_issubnormal(x4) & 0x0010001000100010ULL) | (hf4_isnormal(x4) & 0x0020002000200020ULL)
+                    | (hf4_signbit(x4) & 0x0040004000400040ULL);
+            //Masques d'égalité et d'ordre ramenés au code de hf_cmp
+            r2[9] = hf2_eq(x2, y2) | (hf2_lt(x2, y2) & 0x00020002U) | (hf2_le(x2, y2) & 0x00040004U);
+            r4[9] = hf4_eq(x4, y4) | (hf4_lt(x4, y4) & 0x0002000200020002ULL) | (hf4_le(x4, y4) & 0x0004000400040004ULL);
+
+            for(lane = 0; lane < 4; lane++) {
+                half_float hx = decompose_half(x[lane]);
+                int cmp = hf_cmp(x[lane], y[lane]);
+                uint16_t cls = (uint16_t)(is_nan(&hx) | (is_infinity(&hx) << 1) | (!is_nan(&hx) && !is_infinity(&hx)) << 2
+                                          | is_zero(&hx) << 3 | (is_subnormal(&hx) && !is_zero(&hx)) << 4
+                                          | (!is_nan(&hx) && !is_infinity(&hx) && !is_zero(&hx) && !is_subnormal(&hx)) << 5
+                                          | (x[lane] & HF_MASK_SIGN) >> 9);
+                uint16_t ord = (uint16_t)((cmp == 0 ? 0xFFFFU : 0U) | (cmp == -1 ? 0x0002U : 0U) | ((cmp == -1 || cmp == 0) ? 0x0004U : 0U));
+                uint16_t ref[10];
+
+                ref[0] = hf_neg(x[lane]);
+                ref[1] = hf_abs(x[lane]);
+                ref[2] = hf_copysign(x[lane], y[lane]);
+                ref[3] = (uint16_t)cmp;
+                ref[4] = hf_min(x[lane], y[lane]);
+                ref[5] = hf_max(x[lane], y[lane]);
+                ref[6] = hf_add(x[lane], y[lane]);
+                ref[7] = hf_mul(x[lane], y[lane]);
+                ref[8] = cls;
+                ref[9] = ord;
+
+                for(k = 0; k < 10; k++) {
+                    //Colonnes: signe (0-2), classification (8), hf_cmp (3, 9), min/max (4-5), add/mul (6-7)
+                    int column = (k < 3) ? 0 : (k == 8) ? 1 : (k == 3 || k == 9) ? 2 : (k < 6) ? 3 : 4;
+                    if(lane < 2 && hf2_lane(r2[k], lane) != ref[k]) errors[0][column]++;
+                    if(hf4_lane(r4[k], lane) != ref[k]) errors[1][column]++;
+                }
+            }
+        }
+    }
+
+    for(k = 0; k < 2; k++) {
+        results[k][0] = (float)(2 << k);
+        for(lane = 0; lane < 5; lane++) results[k][lane + 1] = (float)errors[k][lane];
+    }
+
+    print_formatted_table("### SWAR HF2/HF4 (ecarts avec les fonctions scalaires)", headers, 6, results, 2);
+    printf("\n");
+}
+
+/**
+ * @brief Vérifie hf_sort, hf_argmax, hf_topk, hf_isnan_n et hf_classify_n
+ *
+ * Les références sont construites sans clé d'ordre: l'ordre total est
+ * parcouru explicitement (0xFFFF à 0x8000 puis 0x0000 à 0x7FFF) et les
+ * indices sont répartis par comptage selon ce rang. Tableaux aléatoires de
+ * tailles variées (avec infinis et NaN de chaque signe) et tableau des
+ * 65536 motifs. Toutes les colonnes d'écarts doivent valoir 0.
+ */
+void debug_sort(void) {
+    static const size_t sizes[8] = {0, 1, 5, 31, 32, 257, 4096, 70000};
+    static uint16_t data[70000], sorted[70000], expect[70000];
+    static size_t idx[70000], ref_idx[70000], start[65537];
+    static uint32_t rank[65536];
+    static uint64_t mask[(70000 + 63) / 64];
+    const char *headers[] = {"n", "hf_sort", "hf_argmax", "hf_topk", "hf_isnan_n", "hf_classify_n"};
+    float results[9][8];
+    unsigned int seed = 0x2468ACEU;
+    uint32_t value, r;
+    size_t i, m, valid;
+    int row;
+
+    //Rang croissant dans l'ordre total: -NaN (charge décroissante) ... -0, +0 ... +NaN
+    for(r = 0, value = 0xFFFFU; value >= 0x8000U; value--) rank[value] = r++;
+    for(value = 0; value < 0x8000U; value++) rank[value] = r++;
+
+    for(row = 0; row < 9; row++) {
+        size_t n = (row < 8) ? sizes[row] : 65536;
+        size_t argmax_ref = n, k = n / 3 + 1;
+        int errors[5] = {0, 0, 0, 0, 0};
+
+        for(i = 0; i < n; i++) {
+            seed = seed * 1103515245U + 12345U;
+            if(row == 8) data[i] = (uint16_t)(i * 40503U);
+            else if((seed >> 28) == 0) data[i] = (uint16_t)(((seed >> 12) & 1U) ? 0xFC00U : 0x7C00U) | (uint16_t)((seed >> 13) & 3U);
+            else data[i] = (uint16_t)(seed >> 12);
+        }
+
+        //Référence du tri: histogramme des rangs puis parcours de l'ordre total
+        memset(start, 0, sizeof(start));
+        for(i = 0; i < n; i++) start[rank[data[i]] + 1]++;
+        for(r = 0; r < 65536; r++) start[r + 1] += start[r];
+        for(i = 0; i < n; i++) expect[start[rank[data[i]]]++] = data[i];
+        memcpy(sorted, data, n * sizeof(uint16_t));
+        hf_sort(sorted, n);
+        for(i = 0; i < n; i++) errors[0] += sorted[i] != expect[i];
+
+        //Référence argmax/topk: indices non NaN par rang décroissant, stables
+        memset(start, 0, sizeof(start));
+        for(valid = 0, i = 0; i < n; i++) {
+            half_float h = decompose_half(data[i]);
+            if(!is_nan(&h)) {
+                start[65535 - rank[data[i]] + 1]++;
+                valid++;
+            }
+        }
+        for(r = 0; r < 65536; r++) start[r + 1] += start[r];
+        for(i = 0; i < n; i++) {
+            half_float h = decompose_half(data[i]);
+            if(!is_nan(&h)) ref_idx[start[65535 - rank[data[i]]]++] = i;
+        }
+        if(valid > 0) argmax_ref = ref_idx[0];
+        errors[1] += hf_argmax(data, n) != argmax_ref;
+
+        m = hf_topk(data, n, k, idx);
+        errors[2] += m != ((k < valid) ? k : valid);
+        for(i = 0; i < m; i++) errors[2] += idx[i] != ref_idx[i];
+
+        hf_isnan_n(data, mask, n);
+        for(i = 0; i < n; i++) {
+            half_float h = decompose_half(data[i]);
+            errors[3] += (int)((mask[i >> 6] >> (i & 63)) & 1U) != (is_nan(&h) ? 1 : 0);
+        }
+        if(n & 63) errors[3] += (mask[n >> 6] >> (n & 63)) != 0;
+
+        hf_classify_n(data, HF_CLASS_SUBNORMAL | HF_CLASS_NEG_INF | HF_CLASS_QNAN, mask, n);
+        for(i = 0; i < n; i++) {
+            half_float h = decompose_half(data[i]);
+            unsigned int cls = hf_classify(data[i]);
+            int expected = (is_subnormal(&h) && !is_zero(&h)) || (is_infinity(&h) && h.sign)
+                           || (is_nan(&h) && (data[i] & (1U << (HF_MANT_BITS - 1))));
+            errors[4] += (int)((mask[i >> 6] >> (i & 63)) & 1U) != expected;
+            errors[4] += (cls & (cls - 1U)) != 0 || cls == 0;
+        }
+
+        results[row][0] = (float)n;
+        for(i = 0; i < 5; i++) results[row][i + 1] = (float)errors[i];
+    }
+
+    print_formatted_table("### HF_SORT / HF_ARGMAX / HF_TOPK / MASQUES (ecarts avec les references)", headers, 6, results, 9);
+    printf("\n");
+}
+
+/**
+ * @brief Fonction de débogage pour tester les indicateurs d'exception
+ *
+ * Vérifie les indicateurs levés par des opérations représentatives (exactes,
+ * inexactes, dépassement, soupassement, invalides, division par zéro), puis
+ * compare par groupes de 16 éléments les indicateurs des versions par lots à
+ * ceux des boucles scalaires: opérations arithmétiques dans les cinq modes et
+ * hf_from_float_n pour chaque implémentation disponible. Avec HF_NO_FENV,
+ * aucun indicateur n'est attendu.
+ */
+void debug_fenv(void) {
+    static const uint32_t low_bits[8] = {0x0000, 0x1000, 0x0FFF, 0x1001, 0x2000, 0x3000, 0x3FFF, 0x0001};
+    static uint16_t a[65536], b[65536], c[65536], out[65536];
+    static float floats[65536];
+    const uint16_t one = 0x3C00U, two = 0x4000U, max = 0x7BFFU, tiny = 0x0400U, inf = HF_INFINITY_POS;
+    const char *case_headers[] = {"Cas", "Attendu", "Obtenu", "Ecart"};
+    const char *batch_headers[] = {"Mode", "add_n", "sub_n", "mul_n", "div_n", "fma_n", "sqrt_n"};
+    const char *conv_headers[] = {"Niveau", "Dispo", "even", "away", "zero", "+inf", "-inf"};
+    float cases[18][8], batch[5][8], conv[5][8];
+    unsigned int expected[18], got[18];
+    hf_simd_level saved_level = hf_simd_selected();
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+#if defined(HF_NO_FENV)
+    const unsigned int raised = 0; //Aucun indicateur n'est levé sans suivi
+    const char *case_title = "### HF_FETESTEXCEPT (indicateurs attendus / obtenus, inactif)";
+#else
+    const unsigned int raised = HF_FE_ALL_EXCEPT;
+    const char *case_title = "### HF_FETESTEXCEPT (indicateurs attendus / obtenus)";
+#endif
+    int mode, level, row;
+    unsigned int i, j;
+
+    //Opérations représentatives au plus proche pair (mot d'exceptions remis à zéro avant chacune)
+    hf_set_rounding_mode(HF_ROUND_NEAREST_EVEN);
+    for(row = 0; row < 18; row++) {
+        hf_feclearexcept(HF_FE_ALL_EXCEPT);
+        switch(row) {
+            case 0:  expected[row] = 0;                                (void)hf_add(one, two); break;
+            case 1:  expected[row] = HF_FE_INEXACT;                    (void)hf_add(one, 0x0C00U); break;
+            case 2:  expected[row] = HF_FE_OVERFLOW | HF_FE_INEXACT;   (void)hf_add(max, max); break;
+            case 3:  expected[row] = 0;                                (void)hf_mul(tiny, 0x3800U); break;
+            case 4:  expected[row] = HF_FE_UNDERFLOW | HF_FE_INEXACT;  (void)hf_mul(tiny, 0x34CDU); break;
+            case 5:  expected[row] = HF_FE_INVALID;                    (void)hf_div(0, 0); break;
+            case 6:  expected[row] = HF_FE_INVALID;                    (void)hf_sqrt(0xBC00U); break;
+            case 7:  expected[row] = HF_FE_DIVBYZERO;                  (void)hf_div(one, 0); break;
+            case 8:  expected[row] = HF_FE_INVALID;                    (void)hf_sub(inf, inf); break;
+            case 9:  expected[row] = 0;                                (void)hf_add(HF_NAN, one); break;
+            case 10: expected[row] = HF_FE_INVALID;                    (void)hf_add(0x7C01U, one); break;
+            case 11: expected[row] = HF_FE_UNDERFLOW | HF_FE_INEXACT;  (void)float_to_half(1e-10f); break;
+            case 12: expected[row] = HF_FE_OVERFLOW | HF_FE_INEXACT;   (void)float_to_half(1e6f); break;
+            case 13: expected[row] = HF_FE_INEXACT;                    (void)hf_from_double(0.1); break;
+            case 14: expected[row] = HF_FE_INEXACT;                    (void)hf_rint(0x4100U); break;
+            case 15: expected[row] = 0;                                (void)hf_nearbyint(0x4100U); break;
+            case 16: expected[row] = HF_FE_INVALID;                    (void)hf_to_int32_sat(inf); break;
+            default: expected[row] = HF_FE_OVERFLOW | HF_FE_INEXACT;   a[0] = a[1] = max; b[0] = b[1] = two; (void)hf_dot(a, b, 2); break;
+        }
+        expected[row] &= raised;
+        got[row] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+        cases[row][0] = (float)row;
+        cases[row][1] = (float)expected[row];
+        cases[row][2] = (float)got[row];
+        cases[row][3] = (float)(expected[row] != got[row]);
+    }
+
+    //Entrées: tous les motifs (NaN signalants, infinis, subnormaux compris) et floats de debug_conv
+    for(i = 0; i < 65536; i++) {
+        uint32_t bits = ((i * 4U >> 3) << 14) | low_bits[(i * 4U) & 7];
+        a[i] = (uint16_t)i;
+        b[i] = (uint16_t)(i * 40503U + 12345U);
+        c[i] = (uint16_t)((i * 2654435761U) >> 16);
+        memcpy(&floats[i], &bits, sizeof(bits));
+    }
+
+    //Versions par lots: mêmes indicateurs que la boucle scalaire sur chaque groupe de 16 éléments
+    for(mode = HF_ROUND_NEAREST_EVEN; mode <= HF_ROUND_TOWARD_NEG_INF; mode++) {
+        int errors[6] = {0, 0, 0, 0, 0, 0};
+
+        hf_set_rounding_mode((hf_rounding_mode)mode);
+        for(i = 0; i < 65536; i += 16) {
+            unsigned int batch_flags[6], scalar_flags[6];
+
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_add_n(a + i, b + i, out + i, 16);
+            batch_flags[0] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_sub_n(a + i, b + i, out + i, 16);
+            batch_flags[1] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_mul_n(a + i, b + i, out + i, 16);
+            batch_flags[2] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_div_n(a + i, b + i, out + i, 16);
+            batch_flags[3] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_fma_n(a + i, b + i, c + i, out + i, 16);
+            batch_flags[4] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            hf_sqrt_n(a + i, out + i, 16);
+            batch_flags[5] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+
+            for(j = 0; j < 6; j++) {
+                unsigned int k;
+
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                for(k = i; k < i + 16; k++) {
+                    if(j == 0) (void)hf_add(a[k], b[k]);
+                    else if(j == 1) (void)hf_sub(a[k], b[k]);
+                    else if(j == 2) (void)hf_mul(a[k], b[k]);
+                    else if(j == 3) (void)hf_div(a[k], b[k]);
+                    else if(j == 4) (void)hf_fma(a[k], b[k], c[k]);
+                    else (void)hf_sqrt(a[k]);
+                }
+                scalar_flags[j] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+                errors[j] += batch_flags[j] != scalar_flags[j];
+            }
+        }
+
+        batch[mode][0] = (float)mode;
+        for(j = 0; j < 6; j++) batch[mode][j + 1] = (float)errors[j];
+    }
+
+    //hf_from_float_n: indicateurs de chaque noyau (voies vectorielles et reste scalaire)
+    for(level = HF_SIMD_SCALAR; level <= HF_SIMD_NEON; level++) {
+        int errors[5] = {0, 0, 0, 0, 0};
+        int available = hf_simd_select((hf_simd_level)level);
+
+        for(mode = HF_ROUND_NEAREST_EVEN; available && mode <= HF_ROUND_TOWARD_NEG_INF; mode++) {
+            hf_set_rounding_mode((hf_rounding_mode)mode);
+            for(i = 0; i < 65536; i += 24) {
+                unsigned int n = (65536 - i < 24) ? 65536 - i : 24, batch_flags, k;
+
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                hf_from_float_n(floats + i, out, n);
+                batch_flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                for(k = i; k < i + n; k++) (void)float_to_half(floats[k]);
+                errors[mode] += batch_flags != hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            }
+        }
+
+        conv[level - HF_SIMD_SCALAR][0] = (float)level;
+        conv[level - HF_SIMD_SCALAR][1] = (float)available;
+        for(j = 0; j < 5; j++) conv[level - HF_SIMD_SCALAR][j + 2] = (float)errors[j];
+    }
+
+    hf_simd_select(saved_level);
+    hf_set_rounding_mode(saved_mode);
+    hf_feclearexcept(HF_FE_ALL_EXCEPT);
+
+    print_formatted_table(case_title, case_headers, 4, cases, 18);
+    print_formatted_table("### HF_*_N (ecarts d'indicateurs avec les boucles scalaires)", batch_headers, 7, batch, 5);
+    print_formatted_table("### HF_FROM_FLOAT_N (ecarts d'indicateurs avec float_to_half)", conv_headers, 7, conv, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Compare l'arithmétique fp16 à la référence exacte dans les cinq modes
+ *
+ * hf_add_r, hf_sub_r, hf_mul_r, hf_div_r, hf_sqrt_r et hf_inv_r sur 100000
+ * paires pseudo-aléatoires (la moitié des seconds opérandes à moins de 10
+ * exposants du premier, subnormaux compris; racine sur les 65536 motifs),
+ * valeur et indicateurs comparés à ref_fmt_exact arrondi par ref_round_fmt.
+ * Les écarts doivent être nuls. La dernière colonne compte les résultats
+ * vers +inf ou -inf qui s'écartent de la troncature alors que la valeur
+ * exacte en est à moins d'un demi-ULP: seuls les bits collants décident de
+ * leur arrondi. Suivent des cas particuliers à résultat et indicateurs
+ * fixés (0 / 0, produits et quotients d'opérandes subnormaux, bits
+ * collants de la renormalisation, du produit, de la racine et de l'inverse,
+ * dépassements selon le mode, signe des sommes exactement nulles).
+ */
+void debug_arith_modes(void) {
+    //Cas particuliers: opération, mode, x, y, résultat attendu, indicateurs attendus
+    static const uint16_t special[][6] = {
+        {3, HF_ROUND_NEAREST_EVEN,   0x0000U, 0x0000U, 0xFE00U, HF_FE_INVALID},
+        {3, HF_ROUND_NEAREST_EVEN,   0x8000U, 0x0000U, 0xFE00U, HF_FE_INVALID},
+        {3, HF_ROUND_TOWARD_ZERO,    0x0000U, 0x8000U, 0xFE00U, HF_FE_INVALID},
+        {2, HF_ROUND_NEAREST_EVEN,   0x0001U, 0x7BFFU, 0x1BFFU, 0},
+        {2, HF_ROUND_TOWARD_ZERO,    0x8001U, 0x7BFFU, 0x9BFFU, 0},
+        {3, HF_ROUND_NEAREST_EVEN,   0x0001U, 0x07E5U, 0x100EU, HF_FE_INEXACT},
+        {3, HF_ROUND_NEAREST_UP,     0x0001U, 0x1394U, 0x0439U, HF_FE_INEXACT},
+        {3, HF_ROUND_TOWARD_NEG_INF, 0x8003U, 0x0FAFU, 0x8E40U, HF_FE_INEXACT},
+        {0, HF_ROUND_NEAREST_EVEN,   0x5FFFU, 0x4101U, 0x6005U, HF_FE_INEXACT},
+        {2, HF_ROUND_NEAREST_EVEN,   0x3C61U, 0x3E25U, 0x3EBAU, HF_FE_INEXACT},
+        {2, HF_ROUND_TOWARD_POS_INF, 0x3C61U, 0x404AU, 0x40B3U, HF_FE_INEXACT},
+        {4, HF_ROUND_TOWARD_POS_INF, 0x3C3FU, 0x0000U, 0x3C20U, HF_FE_INEXACT},
+        {5, HF_ROUND_TOWARD_POS_INF, 0x0000U, 0x3C01U, 0x3BFFU, HF_FE_INEXACT},
+        {0, HF_ROUND_NEAREST_EVEN,   0x7BFFU, 0x7BFFU, 0x7C00U, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {0, HF_ROUND_TOWARD_ZERO,    0x7BFFU, 0x7BFFU, 0x7BFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {0, HF_ROUND_TOWARD_NEG_INF, 0x7BFFU, 0x7BFFU, 0x7BFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {1, HF_ROUND_TOWARD_POS_INF, 0xFBFFU, 0x7BFFU, 0xFBFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {1, HF_ROUND_TOWARD_NEG_INF, 0xFBFFU, 0x7BFFU, 0xFC00U, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {2, HF_ROUND_TOWARD_ZERO,    0xFBFFU, 0x4000U, 0xFBFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {3, HF_ROUND_TOWARD_NEG_INF, 0x7BFFU, 0x3800U, 0x7BFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {5, HF_ROUND_TOWARD_ZERO,    0x0000U, 0x0001U, 0x7BFFU, HF_FE_OVERFLOW | HF_FE_INEXACT},
+        {0, HF_ROUND_NEAREST_EVEN,   0x0001U, 0x8001U, 0x0000U, 0},
+        {0, HF_ROUND_TOWARD_NEG_INF, 0x0001U, 0x8001U, 0x8000U, 0},
+        {0, HF_ROUND_TOWARD_NEG_INF, 0x0000U, 0x8000U, 0x8000U, 0},
+        {0, HF_ROUND_TOWARD_NEG_INF, 0x3C00U, 0xBC00U, 0x8000U, 0},
+        {1, HF_ROUND_TOWARD_NEG_INF, 0x5640U, 0x5640U, 0x8000U, 0},
+        {1, HF_ROUND_TOWARD_POS_INF, 0x8000U, 0x8000U, 0x0000U, 0}
+    };
+    static uint16_t opa[100000], opb[100000];
+    const char *headers[] = {"Operation", "even", "away", "zero", "+inf", "-inf", "Collant seul"};
+    const char *special_headers[] = {"Cas", "Operation", "Mode", "Attendu", "Obtenu", "Indic. att.", "Indic. obt.", "Ecart"};
+    float results[6][8], special_results[sizeof(special) / sizeof(special[0])][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    uint32_t seed = 2024U;
+    int op, mode, e;
+    unsigned int i;
+
+    for(i = 0; i < 100000; i++) {
+        seed = seed * 1103515245U + 12345U;
+        opa[i] = (uint16_t)(seed >> 16);
+        seed = seed * 1103515245U + 12345U;
+        opb[i] = (uint16_t)(seed >> 16);
+        if(seed & 0x100U) {
+            e = (int)((opa[i] >> HF_MANT_BITS) & 0x1FU) + (int)((seed >> 9) % 21U) - 10;
+            e = e < 0 ? 0 : e > 30 ? 30 : e;
+            opb[i] = (uint16_t)((opb[i] & 0x83FFU) | ((uint32_t)e << HF_MANT_BITS));
+        }
+    }
+
+    //Lignes: 0 add, 1 sub, 2 mul, 3 div, 4 sqrt (rangs de ref_fmt_exact), 5 inv (1 / b)
+    for(op = 0; op < 6; op++) {
+        unsigned int n = op == 4 ? 65536U : 100000U;
+        unsigned long sticky = 0;
+
+        results[op][0] = (float)op;
+        for(mode = HF_ROUND_NEAREST_EVEN; mode <= HF_ROUND_TOWARD_NEG_INF; mode++) {
+            unsigned long errors = 0;
+
+            hf_set_rounding_mode((hf_rounding_mode)mode);
+            for(i = 0; i < n; i++) {
+                uint16_t x = op == 4 ? (uint16_t)i : op == 5 ? 0x3C00U : opa[i], y = opb[i], got, expect;
+                uint16_t sx = x & HF_MASK_SIGN, sy = (op == 1 ? y ^ HF_MASK_SIGN : y) & HF_MASK_SIGN;
+                unsigned int flags;
+                double v;
+
+                if(ref_fmt_class(x, HF_FORMAT_FP16) || (op != 4 && ref_fmt_class(y, HF_FORMAT_FP16))) continue;
+                if(((op == 3 || op == 5) && hf_to_double(y) == 0.0) || (op == 4 && hf_to_double(x) < 0.0)) continue;
+
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                got = arith_test_op(op, x, y, (hf_rounding_mode)mode);
+                flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+
+                //Zéro exact: signe IEEE (somme de signes opposés: -0 seulement vers -inf)
+                v = ref_fmt_exact(op == 5 ? 3 : op, hf_to_double(x), hf_to_double(y), 0.0);
+                expect = (uint16_t)ref_round_fmt(v, HF_FORMAT_FP16, (hf_rounding_mode)mode);
+                if(v == 0.0) {
+                    if(op == 2 || op == 3) expect |= (x ^ y) & HF_MASK_SIGN;
+                    else if(op == 4) expect |= sx;
+                    else if((sx && sy) || (sx != sy && mode == HF_ROUND_TOWARD_NEG_INF)) expect |= HF_MASK_SIGN;
+                }
+                errors += got != expect || flags != ref_fmt_flags(v, expect, HF_FORMAT_FP16);
+
+                //Arrondi vers l'extérieur décidé par les seuls bits collants (valeur exacte sous le demi-ULP)
+                if(mode >= HF_ROUND_TOWARD_POS_INF && v != 0.0) {
+                    uint32_t truncated = ref_round_fmt(v, HF_FORMAT_FP16, HF_ROUND_TOWARD_ZERO);
+                    sticky += expect != truncated && ref_round_fmt(v, HF_FORMAT_FP16, HF_ROUND_NEAREST_UP) == truncated;
+                }
+            }
+            results[op][mode + 1] = (float)errors;
+        }
+        results[op][6] = (float)sticky;
+    }
+
+    for(i = 0; i < sizeof(special) / sizeof(special[0]); i++) {
+        uint16_t got;
+        unsigned int flags;
+
+        hf_feclearexcept(HF_FE_ALL_EXCEPT);
+        got = arith_test_op(special[i][0], special[i][2], special[i][3], (hf_rounding_mode)special[i][1]);
+        flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+        special_results[i][0] = (float)i;
+        special_results[i][1] = (float)special[i][0];
+        special_results[i][2] = (float)special[i][1];
+        special_results[i][3] = (float)special[i][4];
+        special_results[i][4] = (float)got;
+        special_results[i][5] = (float)special[i][5];
+        special_results[i][6] = (float)flags;
+        special_results[i][7] = (float)(got != special[i][4] || flags != special[i][5]);
+    }
+
+    hf_set_rounding_mode(saved_mode);
+    hf_feclearexcept(HF_FE_ALL_EXCEPT);
+
+    print_formatted_table("### ARITHMETIQUE fp16 add/sub/mul/div/sqrt/inv (ecarts avec la reference exacte par mode)", headers, 7, results, 6);
+    print_formatted_table("### ARITHMETIQUE fp16 cas particuliers (resultat et indicateurs fixes)", special_headers, 8, special_results, (int)(sizeof(special) / sizeof(special[0])));
+    printf("\n");
+}
+
+/**
+ * @brief Fonction de débogage pour tester les restes et les voisins
+ *
+ * Compare hf_fmod, hf_remainder et hf_remquo (signe et 3 bits de poids faible
+ * du quotient) à la bibliothèque mathématique double, résultats exacts donc
+ * comparés bit à bit, sur les 65536 dividendes et 260 diviseurs (zéros,
+ * subnormaux, infinis et NaN compris), puis les versions par lots aux
+ * versions scalaires. hf_nextafter et hf_nexttoward sont comparés sur les
+ * 65536 entrées au voisin obtenu par nextafterf puis arrondi dirigé.
+ */
+void debug_remainder(void) {
+    static const uint16_t extra_y[4] = {HF_INFINITY_POS, HF_INFINITY_NEG, 0x0001U, 0x3C00U};
+    static uint16_t a[65536], b[65536], out[65536];
+    static int quo[65536];
+    const char *headers[] = {"Test", "Cas", "Erreurs"};
+    float results[7][8];
+    unsigned long errors[7] = {0, 0, 0, 0, 0, 0, 0}, count[7] = {0, 0, 0, 0, 0, 0, 0};
+    unsigned int i, j;
+    int row;
+
+    for(i = 0; i < 65536; i++) a[i] = (uint16_t)i;
+
+    for(j = 0; j < 260; j++) {
+        uint16_t y = j < 256 ? (uint16_t)(j * 257U) : extra_y[j - 256];
+        double dy = half_to_float(y);
+
+        for(i = 0; i < 65536; i++) {
+            uint16_t x = (uint16_t)i;
+            double dx = half_to_float(x);
+            uint16_t got_f = hf_fmod(x, y), got_r = hf_remainder(x, y), got_q;
+            uint16_t ref_f = float_to_half((float)fmod(dx, dy)), ref_r = float_to_half((float)remainder(dx, dy));
+            half_float hf = decompose_half(got_f), hr = decompose_half(got_r), rf = decompose_half(ref_f), rr = decompose_half(ref_r);
+            int q = 0, ref_q = 0;
+
+            errors[0] += (is_nan(&rf) || is_nan(&hf)) ? is_nan(&rf) != is_nan(&hf) : got_f != ref_f;
+            errors[1] += (is_nan(&rr) || is_nan(&hr)) ? is_nan(&rr) != is_nan(&hr) : got_r != ref_r;
+            got_q = hf_remquo(x, y, &q);
+            (void)remquo(dx, dy, &ref_q);
+            if(!is_nan(&rr)) {
+                int mq = q < 0 ? -q : q, mr = ref_q < 0 ? -ref_q : ref_q;
+                errors[2] += got_q != ref_r || (mq & 7) != (mr & 7) || ((mr & 7) && (q < 0) != (ref_q < 0));
+            }
+            count[0]++; count[1]++; count[2]++;
+        }
+
+        //Versions par lots contre scalaires (diviseur constant, comme une réduction d'argument)
+        for(i = 0; i < 65536; i++) b[i] = y;
+        hf_fmod_n(a, b, out, 65536);
+        for(i = 0; i < 65536; i++) errors[3] += out[i] != hf_fmod(a[i], y);
+        hf_remquo_n(a, b, out, quo, 65536);
+        for(i = 0; i < 65536; i++) {
+            int q = 0;
+            errors[4] += out[i] != hf_remquo(a[i], y, &q) || quo[i] != q;
+        }
+        count[3] += 65536; count[4] += 65536;
+    }
+
+    //Voisins: le float juste au-delà, arrondi vers l'infini dans la direction choisie
+    for(i = 0; i < 65536; i++) {
+        uint16_t x = (uint16_t)i;
+        half_float h = decompose_half(x);
+        float fx = half_to_float(x);
+        long double delta;
+
+        if(!is_nan(&h)) {
+            uint16_t up = float_to_half_r(nextafterf(fx, INFINITY), HF_ROUND_TOWARD_POS_INF);
+            uint16_t down = float_to_half_r(nextafterf(fx, -INFINITY), HF_ROUND_TOWARD_NEG_INF);
+
+            if(x == HF_INFINITY_POS) up = x;
+            if(x == HF_INFINITY_NEG) down = x;
+            errors[5] += hf_nextafter(x, HF_INFINITY_POS) != up || hf_nextafter(x, HF_INFINITY_NEG) != down;
+            errors[5] += hf_nextafter(x, x) != x || hf_nextafter(x, HF_NAN) != HF_NAN;
+            //Cible à peine différente de x (écart relatif 2^-40, invisible en double précision près de 1)
+            delta = is_infinity(&h) ? 1.0L : fabsl((long double)fx) * 0x1p-40L + 1e-30L;
+            errors[6] += hf_nexttoward(x, (long double)fx + delta) != (is_infinity(&h) ? x : up);
+            errors[6] += hf_nexttoward(x, (long double)fx - delta) != (is_infinity(&h) ? x : down);
+            count[5] += 4; count[6] += 2;
+        }
+    }
+    errors[5] += hf_nextafter(HF_ZERO_POS, HF_ZERO_NEG) != HF_ZERO_NEG || hf_nexttoward(HF_ZERO_NEG, 0.0L) != HF_ZERO_POS;
+
+    for(row = 0; row < 7; row++) {
+        results[row][0] = (float)row;
+        results[row][1] = (float)count[row];
+        results[row][2] = (float)errors[row];
+    }
+
+    //Lignes: fmod, remainder, remquo, fmod_n, remquo_n, nextafter, nexttoward
+    print_formatted_table("### HF_FMOD / HF_REMAINDER / HF_REMQUO / HF_NEXTAFTER (ecarts avec les references)", headers, 3, results, 7);
+    printf("\n");
+}
+
 /**
  * @brief Fonction de débogage pour tester la fonction hf_pow avec divers cas de test
  * 
@@ -1013,7 +2111,7 @@ void debug_pow(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[70][8]; //Tableau statique étendu pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Base", "Exp", "Result (my_pow)", "Result (std::pow)", "Difference"};
     
     for(i = 0; i < num_tests; i++) {
@@ -1040,6 +2138,573 @@ void debug_pow(void) {
     printf("\n");
 }
 
+/**
+ * @brief Fonction de débogage pour tester hf_powi et les exposants entiers de hf_pow
+ *
+ * Compare hf_powi sur les 65536 bases à powl arrondi dans les cinq modes,
+ * vérifie que hf_pow donne le même résultat pour l'exposant entier
+ * correspondant, puis compare les exposants demi-entiers et quelconques de
+ * hf_pow à powl et la version par lots hf_pow_n à hf_pow.
+ */
+void debug_powi(void) {
+    static const int powers[11] = {2, 3, 4, 5, 7, -1, -2, -3, 15, -15, 100};
+    static const float half_powers[6] = {0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 0.3f};
+    static uint16_t a[65536], out[65536];
+    const char *int_headers[] = {"n", "even", "away", "zero", "+inf", "-inf", "hf_pow", "hf_pow_n"};
+    const char *half_headers[] = {"Exp", "hf_pow", "hf_pow_n"};
+    float int_results[11][8], half_results[6][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    unsigned int i;
+    int row, mode;
+
+    for(i = 0; i < 65536; i++) a[i] = (uint16_t)i;
+
+    for(row = 0; row < 11; row++) {
+        int n = powers[row];
+        uint16_t hfn = float_to_half((float)n);
+        unsigned long errors[7] = {0, 0, 0, 0, 0, 0, 0};
+
+        for(mode = 0; mode < 5; mode++) {
+            hf_set_rounding_mode((hf_rounding_mode)mode);
+            for(i = 0; i < 65536; i++) {
+                half_float h = decompose_half(a[i]);
+                uint16_t got = hf_powi(a[i], n), expect;
+                long double p;
+
+                if(is_nan(&h) || is_infinity(&h) || is_zero(&h)) continue;
+                //Résultats sous la plage double ramenés à 2^-30 (même arrondi fp16, sans s'annuler)
+                p = powl((long double)hf_to_double(a[i]), n);
+                if(p != 0.0L && fabsl(p) < 0x1p-30L) p = p < 0.0L ? -0x1p-30L : 0x1p-30L;
+                expect = ref_round_half((double)p, (hf_rounding_mode)mode);
+                errors[mode] += got != expect;
+            }
+        }
+
+        //Exposant entier de hf_pow et version par lots (mode au plus proche pair)
+        hf_set_rounding_mode(HF_ROUND_NEAREST_EVEN);
+        hf_pow_n(a, hfn, out, 65536);
+        for(i = 0; i < 65536; i++) {
+            uint16_t ref = hf_pow(a[i], hfn);
+            half_float h = decompose_half(ref), p = decompose_half(hf_powi(a[i], n));
+
+            errors[5] += (is_nan(&h) || is_nan(&p)) ? is_nan(&h) != is_nan(&p) : ref != hf_powi(a[i], n);
+            errors[6] += out[i] != ref;
+        }
+
+        int_results[row][0] = (float)n;
+        for(i = 0; i < 7; i++) int_results[row][i + 1] = (float)errors[i];
+    }
+
+    //Exposants demi-entiers (une racine large) et quelconques (chemin ln/exp)
+    for(row = 0; row < 6; row++) {
+        uint16_t hfy = float_to_half(half_powers[row]);
+        long double y = (long double)hf_to_double(hfy);
+        unsigned long errors[2] = {0, 0};
+
+        hf_pow_n(a, hfy, out, 65536);
+        for(i = 0; i < 65536; i++) {
+            uint16_t got = hf_pow(a[i], hfy);
+            half_float h = decompose_half(a[i]);
+
+            if(row < 5 && !is_nan(&h) && !is_infinity(&h) && !is_zero(&h) && !h.sign) {
+                errors[0] += got != ref_round_half((double)powl((long double)hf_to_double(a[i]), y), HF_ROUND_NEAREST_EVEN);
+            }
+            errors[1] += out[i] != got;
+        }
+
+        half_results[row][0] = half_powers[row];
+        half_results[row][1] = (float)errors[0];
+        half_results[row][2] = (float)errors[1];
+    }
+
+    hf_set_rounding_mode(saved_mode);
+
+    print_formatted_table("### HF_POWI (ecarts avec powl arrondi, par mode) / HF_POW / HF_POW_N", int_headers, 8, int_results, 11);
+    print_formatted_table("### HF_POW exposants demi-entiers (ecarts avec powl) / HF_POW_N", half_headers, 3, half_results, 6);
+    printf("\n");
+}
+
+/**
+ * @brief Fonction de débogage pour tester les formats bfloat16 et FP8
+ *
+ * Compare dans les cinq modes d'arrondi chaque conversion (exhaustive depuis
+ * fp16 et bf16, sur un échantillon depuis float) et chaque opération (paires
+ * FP8 exhaustives, échantillon bf16, triplets aléatoires pour la FMA) à une
+ * référence exacte arrondie par dichotomie, résultat et indicateurs compris,
+ * vérifie les élargissements exacts, l'égalité des versions par lots avec les
+ * boucles scalaires et quelques cas particuliers (NaN, infinis, dépassement
+ * E4M3 vers NaN).
+ */
+void debug_fmt(void) {
+    static const int conv_src[16] = {HF_FORMAT_FP16, HF_FORMAT_FP16, HF_FORMAT_FP16, HF_FORMAT_BF16, HF_FORMAT_BF16, HF_FORMAT_BF16, -1, -1, -1,
+                                     HF_FORMAT_E4M3, HF_FORMAT_E4M3, HF_FORMAT_E4M3, HF_FORMAT_E5M2, HF_FORMAT_E5M2, HF_FORMAT_E5M2, HF_FORMAT_BF16};
+    static const int conv_dst[16] = {HF_FORMAT_BF16, HF_FORMAT_E4M3, HF_FORMAT_E5M2, HF_FORMAT_FP16, HF_FORMAT_E4M3, HF_FORMAT_E5M2,
+                                     HF_FORMAT_BF16, HF_FORMAT_E4M3, HF_FORMAT_E5M2, HF_FORMAT_FP16, HF_FORMAT_BF16, -1, HF_FORMAT_FP16, HF_FORMAT_BF16, -1, -1};
+    static const hf_format arith_fmt[3] = {HF_FORMAT_BF16, HF_FORMAT_E4M3, HF_FORMAT_E5M2};
+    static uint32_t in[65536], out[65536], opa[200000], opb[200000], opc[200000];
+    const char *conv_headers[] = {"Conv", "even", "away", "zero", "+inf", "-inf", "Lots"};
+    const char *widen_headers[] = {"Conv", "Ecarts", "Lots"};
+    const char *arith_headers[] = {"Format", "add", "sub", "mul", "div", "sqrt", "fma"};
+    const char *case_headers[] = {"Cas", "Attendu", "Obtenu", "Ind. att.", "Ind. obt.", "Ecart"};
+    float conv_results[9][8], widen_results[7][8], arith_results[3][8], case_results[14][8];
+    hf_rounding_mode saved_mode = hf_get_rounding_mode();
+    unsigned int seed = 0x2468ACEU, i;
+    int conv, mode, row, op;
+
+    for(conv = 0; conv < 16; conv++) {
+        hf_format dst_fmt = (hf_format)(conv_dst[conv] < 0 ? 0 : conv_dst[conv]);
+        uint32_t src_sign = conv_src[conv] < 0 ? 0x80000000U : HF_FMT_MASK_SIGN((hf_format)conv_src[conv]);
+        uint32_t dst_sign = conv_dst[conv] < 0 ? 0x80000000U : HF_FMT_MASK_SIGN(dst_fmt);
+        unsigned long errors[6] = {0, 0, 0, 0, 0, 0};
+
+        //Entrées: tous les motifs 16 bits ou FP8, floats de toutes plages (mantisses tronquées pour les égalités)
+        for(i = 0; i < 65536; i++) {
+            if(conv_src[conv] >= 0) in[i] = conv_src[conv] == HF_FORMAT_E4M3 || conv_src[conv] == HF_FORMAT_E5M2 ? i & 0xFFU : i;
+            else {
+                seed = seed * 1103515245U + 12345U;
+                in[i] = seed ^ (seed << 16);
+                if(i & 1U) in[i] = (in[i] & 0x807FFFFFU) | ((97U + (seed >> 8) % 48U) << 23);
+                if((i & 3U) == 3U) in[i] &= ~0x7FFFU;
+            }
+        }
+
+        for(mode = 0; mode < 5; mode++) {
+            unsigned int batch_flags;
+
+            hf_set_rounding_mode((hf_rounding_mode)mode);
+            for(i = 0; i < 65536; i++) {
+                uint32_t got, expect = 0;
+                unsigned int flags, expect_flags = 0;
+                int cls = ref_fmt_class(in[i], conv_src[conv]), ok;
+
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                got = fmt_test_convert(conv, in[i]);
+                flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+
+                if(cls >= 2 || (cls == 1 && conv_dst[conv] == HF_FORMAT_E4M3)) {
+                    //NaN (silencieux, même signe), invalide pour un NaN signalant (sauf vers float) ou un infini vers E4M3
+                    expect_flags = (cls == 1 || (cls == 3 && conv_dst[conv] >= 0)) ? HF_FE_INVALID : 0;
+                    ok = ref_fmt_class(got, conv_dst[conv]) == 2 && ((got & dst_sign) != 0) == ((in[i] & src_sign) != 0);
+                } else if(cls == 1) {
+                    ok = got == ((in[i] & src_sign) ? dst_sign : 0) + (conv_dst[conv] < 0 ? 0x7F800000U : HF_FMT_INFINITY(dst_fmt));
+                } else if(conv_dst[conv] < 0) {
+                    ok = ref_fmt_class(got, -1) == 0 && ref_fmt_value(got, -1) == ref_fmt_value(in[i], conv_src[conv]) &&
+                         ((got & dst_sign) != 0) == ((in[i] & src_sign) != 0);
+                } else {
+                    double v = ref_fmt_value(in[i], conv_src[conv]);
+
+                    expect = ref_round_fmt(v, dst_fmt, (hf_rounding_mode)mode) | ((in[i] & src_sign) ? dst_sign : 0);
+                    expect_flags = ref_fmt_flags(v, expect, dst_fmt);
+                    ok = got == expect;
+                }
+                errors[mode] += !ok || flags != expect_flags;
+            }
+
+            //Version par lots: mêmes motifs et mêmes indicateurs que la boucle scalaire
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            fmt_test_convert_n(conv, in, out, 65536);
+            batch_flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            hf_feclearexcept(HF_FE_ALL_EXCEPT);
+            for(i = 0; i < 65536; i++) errors[5] += out[i] != fmt_test_convert(conv, in[i]);
+            errors[5] += batch_flags != hf_fetestexcept(HF_FE_ALL_EXCEPT);
+        }
+
+        if(conv < 9) {
+            conv_results[conv][0] = (float)conv;
+            for(i = 0; i < 6; i++) conv_results[conv][i + 1] = (float)errors[i];
+        } else {
+            widen_results[conv - 9][0] = (float)(conv - 9);
+            widen_results[conv - 9][1] = (float)(errors[0] + errors[1] + errors[2] + errors[3] + errors[4]);
+            widen_results[conv - 9][2] = (float)errors[5];
+        }
+    }
+
+    //Arithmétique: opérandes finis (les cas particuliers sont vérifiés plus bas)
+    for(row = 0; row < 3; row++) {
+        hf_format fmt = arith_fmt[row];
+        uint32_t sign_mask = HF_FMT_MASK_SIGN(fmt);
+        int narrow = fmt != HF_FORMAT_BF16;
+
+        //bf16: exposants voisins pour une moitié des paires et des triplets (annulations, arrondis fins)
+        for(i = 0; i < 200000; i++) {
+            int e;
+
+            seed = seed * 1103515245U + 12345U;
+            opa[i] = narrow ? (seed >> 16) & 0xFFU : seed >> 16;
+            seed = seed * 1103515245U + 12345U;
+            opb[i] = narrow ? (seed >> 16) & 0xFFU : seed >> 16;
+            if(!narrow && (seed & 0x100U)) {
+                e = (int)((opa[i] >> 7) & 0xFFU) + (int)((seed >> 9) % 21U) - 10;
+                e = e < 0 ? 0 : e > 254 ? 254 : e;
+                opb[i] = (opb[i] & 0x807FU) | ((uint32_t)e << 7);
+            }
+            seed = seed * 1103515245U + 12345U;
+            opc[i] = narrow ? (seed >> 16) & 0xFFU : seed >> 16;
+            if(!narrow && (seed & 0x100U)) {
+                e = (int)((opa[i] >> 7) & 0xFFU) + (int)((opb[i] >> 7) & 0xFFU) - 127 + (int)((seed >> 9) % 21U) - 10;
+                e = e < 0 ? 0 : e > 254 ? 254 : e;
+                opc[i] = (opc[i] & 0x807FU) | ((uint32_t)e << 7);
+            }
+        }
+
+        arith_results[row][0] = (float)row;
+        for(op = 0; op < 6; op++) {
+            //FP8: paires et racines exhaustives, bf16: échantillon et racines exhaustives
+            unsigned int n = op == 4 ? (narrow ? 256U : 65536U) : (narrow && op < 4) ? 65536U : 200000U;
+            unsigned long errors = 0;
+
+            for(mode = 0; mode < 5; mode++) {
+                hf_set_rounding_mode((hf_rounding_mode)mode);
+                for(i = 0; i < n; i++) {
+                    uint32_t x = op == 4 ? i : (narrow && op < 4) ? i >> 8 : opa[i];
+                    uint32_t y = (narrow && op < 4) ? i & 0xFFU : opb[i], z = opc[i], got, expect;
+                    uint32_t sx = x & sign_mask, sy = (op == 1 ? y ^ sign_mask : y) & sign_mask;
+                    unsigned int flags;
+                    double v;
+
+                    if(op == 5) {sx ^= y & sign_mask; sy = z & sign_mask;}
+                    if(ref_fmt_class(x, fmt) || (op != 4 && ref_fmt_class(y, fmt)) || (op == 5 && ref_fmt_class(z, fmt))) continue;
+                    if((op == 3 && ref_fmt_value(y, fmt) == 0.0) || (op == 4 && ref_fmt_value(x, fmt) < 0.0)) continue;
+
+                    hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                    got = fmt_test_arith(fmt, op, x, y, z);
+                    flags = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+
+                    //Zéro exact: signe IEEE (somme de signes opposés: -0 seulement vers -inf)
+                    v = ref_fmt_exact(op, ref_fmt_value(x, fmt), ref_fmt_value(y, fmt), ref_fmt_value(z, fmt));
+                    expect = ref_round_fmt(v, fmt, (hf_rounding_mode)mode);
+                    if(v == 0.0) {
+                        if(op == 2 || op == 3) expect |= (x ^ y) & sign_mask;
+                        else if(op == 4) expect |= sx;
+                        else if((sx && sy) || (sx != sy && mode == HF_ROUND_TOWARD_NEG_INF)) expect |= sign_mask;
+                    }
+                    errors += got != expect || flags != ref_fmt_flags(v, expect, fmt);
+                }
+            }
+            arith_results[row][op + 1] = (float)errors;
+        }
+    }
+
+    //Cas particuliers au plus proche pair (NaN comparé par classe)
+    hf_set_rounding_mode(HF_ROUND_NEAREST_EVEN);
+    for(row = 0; row < 14; row++) {
+        uint32_t expect, got;
+        unsigned int expect_flags;
+        int fmt;
+
+        hf_feclearexcept(HF_FE_ALL_EXCEPT);
+        switch(row) {
+            case 0:  fmt = HF_FORMAT_BF16; expect = BF16_NAN;              expect_flags = HF_FE_INVALID;                 got = bf16_add(BF16_INFINITY_POS, BF16_INFINITY_NEG); break;
+            case 1:  fmt = HF_FORMAT_BF16; expect = BF16_NAN;              expect_flags = HF_FE_INVALID;                 got = bf16_mul(0, BF16_INFINITY_POS); break;
+            case 2:  fmt = HF_FORMAT_BF16; expect = BF16_INFINITY_NEG;     expect_flags = HF_FE_DIVBYZERO;               got = bf16_div(0xBF80U, 0); break;
+            case 3:  fmt = HF_FORMAT_BF16; expect = BF16_NAN;              expect_flags = HF_FE_INVALID;                 got = bf16_sqrt(0xBF80U); break;
+            case 4:  fmt = HF_FORMAT_BF16; expect = BF16_NAN;              expect_flags = HF_FE_INVALID;                 got = bf16_add(0x7F81U, BF16_ONE_POS); break;
+            case 5:  fmt = HF_FORMAT_BF16; expect = BF16_NAN;              expect_flags = HF_FE_INVALID;                 got = bf16_fma(BF16_INFINITY_POS, 0, BF16_ONE_POS); break;
+            case 6:  fmt = HF_FORMAT_E5M2; expect = FP8_E5M2_INFINITY_POS; expect_flags = 0;                             got = fp8_e5m2_add(FP8_E5M2_INFINITY_POS, FP8_E5M2_ONE_POS); break;
+            case 7:  fmt = HF_FORMAT_E5M2; expect = FP8_E5M2_NAN;          expect_flags = HF_FE_INVALID;                 got = fp8_e5m2_div(0, 0); break;
+            case 8:  fmt = HF_FORMAT_E5M2; expect = FP8_E5M2_INFINITY_POS; expect_flags = HF_FE_OVERFLOW | HF_FE_INEXACT; got = fp8_e5m2_mul(0x7BU, 0x40U); break;
+            case 9:  fmt = HF_FORMAT_E4M3; expect = FP8_E4M3_NAN;          expect_flags = HF_FE_OVERFLOW | HF_FE_INEXACT; got = fp8_e4m3_mul(FP8_E4M3_MAX, 0x40U); break;
+            case 10: fmt = HF_FORMAT_E4M3; expect = FP8_E4M3_NAN;          expect_flags = HF_FE_DIVBYZERO;               got = fp8_e4m3_div(FP8_E4M3_ONE_POS, 0); break;
+            case 11: fmt = HF_FORMAT_E4M3; expect = FP8_E4M3_NAN;          expect_flags = 0;                             got = fp8_e4m3_add(FP8_E4M3_NAN, FP8_E4M3_ONE_POS); break;
+            case 12: fmt = HF_FORMAT_E4M3; expect = FP8_E4M3_MAX;          expect_flags = 0;                             got = fp8_e4m3_from_half(0x5F00U); break;
+            default: fmt = HF_FORMAT_E4M3; expect = FP8_E4M3_NAN;          expect_flags = HF_FE_OVERFLOW | HF_FE_INEXACT; got = fp8_e4m3_from_half(0x5F80U); break;
+        }
+        case_results[row][0] = (float)row;
+        case_results[row][1] = (float)expect;
+        case_results[row][2] = (float)got;
+        case_results[row][3] = (float)expect_flags;
+        case_results[row][4] = (float)hf_fetestexcept(HF_FE_ALL_EXCEPT);
+        case_results[row][5] = (float)((ref_fmt_class(expect, fmt) == 2 ? ref_fmt_class(got, fmt) != 2 : got != expect) ||
+                                       expect_flags != hf_fetestexcept(HF_FE_ALL_EXCEPT));
+    }
+
+    hf_set_rounding_mode(saved_mode);
+
+    print_formatted_table("### FORMATS COURTS conversions fp16/bf16/float -> bf16/e4m3/e5m2 (ecarts valeur ou indicateurs, par mode)", conv_headers, 7, conv_results, 9);
+    print_formatted_table("### FORMATS COURTS elargissements exacts e4m3/e5m2/bf16 -> fp16/bf16/float", widen_headers, 3, widen_results, 7);
+    print_formatted_table("### FORMATS COURTS arithmetique bf16/e4m3/e5m2 (ecarts avec la reference exacte, 5 modes)", arith_headers, 7, arith_results, 3);
+    print_formatted_table("### FORMATS COURTS cas particuliers", case_headers, 6, case_results, 14);
+    printf("\n");
+}
+
+/**
+ * @brief Compare les moteurs des fonctions transcendantes (tables et polynômes)
+ *
+ * Premier tableau: erreur maximale des noyaux Q15 (quart d'onde du sinus,
+ * atan sur [0, 1], e^r sur [0, ln(2)), ln(1 + f) sur [0, 1)) sur toutes leurs
+ * entrées, en LSB Q15 par rapport à libm; le polynôme doit rester <= 0.51.
+ * Second tableau: erreur maximale en ULP des fonctions publiques sur les
+ * 65536 motifs avec chaque moteur (résultats finis de référence finie) et
+ * nombre d'entrées dont la classe (NaN, infini, fini) diffère entre les deux
+ * moteurs, qui doit valoir 0. Le polynôme ne doit dépasser la table nulle part.
+ */
+void debug_engine(void) {
+    static const hf_unary_fn fns[6] = {hf_sin, hf_cos, hf_atan, hf_exp, hf_ln, hf_tanh};
+    static double (*const refs[6])(double) = {sin, cos, atan, exp, log, tanh};
+    const char *core_headers[] = {"Noyau", "Entrees", "Tables (LSB)", "Polynome (LSB)"};
+    const char *fn_headers[] = {"Fonction", "Tables (ulp)", "Polynome (ulp)", "Classes differentes"};
+    float core_results[4][8], fn_results[6][8];
+    hf_engine saved_engine = hf_engine_selected();
+    int row, engine;
+    uint32_t i;
+
+    for(row = 0; row < 4; row++) {
+        uint32_t count = row == 0 ? 16384U : row == 1 ? 32769U : row == 2 ? (uint32_t)LNI_2 : 32768U;
+
+        core_results[row][0] = (float)row;
+        core_results[row][1] = (float)count;
+        for(engine = HF_ENGINE_TABLE; engine <= HF_ENGINE_POLY; engine++) {
+            double max_err = 0.0;
+
+            hf_engine_select((hf_engine)engine);
+            for(i = 0; i < count; i++) {
+                double ref, err;
+                int32_t value;
+                half_float e;
+
+                if(row == 0) {
+                    ref = sin((M_PI / 2) * i / 16384.0);
+                    value = sin_quarter_q15(i);
+                } else if(row == 1) {
+                    ref = atan(i / 32768.0);
+                    value = atan_unit_q15((int32_t)i);
+                } else if(row == 2) {
+                    ref = exp(i / 32768.0);
+                    exp_fixed((int32_t)i, &e);
+                    value = e.mant;
+                } else {
+                    ref = log1p(i / 32768.0);
+                    value = ln_mant_q15(i);
+                }
+                err = fabs(value - ref * 32768.0);
+                if(err > max_err) max_err = err;
+            }
+            core_results[row][2 + engine] = (float)max_err;
+        }
+    }
+
+    for(row = 0; row < 6; row++) {
+        uint16_t results[2];
+        int classes = 0;
+
+        fn_results[row][0] = (float)row;
+        fn_results[row][1] = 0.0f;
+        fn_results[row][2] = 0.0f;
+        for(i = 0; i < 65536U; i++) {
+            for(engine = HF_ENGINE_TABLE; engine <= HF_ENGINE_POLY; engine++) {
+                double ref, got, ulp;
+                int exponent;
+
+                hf_engine_select((hf_engine)engine);
+                results[engine] = fns[row]((uint16_t)i);
+                ref = refs[row]((double)half_to_float((uint16_t)i));
+                got = (double)half_to_float(results[engine]);
+                if(isfinite(ref) && fabs(ref) <= 65504.0 && isfinite(got)) {
+                    frexp(ref, &exponent);
+                    ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+                    if(fabs(got - ref) / ulp > fn_results[row][1 + engine]) fn_results[row][1 + engine] = (float)(fabs(got - ref) / ulp);
+                }
+            }
+            classes += (results[0] & HF_INFINITY_POS) == HF_INFINITY_POS && (results[0] & HF_MASK_MANT) != 0
+                    ? !((results[1] & HF_INFINITY_POS) == HF_INFINITY_POS && (results[1] & HF_MASK_MANT) != 0)
+                    : ((results[0] & HF_INFINITY_POS) == HF_INFINITY_POS) != ((results[1] & HF_INFINITY_POS) == HF_INFINITY_POS);
+        }
+        fn_results[row][3] = (float)classes;
+    }
+
+    hf_engine_select(saved_engine);
+
+    print_formatted_table("### MOTEURS noyaux Q15 sin/atan/exp/ln (erreur max avec libm)", core_headers, 4, core_results, 4);
+    print_formatted_table("### MOTEURS hf_sin/cos/atan/exp/ln/tanh (erreur max, classes NaN/inf/fini differentes)", fn_headers, 4, fn_results, 6);
+    printf("\n");
+}
+
+/**
+ * @brief Teste les fonctions approchées rapides hf_fast_*
+ *
+ * Pour chaque fonction: erreur maximale en ULP par rapport à libm (résultats
+ * finis de référence finie), borne publiée dans hf_lib_fast.h, part des
+ * résultats identiques à la fonction IEEE et nombre d'entrées spéciales (NaN,
+ * infini ou zéro) dont le résultat diffère de la fonction IEEE, qui doit
+ * valoir 0 (sigmoïde: NaN silencieux pour NaN; tanh et sin rendent -0 pour
+ * -0, là où hf_tanh et hf_sin rendent +0; rsqrt doit de plus rendre l'infini
+ * du signe du zéro). hf_fast_div est testée sur les 65536
+ * numérateurs et 256 dénominateurs répartis sur tous les exposants.
+ */
+void debug_fast(void) {
+    static const hf_unary_fn fast_fns[7] = {hf_fast_exp, hf_fast_ln, hf_fast_rsqrt, hf_fast_tanh,
+                                            hf_fast_sigmoid, hf_fast_sin, hf_fast_cos};
+    static const hf_unary_fn ieee_fns[7] = {hf_exp, hf_ln, hf_rsqrt, hf_tanh, NULL, hf_sin, hf_cos};
+    static const float bounds[8] = {1.0f, 1.0f, 2.0f, 1.0f, 1.0f, 0.5f, 1.0f, 1.0f};
+    const char *headers[] = {"Fonction", "Erreur max (ulp)", "Borne (ulp)", "Identiques IEEE (%)", "Speciaux differents"};
+    float results[8][8];
+    uint32_t i, j;
+    int row;
+
+    for(row = 0; row < 8; row++) {
+        double max_ulp = 0.0;
+        uint32_t same = 0, total = 0, specials = 0;
+        uint32_t count_j = row == 7 ? 256U : 1U;
+
+        for(i = 0; i < 65536U; i++) {
+            for(j = 0; j < count_j; j++) {
+                uint16_t x = (uint16_t)i, y = (uint16_t)((j << 8) | (j * 37U & 0xFFU)), fast, ieee;
+                double xd = (double)half_to_float(x), ref, got, ulp;
+                int exponent, special;
+
+                if(row == 7) {
+                    fast = hf_fast_div(x, y);
+                    ieee = hf_div(x, y);
+                    ref = xd / (double)half_to_float(y);
+                } else {
+                    fast = fast_fns[row](x);
+                    ieee = row == 4 ? hf_div(HF_ONE_POS, hf_add(HF_ONE_POS, hf_exp(hf_neg(x)))) : ieee_fns[row](x);
+                    ref = row == 0 ? exp(xd) : row == 1 ? log(xd) : row == 2 ? 1.0 / sqrt(xd) : row == 3 ? tanh(xd)
+                        : row == 4 ? 1.0 / (1.0 + exp(-xd)) : row == 5 ? sin(xd) : cos(xd);
+                }
+                special = !isfinite(xd) || xd == 0.0
+                       || (row == 7 && ((y & HF_INFINITY_POS) == HF_INFINITY_POS || (y & ~HF_MASK_SIGN) == 0));
+                if(special && row != 4) specials += fast != ieee && !(xd == 0.0 && (row == 3 || row == 5) && fast == x);
+                if(special && row == 4 && isnan(xd)) specials += (fast & HF_INFINITY_POS) != HF_INFINITY_POS || (fast & HF_MASK_MANT) == 0;
+                if(row == 2 && (x & ~HF_MASK_SIGN) == 0) specials += fast != (x | HF_INFINITY_POS);
+                got = (double)half_to_float(fast);
+                if(isfinite(ref) && fabs(ref) <= 65504.0 && isfinite(got)) {
+                    frexp(ref, &exponent);
+                    ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+                    if(fabs(got - ref) / ulp > max_ulp) max_ulp = fabs(got - ref) / ulp;
+                }
+                same += fast == ieee;
+                total++;
+            }
+        }
+        results[row][0] = (float)row;
+        results[row][1] = (float)max_ulp;
+        results[row][2] = bounds[row];
+        results[row][3] = 100.0f * (float)same / (float)total;
+        results[row][4] = (float)specials;
+    }
+
+    print_formatted_table("### HF_FAST exp/ln/rsqrt/tanh/sigmoid/sin/cos/div (erreur max, speciaux differents de l'IEEE)", headers, 5, results, 8);
+    printf("\n");
+}
+
+/**
+ * @brief Teste les fonctions d'activation fusionnées (hf_sigmoid, hf_silu, hf_gelu, hf_softmax_n)
+ *
+ * Premier tableau: erreur maximale en ULP sur les 65536 motifs avec chaque
+ * moteur (résultats finis de référence finie, GELU sous sa forme tanh),
+ * nombre de motifs au-delà de la borne (deux moteurs réunis) et de cas
+ * spéciaux erronés (NaN, +/-inf, +/-0). La borne de 1 ULP laisse une demi-ULP
+ * à l'arrondi au plus proche et une demi-ULP aux erreurs internes: mantisse
+ * Q15 du polynôme de e^-|t| (utilisé avec les deux moteurs), argument t
+ * arrondi en Q15 et coefficients de GELU en Q30; la série utilisée pour
+ * |t| < 2^-6 a une erreur sous 2^-38. Second tableau:
+ * softmax de vecteurs de tailles et plages variées (jusqu'à 65504, où e^x
+ * déborde sans la soustraction du maximum), calculé en place: erreur maximale
+ * en ULP par rapport au softmax double, écart de la somme des sorties à 1,
+ * et sorties invalides (NaN pour une entrée finie, ou différente de 1 pour
+ * n = 1). Les vecteurs avec NaN, +inf ou uniquement des -inf doivent donner
+ * NaN partout.
+ */
+void debug_act(void) {
+    static const hf_unary_fn fns[3] = {hf_sigmoid, hf_silu, hf_gelu};
+    static const size_t sizes[6] = {1, 2, 7, 64, 1000, 4096};
+    static const float scales[6] = {1.0f, 4.0f, 0.01f, 16.0f, 2.0f, 65504.0f};
+    static uint16_t vec[4096], in[4096];
+    const char *fn_headers[] = {"Fonction", "Tables (ulp)", "Polynome (ulp)", "Borne (ulp)", "Hors borne", "Speciaux errones"};
+    const char *sm_headers[] = {"n", "Echelle", "Erreur max (ulp)", "|somme - 1|", "Sorties invalides"};
+    float fn_results[3][8], sm_results[7][8];
+    hf_engine saved_engine = hf_engine_selected();
+    int row, engine;
+    uint32_t i;
+
+    for(row = 0; row < 3; row++) {
+        static const uint16_t special_in[6] = {HF_NAN, HF_NAN | HF_MASK_SIGN, HF_INFINITY_POS, HF_INFINITY_NEG, HF_ZERO_POS, HF_ZERO_NEG};
+        uint16_t special_out[3][6] = {
+            {HF_NAN, HF_NAN | HF_MASK_SIGN, HF_ONE_POS, HF_ZERO_POS, 0x3800U, 0x3800U},
+            {HF_NAN, HF_NAN | HF_MASK_SIGN, HF_INFINITY_POS, HF_ZERO_NEG, HF_ZERO_POS, HF_ZERO_NEG},
+            {HF_NAN, HF_NAN | HF_MASK_SIGN, HF_INFINITY_POS, HF_ZERO_NEG, HF_ZERO_POS, HF_ZERO_NEG}};
+        int errors = 0, over = 0;
+
+        fn_results[row][0] = (float)row;
+        for(engine = HF_ENGINE_TABLE; engine <= HF_ENGINE_POLY; engine++) {
+            double max_ulp = 0.0;
+
+            hf_engine_select((hf_engine)engine);
+            for(i = 0; i < 65536U; i++) {
+                double x = (double)half_to_float((uint16_t)i), ref, got, ulp;
+                int exponent;
+
+                ref = row == 0 ? 1.0 / (1.0 + exp(-x)) : row == 1 ? x / (1.0 + exp(-x))
+                    : x / (1.0 + exp(-1.5957691216057308 * (x + 0.044715 * x * x * x)));
+                got = (double)half_to_float(fns[row]((uint16_t)i));
+                if(isfinite(ref) && fabs(ref) <= 65504.0 && isfinite(got)) {
+                    frexp(ref, &exponent);
+                    ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+                    if(fabs(got - ref) / ulp > max_ulp) max_ulp = fabs(got - ref) / ulp;
+                    over += fabs(got - ref) / ulp > 1.0;
+                }
+            }
+            for(i = 0; i < 6; i++) errors += fns[row](special_in[i]) != special_out[row][i];
+            fn_results[row][1 + engine] = (float)max_ulp;
+        }
+        fn_results[row][3] = 1.0f;
+        fn_results[row][4] = (float)over;
+        fn_results[row][5] = (float)errors;
+    }
+
+    for(row = 0; row < 7; row++) {
+        size_t n = row < 6 ? sizes[row] : 8, k;
+        double max_ulp = 0.0, max_value = -INFINITY, sum = 0.0, out_sum = 0.0;
+        int invalid = 0;
+
+        for(k = 0; k < n; k++) {
+            float value = row < 6 ? scales[row] * (float)((int)((k * 37U + 11U) % 201U) - 100) / 100.0f : (float)k;
+            in[k] = float_to_half(value);
+            vec[k] = in[k];
+            if((double)half_to_float(in[k]) > max_value) max_value = (double)half_to_float(in[k]);
+        }
+        for(k = 0; k < n; k++) sum += exp((double)half_to_float(in[k]) - max_value);
+
+        if(row < 6) {
+            hf_softmax_n(vec, vec, n);
+            for(k = 0; k < n; k++) {
+                double ref = exp((double)half_to_float(in[k]) - max_value) / sum, got = (double)half_to_float(vec[k]), ulp;
+                int exponent;
+
+                invalid += !isfinite(got) || (n == 1 && vec[k] != HF_ONE_POS);
+                out_sum += got;
+                frexp(ref, &exponent);
+                ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+                if(fabs(got - ref) / ulp > max_ulp) max_ulp = fabs(got - ref) / ulp;
+            }
+            sm_results[row][1] = scales[row];
+        } else {
+            //Vecteurs spéciaux: NaN, +inf, uniquement -inf
+            static const uint16_t specials[3] = {HF_NAN, HF_INFINITY_POS, HF_INFINITY_NEG};
+
+            for(i = 0; i < 3; i++) {
+                for(k = 0; k < n; k++) vec[k] = i == 2 ? HF_INFINITY_NEG : in[k];
+                vec[3] = specials[i];
+                hf_softmax_n(vec, vec, n);
+                for(k = 0; k < n; k++) invalid += (vec[k] & ~HF_MASK_SIGN) <= HF_INFINITY_POS;
+            }
+            out_sum = 1.0;
+            sm_results[row][1] = 0.0f;
+        }
+        sm_results[row][0] = (float)n;
+        sm_results[row][2] = (float)max_ulp;
+        sm_results[row][3] = (float)fabs(out_sum - 1.0);
+        sm_results[row][4] = (float)invalid;
+    }
+
+    hf_engine_select(saved_engine);
+
+    print_formatted_table("### ACTIVATIONS hf_sigmoid/silu/gelu (erreur max par moteur, motifs hors borne, speciaux errones)", fn_headers, 6, fn_results, 3);
+    print_formatted_table("### ACTIVATIONS hf_softmax_n en place (derniere ligne: vecteurs NaN/+inf/-inf)", sm_headers, 5, sm_results, 7);
+    printf("\n");
+}
+
 /**
  * @brief Fonction de débogage pour tester la fonction hf_exp avec divers cas de test
  * 
@@ -1072,7 +2737,7 @@ void debug_exp(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests étendus
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_exp)", "Result (std::exp)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1148,7 +2813,7 @@ void debug_ln(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests étendus
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (my_ln)", "Result (std::ln)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1201,7 +2866,7 @@ void debug_log2(void) {
     };
     int num_tests = sizeof(test_values) / sizeof(test_values[0]);
 
-    float results[200][8];
+    float results[sizeof(test_values) / sizeof(test_values[0])][8];
     const char *headers[] = {"Value", "Result (hf_log2)", "Result (log2f)", "Difference"};
     int i, row = 0;
 
@@ -1257,7 +2922,7 @@ void debug_log10(void) {
     };
     int num_tests = sizeof(test_values) / sizeof(test_values[0]);
 
-    float results[200][8];
+    float results[sizeof(test_values) / sizeof(test_values[0])][8];
     const char *headers[] = {"Value", "Result (hf_log10)", "Result (log10f)", "Difference"};
     int i, row = 0;
 
@@ -1396,7 +3061,7 @@ void debug_sin(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[25][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Angle (rad)", "Result (hf_sin)", "Result (sinf)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1444,7 +3109,7 @@ void debug_cos(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[25][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Angle (rad)", "Result (hf_cos)", "Result (cosf)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1496,7 +3161,7 @@ void debug_tan(void) {
     int i;
 
     //Préparer les données pour le tableau formaté
-    float results[70][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Angle (rad)", "Result (hf_tan)", "Result (tanf)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1565,7 +3230,7 @@ void debug_asin(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_asin)", "Result (asinf)", "Difference"};
     
     for(i = 0; i < num_tests; i++) {
@@ -1633,7 +3298,7 @@ void debug_acos(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
     //Préparer les données pour le tableau formaté
-    float results[50][8]; //Tableau statique suffisant pour tous les tests
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_acos)", "Result (acosf)", "Difference"};
    
     for(i = 0; i < num_tests; i++) {
@@ -1685,7 +3350,7 @@ void debug_atan(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
 
-    float results[40][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_atan)", "Result (atanf)", "Diff (rad)", "Diff (deg)"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1763,7 +3428,7 @@ void debug_atan2(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
     
-    float results[30][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Y", "X", "Result (hf)", "Result (std)", "Diff (rad)", "Diff (deg)"};
     
     for(i = 0; i < num_tests; i++) {
@@ -1814,7 +3479,7 @@ void debug_sinh(void) {
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
-    float results[40][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_sinh)", "Result (sinhf)", "Diff", "RelErr"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1845,7 +3510,7 @@ void debug_cosh(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_cosh)", "Result (coshf)", "Difference"};
 
     int i; for(i = 0; i < num_tests; i++) {
@@ -1888,7 +3553,7 @@ void debug_tanh(void) {
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
     int i;
 
-    float results[30][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_tanh)", "Result (tanhf)", "Difference"};
 
     for(i = 0; i < num_tests; i++) {
@@ -1923,7 +3588,7 @@ void debug_asinh(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_asinh)", "Result (asinhf)", "Difference"};
     int i;
 
@@ -1957,7 +3622,7 @@ void debug_acosh(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_acosh)", "Result (acoshf)", "Difference"};
     int i;
     
@@ -1991,7 +3656,7 @@ void debug_atanh(void) {
         half_to_float(HF_INFINITY_POS), half_to_float(HF_INFINITY_NEG), half_to_float(HF_NAN)
     };
     int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-    float results[20][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {"Value", "Result (hf_atanh)", "Result (atanhf)", "Difference"};
     int i;
     
@@ -2616,7 +4281,7 @@ void debug_rsqrt_comparison(void) {
     uint16_t value_half, rsqrt_result, sqrt_result, one_half, div_result, inv_result;
     float rsqrt_float, div_float, inv_float;
     float err_rsqrt, err_div, err_inv;
-    float results[100][8];
+    float results[sizeof(test_cases) / sizeof(test_cases[0])][8];
     const char *headers[] = {
         "Value", 
         "hf_rsqrt", 
@@ -2660,7 +4325,7 @@ void debug_rsqrt_comparison(void) {
         } else if(isinf(value_converted)) {
             std_result = (value_converted > 0.0f) ? 0.0f : NAN;
         } else if(value_converted == 0.0f) {
-            std_result = INFINITY;
+            std_result = copysignf(INFINITY, value_converted);
         } else if(value_converted < 0.0f) {
             std_result = NAN;
         } else {
@@ -2862,3 +4527,779 @@ static void print_formatted_table(const char *title, const char **headers, int n
     }
 }
 
+/**
+ * @brief Référence d'arrondi d'un double fini en demi-flottant
+ *
+ * Recherche dichotomique du plus grand demi-flottant positif <= |d| (valeurs
+ * exactes de hf_to_double), puis choix entre ce voisin et le suivant selon le
+ * mode. Le suivant de 65504 est l'infini, compté comme 65536 pour les égalités.
+ *
+ * @param d Double fini à arrondir
+ * @param mode Mode d'arrondi
+ * @return Demi-flottant attendu
+ */
+static uint16_t ref_round_half(double d, hf_rounding_mode mode) {
+    double a = fabs(d), lo_v, hi_v;
+    uint16_t sign = d < 0 ? HF_MASK_SIGN : 0, lo = 0, top = HF_INFINITY_POS - 1, hi, result;
+
+    while(lo < top) {
+        uint16_t mid = (uint16_t)((lo + top + 1) / 2);
+        if(hf_to_double(mid) <= a) lo = mid;
+        else top = (uint16_t)(mid - 1);
+    }
+    hi = (uint16_t)(lo + 1);
+    lo_v = hf_to_double(lo);
+    hi_v = hi == HF_INFINITY_POS ? 65536.0 : hf_to_double(hi);
+
+    if(a == lo_v || mode == HF_ROUND_TOWARD_ZERO) result = lo;
+    else if(mode == HF_ROUND_TOWARD_POS_INF) result = sign ? lo : hi;
+    else if(mode == HF_ROUND_TOWARD_NEG_INF) result = sign ? hi : lo;
+    else if(a - lo_v != hi_v - a) result = (a - lo_v < hi_v - a) ? lo : hi;
+    else result = (mode == HF_ROUND_NEAREST_UP || (lo & 1U)) ? hi : lo;
+
+    return (uint16_t)(sign | result);
+}
+
+/**
+ * @brief Classe d'un motif d'un format court, fp16 ou binary32
+ *
+ * @param bits Motif (bit de signe compris)
+ * @param fmt Format HF_FORMAT_*, ou -1 pour binary32
+ * @return 0 fini, 1 infini, 2 NaN silencieux, 3 NaN signalant
+ */
+static int ref_fmt_class(uint32_t bits, int fmt) {
+    int mant_bits = fmt < 0 ? 23 : HF_FMT_MANT_BITS((hf_format)fmt), exp_bits = fmt < 0 ? 8 : HF_FMT_EXP_BITS((hf_format)fmt);
+    uint32_t exp = (bits >> mant_bits) & ((1U << exp_bits) - 1U), mant = bits & ((1U << mant_bits) - 1U);
+    int result = 0;
+
+    if(exp == (1U << exp_bits) - 1U) {
+        if(fmt == HF_FORMAT_E4M3) result = mant == (1U << mant_bits) - 1U ? 2 : 0;
+        else if(mant == 0) result = 1;
+        else result = (mant >> (mant_bits - 1)) ? 2 : 3;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Valeur exacte d'un motif fini, décodée champ par champ
+ *
+ * Le motif qui suit le plus grand fini (infini, ou NaN de E4M3) est décodé
+ * par la même formule: 2^(emax+1), ou 480 pour E4M3.
+ *
+ * @param bits Motif (bit de signe compris)
+ * @param fmt Format HF_FORMAT_*, ou -1 pour binary32
+ * @return Valeur exacte en double
+ */
+static double ref_fmt_value(uint32_t bits, int fmt) {
+    int mant_bits = fmt < 0 ? 23 : HF_FMT_MANT_BITS((hf_format)fmt), exp_bits = fmt < 0 ? 8 : HF_FMT_EXP_BITS((hf_format)fmt);
+    int bias = (1 << (exp_bits - 1)) - 1;
+    uint32_t exp = (bits >> mant_bits) & ((1U << exp_bits) - 1U), mant = bits & ((1U << mant_bits) - 1U);
+    double result = exp ? ldexp((double)(mant | (1U << mant_bits)), (int)exp - bias - mant_bits) : ldexp((double)mant, 1 - bias - mant_bits);
+
+    return ((bits >> (exp_bits + mant_bits)) & 1U) ? -result : result;
+}
+
+/**
+ * @brief Référence d'arrondi d'un double fini dans un format court ou fp16
+ *
+ * Même dichotomie que ref_round_half sur les valeurs exactes de
+ * ref_fmt_value; le suivant du plus grand fini code l'infini (NaN pour E4M3).
+ * Un zéro est rendu positif.
+ *
+ * @param d Double fini à arrondir
+ * @param fmt Format cible
+ * @param mode Mode d'arrondi
+ * @return Motif attendu
+ */
+static uint32_t ref_round_fmt(double d, hf_format fmt, hf_rounding_mode mode) {
+    double a = fabs(d), lo_v, hi_v;
+    uint32_t sign = d < 0 ? HF_FMT_MASK_SIGN(fmt) : 0, lo = 0, top = HF_FMT_INFINITY(fmt) - 1U, hi, result;
+
+    while(lo < top) {
+        uint32_t mid = (lo + top + 1U) / 2U;
+        if(ref_fmt_value(mid, fmt) <= a) lo = mid;
+        else top = mid - 1U;
+    }
+    hi = lo + 1U;
+    lo_v = ref_fmt_value(lo, fmt);
+    hi_v = ref_fmt_value(hi, fmt);
+
+    if(a == lo_v || mode == HF_ROUND_TOWARD_ZERO) result = lo;
+    else if(mode == HF_ROUND_TOWARD_POS_INF) result = sign ? lo : hi;
+    else if(mode == HF_ROUND_TOWARD_NEG_INF) result = sign ? hi : lo;
+    else if(a - lo_v != hi_v - a) result = (a - lo_v < hi_v - a) ? lo : hi;
+    else result = (mode == HF_ROUND_NEAREST_UP || (lo & 1U)) ? hi : lo;
+
+    return sign | result;
+}
+
+/**
+ * @brief Indicateurs attendus pour l'arrondi d'une valeur exacte
+ *
+ * Dépassement si l'arrondi sans borne d'exposant dépasse le plus grand fini,
+ * inexact si le motif ne vaut pas d exactement, soupassement si de plus
+ * |d| < 2^emin.
+ *
+ * @param d Valeur exacte (finie)
+ * @param code Motif arrondi
+ * @param fmt Format cible
+ * @return Indicateurs HF_FE_*
+ */
+static unsigned int ref_fmt_flags(double d, uint32_t code, hf_format fmt) {
+    double a = fabs(d);
+    uint32_t top = HF_FMT_INFINITY(fmt) - 1U, mag = code & ~HF_FMT_MASK_SIGN(fmt);
+    unsigned int result = 0;
+
+    if(mag > top || a >= ref_fmt_value(top + 1U, fmt)) result = HF_FE_OVERFLOW | HF_FE_INEXACT;
+    else if(ref_fmt_value(mag, fmt) != a) result = a < ldexp(1.0, HF_FMT_EXP_MIN(fmt)) ? HF_FE_INEXACT | HF_FE_UNDERFLOW : HF_FE_INEXACT;
+
+    return result;
+}
+
+/**
+ * @brief Résultat exact (ou équivalent pour l'arrondi) d'une opération
+ *
+ * Produit et sommes proches calculés exactement en double. Quand les
+ * exposants d'une somme diffèrent de plus de 30, le petit terme est remplacé
+ * par ±2^(e-50): même côté de chaque frontière d'arrondi, somme exacte.
+ * Quotient et racine par division et racine entières sur 30 bits, le reste
+ * non nul ajoutant un demi-pas (strictement entre deux frontières).
+ *
+ * @param op 0 add, 1 sub, 2 mul, 3 div, 4 sqrt, 5 fma (a*b+c)
+ * @param a Premier opérande
+ * @param b Deuxième opérande
+ * @param c Troisième opérande (fma)
+ * @return Valeur de même arrondi que le résultat exact
+ */
+static double ref_fmt_exact(int op, double a, double b, double c) {
+    double x = a, y = op == 1 ? -b : b, result;
+    int ex, ey;
+
+    if(op == 2) result = a * b;
+    else if(op == 3) {
+        uint64_t ma, mb, q;
+
+        ma = (uint64_t)ldexp(frexp(fabs(a), &ex), 24);
+        mb = (uint64_t)ldexp(frexp(fabs(b), &ey), 24);
+        q = (ma << 30) / mb;
+        result = ldexp((double)(2U * q + ((ma << 30) % mb != 0)), ex - ey - 31);
+        if((a < 0) != (b < 0)) result = -result;
+    } else if(op == 4) {
+        uint64_t m, s, r;
+
+        m = (uint64_t)ldexp(frexp(a, &ex), 24);
+        ex -= 24;
+        if(ex & 1) {m <<= 1; ex--;}
+        s = m << 36;
+        ex -= 36;
+        r = (uint64_t)sqrt((double)s);
+        while(r * r > s) r--;
+        while((r + 1U) * (r + 1U) <= s) r++;
+        result = ldexp((double)(2U * r + (r * r != s)), ex / 2 - 1);
+    } else {
+        if(op == 5) {x = a * b; y = c;}
+        if(x != 0.0 && y != 0.0) {
+            (void)frexp(x, &ex);
+            (void)frexp(y, &ey);
+            if(ex - ey > 30) y = y < 0.0 ? -ldexp(1.0, ex - 50) : ldexp(1.0, ex - 50);
+            else if(ey - ex > 30) x = x < 0.0 ? -ldexp(1.0, ey - 50) : ldexp(1.0, ey - 50);
+        }
+        result = x + y;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Appelle la conversion scalaire de rang conv de debug_fmt
+ *
+ * 0-2 fp16 -> bf16/e4m3/e5m2, 3-5 bf16 -> fp16/e4m3/e5m2, 6-8 float ->
+ * bf16/e4m3/e5m2, 9-11 e4m3 -> fp16/bf16/float, 12-14 e5m2 -> fp16/bf16/float,
+ * 15 bf16 -> float. Les floats passent par leur motif binary32.
+ *
+ * @param conv Rang de la conversion
+ * @param x Motif source
+ * @return Motif converti
+ */
+static uint32_t fmt_test_convert(int conv, uint32_t x) {
+    uint32_t result;
+    float f;
+
+    memcpy(&f, &x, sizeof(f));
+    switch(conv) {
+        case 0:  result = bf16_from_half((uint16_t)x); break;
+        case 1:  result = fp8_e4m3_from_half((uint16_t)x); break;
+        case 2:  result = fp8_e5m2_from_half((uint16_t)x); break;
+        case 3:  result = bf16_to_half((uint16_t)x); break;
+        case 4:  result = fp8_e4m3_from_bf16((uint16_t)x); break;
+        case 5:  result = fp8_e5m2_from_bf16((uint16_t)x); break;
+        case 6:  result = bf16_from_float(f); break;
+        case 7:  result = fp8_e4m3_from_float(f); break;
+        case 8:  result = fp8_e5m2_from_float(f); break;
+        case 9:  result = fp8_e4m3_to_half((uint8_t)x); break;
+        case 10: result = fp8_e4m3_to_bf16((uint8_t)x); break;
+        case 11: f = fp8_e4m3_to_float((uint8_t)x); memcpy(&result, &f, sizeof(f)); break;
+        case 12: result = fp8_e5m2_to_half((uint8_t)x); break;
+        case 13: result = fp8_e5m2_to_bf16((uint8_t)x); break;
+        case 14: f = fp8_e5m2_to_float((uint8_t)x); memcpy(&result, &f, sizeof(f)); break;
+        default: f = bf16_to_float((uint16_t)x); memcpy(&result, &f, sizeof(f)); break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Appelle la conversion par lots de rang conv (voir fmt_test_convert)
+ *
+ * @param conv Rang de la conversion
+ * @param in Motifs sources (au plus 65536)
+ * @param out Motifs convertis
+ * @param n Nombre d'éléments
+ */
+static void fmt_test_convert_n(int conv, const uint32_t *in, uint32_t *out, size_t n) {
+    static uint16_t in16[65536], out16[65536];
+    static uint8_t in8[65536], out8[65536];
+    static float inf32[65536], outf32[65536];
+    size_t i;
+
+    for(i = 0; i < n; i++) {
+        in16[i] = (uint16_t)in[i];
+        in8[i] = (uint8_t)in[i];
+        memcpy(&inf32[i], &in[i], sizeof(float));
+    }
+
+    switch(conv) {
+        case 0:  bf16_from_half_n(in16, out16, n); break;
+        case 1:  fp8_e4m3_from_half_n(in16, out8, n); break;
+        case 2:  fp8_e5m2_from_half_n(in16, out8, n); break;
+        case 3:  bf16_to_half_n(in16, out16, n); break;
+        case 4:  fp8_e4m3_from_bf16_n(in16, out8, n); break;
+        case 5:  fp8_e5m2_from_bf16_n(in16, out8, n); break;
+        case 6:  bf16_from_float_n(inf32, out16, n); break;
+        case 7:  fp8_e4m3_from_float_n(inf32, out8, n); break;
+        case 8:  fp8_e5m2_from_float_n(inf32, out8, n); break;
+        case 9:  fp8_e4m3_to_half_n(in8, out16, n); break;
+        case 10: fp8_e4m3_to_bf16_n(in8, out16, n); break;
+        case 11: fp8_e4m3_to_float_n(in8, outf32, n); break;
+        case 12: fp8_e5m2_to_half_n(in8, out16, n); break;
+        case 13: fp8_e5m2_to_bf16_n(in8, out16, n); break;
+        case 14: fp8_e5m2_to_float_n(in8, outf32, n); break;
+        default: bf16_to_float_n(in16, outf32, n); break;
+    }
+
+    for(i = 0; i < n; i++) {
+        if(conv == 1 || conv == 2 || conv == 4 || conv == 5 || conv == 7 || conv == 8) out[i] = out8[i];
+        else if(conv == 11 || conv == 14 || conv == 15) memcpy(&out[i], &outf32[i], sizeof(float));
+        else out[i] = out16[i];
+    }
+}
+
+/**
+ * @brief Appelle l'opération op du format fmt (voir ref_fmt_exact)
+ *
+ * @param fmt Format (bf16, E4M3 ou E5M2)
+ * @param op 0 add, 1 sub, 2 mul, 3 div, 4 sqrt, 5 fma
+ * @param a Premier opérande
+ * @param b Deuxième opérande
+ * @param c Troisième opérande (fma)
+ * @return Motif résultat
+ */
+static uint32_t fmt_test_arith(hf_format fmt, int op, uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t result;
+
+    if(fmt == HF_FORMAT_BF16) {
+        uint16_t x = (uint16_t)a, y = (uint16_t)b, z = (uint16_t)c;
+        switch(op) {
+            case 0:  result = bf16_add(x, y); break;
+            case 1:  result = bf16_sub(x, y); break;
+            case 2:  result = bf16_mul(x, y); break;
+            case 3:  result = bf16_div(x, y); break;
+            case 4:  result = bf16_sqrt(x); break;
+            default: result = bf16_fma(x, y, z); break;
+        }
+    } else if(fmt == HF_FORMAT_E4M3) {
+        uint8_t x = (uint8_t)a, y = (uint8_t)b, z = (uint8_t)c;
+        switch(op) {
+            case 0:  result = fp8_e4m3_add(x, y); break;
+            case 1:  result = fp8_e4m3_sub(x, y); break;
+            case 2:  result = fp8_e4m3_mul(x, y); break;
+            case 3:  result = fp8_e4m3_div(x, y); break;
+            case 4:  result = fp8_e4m3_sqrt(x); break;
+            default: result = fp8_e4m3_fma(x, y, z); break;
+        }
+    } else {
+        uint8_t x = (uint8_t)a, y = (uint8_t)b, z = (uint8_t)c;
+        switch(op) {
+            case 0:  result = fp8_e5m2_add(x, y); break;
+            case 1:  result = fp8_e5m2_sub(x, y); break;
+            case 2:  result = fp8_e5m2_mul(x, y); break;
+            case 3:  result = fp8_e5m2_div(x, y); break;
+            case 4:  result = fp8_e5m2_sqrt(x); break;
+            default: result = fp8_e5m2_fma(x, y, z); break;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Appelle l'opération fp16 op avec un mode d'arrondi explicite
+ *
+ * @param op 0 add, 1 sub, 2 mul, 3 div, 4 sqrt (de x), 5 inv (de y)
+ * @param x Premier opérande
+ * @param y Second opérande
+ * @param mode Mode d'arrondi
+ * @return Motif résultat
+ */
+static uint16_t arith_test_op(int op, uint16_t x, uint16_t y, hf_rounding_mode mode) {
+    uint16_t result;
+
+    switch(op) {
+        case 0:  result = hf_add_r(x, y, mode); break;
+        case 1:  result = hf_sub_r(x, y, mode); break;
+        case 2:  result = hf_mul_r(x, y, mode); break;
+        case 3:  result = hf_div_r(x, y, mode); break;
+        case 4:  result = hf_sqrt_r(x, mode); break;
+        default: result = hf_inv_r(y, mode); break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Teste le comptage des zéros de tête et les normalisations qui l'utilisent
+ *
+ * Lignes: hf_clz32 et hf_clz64 comparés à un comptage bit à bit (puissances
+ * de deux, voisins et valeurs pseudo-aléatoires), normalize_denormalized_mantissa
+ * sur les 1023 subnormaux (bit implicite au bit 15 et valeur conservée),
+ * hf_frexp et hf_ln sur les subnormaux positifs (mantisse dans [0.5, 1) et
+ * valeur reconstituée; erreur de ln au plus 4 ULP, seuil de hf_verify).
+ */
+void debug_clz(void) {
+    const char *headers[] = {"Test", "Cas", "Erreurs"};
+    float results[5][8];
+    uint32_t state = 0x2545F491U, i;
+    int row;
+
+    for(row = 0; row < 5; row++) {
+        results[row][0] = (float)row;
+        results[row][1] = 0.0f;
+        results[row][2] = 0.0f;
+    }
+
+    //hf_clz32 / hf_clz64: 2^k, 2^k - 1, 2^k + 1 et valeurs xorshift de toutes tailles
+    for(i = 0; i < 4096U; i++) {
+        uint32_t x32;
+        uint64_t x64;
+        int naive32 = 0, naive64 = 0;
+
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if(i < 96U) {
+            x32 = (1U << (i / 3U)) + (i % 3U == 0U ? 0U : i % 3U == 1U ? 0U - 1U : 1U);
+            x64 = ((uint64_t)1 << (i % 64U)) | ((uint64_t)state & (((uint64_t)1 << (i % 64U)) - 1U));
+        } else {
+            x32 = state >> (i % 32U);
+            x64 = (((uint64_t)state << 32) | (state * 2654435761U)) >> (i % 64U);
+        }
+        x32 |= x32 == 0;
+        x64 |= x64 == 0;
+        while(!(x32 & (0x80000000U >> naive32))) naive32++;
+        while(!(x64 & (0x8000000000000000ULL >> naive64))) naive64++;
+        results[0][1] += 1.0f;
+        results[0][2] += (float)(hf_clz32(x32) != naive32);
+        results[1][1] += 1.0f;
+        results[1][2] += (float)(hf_clz64(x64) != naive64);
+    }
+
+    //Subnormaux: normalisation, frexp et ln
+    for(i = 1; i <= HF_MASK_MANT; i++) {
+        half_float hf = decompose_half((uint16_t)i);
+        double value = ldexp((double)i, -24), ref = log(value), got, ulp;
+        float m;
+        int e = 0, exponent;
+
+        normalize_denormalized_mantissa(&hf);
+        results[2][1] += 1.0f;
+        results[2][2] += (float)(hf.mant < HF_MANT_NORM_MIN || hf.mant >= HF_MANT_NORM_MAX || ldexp((double)hf.mant, hf.exp - HF_MANT_SHIFT) != value);
+
+        m = half_to_float(hf_frexp((uint16_t)i, &e));
+        results[3][1] += 1.0f;
+        results[3][2] += (float)(m < 0.5f || m >= 1.0f || ldexp((double)m, e) != value);
+
+        got = (double)half_to_float(hf_ln((uint16_t)i));
+        frexp(ref, &exponent);
+        ulp = ldexp(1.0, exponent - 11);
+        results[4][1] += 1.0f;
+        results[4][2] += (float)(fabs(got - ref) / ulp > 4.0);
+    }
+
+    print_formatted_table("### CLZ hf_clz32/hf_clz64, normalisation, frexp et ln des subnormaux", headers, 3, results, 5);
+    printf("\n");
+}
+
+/**
+ * @brief Teste l'arithmétique complexe et la FFT
+ *
+ * Premier tableau: erreur maximale en norme (|résultat - référence double|
+ * en ULP du module de la référence) de hf_cmul, de sa forme composée
+ * (quatre hf_mul et deux hf_add), de hf_cabs, hf_carg et hf_cexp sur des
+ * paires pseudo-aléatoires de [-8, 8], échecs (partie NaN ou infinie alors
+ * que la référence est finie, ou erreur au-delà de la borne) et cas spéciaux
+ * de hf_cabs mal traités (infini avec NaN, NaN, zéros, triplets
+ * pythagoriciens exacts, sous-normaux et dépassement). Bornes: 1 ULP pour
+ * hf_cmul (une demi-ULP par partie), 2 pour la forme composée (six
+ * arrondis), une demi-ULP pour hf_cabs (correctement arrondi), 2 pour
+ * hf_carg (angle Q15 absolu au-delà de |im/re| = 2^-4, relatif en deçà) et
+ * 8 pour hf_cexp (hf_exp, hf_sincos puis un produit arrondi).
+ * Second tableau: pour n = 1 à 4096 (log2(n) pairs et impairs), écart
+ * maximal de hf_fft à une DFT double et de hf_ifft(hf_fft(x)) à x, rapportés
+ * au plus grand module, et cas spéciaux (infini réel en x0, NaN en x1,
+ * tailles refusées) mal traités.
+ */
+void debug_complex(void) {
+    static const size_t sizes[6] = {1, 2, 8, 64, 512, 4096};
+    static uint16_t data[2 * 4096], orig[2 * 4096];
+    static const uint16_t cabs_cases[][3] = {
+        {HF_INFINITY_POS, HF_NAN, HF_INFINITY_POS}, {HF_NAN, HF_INFINITY_NEG, HF_INFINITY_POS},
+        {HF_NAN, HF_ONE_POS, HF_NAN}, {HF_ZERO_NEG, 0xC200U, 0x4200U},             //|(-0, -3)| = 3
+        {0x4200U, 0xC400U, 0x4500U}, {0x0003U, 0x0004U, 0x0005U},                   //3-4-5, sous-normaux compris
+        {0x7BFFU, 0x7BFFU, HF_INFINITY_POS}, {0x7BFFU, 0x0001U, 0x7BFFU}};
+    static const float cx_bounds[5] = {1.0f, 2.0f, 0.5f, 2.0f, 8.0f};
+    const char *cx_headers[] = {"Fonction", "Paires", "Erreur max (ulp)", "Borne (ulp)", "Echecs", "Speciaux errones"};
+    const char *fft_headers[] = {"n", "Erreur FFT / max|X|", "Aller-retour / max|x|", "Speciaux errones"};
+    float cx_results[5][8], fft_results[6][8];
+    uint32_t state = 0x9E3779B9U, i;
+    int row;
+
+    for(row = 0; row < 5; row++) {
+        cx_results[row][0] = (float)row;
+        cx_results[row][1] = 0.0f;
+        cx_results[row][2] = 0.0f;
+        cx_results[row][3] = cx_bounds[row];
+        cx_results[row][4] = 0.0f;
+        cx_results[row][5] = 0.0f;
+    }
+    for(i = 0; i < sizeof(cabs_cases) / sizeof(cabs_cases[0]); i++) {
+        cx_results[2][5] += (float)(hf_cabs(hf_cmake(cabs_cases[i][0], cabs_cases[i][1])) != cabs_cases[i][2]);
+    }
+
+    for(i = 0; i < 20000U; i++) {
+        uint16_t parts[4];
+        double v[4], ref[5][2];
+        hf_complex a, b, r[5];
+        int k;
+
+        for(k = 0; k < 4; k++) {
+            state = state * 1664525U + 1013904223U;
+            parts[k] = float_to_half((float)((int)(state >> 16) - 32768) / 4096.0f);
+            v[k] = (double)half_to_float(parts[k]);
+        }
+        a = hf_cmake(parts[0], parts[1]);
+        b = hf_cmake(parts[2], parts[3]);
+
+        r[0] = hf_cmul(a, b);
+        r[1] = hf_cmake(hf_sub(hf_mul(a.re, b.re), hf_mul(a.im, b.im)), hf_add(hf_mul(a.re, b.im), hf_mul(a.im, b.re)));
+        r[2] = hf_cmake(hf_cabs(a), HF_ZERO_POS);
+        r[3] = hf_cmake(hf_carg(a), HF_ZERO_POS);
+        r[4] = hf_cexp(hf_cmake(hf_mul(a.re, 0x3400U), a.im));        //Partie réelle / 4: e^x fini
+
+        ref[0][0] = v[0] * v[2] - v[1] * v[3];
+        ref[0][1] = v[0] * v[3] + v[1] * v[2];
+        ref[1][0] = ref[0][0];
+        ref[1][1] = ref[0][1];
+        ref[2][0] = sqrt(v[0] * v[0] + v[1] * v[1]);
+        ref[2][1] = 0.0;
+        ref[3][0] = atan2(v[1], v[0]);
+        ref[3][1] = 0.0;
+        ref[4][0] = exp(v[0] / 4.0) * cos(v[1]);
+        ref[4][1] = exp(v[0] / 4.0) * sin(v[1]);
+
+        //Erreur en norme, en ULP du module de la référence (références toutes finies)
+        for(row = 0; row < 5; row++) {
+            double err, ulp;
+            int exponent;
+
+            cx_results[row][1] += 1.0f;
+            if((r[row].re & HF_INFINITY_POS) == HF_INFINITY_POS || (r[row].im & HF_INFINITY_POS) == HF_INFINITY_POS) {
+                //NaN ou infini: testé sur les bits (NaN non détectable sous -ffast-math)
+                cx_results[row][4] += 1.0f;
+            } else {
+                err = hypot((double)half_to_float(r[row].re) - ref[row][0], (double)half_to_float(r[row].im) - ref[row][1]);
+                frexp(hypot(ref[row][0], ref[row][1]), &exponent);
+                ulp = ldexp(1.0, (exponent - 11 < -24) ? -24 : exponent - 11);
+                if((float)(err / ulp) > cx_results[row][2]) cx_results[row][2] = (float)(err / ulp);
+                if((float)(err / ulp) > cx_bounds[row]) cx_results[row][4] += 1.0f;
+            }
+        }
+    }
+
+    for(row = 0; row < 6; row++) {
+        size_t n = sizes[row], j, k;
+        double max_err = 0.0, max_mod = 0.0, max_back = 0.0, max_x = 0.0;
+        int errors = 0;
+
+        for(j = 0; j < 2 * n; j++) {
+            state = state * 1664525U + 1013904223U;
+            orig[j] = float_to_half((float)((int)(state >> 16) - 32768) / 32768.0f);
+            data[j] = orig[j];
+        }
+
+        errors += !hf_fft(data, n);
+        for(k = 0; k < n; k++) {
+            double sum_re = 0.0, sum_im = 0.0;
+
+            for(j = 0; j < n; j++) {
+                double angle = -2.0 * M_PI * (double)((j * k) % n) / (double)n;
+                double xr = (double)half_to_float(orig[2 * j]), xi = (double)half_to_float(orig[2 * j + 1]);
+
+                sum_re += xr * cos(angle) - xi * sin(angle);
+                sum_im += xr * sin(angle) + xi * cos(angle);
+            }
+            if(hypot(sum_re, sum_im) > max_mod) max_mod = hypot(sum_re, sum_im);
+            if(hypot((double)half_to_float(data[2 * k]) - sum_re, (double)half_to_float(data[2 * k + 1]) - sum_im) > max_err) {
+                max_err = hypot((double)half_to_float(data[2 * k]) - sum_re, (double)half_to_float(data[2 * k + 1]) - sum_im);
+            }
+        }
+
+        errors += !hf_ifft(data, n);
+        for(j = 0; j < 2 * n; j++) {
+            double ref = (double)half_to_float(orig[j]);
+
+            if(fabs(ref) > max_x) max_x = fabs(ref);
+            if(fabs((double)half_to_float(data[j]) - ref) > max_back) max_back = fabs((double)half_to_float(data[j]) - ref);
+        }
+
+        //Infini réel en x0: toutes les parties réelles infinies, parties imaginaires finies
+        for(j = 0; j < 2 * n; j++) data[j] = orig[j];
+        data[0] = HF_INFINITY_POS;
+        hf_fft(data, n);
+        for(k = 0; k < n; k++) errors += data[2 * k] != HF_INFINITY_POS || (data[2 * k + 1] & HF_INFINITY_POS) == HF_INFINITY_POS;
+
+        //NaN: propagé à toutes les sorties (n > 1)
+        if(n > 1) {
+            for(j = 0; j < 2 * n; j++) data[j] = orig[j];
+            data[3] = HF_NAN;
+            hf_fft(data, n);
+            for(j = 0; j < 2 * n; j++) errors += (data[j] & ~HF_MASK_SIGN & 0xFFFFU) <= HF_INFINITY_POS;
+        }
+
+        fft_results[row][0] = (float)n;
+        fft_results[row][1] = (float)(max_mod > 0.0 ? max_err / max_mod : max_err);
+        fft_results[row][2] = (float)(max_x > 0.0 ? max_back / max_x : max_back);
+        fft_results[row][3] = (float)errors;
+    }
+    fft_results[5][3] += (float)(hf_fft(data, 0) + hf_fft(data, 3) + hf_ifft(data, 2 * HF_FFT_MAX));
+
+    print_formatted_table("### COMPLEXES hf_cmul (fusionné / composé), hf_cabs, hf_carg, hf_cexp", cx_headers, 6, cx_results, 5);
+    print_formatted_table("### FFT hf_fft / hf_ifft (radix-4, rotations Q15)", fft_headers, 4, fft_results, 6);
+    printf("\n");
+}
+
+/**
+ * @brief Vérifie les compteurs de profilage (HF_PROFILE)
+ *
+ * Relève les compteurs autour d'appels dont le décompte est connu: appels et
+ * classes d'opérandes, éléments des noyaux par lots, noyaux table/polynôme et
+ * histogramme de sin_table, remise à zéro, puis une entrée de chaque famille
+ * comptée par élément ou par voie (fast, activations, BLAS, SWAR, tri,
+ * FFT, bf16/FP8). Sans HF_PROFILE, tous les
+ * compteurs attendus sont nuls. Affiche ensuite le profil d'un petit mélange.
+ */
+void debug_profile(void) {
+    const char *headers[] = {"Test", "Attendu", "Mesure", "Erreurs"};
+    static uint16_t a[64], b[64], out[64];
+    float results[7][8];
+    hf_profile_counters snap;
+    hf_engine saved = hf_engine_selected();
+    uint64_t on = (uint64_t)hf_profile_enabled(), expected[7], measured[7], total;
+    int i, j, row;
+
+    printf("\n### PROFIL HF_PROFILE (%s)\n", on ? "actif" : "inactif");
+    for(i = 0; i < 64; i++) {
+        a[i] = float_to_half(1.0f + (float)i);
+        b[i] = float_to_half(0.5f + (float)i / 64.0f);
+    }
+
+    //Appels: 100 additions normales
+    hf_profile_reset();
+    for(i = 0; i < 100; i++) out[0] = hf_add(a[i & 63], b[i & 63]);
+    hf_profile_snapshot(&snap);
+    expected[0] = 100 * on;
+    measured[0] = snap.fn[HF_PROF_ADD][HF_PROF_CALLS];
+
+    //Classes: un NaN, deux zéros, trois sous-normaux (une seule classe par appel)
+    hf_profile_reset();
+    out[0] = hf_mul(HF_NAN, HF_ZERO_POS);
+    for(i = 0; i < 2; i++) out[0] = hf_mul(HF_ZERO_NEG, 1);
+    for(i = 0; i < 3; i++) out[0] = hf_mul(a[i], (uint16_t)(i + 1));
+    hf_profile_snapshot(&snap);
+    expected[1] = 123 * on;
+    measured[1] = snap.fn[HF_PROF_MUL][HF_PROF_SPECIAL] * 100 + snap.fn[HF_PROF_MUL][HF_PROF_ZERO] * 10 + snap.fn[HF_PROF_MUL][HF_PROF_SUBNORMAL];
+
+    //Noyaux par lots: éléments comptés, pas les appels
+    hf_profile_reset();
+    hf_add_n(a, b, out, 64);
+    hf_mul_n(a, b, out, 40);
+    hf_profile_snapshot(&snap);
+    expected[2] = 104 * on;
+    measured[2] = snap.fn[HF_PROF_ARITH_N][HF_PROF_CALLS];
+
+    //Noyau des tables: sin_table lue une fois par sinus, histogramme complet
+    hf_profile_reset();
+    hf_engine_select(HF_ENGINE_TABLE);
+    for(i = 0; i < 64; i++) out[0] = hf_sin(b[i]);
+    hf_profile_snapshot(&snap);
+    total = 0;
+    for(j = 0; j < HF_PROFILE_BUCKETS; j++) total += snap.table[HF_PROF_TABLE_SIN][j];
+    expected[3] = 64 * on;
+    measured[3] = snap.path[HF_PROF_KERNEL_TABLE] == total ? total : 0;
+
+    //Moteur polynomial: aucune lecture de table
+    hf_profile_reset();
+    hf_engine_select(HF_ENGINE_POLY);
+    for(i = 0; i < 64; i++) out[0] = hf_sin(b[i]);
+    hf_profile_snapshot(&snap);
+    total = 0;
+    for(j = 0; j < HF_PROFILE_BUCKETS; j++) total += snap.table[HF_PROF_TABLE_SIN][j];
+    expected[4] = 64 * on;
+    measured[4] = total == 0 ? snap.path[HF_PROF_KERNEL_POLY] : 0;
+    hf_engine_select(saved);
+
+    //Remise à zéro: tous les compteurs nuls
+    hf_profile_reset();
+    hf_profile_snapshot(&snap);
+    total = 0;
+    for(i = 0; i < HF_PROF_FN_COUNT; i++) for(j = 0; j < HF_PROF_CLASS_COUNT; j++) total += snap.fn[i][j];
+    for(i = 0; i < HF_PROF_PATH_COUNT; i++) total += snap.path[i];
+    for(i = 0; i < HF_PROF_TABLE_COUNT; i++) for(j = 0; j < HF_PROFILE_BUCKETS; j++) total += snap.table[i][j];
+    expected[5] = 0;
+    measured[5] = total;
+
+    //Familles: nombre de compteurs égaux au décompte attendu (appels, éléments ou voies)
+    hf_profile_reset();
+    for(i = 0; i < 3; i++) out[i] = hf_fast_exp(b[i]);
+    for(i = 0; i < 2; i++) out[i] = hf_gelu(b[i]);
+    out[0] = hf_dot(a, b, 64);
+    out[0] = hf4_lane(hf4_add(hf4_load(a), hf4_load(b)), 0);
+    memcpy(out, a, sizeof(out));
+    hf_sort(out, 64);
+    hf_fft(out, 4);
+    out[0] = bf16_mul(0x3F80, 0x4000);
+    bf16_from_half_n(a, out, 64);
+    hf_profile_snapshot(&snap);
+    expected[6] = 8 * on;
+    measured[6] = (uint64_t)(snap.fn[HF_PROF_FAST][HF_PROF_CALLS] == 3) + (snap.fn[HF_PROF_ACT][HF_PROF_CALLS] == 2) +
+                  (snap.fn[HF_PROF_BLAS][HF_PROF_CALLS] == 64) + (snap.fn[HF_PROF_SWAR][HF_PROF_CALLS] == 4) +
+                  (snap.fn[HF_PROF_SORT_N][HF_PROF_CALLS] == 64) + (snap.fn[HF_PROF_FFT][HF_PROF_CALLS] == 4) +
+                  (snap.fn[HF_PROF_FMT][HF_PROF_CALLS] == 1) + (snap.fn[HF_PROF_FMT_N][HF_PROF_CALLS] == 64);
+
+    for(row = 0; row < 7; row++) {
+        results[row][0] = (float)row;
+        results[row][1] = (float)expected[row];
+        results[row][2] = (float)measured[row];
+        results[row][3] = (float)(expected[row] != measured[row]);
+    }
+    print_formatted_table("### PROFIL appels, classes, lots, tables, polynomes, remise a zero, familles", headers, 4, results, 7);
+
+    //Profil d'un petit mélange de fonctions
+    hf_profile_reset();
+    for(i = 0; i < 64; i++) {
+        out[i] = hf_div(a[i], b[i]);
+        out[i] = hf_exp(hf_ln(out[i]));
+        out[i] = hf_atan2(out[i], a[i]);
+        out[i] = hf_sqrt(hf_tan(out[i]));
+    }
+    out[0] = hf_mul(0x7BFF, 0x7BFF);
+    out[0] = hf_div(1, 0x7BFF);
+    hf_profile_snapshot(&snap);
+    if(on) hf_profile_print(&snap);
+    hf_profile_reset();
+    printf("\n");
+}
+
+/**
+ * @brief Compare les noyaux par lots répartis sur plusieurs threads à leur exécution séquentielle
+ *
+ * Motifs pseudo-aléatoires (spéciaux compris), seuil abaissé pour que chaque
+ * lot soit découpé, dans deux modes d'arrondi: résultats et indicateurs
+ * d'exception doivent être identiques à ceux d'un seul thread. Sans
+ * HF_THREADS, les deux exécutions sont séquentielles.
+ */
+void debug_par(void) {
+    enum { PAR_N = 100000, PAR_KERNELS = 7 };
+    static uint16_t a[PAR_N], b[PAR_N], c[PAR_N], ref[PAR_N], got[PAR_N];
+    static int quo_ref[PAR_N], quo_got[PAR_N];
+    static float f[PAR_N];
+    static double d_ref[PAR_N], d_got[PAR_N];
+    static const hf_rounding_mode modes[2] = {HF_ROUND_NEAREST_EVEN, HF_ROUND_TOWARD_ZERO};
+    const char *headers[] = {"Noyau", "Elements", "Ecarts resultats", "Ecarts indicateurs"};
+    float results[PAR_KERNELS][8];
+    size_t threshold = hf_par_get_threshold();
+    uint32_t state = 0x1B873593U;
+    unsigned int threads, flags[2];
+    int i, k, m, pass;
+
+    for(i = 0; i < PAR_N; i++) {
+        union { float f; uint32_t u; } conv;
+
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        a[i] = (uint16_t)state;
+        b[i] = (uint16_t)(state >> 16);
+        c[i] = (uint16_t)(state * 2654435761U >> 16);
+        conv.u = state * 2246822519U;
+        f[i] = conv.f;
+    }
+
+    threads = hf_par_set_threads(4);
+    hf_par_set_threshold(4096);
+    printf("\n### PARALLELE hf_*_n (%u threads, seuil 4096)\n", threads);
+    for(k = 0; k < PAR_KERNELS; k++) {
+        results[k][0] = (float)k;
+        results[k][1] = (float)PAR_N;
+        results[k][2] = 0.0f;
+        results[k][3] = 0.0f;
+    }
+
+    for(m = 0; m < 2; m++) {
+        hf_set_rounding_mode(modes[m]);
+        for(k = 0; k < PAR_KERNELS; k++) {
+            //Passe 0: un seul thread (référence), passe 1: groupe de threads
+            for(pass = 0; pass < 2; pass++) {
+                uint16_t *out = pass ? got : ref;
+                int *quo = pass ? quo_got : quo_ref;
+                double *d = pass ? d_got : d_ref;
+
+                hf_par_set_threads(pass ? threads : 1);
+                hf_feclearexcept(HF_FE_ALL_EXCEPT);
+                switch(k) {
+                    case 0: hf_add_n(a, b, out, PAR_N); break;
+                    case 1: hf_div_n(a, b, out, PAR_N); break;
+                    case 2: hf_fma_n(a, b, c, out, PAR_N); break;
+                    case 3: hf_remquo_n(a, b, out, quo, PAR_N); break;
+                    case 4: hf_from_float_n(f, out, PAR_N); break;
+                    case 5: hf_to_double_n(a, d, PAR_N); break;
+                    default: hf_unary_n(HF_UNARY_EXP, a, out, PAR_N); break;
+                }
+                flags[pass] = hf_fetestexcept(HF_FE_ALL_EXCEPT);
+            }
+
+            for(i = 0; i < PAR_N; i++) {
+                if(k == 5) results[k][2] += (float)(memcmp(&d_ref[i], &d_got[i], sizeof(double)) != 0);
+                else results[k][2] += (float)(ref[i] != got[i] || (k == 3 && quo_ref[i] != quo_got[i]));
+            }
+            results[k][3] += (float)(flags[0] != flags[1]);
+        }
+    }
+
+    hf_set_rounding_mode(HF_ROUND_NEAREST_EVEN);
+    hf_feclearexcept(HF_FE_ALL_EXCEPT);
+    hf_par_set_threshold(threshold);
+    hf_par_set_threads(0);
+    print_formatted_table("### PARALLELE add, div, fma, remquo, from_float, to_double, unary exp (2 modes)", headers, 4, results, PAR_KERNELS);
+    printf("\n");
+}
@@ -20,6 +20,7 @@ void debug_ceil(void);
 void debug_floor(void);
 void debug_round(void);
 void debug_trunc(void);
+void debug_nearbyint(void);
 
 void debug_min(void);
 void debug_max(void);
@@ -36,8 +37,29 @@ void debug_inv(void);
 void debug_sqrt(void);
 void debug_rsqrt(void);
 void debug_fma(void);
+void debug_batch(void);
+void debug_conv(void);
+void debug_conv_int(void);
+void debug_lut(void);
+void debug_interp(void);
+void debug_sincos(void);
+void debug_blas(void);
+void debug_swar(void);
+void debug_sort(void);
+void debug_fenv(void);
+void debug_arith_modes(void);
+void debug_remainder(void);
 
 void debug_pow(void);
+void debug_powi(void);
+void debug_fmt(void);
+void debug_engine(void);
+void debug_fast(void);
+void debug_act(void);
+void debug_clz(void);
+void debug_complex(void);
+void debug_profile(void);
+void debug_par(void);
 void debug_exp(void);
 void debug_exp2(void);
 void debug_ln(void);
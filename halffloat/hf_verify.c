@@ -0,0 +1,576 @@
+/**
+ * @file hf_verify.c
+ * @brief Vérificateur exhaustif et parallèle de la précision des fonctions Half-Float
+ *
+ * Programme autonome (cible `make verify`) qui compare chaque fonction à une
+ * référence double précision arrondie au plus proche: les fonctions unaires
+ * sur les 65536 entrées, les fonctions binaires sur 65536 x 256 paires
+ * (ou les 2^32 paires avec -x). Le travail est réparti entre plusieurs threads
+ * par tranches du premier opérande.
+ *
+ * Pour chaque fonction: erreur maximale en ULP (entière et fractionnaire),
+ * histogramme des erreurs, nombre de cas spéciaux incorrects (NaN ou infini
+ * attendu non obtenu, ou inversement) et pires entrées. Le code de retour vaut
+ * 1 si une fonction dépasse son seuil de régression (tableau verify_entries):
+ * un changement de table ou d'algorithme motivé par la performance peut ainsi
+ * être accepté sans risque, en relevant explicitement le seuil concerné.
+ * Les défauts connus (stubs, implémentations temporaires) ont pour seuil leur
+ * comportement mesuré: ils sont listés à part et n'échouent que s'ils empirent.
+ *
+ * Usage: hf_verify [-f fonction] [-j threads] [-x] [-w pires] [-p] [-l]
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "hf_common.h"
+#include "hf_precalc.h"
+#include "hf_lib_arith.h"
+#include "hf_lib_exp.h"
+#include "hf_lib_trig.h"
+#include "hf_lib_fast.h"
+#include "hf_lib_act.h"
+
+#define VERIFY_CHUNK 256                    //Nombre de premiers opérandes par tranche de travail
+#define VERIFY_SAMPLE_B 256                 //Nombre de seconds opérandes en mode échantillonné
+#define VERIFY_WORST_MAX 16                 //Nombre maximal de pires entrées conservées
+#define VERIFY_MAX_THREADS 256              //Nombre maximal de threads
+#define VERIFY_HIST_BINS 9                  //Classes: 0, 1, 2, 3-4, 5-8, 9-16, 17-64, 65+, spécial
+#define VERIFY_SPECIAL_ERR 1e30             //Erreur attribuée aux cas spéciaux (classés en tête)
+
+//Fonction vérifiée et sa référence double précision
+typedef struct {
+    const char *name;
+    uint16_t (*f1)(uint16_t);
+    uint16_t (*f2)(uint16_t, uint16_t);
+    double (*r1)(double);
+    double (*r2)(double, double);
+    unsigned int max_ulp;                   //Seuil de régression: erreur maximale admise (ULP)
+    double max_special_rate;                //Seuil de régression: proportion maximale de cas spéciaux faux
+    const char *known;                      //Défaut connu couvert par les seuils (NULL si aucun)
+} verify_entry;
+
+//Cas mesuré (opérandes, résultat obtenu, résultat attendu)
+typedef struct {
+    uint16_t a, b;
+    uint16_t result, expected;
+    double err;
+} verify_case;
+
+//Statistiques d'une fonction (par thread puis fusionnées)
+typedef struct {
+    unsigned long long count;
+    unsigned long long special;
+    unsigned long long hist[VERIFY_HIST_BINS];
+    unsigned int max_ulp;
+    double max_err;
+    double sum_err;
+    verify_case worst[VERIFY_WORST_MAX];
+    int nworst;
+} verify_stats;
+
+//Travail d'un thread
+typedef struct {
+    const verify_entry *entry;
+    const uint16_t *b_values;
+    unsigned int b_count;
+    int worst_count;
+    verify_stats stats;
+} verify_job;
+
+//Déclaration des helpers statiques
+static double ref_inv(double x);
+static double ref_rsqrt(double x);
+static double ref_exp10(double x);
+static double ref_sigmoid(double x);
+static double ref_silu(double x);
+static double ref_gelu(double x);
+static double ref_add(double x, double y);
+static double ref_sub(double x, double y);
+static double ref_mul(double x, double y);
+static double ref_div(double x, double y);
+static void *verify_worker(void *arg);
+static void record_case(verify_stats *stats, int worst_count, uint16_t a, uint16_t b, uint16_t result, double ref);
+static void insert_worst(verify_stats *stats, int worst_count, const verify_case *item);
+static void merge_stats(verify_stats *dst, const verify_stats *src, int worst_count);
+static uint16_t double_to_half_rne(double x);
+static double half_quantum(double x);
+static int double_is_nan(double x);
+static int double_is_inf(double x);
+static int half_is_nan(uint16_t hf);
+static int name_matches(const char *name, const char *filter);
+static void print_usage(const char *prog);
+
+#define UNARY(fn, ref, ulp, rate)  {#fn, fn, NULL, ref, NULL, ulp, rate, NULL}
+#define BINARY(fn, ref, ulp, rate) {#fn, NULL, fn, NULL, ref, ulp, rate, NULL}
+#define UNARY_KNOWN(fn, ref, ulp, rate, why) {#fn, fn, NULL, ref, NULL, ulp, rate, why}
+
+//Fonctions vérifiées et seuils de régression (max ULP, taux de résultats spéciaux erronés):
+//valeurs mesurées avec les deux moteurs (tables et -p) plus une faible marge, aucune pour
+//les opérations correctement arrondies. Les défauts connus (UNARY_KNOWN) gardent leur
+//comportement mesuré comme seuil: leurs seuils devront être resserrés avec leur correction.
+static const verify_entry verify_entries[] = {
+    UNARY(hf_sqrt, sqrt, 0, 0.0),
+    UNARY(hf_rsqrt, ref_rsqrt, 1, 0.0),
+    UNARY_KNOWN(hf_cbrt, cbrt, 0, 0.969, "stub retournant NaN"),
+    UNARY(hf_inv, ref_inv, 0, 0.0),
+    UNARY(hf_exp, exp, 110, 0.0),
+    UNARY(hf_exp2, exp2, 110, 0.0),
+    UNARY(hf_exp10, ref_exp10, 110, 0.0),
+    UNARY_KNOWN(hf_expm1, expm1, 0, 0.969, "stub retournant NaN"),
+    UNARY(hf_ln, log, 5, 0.0),
+    UNARY(hf_log2, log2, 7, 0.0),
+    UNARY(hf_log10, log10, 6, 0.0),
+    UNARY_KNOWN(hf_log1p, log1p, 0, 0.719, "stub retournant NaN"),
+    UNARY(hf_sin, sin, 2900, 0.0),
+    UNARY(hf_cos, cos, 2700, 0.0),
+    UNARY(hf_tan, tan, 32768, 0.0),
+    UNARY(hf_asin, asin, 520, 0.0),
+    UNARY(hf_acos, acos, 620, 0.0),
+    UNARY(hf_atan, atan, 520, 0.0),
+    UNARY(hf_sinh, sinh, 520, 0.0),
+    UNARY(hf_cosh, cosh, 7, 0.0),
+    UNARY(hf_tanh, tanh, 520, 0.0),
+    UNARY_KNOWN(hf_asinh, asinh, 4200, 0.25, "debordement vers l'infini pour |x| >= 256"),
+    UNARY_KNOWN(hf_acosh, acosh, 10, 0.125, "debordement vers l'infini pour x >= 256"),
+    UNARY(hf_atanh, atanh, 3200, 0.0),
+    BINARY(hf_add, ref_add, 0, 0.0),
+    BINARY(hf_sub, ref_sub, 0, 0.0),
+    BINARY(hf_mul, ref_mul, 0, 0.0),
+    BINARY(hf_div, ref_div, 0, 0.0),
+    BINARY(hf_pow, pow, 15, 7.75e-07),
+    BINARY(hf_atan2, atan2, 2, 0.0),
+    BINARY(hf_hypot, hypot, 0, 0.0),
+    BINARY(hf_fmod, fmod, 0, 0.0),
+    BINARY(hf_remainder, remainder, 0, 0.0),
+    UNARY(hf_fast_exp, exp, 1, 0.0),
+    UNARY(hf_fast_ln, log, 1, 0.0),
+    UNARY(hf_fast_rsqrt, ref_rsqrt, 2, 0.0),
+    UNARY(hf_fast_tanh, tanh, 1, 0.0),
+    UNARY(hf_fast_sigmoid, ref_sigmoid, 1, 0.0),
+    UNARY(hf_fast_sin, sin, 1, 0.0),
+    UNARY(hf_fast_cos, cos, 1, 0.0),
+    BINARY(hf_fast_div, ref_div, 1, 0.0),
+    UNARY(hf_sigmoid, ref_sigmoid, 1, 0.0),
+    UNARY(hf_silu, ref_silu, 1, 0.0),
+    UNARY(hf_gelu, ref_gelu, 1, 0.0)
+};
+
+#define VERIFY_ENTRY_COUNT ((int)(sizeof(verify_entries) / sizeof(verify_entries[0])))
+
+//Valeurs exactes des 65536 motifs (remplies avant le lancement des threads)
+static double half_values[65536];
+
+//Répartition des tranches entre threads
+static pthread_mutex_t chunk_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int next_chunk = 0;
+
+/**
+ * @brief Point d'entrée du vérificateur
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Tableau des arguments
+ * @return 0 si toutes les fonctions respectent leurs seuils, 1 sinon
+ */
+int main(int argc, char *argv[]) {
+    static const char *bin_labels[VERIFY_HIST_BINS] = {"0", "1", "2", "3-4", "5-8", "9-16", "17-64", "65+", "spec"};
+    static verify_job jobs[VERIFY_MAX_THREADS];
+    static uint16_t sample_b[VERIFY_SAMPLE_B];
+    static uint16_t all_b[65536];
+    static const uint16_t special_b[] = {
+        HF_ZERO_POS, HF_ZERO_NEG, HF_ONE_POS, HF_ONE_NEG, HF_INFINITY_POS, HF_INFINITY_NEG, HF_NAN,
+        0x0001, 0x8001, 0x03FF, 0x0400, 0x7BFF, 0xFBFF, 0x3800, 0x4000, 0xC000
+    };
+    pthread_t threads[VERIFY_MAX_THREADS];
+    const char *filter = NULL;
+    int nthreads = 0, exhaustive = 0, worst_count = 5;
+    int failures = 0, checked = 0, known = 0, i, e, t;
+    uint32_t state = 0x9E3779B9U;
+
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-f") == 0 && i + 1 < argc) filter = argv[++i];
+        else if(strcmp(argv[i], "-j") == 0 && i + 1 < argc) nthreads = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-w") == 0 && i + 1 < argc) worst_count = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-x") == 0) exhaustive = 1;
+        else if(strcmp(argv[i], "-p") == 0) hf_engine_select(HF_ENGINE_POLY);
+        else if(strcmp(argv[i], "-l") == 0) {
+            for(e = 0; e < VERIFY_ENTRY_COUNT; e++) printf("%s\n", verify_entries[e].name);
+            return 0;
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+#ifdef _SC_NPROCESSORS_ONLN
+    if(nthreads <= 0) nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if(nthreads <= 0) nthreads = 1;
+    if(nthreads > VERIFY_MAX_THREADS) nthreads = VERIFY_MAX_THREADS;
+    if(worst_count < 0) worst_count = 0;
+    if(worst_count > VERIFY_WORST_MAX) worst_count = VERIFY_WORST_MAX;
+
+    hf_precalc_init();
+
+    //Seconds opérandes: valeurs spéciales puis motifs aléatoires (xorshift32), ou tous les motifs
+    for(i = 0; i < VERIFY_SAMPLE_B; i++) {
+        if(i < (int)(sizeof(special_b) / sizeof(special_b[0]))) {
+            sample_b[i] = special_b[i];
+        } else {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            sample_b[i] = (uint16_t)(state >> 16);
+        }
+    }
+    for(i = 0; i < 65536; i++) {
+        all_b[i] = (uint16_t)i;
+        half_values[i] = (double)half_to_float((uint16_t)i);
+    }
+
+    printf("Verification (%d threads, paires %s, moteur %s)\n\n", nthreads, exhaustive ? "exhaustives" : "echantillonnees",
+           hf_engine_name(hf_engine_selected()));
+    printf("%-14s %11s %8s %10s %10s", "fonction", "entrees", "max_ulp", "max_err", "moy_err");
+    for(i = 0; i < VERIFY_HIST_BINS; i++) printf(" %10s", bin_labels[i]);
+    printf("  statut\n");
+
+    for(e = 0; e < VERIFY_ENTRY_COUNT; e++) {
+        const verify_entry *entry = &verify_entries[e];
+        verify_stats total;
+        double special_rate;
+        int failed, started = 0;
+
+        if(filter != NULL && !name_matches(entry->name, filter)) continue;
+
+        next_chunk = 0;
+        for(t = 0; t < nthreads; t++) {
+            memset(&jobs[t], 0, sizeof(jobs[t]));
+            jobs[t].entry = entry;
+            jobs[t].b_values = exhaustive ? all_b : sample_b;
+            jobs[t].b_count = exhaustive ? 65536U : VERIFY_SAMPLE_B;
+            jobs[t].worst_count = worst_count;
+            if(pthread_create(&threads[t], NULL, verify_worker, &jobs[t]) != 0) break;
+            started++;
+        }
+        //Le thread principal traite les tranches restantes si aucun thread n'a pu démarrer
+        if(started == 0) {
+            verify_worker(&jobs[0]);
+        }
+        for(t = 0; t < started; t++) pthread_join(threads[t], NULL);
+
+        memset(&total, 0, sizeof(total));
+        for(t = 0; t < (started > 0 ? started : 1); t++) merge_stats(&total, &jobs[t].stats, worst_count);
+
+        special_rate = total.count > 0 ? (double)total.special / (double)total.count : 0.0;
+        failed = total.max_ulp > entry->max_ulp || special_rate > entry->max_special_rate * (1.0 + 1e-9);
+        failures += failed;
+        known += !failed && entry->known != NULL;
+        checked++;
+
+        printf("%-14s %11llu %8u %10.3f %10.4f", entry->name, total.count, total.max_ulp, total.max_err,
+               total.count > total.special ? total.sum_err / (double)(total.count - total.special) : 0.0);
+        for(i = 0; i < VERIFY_HIST_BINS; i++) printf(" %10llu", total.hist[i]);
+        printf("  %s\n", failed ? "ECHEC" : entry->known != NULL ? "connu" : "ok");
+
+        for(i = 0; i < total.nworst; i++) {
+            const verify_case *item = &total.worst[i];
+
+            if(item->err <= 0.5) break;
+            if(entry->f2 != NULL) {
+                printf("    %s(0x%04X, 0x%04X) = 0x%04X, attendu 0x%04X (%.9g, %.9g -> %.9g au lieu de %.9g)",
+                       entry->name, item->a, item->b, item->result, item->expected,
+                       (double)half_to_float(item->a), (double)half_to_float(item->b),
+                       (double)half_to_float(item->result), (double)half_to_float(item->expected));
+            } else {
+                printf("    %s(0x%04X) = 0x%04X, attendu 0x%04X (%.9g -> %.9g au lieu de %.9g)",
+                       entry->name, item->a, item->result, item->expected, (double)half_to_float(item->a),
+                       (double)half_to_float(item->result), (double)half_to_float(item->expected));
+            }
+            if(item->err >= VERIFY_SPECIAL_ERR) printf(" [special]\n");
+            else printf(" [%.3f ulp]\n", item->err);
+        }
+        if(total.max_ulp > entry->max_ulp) {
+            printf("    seuil depasse: max_ulp %u > %u\n", total.max_ulp, entry->max_ulp);
+        }
+        if(special_rate > entry->max_special_rate * (1.0 + 1e-9)) {
+            printf("    seuil depasse: cas speciaux %.3g > %.3g\n", special_rate, entry->max_special_rate);
+        }
+        fflush(stdout);
+    }
+
+    if(checked == 0) {
+        fprintf(stderr, "hf_verify: aucune fonction ne correspond à '%s' (voir -l)\n", filter != NULL ? filter : "");
+        return 1;
+    }
+
+    printf("\n%d fonction(s) verifiee(s), %d regression(s), %d defaut(s) connu(s)\n", checked, failures, known);
+    for(e = 0; e < VERIFY_ENTRY_COUNT && known > 0; e++) {
+        const verify_entry *entry = &verify_entries[e];
+
+        if(entry->known != NULL && (filter == NULL || name_matches(entry->name, filter))) {
+            printf("    %s: %s\n", entry->name, entry->known);
+        }
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * @brief Références double précision sans équivalent direct dans math.h
+ */
+static double ref_inv(double x) { return 1.0 / x; }
+static double ref_rsqrt(double x) { return 1.0 / sqrt(x); }
+static double ref_sigmoid(double x) { return 1.0 / (1.0 + exp(-x)); }
+static double ref_silu(double x) { return isinf(x) ? (x > 0 ? x : -0.0) : x / (1.0 + exp(-x)); }
+static double ref_gelu(double x) { return isinf(x) ? (x > 0 ? x : -0.0) : x / (1.0 + exp(-1.5957691216057308 * (x + 0.044715 * x * x * x))); }
+static double ref_exp10(double x) { return pow(10.0, x); }
+static double ref_add(double x, double y) { return x + y; }
+static double ref_sub(double x, double y) { return x - y; }
+static double ref_mul(double x, double y) { return x * y; }
+static double ref_div(double x, double y) { return x / y; }
+
+/**
+ * @brief Boucle d'un thread: traite les tranches de premiers opérandes jusqu'à épuisement
+ *
+ * @param arg Travail du thread (verify_job)
+ * @return NULL
+ */
+static void *verify_worker(void *arg) {
+    verify_job *job = (verify_job *)arg;
+    const verify_entry *entry = job->entry;
+
+    for(;;) {
+        unsigned int chunk, a, j;
+
+        pthread_mutex_lock(&chunk_lock);
+        chunk = next_chunk++;
+        pthread_mutex_unlock(&chunk_lock);
+        if(chunk >= 65536 / VERIFY_CHUNK) break;
+
+        for(a = chunk * VERIFY_CHUNK; a < (chunk + 1) * VERIFY_CHUNK; a++) {
+            double x = half_values[a];
+
+            if(entry->f1 != NULL) {
+                record_case(&job->stats, job->worst_count, (uint16_t)a, 0, entry->f1((uint16_t)a), entry->r1(x));
+                continue;
+            }
+            for(j = 0; j < job->b_count; j++) {
+                uint16_t b = job->b_values[j];
+                double y = half_values[b];
+
+                record_case(&job->stats, job->worst_count, (uint16_t)a, b, entry->f2((uint16_t)a, b), entry->r2(x, y));
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Compare un résultat à sa référence et met à jour les statistiques
+ *
+ * L'erreur entière est la distance en ULP entre le résultat et la référence
+ * arrondie au plus proche; l'erreur fractionnaire est mesurée par rapport à la
+ * référence exacte, en unités de l'ULP demi-précision de celle-ci.
+ */
+static void record_case(verify_stats *stats, int worst_count, uint16_t a, uint16_t b, uint16_t result, double ref) {
+    uint16_t expected = double_to_half_rne(ref);
+    int ref_nan = double_is_nan(ref);
+    int res_nan = half_is_nan(result);
+    verify_case item;
+    unsigned int ulp = 0;
+    double err = 0.0;
+    int bin;
+
+    stats->count++;
+
+    if(ref_nan != res_nan || (double_is_inf(ref) && result != expected) ||
+       ((result & 0x7FFF) == HF_INFINITY_POS && (expected & 0x7FFF) != HF_INFINITY_POS)) {
+        //Cas spécial incorrect (NaN ou infini mal traité, infini obtenu pour un résultat fini)
+        stats->special++;
+        stats->hist[VERIFY_HIST_BINS - 1]++;
+        err = VERIFY_SPECIAL_ERR;
+    } else if(!ref_nan) {
+        //Distance entre motifs ordonnés (les zéros signés sont confondus)
+        long ka = (result & HF_MASK_SIGN) ? 0x8000L - (result & 0x7FFF) : 0x8000L + result;
+        long kb = (expected & HF_MASK_SIGN) ? 0x8000L - (expected & 0x7FFF) : 0x8000L + expected;
+        double value = (result & 0x7FFF) == HF_INFINITY_POS ? ((result & HF_MASK_SIGN) ? -65536.0 : 65536.0)
+                                                            : half_values[result];
+
+        ulp = (unsigned int)(ka > kb ? ka - kb : kb - ka);
+        err = result == expected && (expected & 0x7FFF) == HF_INFINITY_POS ? 0.0 : fabs(value - ref) / half_quantum(ref);
+
+        if(ulp > stats->max_ulp) stats->max_ulp = ulp;
+        if(err > stats->max_err) stats->max_err = err;
+        stats->sum_err += err;
+
+        if(ulp <= 2) bin = (int)ulp;
+        else if(ulp <= 4) bin = 3;
+        else if(ulp <= 8) bin = 4;
+        else if(ulp <= 16) bin = 5;
+        else if(ulp <= 64) bin = 6;
+        else bin = 7;
+        stats->hist[bin]++;
+    } else {
+        stats->hist[0]++;
+    }
+
+    if(worst_count > 0 && err > 0.5) {
+        item.a = a;
+        item.b = b;
+        item.result = result;
+        item.expected = expected;
+        item.err = err;
+        insert_worst(stats, worst_count, &item);
+    }
+}
+
+/**
+ * @brief Insère un cas dans la liste des pires entrées (triée par erreur décroissante)
+ */
+static void insert_worst(verify_stats *stats, int worst_count, const verify_case *item) {
+    int pos;
+
+    if(stats->nworst == worst_count && item->err <= stats->worst[worst_count - 1].err) return;
+
+    pos = stats->nworst < worst_count ? stats->nworst++ : worst_count - 1;
+    while(pos > 0 && stats->worst[pos - 1].err < item->err) {
+        stats->worst[pos] = stats->worst[pos - 1];
+        pos--;
+    }
+    stats->worst[pos] = *item;
+}
+
+/**
+ * @brief Fusionne les statistiques d'un thread dans le total
+ */
+static void merge_stats(verify_stats *dst, const verify_stats *src, int worst_count) {
+    int i;
+
+    dst->count += src->count;
+    dst->special += src->special;
+    dst->sum_err += src->sum_err;
+    if(src->max_ulp > dst->max_ulp) dst->max_ulp = src->max_ulp;
+    if(src->max_err > dst->max_err) dst->max_err = src->max_err;
+    for(i = 0; i < VERIFY_HIST_BINS; i++) dst->hist[i] += src->hist[i];
+    for(i = 0; i < src->nworst; i++) insert_worst(dst, worst_count, &src->worst[i]);
+}
+
+/**
+ * @brief Conversion double vers demi-flottant correctement arrondie (au plus proche, pair)
+ *
+ * Calcul entier sur les bits du double (exact, indépendant du mode d'arrondi du FPU).
+ */
+static uint16_t double_to_half_rne(double x) {
+    uint64_t bits, mant, rem, half;
+    int exp, shift;
+    uint16_t sign, result;
+
+    memcpy(&bits, &x, sizeof(bits));
+    sign = (uint16_t)((bits >> 48) & HF_MASK_SIGN);
+    exp = (int)((bits >> 52) & 0x7FF) - 1023;
+    mant = bits & 0xFFFFFFFFFFFFFULL;
+
+    if(exp == 1024) {
+        //NaN ou infini
+        result = (uint16_t)(sign | (mant ? HF_NAN : HF_INFINITY_POS));
+    } else if(exp >= 16) {
+        result = (uint16_t)(sign | HF_INFINITY_POS);
+    } else {
+        if(exp >= -14) {
+            //Normalisé: 10 bits de mantisse conservés sur 52
+            shift = 42;
+            result = (uint16_t)(((exp + 15) << HF_MANT_BITS) | (int)(mant >> shift));
+        } else {
+            //Sous-normal (ou zéro): unités de 2^-24, bit implicite explicite
+            shift = 28 - exp;
+            if(shift > 60) {
+                //Moins de 2^-26: arrondi à zéro
+                shift = 60;
+                mant = 0;
+            } else {
+                mant |= 1ULL << 52;
+            }
+            result = (uint16_t)(mant >> shift);
+        }
+
+        //Arrondi au plus proche, égalité vers pair (la retenue propage sur l'exposant)
+        rem = mant & ((1ULL << shift) - 1);
+        half = 1ULL << (shift - 1);
+        if(rem > half || (rem == half && (result & 1))) result++;
+        result = (uint16_t)(result | sign);
+    }
+
+    return result;
+}
+
+/**
+ * @brief ULP demi-précision à la magnitude de x (2^-24 pour les sous-normaux, 32 au-delà de 65504)
+ */
+static double half_quantum(double x) {
+    uint64_t bits;
+    int exp;
+    double result;
+
+    memcpy(&bits, &x, sizeof(bits));
+    exp = (int)((bits >> 52) & 0x7FF) - 1023;
+    if(exp < -14) exp = -14;
+    if(exp > 15) exp = 15;
+
+    //2^(exp - 10) construit directement
+    bits = (uint64_t)(exp - 10 + 1023) << 52;
+    memcpy(&result, &bits, sizeof(result));
+
+    return result;
+}
+
+/**
+ * @brief Tests sur les bits du double (indépendants des options de compilation flottantes)
+ */
+static int double_is_nan(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x7FFFFFFFFFFFFFFFULL) > 0x7FF0000000000000ULL;
+}
+
+static int double_is_inf(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x7FFFFFFFFFFFFFFFULL) == 0x7FF0000000000000ULL;
+}
+
+static int half_is_nan(uint16_t hf) {
+    return (hf & 0x7FFF) > HF_INFINITY_POS;
+}
+
+/**
+ * @brief Vrai si le nom correspond au filtre (avec ou sans le préfixe "hf_")
+ */
+static int name_matches(const char *name, const char *filter) {
+    return strcmp(name, filter) == 0 || (strncmp(name, "hf_", 3) == 0 && strcmp(name + 3, filter) == 0);
+}
+
+/**
+ * @brief Affiche l'aide de la ligne de commande
+ */
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [-f fonction] [-j threads] [-x] [-w pires] [-p] [-l]\n"
+        "  -f  ne verifie que la fonction indiquee (ex: hf_pow ou pow)\n"
+        "  -j  nombre de threads (defaut: nombre de coeurs)\n"
+        "  -x  fonctions binaires sur les 2^32 paires (defaut: 65536 x %d)\n"
+        "  -w  nombre de pires entrees affichees (defaut: 5, max %d)\n"
+        "  -p  moteur polynomial des fonctions transcendantes (defaut: HF_ENGINE_DEFAULT)\n"
+        "  -l  liste les fonctions verifiables\n",
+        prog, VERIFY_SAMPLE_B, VERIFY_WORST_MAX);
+}
@@ -0,0 +1,471 @@
+/**
+ * @file hfconv.c
+ * @brief Convertisseur de fichiers binaires float32 <-> demi-flottants
+ *
+ * Programme autonome (cible `make hfconv`) qui convertit un fichier de
+ * float32 en demi-flottants (f2h) ou l'inverse (h2f) avec hf_from_float_n et
+ * hf_to_float_n. L'entrée est projetée en mémoire (mmap) et découpée en
+ * tranches de la taille du cache réparties dynamiquement entre plusieurs
+ * threads. La sortie est soit projetée en mémoire (-m, une seule passe
+ * parallèle), soit écrite en flux par lots en double tampon: les threads
+ * convertissent le lot suivant pendant que le thread principal écrit le lot
+ * courant.
+ *
+ * Options: inversion d'octets de l'entrée et/ou de la sortie (fichiers d'une
+ * autre boutisme), remplacement de tous les NaN par le NaN canonique
+ * (0x7E00 ou 0x7FC00000) et mode d'arrondi de la conversion, appliqué dans
+ * chaque thread par hf_set_rounding_mode.
+ *
+ * Usage: hfconv [-d f2h|h2f] [-r mode] [-b in|out|both] [-n] [-m] [-j threads] [-c elements] [-v] entree sortie
+ *
+ * @author Seg
+ * @date Novembre 2025
+ * @version 1.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hf_common.h"
+#include "hf_lib_conv.h"
+
+#define CONV_CHUNK 32768                    //Éléments par tranche (64 Ko de demi-flottants, 128 Ko de float)
+#define CONV_BATCH_CHUNKS 4                 //Tranches par thread et par lot en écriture par flux
+#define CONV_MAX_THREADS 256                //Nombre maximal de threads
+#define CONV_NAN_F32 0x7FC00000U            //NaN canonique float32
+
+//Sens de conversion
+typedef enum {
+    CONV_F2H = 0,                           //float32 -> demi-flottant
+    CONV_H2F = 1                            //demi-flottant -> float32
+} conv_direction;
+
+//Paramètres de la conversion
+typedef struct {
+    conv_direction direction;
+    hf_rounding_mode mode;
+    int swap_in;
+    int swap_out;
+    int canonical_nan;
+    size_t chunk;
+} conv_options;
+
+//Travail partagé par les threads (un lot d'éléments)
+typedef struct {
+    const conv_options *opt;
+    const unsigned char *in;                //Premier élément du lot en entrée
+    unsigned char *out;                     //Premier élément du lot en sortie
+    size_t count;                           //Nombre d'éléments du lot
+    size_t next;                            //Prochain élément à attribuer (protégé par lock)
+    pthread_mutex_t lock;
+} conv_job;
+
+//Déclaration des helpers statiques
+static void *conv_worker(void *arg);
+static void convert_chunk(const conv_options *opt, const unsigned char *in, unsigned char *out, size_t n, void *tmp);
+static size_t run_job(conv_job *job, int nthreads);
+static int write_all(int fd, const unsigned char *buf, size_t len);
+static int parse_mode(const char *name, hf_rounding_mode *mode);
+static double elapsed_seconds(const struct timespec *start);
+static void print_usage(const char *prog);
+
+/**
+ * @brief Point d'entrée du convertisseur
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Tableau des arguments
+ * @return 0 en cas de succès, 1 en cas d'erreur
+ */
+int main(int argc, char *argv[]) {
+    conv_options opt;
+    const char *in_path = NULL, *out_path = NULL;
+    const unsigned char *in_map = NULL;
+    unsigned char *out_map = NULL;
+    unsigned char *batch[2] = {NULL, NULL};
+    size_t in_size, out_size, n, in_elem, out_elem;
+    int nthreads = 0, use_mmap = 0, verbose = 0, status = 0, bad = 0, i;
+    int in_fd = -1, out_fd = -1;
+    struct timespec start;
+    struct stat st, out_st;
+
+    opt.direction = CONV_F2H;
+    opt.mode = HF_ROUND_NEAREST_EVEN;
+    opt.swap_in = 0;
+    opt.swap_out = 0;
+    opt.canonical_nan = 0;
+    opt.chunk = CONV_CHUNK;
+
+    for(i = 1; i < argc && !bad; i++) {
+        if(strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            i++;
+            if(strcmp(argv[i], "f2h") == 0) opt.direction = CONV_F2H;
+            else if(strcmp(argv[i], "h2f") == 0) opt.direction = CONV_H2F;
+            else bad = 1;
+        }
+        else if(strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            if(!parse_mode(argv[++i], &opt.mode)) {
+                fprintf(stderr, "hfconv: mode d'arrondi inconnu '%s'\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            i++;
+            opt.swap_in = strcmp(argv[i], "in") == 0 || strcmp(argv[i], "both") == 0;
+            opt.swap_out = strcmp(argv[i], "out") == 0 || strcmp(argv[i], "both") == 0;
+            if(!opt.swap_in && !opt.swap_out) {
+                fprintf(stderr, "hfconv: inversion d'octets inconnue '%s'\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "-j") == 0 && i + 1 < argc) nthreads = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc) opt.chunk = (size_t)strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "-n") == 0) opt.canonical_nan = 1;
+        else if(strcmp(argv[i], "-m") == 0) use_mmap = 1;
+        else if(strcmp(argv[i], "-v") == 0) verbose = 1;
+        else if(argv[i][0] != '-' && in_path == NULL) in_path = argv[i];
+        else if(argv[i][0] != '-' && out_path == NULL) out_path = argv[i];
+        else bad = 1;
+    }
+    if(bad || in_path == NULL || out_path == NULL) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+#ifdef _SC_NPROCESSORS_ONLN
+    if(nthreads <= 0) nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if(nthreads <= 0) nthreads = 1;
+    if(nthreads > CONV_MAX_THREADS) nthreads = CONV_MAX_THREADS;
+    if(opt.chunk == 0) opt.chunk = CONV_CHUNK;
+
+    in_elem = opt.direction == CONV_F2H ? sizeof(float) : sizeof(uint16_t);
+    out_elem = opt.direction == CONV_F2H ? sizeof(uint16_t) : sizeof(float);
+
+    //Projection de l'entrée
+    in_fd = open(in_path, O_RDONLY);
+    if(in_fd < 0 || fstat(in_fd, &st) != 0) {
+        fprintf(stderr, "hfconv: impossible d'ouvrir '%s': %s\n", in_path, strerror(errno));
+        if(in_fd >= 0) close(in_fd);
+        return 1;
+    }
+    in_size = (size_t)st.st_size;
+    if(in_size % in_elem != 0) {
+        fprintf(stderr, "hfconv: taille de '%s' (%lu octets) non multiple de %lu\n",
+                in_path, (unsigned long)in_size, (unsigned long)in_elem);
+        close(in_fd);
+        return 1;
+    }
+    n = in_size / in_elem;
+    out_size = n * out_elem;
+    if(n > 0) {
+        void *p = mmap(NULL, in_size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+
+        if(p == MAP_FAILED) {
+            fprintf(stderr, "hfconv: mmap de '%s' impossible: %s\n", in_path, strerror(errno));
+            close(in_fd);
+            return 1;
+        }
+        in_map = (const unsigned char *)p;
+        posix_madvise(p, in_size, POSIX_MADV_SEQUENTIAL);
+    }
+
+    //Ouverture sans O_TRUNC: vider la sortie avant de vérifier qu'elle n'est
+    //pas l'entrée détruirait le fichier encore projeté
+    out_fd = open(out_path, O_RDWR | O_CREAT, 0666);
+    if(out_fd < 0 || fstat(out_fd, &out_st) != 0) {
+        fprintf(stderr, "hfconv: impossible de créer '%s': %s\n", out_path, strerror(errno));
+        status = 1;
+    } else if(out_st.st_dev == st.st_dev && out_st.st_ino == st.st_ino) {
+        fprintf(stderr, "hfconv: '%s' et '%s' désignent le même fichier\n", in_path, out_path);
+        status = 1;
+    } else if(ftruncate(out_fd, 0) != 0) {
+        fprintf(stderr, "hfconv: impossible de vider '%s': %s\n", out_path, strerror(errno));
+        status = 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    if(status == 0 && n > 0 && use_mmap) {
+        //Sortie projetée: une seule passe parallèle sur tout le fichier
+        void *p = MAP_FAILED;
+        conv_job job;
+
+        if(ftruncate(out_fd, (off_t)out_size) == 0) {
+            p = mmap(NULL, out_size, PROT_READ | PROT_WRITE, MAP_SHARED, out_fd, 0);
+        }
+        if(p == MAP_FAILED) {
+            fprintf(stderr, "hfconv: mmap de '%s' impossible: %s\n", out_path, strerror(errno));
+            status = 1;
+        } else {
+            out_map = (unsigned char *)p;
+            job.opt = &opt;
+            job.in = in_map;
+            job.out = out_map;
+            job.count = n;
+            if(run_job(&job, nthreads) != n) status = 1;
+            if(msync(out_map, out_size, MS_SYNC) != 0) status = 1;
+            munmap(out_map, out_size);
+        }
+    } else if(status == 0 && n > 0) {
+        //Sortie en flux: conversion du lot k+1 pendant l'écriture du lot k
+        size_t batch_elems = opt.chunk * CONV_BATCH_CHUNKS * (size_t)nthreads;
+        size_t pos = 0, pending = 0;
+        int cur = 0;
+
+        if(batch_elems > n) batch_elems = n;
+        batch[0] = (unsigned char *)malloc(batch_elems * out_elem);
+        batch[1] = (unsigned char *)malloc(batch_elems * out_elem);
+        if(batch[0] == NULL || batch[1] == NULL) {
+            fprintf(stderr, "hfconv: mémoire insuffisante\n");
+            status = 1;
+        }
+        while(status == 0 && (pos < n || pending > 0)) {
+            conv_job job;
+            pthread_t threads[CONV_MAX_THREADS];
+            size_t count = n - pos < batch_elems ? n - pos : batch_elems;
+            int t, started = 0;
+
+            job.opt = &opt;
+            job.in = in_map + pos * in_elem;
+            job.out = batch[cur];
+            job.count = count;
+            job.next = 0;
+            pthread_mutex_init(&job.lock, NULL);
+            for(t = 0; t < nthreads && count > 0; t++) {
+                if(pthread_create(&threads[t], NULL, conv_worker, &job) != 0) break;
+                started++;
+            }
+            if(pending > 0 && !write_all(out_fd, batch[cur ^ 1], pending * out_elem)) status = 1;
+            //Le thread principal convertit le lot si aucun thread n'a pu démarrer
+            if(started == 0 && count > 0) conv_worker(&job);
+            for(t = 0; t < started; t++) pthread_join(threads[t], NULL);
+            pthread_mutex_destroy(&job.lock);
+            if(job.next != count) status = 1;
+
+            pos += count;
+            pending = count;
+            cur ^= 1;
+        }
+        if(status != 0) fprintf(stderr, "hfconv: écriture de '%s' impossible: %s\n", out_path, strerror(errno));
+        free(batch[0]);
+        free(batch[1]);
+    }
+
+    if(status == 0 && verbose) {
+        double seconds = elapsed_seconds(&start);
+
+        fprintf(stderr, "hfconv: %lu elements %s (%s, %d threads) en %.3f ms (%.1f Melem/s, %.1f Mo/s lus)\n",
+                (unsigned long)n, opt.direction == CONV_F2H ? "f2h" : "h2f", hf_simd_name(hf_simd_selected()),
+                nthreads, seconds * 1e3,
+                seconds > 0.0 ? (double)n / seconds * 1e-6 : 0.0,
+                seconds > 0.0 ? (double)in_size / seconds * 1e-6 : 0.0);
+    }
+
+    if(in_map != NULL) munmap((void *)in_map, in_size);
+    close(in_fd);
+    if(out_fd >= 0 && close(out_fd) != 0) status = 1;
+
+    return status;
+}
+
+/**
+ * @brief Boucle d'un thread: convertit les tranches d'un lot jusqu'à épuisement
+ *
+ * Le mode d'arrondi étant propre à chaque thread, il est appliqué ici.
+ *
+ * @param arg Travail partagé (conv_job)
+ * @return NULL
+ */
+static void *conv_worker(void *arg) {
+    conv_job *job = (conv_job *)arg;
+    const conv_options *opt = job->opt;
+    size_t in_elem = opt->direction == CONV_F2H ? sizeof(float) : sizeof(uint16_t);
+    size_t out_elem = opt->direction == CONV_F2H ? sizeof(uint16_t) : sizeof(float);
+    void *tmp = NULL;
+
+    hf_set_rounding_mode(opt->mode);
+    if(opt->swap_in) {
+        tmp = malloc(opt->chunk * in_elem);
+        if(tmp == NULL) return NULL;
+    }
+
+    for(;;) {
+        size_t first, count;
+
+        pthread_mutex_lock(&job->lock);
+        first = job->next;
+        count = job->count - first < opt->chunk ? job->count - first : opt->chunk;
+        job->next += count;
+        pthread_mutex_unlock(&job->lock);
+        if(count == 0) break;
+
+        convert_chunk(opt, job->in + first * in_elem, job->out + first * out_elem, count, tmp);
+    }
+
+    free(tmp);
+
+    return NULL;
+}
+
+/**
+ * @brief Exécute un lot sur nthreads threads (ou sur le thread courant)
+ *
+ * @param job Lot à convertir (in, out, count et opt remplis)
+ * @param nthreads Nombre de threads
+ * @return Nombre d'éléments attribués (count en cas de succès)
+ */
+static size_t run_job(conv_job *job, int nthreads) {
+    pthread_t threads[CONV_MAX_THREADS];
+    int t, started = 0;
+
+    job->next = 0;
+    pthread_mutex_init(&job->lock, NULL);
+    for(t = 0; t < nthreads; t++) {
+        if(pthread_create(&threads[t], NULL, conv_worker, job) != 0) break;
+        started++;
+    }
+    if(started == 0) conv_worker(job);
+    for(t = 0; t < started; t++) pthread_join(threads[t], NULL);
+    pthread_mutex_destroy(&job->lock);
+
+    return job->next;
+}
+
+/**
+ * @brief Convertit une tranche: inversion d'entrée, conversion, NaN canonique, inversion de sortie
+ *
+ * Les accès aux mots passent par memcpy (pas d'hypothèse d'alignement ni d'aliasing
+ * sur les tampons projetés).
+ *
+ * @param opt Paramètres de la conversion
+ * @param in Éléments d'entrée
+ * @param out Éléments de sortie
+ * @param n Nombre d'éléments
+ * @param tmp Tampon de n éléments d'entrée (requis si opt->swap_in)
+ */
+static void convert_chunk(const conv_options *opt, const unsigned char *in, unsigned char *out, size_t n, void *tmp) {
+    size_t i;
+
+    if(opt->direction == CONV_F2H) {
+        uint16_t *dst = (uint16_t *)(void *)out;
+        const float *src = (const float *)(const void *)in;
+
+        if(opt->swap_in) {
+            uint32_t *w = (uint32_t *)tmp;
+
+            memcpy(w, in, n * sizeof(uint32_t));
+            for(i = 0; i < n; i++) {
+                w[i] = (w[i] >> 24) | ((w[i] >> 8) & 0xFF00U) | ((w[i] << 8) & 0xFF0000U) | (w[i] << 24);
+            }
+            src = (const float *)tmp;
+        }
+        hf_from_float_n(src, dst, n);
+        for(i = 0; i < n; i++) {
+            uint16_t h = dst[i];
+
+            if(opt->canonical_nan && (h & 0x7FFF) > HF_INFINITY_POS) h = HF_NAN;
+            if(opt->swap_out) h = (uint16_t)((h >> 8) | (h << 8));
+            dst[i] = h;
+        }
+    } else {
+        uint32_t *dst = (uint32_t *)(void *)out;
+        const uint16_t *src = (const uint16_t *)(const void *)in;
+
+        if(opt->swap_in) {
+            uint16_t *w = (uint16_t *)tmp;
+
+            for(i = 0; i < n; i++) w[i] = (uint16_t)((src[i] >> 8) | (src[i] << 8));
+            src = w;
+        }
+        hf_to_float_n(src, (float *)(void *)dst, n);
+        for(i = 0; i < n; i++) {
+            uint32_t w;
+
+            memcpy(&w, &dst[i], sizeof(w));
+            if(opt->canonical_nan && (w & 0x7FFFFFFFU) > 0x7F800000U) w = CONV_NAN_F32;
+            if(opt->swap_out) w = (w >> 24) | ((w >> 8) & 0xFF00U) | ((w << 8) & 0xFF0000U) | (w << 24);
+            memcpy(&dst[i], &w, sizeof(w));
+        }
+    }
+}
+
+/**
+ * @brief Écrit len octets (reprend après les écritures partielles et EINTR)
+ *
+ * @return 1 en cas de succès, 0 sinon
+ */
+static int write_all(int fd, const unsigned char *buf, size_t len) {
+    int ok = 1;
+
+    while(ok && len > 0) {
+        ssize_t w = write(fd, buf, len);
+
+        if(w < 0 && errno == EINTR) continue;
+        if(w <= 0) ok = 0;
+        else {
+            buf += w;
+            len -= (size_t)w;
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Traduit un nom de mode d'arrondi (even, away, zero, up, down)
+ *
+ * @return 1 si le nom est reconnu, 0 sinon
+ */
+static int parse_mode(const char *name, hf_rounding_mode *mode) {
+    static const char *names[] = {"even", "away", "zero", "up", "down"};
+    static const hf_rounding_mode modes[] = {
+        HF_ROUND_NEAREST_EVEN, HF_ROUND_NEAREST_UP, HF_ROUND_TOWARD_ZERO, HF_ROUND_TOWARD_POS_INF, HF_ROUND_TOWARD_NEG_INF
+    };
+    int found = 0, i;
+
+    for(i = 0; i < 5 && !found; i++) {
+        if(strcmp(name, names[i]) == 0) {
+            *mode = modes[i];
+            found = 1;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Secondes écoulées depuis start (horloge monotone)
+ */
+static double elapsed_seconds(const struct timespec *start) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)(now.tv_sec - start->tv_sec) + (double)(now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+/**
+ * @brief Affiche l'aide de la ligne de commande
+ */
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [options] entree sortie\n"
+        "  -d f2h|h2f           sens: float32 -> demi-flottant (defaut) ou inverse\n"
+        "  -r even|away|zero|up|down  mode d'arrondi (hf_set_rounding_mode, defaut: even)\n"
+        "  -b in|out|both       inverse l'ordre des octets de l'entree et/ou de la sortie\n"
+        "  -n                   remplace les NaN par le NaN canonique (0x7E00 / 0x7FC00000)\n"
+        "  -m                   sortie projetee en memoire (mmap) au lieu d'une ecriture en flux\n"
+        "  -j threads           nombre de threads (defaut: nombre de coeurs)\n"
+        "  -c elements          elements par tranche (defaut: %d)\n"
+        "  -v                   affiche le debit sur stderr\n",
+        prog, CONV_CHUNK);
+}
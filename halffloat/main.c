@@ -32,13 +32,8 @@ int main(int argc, char *argv[]) {
     system("chcp 65001 >nul 2>&1");
 #endif
     
-    //Initialisation des tables nécessaires
-    fill_sin_table();
-    fill_asin_table();
-    fill_atan_table();
-    fill_exp_table();
-    fill_ln_table();
-    fill_tan_tables_dual();  //Nouvelle fonction dual-table optimisée à 75°
+    //Initialisation des tables nécessaires (sans effet avec les tables constantes générées)
+    hf_precalc_init();
 
     //Message d'introduction
     printf("===== Half-Float Library Test Suite =====\n\n");
@@ -49,6 +44,7 @@ int main(int argc, char *argv[]) {
     debug_floor();
     debug_round();
     debug_trunc();
+    debug_nearbyint();
 
     debug_min();
     debug_max();
@@ -66,8 +62,29 @@ int main(int argc, char *argv[]) {
     debug_sqrt();
     debug_rsqrt();
     debug_fma();
+    debug_batch();
+    debug_conv();
+    debug_conv_int();
+    debug_lut();
+    debug_interp();
+    debug_sincos();
+    debug_blas();
+    debug_swar();
+    debug_sort();
+    debug_fenv();
+    debug_arith_modes();
+    debug_remainder();
 
     debug_pow();
+    debug_powi();
+    debug_fmt();
+    debug_engine();
+    debug_fast();
+    debug_act();
+    debug_clz();
+    debug_complex();
+    debug_profile();
+    debug_par();
     debug_exp();
     debug_exp2();
     debug_exp10();